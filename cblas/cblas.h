@@ -32,3 +32,19 @@
 #define TPUP(N,i,j) (TRCOUNT(N,(i)-1)+(j)-(i))
 #define TPLO(N,i,j) (((i)*((i)+1))/2 + (j))
 
+
+/* Blocking parameters for the packed GEMM kernels in source_gemm_r.h
+   and source_gemm_c.h.  MR x NR is the register tile of the
+   micro-kernel (written out explicitly as 4 x 4 for real and 2 x 2
+   for complex types), MC x KC is the packed block of op(A) kept in
+   L2 cache and KC x NC the packed block of op(B).  Products with
+   fewer than GEMM_BLOCK_MIN multiply-adds use the unblocked loops. */
+
+#define GEMM_MR 4
+#define GEMM_NR 4
+#define GEMM_MR_C 2
+#define GEMM_NR_C 2
+#define GEMM_MC 128
+#define GEMM_KC 256
+#define GEMM_NC 2048
+#define GEMM_BLOCK_MIN 32768.0
@@ -1,12 +1,15 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels.h"
 
 void
 cblas_daxpy (const int N, const double alpha, const double *X, const int incX,
              double *Y, const int incY)
 {
 #define BASE double
+#define KERNEL cblas_kernel_d ()
 #include "source_axpy_r.h"
 #undef BASE
+#undef KERNEL
 }
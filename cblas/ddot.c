@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels.h"
 
 double
 cblas_ddot (const int N, const double *X, const int incX, const double *Y,
@@ -9,8 +10,10 @@ cblas_ddot (const int N, const double *X, const int incX, const double *Y,
 #define INIT_VAL  0.0
 #define ACC_TYPE  double
 #define BASE double
+#define KERNEL cblas_kernel_d ()
 #include "source_dot_r.h"
 #undef ACC_TYPE
 #undef BASE
+#undef KERNEL
 #undef INIT_VAL
 }
@@ -1,6 +1,8 @@
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "thread.h"
 #include "error_cblas_l3.h"
 
 void
@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels.h"
 #include "error_cblas_l2.h"
 
 void
@@ -10,6 +11,8 @@ cblas_dgemv (const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA,
              const double beta, double *Y, const int incY)
 {
 #define BASE double
+#define KERNEL cblas_kernel_d ()
 #include "source_gemv_r.h"
 #undef BASE
+#undef KERNEL
 }
@@ -1,11 +1,14 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels.h"
 
 double
 cblas_dnrm2 (const int N, const double *X, const int incX)
 {
 #define BASE double
+#define KERNEL cblas_kernel_d ()
 #include "source_nrm2_r.h"
 #undef BASE
+#undef KERNEL
 }
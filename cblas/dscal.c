@@ -1,11 +1,14 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels.h"
 
 void
 cblas_dscal (const int N, const double alpha, double *X, const int incX)
 {
 #define BASE double
+#define KERNEL cblas_kernel_d ()
 #include "source_scal_r.h"
 #undef BASE
+#undef KERNEL
 }
@@ -601,6 +601,13 @@ void cblas_zher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
 
 void cblas_xerbla(int p, const char *rout, const char *form, ...);
 
+/*
+ * GSL extensions: number of threads used by the level 3 routines when
+ * the library is built with OpenMP support
+ */
+void gsl_cblas_set_num_threads(const int n);
+int gsl_cblas_get_num_threads(void);
+
 __END_DECLS
 
 #endif /* __GSL_CBLAS_H__ */
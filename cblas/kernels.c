@@ -0,0 +1,246 @@
+/* cblas/kernels.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <gsl/gsl_math.h>
+#include "kernels.h"
+
+/* vector kernels need the target attribute and __builtin_cpu_supports */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    !defined(GSL_CBLAS_NO_SIMD)
+#define HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+/* range of max|x(i)| for which nrm2 may sum squares without scaling */
+#define NRM2_TINY 1.0010415475915505e-146 /* 2^-485 */
+#define NRM2_HUGE 9.989595361011175e+145 /* 2^485 */
+
+/* generic kernels, plain loops */
+
+static void
+axpy_generic (const int N, const double alpha, const double *X, double *Y)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+static double
+dot_generic (const int N, const double *X, const double *Y)
+{
+  double r = 0.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+static double
+nrm2_generic (const int N, const double *X)
+{
+  double scale = 0.0;
+  double ssq = 1.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    {
+      const double x = X[i];
+
+      if (x != 0.0)
+        {
+          const double ax = fabs (x);
+
+          if (scale < ax)
+            {
+              ssq = 1.0 + ssq * (scale / ax) * (scale / ax);
+              scale = ax;
+            }
+          else
+            {
+              ssq += (ax / scale) * (ax / scale);
+            }
+        }
+    }
+
+  return scale * sqrt (ssq);
+}
+
+static void
+scal_generic (const int N, const double alpha, double *X)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    X[i] *= alpha;
+}
+
+static void
+gemv_n_generic (const int M, const int N, const double alpha,
+                const double *A, const int lda, const double *X, double *Y)
+{
+  int i;
+
+  for (i = 0; i < M; i++)
+    Y[i] += alpha * dot_generic (N, A + lda * i, X);
+}
+
+static void
+gemv_t_generic (const int M, const int N, const double alpha,
+                const double *A, const int lda, const double *X, double *Y)
+{
+  int i;
+
+  for (i = 0; i < M; i++)
+    {
+      const double temp = alpha * X[i];
+
+      if (temp != 0.0)
+        axpy_generic (N, temp, A + lda * i, Y);
+    }
+}
+
+static const cblas_kernel_type kernel_generic = {
+  "generic",
+  axpy_generic,
+  dot_generic,
+  nrm2_generic,
+  scal_generic,
+  gemv_n_generic,
+  gemv_t_generic
+};
+
+#ifdef HAVE_X86_KERNELS
+
+/* AVX2 + FMA, 4 doubles per vector */
+
+#define VEC __m256d
+#define VLEN 4
+#define LOADU _mm256_loadu_pd
+#define STOREU _mm256_storeu_pd
+#define SET1 _mm256_set1_pd
+#define SETZERO _mm256_setzero_pd
+#define ADD _mm256_add_pd
+#define MUL _mm256_mul_pd
+#define FMADD _mm256_fmadd_pd
+#define MAXV _mm256_max_pd
+#define ABSV(x) _mm256_andnot_pd (_mm256_set1_pd (-0.0), (x))
+#define TARGET __attribute__ ((target ("avx2,fma")))
+#define FUNCTION(name) name ## _avx2
+#define KERNEL_NAME "avx2"
+#include "source_kernel_d.h"
+#undef VEC
+#undef VLEN
+#undef LOADU
+#undef STOREU
+#undef SET1
+#undef SETZERO
+#undef ADD
+#undef MUL
+#undef FMADD
+#undef MAXV
+#undef ABSV
+#undef TARGET
+#undef FUNCTION
+#undef KERNEL_NAME
+
+/* AVX-512F, 8 doubles per vector */
+
+#define VEC __m512d
+#define VLEN 8
+#define LOADU _mm512_loadu_pd
+#define STOREU _mm512_storeu_pd
+#define SET1 _mm512_set1_pd
+#define SETZERO _mm512_setzero_pd
+#define ADD _mm512_add_pd
+#define MUL _mm512_mul_pd
+#define FMADD _mm512_fmadd_pd
+#define MAXV _mm512_max_pd
+#define ABSV(x) _mm512_castsi512_pd (_mm512_and_epi64 (_mm512_castpd_si512 (x), \
+                                     _mm512_set1_epi64 (0x7fffffffffffffffLL)))
+#define TARGET __attribute__ ((target ("avx512f")))
+#define FUNCTION(name) name ## _avx512
+#define KERNEL_NAME "avx512"
+#include "source_kernel_d.h"
+#undef VEC
+#undef VLEN
+#undef LOADU
+#undef STOREU
+#undef SET1
+#undef SETZERO
+#undef ADD
+#undef MUL
+#undef FMADD
+#undef MAXV
+#undef ABSV
+#undef TARGET
+#undef FUNCTION
+#undef KERNEL_NAME
+
+#endif /* HAVE_X86_KERNELS */
+
+static const cblas_kernel_type *
+kernel_select (void)
+{
+  const char *env = getenv ("GSL_CBLAS_KERNEL");
+  int allow_avx512 = 1, allow_avx2 = 1;
+
+  if (env != NULL)
+    {
+      if (strcmp (env, "generic") == 0)
+        allow_avx512 = allow_avx2 = 0;
+      else if (strcmp (env, "avx2") == 0)
+        allow_avx512 = 0;
+    }
+
+#ifdef HAVE_X86_KERNELS
+  __builtin_cpu_init ();
+
+  if (allow_avx512 && __builtin_cpu_supports ("avx512f"))
+    return &kernel_avx512;
+
+  if (allow_avx2 && __builtin_cpu_supports ("avx2")
+      && __builtin_cpu_supports ("fma"))
+    return &kernel_avx2;
+#else
+  (void) allow_avx512;
+  (void) allow_avx2;
+#endif
+
+  return &kernel_generic;
+}
+
+const cblas_kernel_type *
+cblas_kernel_d (void)
+{
+  /* the selection is idempotent, so a race between threads calling
+     this for the first time only repeats the work */
+  static const cblas_kernel_type *kernel = NULL;
+
+  if (kernel == NULL)
+    kernel = kernel_select ();
+
+  return kernel;
+}
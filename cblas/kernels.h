@@ -0,0 +1,51 @@
+/* cblas/kernels.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_KERNELS_H__
+#define __CBLAS_KERNELS_H__
+
+/* Unit-stride kernels for the double precision level 1 and level 2
+   routines.  The table is chosen once, at the first call, according
+   to the instruction sets supported by the processor.  Setting the
+   environment variable GSL_CBLAS_KERNEL to "generic", "avx2" or
+   "avx512" restricts the choice (unsupported values are ignored).
+
+   The level 2 kernels use the row-major view of the matrix:
+
+     gemv_n:  y(i) += alpha * sum_j A(i,j) x(j),   i < M, j < N
+     gemv_t:  y(j) += alpha * sum_i A(i,j) x(i),   i < M, j < N
+
+   where A(i,j) = A[lda * i + j]. */
+
+typedef struct
+{
+  const char *name;
+  void (*axpy) (const int N, const double alpha, const double *X, double *Y);
+  double (*dot) (const int N, const double *X, const double *Y);
+  double (*nrm2) (const int N, const double *X);
+  void (*scal) (const int N, const double alpha, double *X);
+  void (*gemv_n) (const int M, const int N, const double alpha,
+                  const double *A, const int lda, const double *X, double *Y);
+  void (*gemv_t) (const int M, const int N, const double alpha,
+                  const double *A, const int lda, const double *X, double *Y);
+} cblas_kernel_type;
+
+const cblas_kernel_type *cblas_kernel_d (void);
+
+#endif /* __CBLAS_KERNELS_H__ */
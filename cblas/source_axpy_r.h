@@ -24,6 +24,13 @@
     return;
   }
 
+#ifdef KERNEL
+  if (incX == 1 && incY == 1) {
+    (KERNEL)->axpy (N, alpha, X, Y);
+    return;
+  }
+#endif
+
   if (incX == 1 && incY == 1) {
     const INDEX m = N % 4;
 
@@ -23,6 +23,12 @@
   INDEX ix = OFFSET(N, incX);
   INDEX iy = OFFSET(N, incY);
 
+#ifdef KERNEL
+  if (incX == 1 && incY == 1) {
+    return (KERNEL)->dot (N, X, Y);
+  }
+#endif
+
   for (i = 0; i < N; i++) {
     r += X[ix] * Y[iy];
     ix += incX;
@@ -83,6 +83,139 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    if ((double) n1 * (double) n2 * (double) K >= GEMM_BLOCK_MIN) {
+
+      /* Cache-blocked product, see source_gemm_r.h.  The packed
+         panels hold interleaved (real, imag) pairs with alpha and
+         any conjugation already applied. */
+
+      const int nthreads = cblas_thread_count (4.0 * (double) n1 * (double) n2 * (double) K);
+      const INDEX kc_max = GSL_MIN (K, GEMM_KC);
+      const INDEX mc_max = GSL_MIN (n1, GEMM_MC) + GEMM_MR_C;
+      const INDEX nc_max = GSL_MIN (n2, GEMM_NC) + GEMM_NR_C;
+      BASE *Fp = malloc (2 * sizeof (BASE) * kc_max * mc_max * nthreads);
+      BASE *Gp = malloc (2 * sizeof (BASE) * kc_max * nc_max);
+
+      if (Fp != NULL && Gp != NULL) {
+        /* rows of C per block, a multiple of MR */
+        INDEX mb = (n1 + nthreads - 1) / nthreads;
+        mb = GSL_MIN (GEMM_MR_C * ((mb + GEMM_MR_C - 1) / GEMM_MR_C), GEMM_MC);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1)
+#endif
+        {
+          BASE *Fq = Fp + 2 * (size_t) kc_max * mc_max * cblas_thread_id ();
+          INDEX ic, jc, pc, ir, jr, p, r, c;
+
+          for (jc = 0; jc < n2; jc += GEMM_NC) {
+            const INDEX nc = GSL_MIN (n2 - jc, GEMM_NC);
+
+            for (pc = 0; pc < K; pc += GEMM_KC) {
+              const INDEX kc = GSL_MIN (K - pc, GEMM_KC);
+
+              /* pack op(G)(pc:pc+kc, jc:jc+nc) */
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+              for (jr = 0; jr < nc; jr += GEMM_NR_C) {
+                const INDEX nr = GSL_MIN (nc - jr, GEMM_NR_C);
+                BASE *g = Gp + 2 * jr * kc;
+                for (p = 0; p < kc; p++) {
+                  const INDEX kk = pc + p;
+                  for (c = 0; c < nr; c++) {
+                    const INDEX idx = (TransG == CblasNoTrans) ?
+                      ldg * kk + (jc + jr + c) : ldg * (jc + jr + c) + kk;
+                    g[2 * (GEMM_NR_C * p + c)] = CONST_REAL (G, idx);
+                    g[2 * (GEMM_NR_C * p + c) + 1] = conjG * CONST_IMAG (G, idx);
+                  }
+                  for (; c < GEMM_NR_C; c++) {
+                    g[2 * (GEMM_NR_C * p + c)] = 0.0;
+                    g[2 * (GEMM_NR_C * p + c) + 1] = 0.0;
+                  }
+                }
+              }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+              for (ic = 0; ic < n1; ic += mb) {
+                const INDEX mc = GSL_MIN (n1 - ic, mb);
+
+                /* pack alpha*op(F)(ic:ic+mc, pc:pc+kc) */
+                for (ir = 0; ir < mc; ir += GEMM_MR_C) {
+                  const INDEX mr = GSL_MIN (mc - ir, GEMM_MR_C);
+                  BASE *f = Fq + 2 * ir * kc;
+                  for (p = 0; p < kc; p++) {
+                    const INDEX kk = pc + p;
+                    for (r = 0; r < mr; r++) {
+                      const INDEX idx = (TransF == CblasNoTrans) ?
+                        ldf * (ic + ir + r) + kk : ldf * kk + (ic + ir + r);
+                      const BASE Fik_real = CONST_REAL (F, idx);
+                      const BASE Fik_imag = conjF * CONST_IMAG (F, idx);
+                      f[2 * (GEMM_MR_C * p + r)] =
+                        alpha_real * Fik_real - alpha_imag * Fik_imag;
+                      f[2 * (GEMM_MR_C * p + r) + 1] =
+                        alpha_real * Fik_imag + alpha_imag * Fik_real;
+                    }
+                    for (; r < GEMM_MR_C; r++) {
+                      f[2 * (GEMM_MR_C * p + r)] = 0.0;
+                      f[2 * (GEMM_MR_C * p + r) + 1] = 0.0;
+                    }
+                  }
+                }
+
+                for (jr = 0; jr < nc; jr += GEMM_NR_C) {
+                  const INDEX nr = GSL_MIN (nc - jr, GEMM_NR_C);
+
+                  for (ir = 0; ir < mc; ir += GEMM_MR_C) {
+                    const INDEX mr = GSL_MIN (mc - ir, GEMM_MR_C);
+                    const BASE *f = Fq + 2 * ir * kc;
+                    const BASE *g = Gp + 2 * jr * kc;
+                    BASE ab[2 * GEMM_MR_C * GEMM_NR_C];
+
+                    /* 2 x 2 complex register-tiled micro-kernel */
+                    BASE c00r = 0.0, c00i = 0.0, c01r = 0.0, c01i = 0.0;
+                    BASE c10r = 0.0, c10i = 0.0, c11r = 0.0, c11i = 0.0;
+
+                    for (p = 0; p < kc; p++) {
+                      const BASE f0r = f[0], f0i = f[1], f1r = f[2], f1i = f[3];
+                      const BASE g0r = g[0], g0i = g[1], g1r = g[2], g1i = g[3];
+                      c00r += f0r * g0r - f0i * g0i; c00i += f0r * g0i + f0i * g0r;
+                      c01r += f0r * g1r - f0i * g1i; c01i += f0r * g1i + f0i * g1r;
+                      c10r += f1r * g0r - f1i * g0i; c10i += f1r * g0i + f1i * g0r;
+                      c11r += f1r * g1r - f1i * g1i; c11i += f1r * g1i + f1i * g1r;
+                      f += 2 * GEMM_MR_C;
+                      g += 2 * GEMM_NR_C;
+                    }
+
+                    ab[0] = c00r; ab[1] = c00i; ab[2] = c01r; ab[3] = c01i;
+                    ab[4] = c10r; ab[5] = c10i; ab[6] = c11r; ab[7] = c11i;
+
+                    for (r = 0; r < mr; r++) {
+                      for (c = 0; c < nr; c++) {
+                        const INDEX idx = ldc * (ic + ir + r) + jc + jr + c;
+                        REAL (C, idx) += ab[2 * (GEMM_NR_C * r + c)];
+                        IMAG (C, idx) += ab[2 * (GEMM_NR_C * r + c) + 1];
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        free (Fp);
+        free (Gp);
+        return;
+      }
+
+      /* not enough memory for the packed panels, use the unblocked loops */
+      free (Fp);
+      free (Gp);
+    }
+
     if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
       /* form  C := alpha*A*B + C */
@@ -67,6 +67,143 @@
   if (alpha == 0.0)
     return;
 
+  if ((double) n1 * (double) n2 * (double) K >= GEMM_BLOCK_MIN) {
+
+    /* Cache-blocked product.  The K dimension is split into blocks of
+       KC, the columns of C into blocks of NC and the rows of C into
+       blocks of at most MC.  Each block of op(G) is packed into
+       contiguous KC x NR slivers and each block of alpha*op(F) into
+       MR x KC slivers, so that the MR x NR register tile of the
+       micro-kernel streams through memory with unit stride whatever
+       the transposition or storage order of the arguments.
+
+       With several threads the packed block of op(G) is shared and
+       the row blocks of C are divided between the threads, each
+       packing its own blocks of op(F).  The operations on each
+       element of C do not depend on the number of threads. */
+
+    const int nthreads = cblas_thread_count ((double) n1 * (double) n2 * (double) K);
+    const INDEX kc_max = GSL_MIN (K, GEMM_KC);
+    const INDEX mc_max = GSL_MIN (n1, GEMM_MC) + GEMM_MR;
+    const INDEX nc_max = GSL_MIN (n2, GEMM_NC) + GEMM_NR;
+    BASE *Fp = malloc (sizeof (BASE) * kc_max * mc_max * nthreads);
+    BASE *Gp = malloc (sizeof (BASE) * kc_max * nc_max);
+
+    if (Fp != NULL && Gp != NULL) {
+      /* rows of C per block, a multiple of MR */
+      INDEX mb = (n1 + nthreads - 1) / nthreads;
+      mb = GSL_MIN (GEMM_MR * ((mb + GEMM_MR - 1) / GEMM_MR), GEMM_MC);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1)
+#endif
+      {
+        BASE *Fq = Fp + (size_t) kc_max * mc_max * cblas_thread_id ();
+        INDEX ic, jc, pc, ir, jr, p, r, c;
+
+        for (jc = 0; jc < n2; jc += GEMM_NC) {
+          const INDEX nc = GSL_MIN (n2 - jc, GEMM_NC);
+
+          for (pc = 0; pc < K; pc += GEMM_KC) {
+            const INDEX kc = GSL_MIN (K - pc, GEMM_KC);
+
+            /* pack op(G)(pc:pc+kc, jc:jc+nc) */
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (jr = 0; jr < nc; jr += GEMM_NR) {
+              const INDEX nr = GSL_MIN (nc - jr, GEMM_NR);
+              BASE *g = Gp + jr * kc;
+              for (p = 0; p < kc; p++) {
+                const INDEX kk = pc + p;
+                for (c = 0; c < nr; c++) {
+                  const INDEX jj = jc + jr + c;
+                  g[GEMM_NR * p + c] = (TransG == CblasNoTrans) ?
+                    G[ldg * kk + jj] : G[ldg * jj + kk];
+                }
+                for (; c < GEMM_NR; c++) {
+                  g[GEMM_NR * p + c] = 0.0;
+                }
+              }
+            }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (ic = 0; ic < n1; ic += mb) {
+              const INDEX mc = GSL_MIN (n1 - ic, mb);
+
+              /* pack alpha*op(F)(ic:ic+mc, pc:pc+kc) */
+              for (ir = 0; ir < mc; ir += GEMM_MR) {
+                const INDEX mr = GSL_MIN (mc - ir, GEMM_MR);
+                BASE *f = Fq + ir * kc;
+                for (p = 0; p < kc; p++) {
+                  const INDEX kk = pc + p;
+                  for (r = 0; r < mr; r++) {
+                    const INDEX ii = ic + ir + r;
+                    f[GEMM_MR * p + r] = alpha * ((TransF == CblasNoTrans) ?
+                                                  F[ldf * ii + kk] : F[ldf * kk + ii]);
+                  }
+                  for (; r < GEMM_MR; r++) {
+                    f[GEMM_MR * p + r] = 0.0;
+                  }
+                }
+              }
+
+              for (jr = 0; jr < nc; jr += GEMM_NR) {
+                const INDEX nr = GSL_MIN (nc - jr, GEMM_NR);
+
+                for (ir = 0; ir < mc; ir += GEMM_MR) {
+                  const INDEX mr = GSL_MIN (mc - ir, GEMM_MR);
+                  const BASE *f = Fq + ir * kc;
+                  const BASE *g = Gp + jr * kc;
+                  BASE ab[GEMM_MR * GEMM_NR];
+
+                  /* 4 x 4 register-tiled micro-kernel */
+                  BASE c00 = 0.0, c01 = 0.0, c02 = 0.0, c03 = 0.0;
+                  BASE c10 = 0.0, c11 = 0.0, c12 = 0.0, c13 = 0.0;
+                  BASE c20 = 0.0, c21 = 0.0, c22 = 0.0, c23 = 0.0;
+                  BASE c30 = 0.0, c31 = 0.0, c32 = 0.0, c33 = 0.0;
+
+                  for (p = 0; p < kc; p++) {
+                    const BASE f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3];
+                    const BASE g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3];
+                    c00 += f0 * g0; c01 += f0 * g1; c02 += f0 * g2; c03 += f0 * g3;
+                    c10 += f1 * g0; c11 += f1 * g1; c12 += f1 * g2; c13 += f1 * g3;
+                    c20 += f2 * g0; c21 += f2 * g1; c22 += f2 * g2; c23 += f2 * g3;
+                    c30 += f3 * g0; c31 += f3 * g1; c32 += f3 * g2; c33 += f3 * g3;
+                    f += GEMM_MR;
+                    g += GEMM_NR;
+                  }
+
+                  ab[0] = c00; ab[1] = c01; ab[2] = c02; ab[3] = c03;
+                  ab[4] = c10; ab[5] = c11; ab[6] = c12; ab[7] = c13;
+                  ab[8] = c20; ab[9] = c21; ab[10] = c22; ab[11] = c23;
+                  ab[12] = c30; ab[13] = c31; ab[14] = c32; ab[15] = c33;
+
+                  for (r = 0; r < mr; r++) {
+                    BASE *Ci = C + ldc * (ic + ir + r) + jc + jr;
+                    for (c = 0; c < nr; c++) {
+                      Ci[c] += ab[GEMM_NR * r + c];
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      free (Fp);
+      free (Gp);
+      return;
+    }
+
+    /* not enough memory for the packed panels, use the unblocked loops */
+    free (Fp);
+    free (Gp);
+  }
+
   if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
     /* form  C := alpha*A*B + C */
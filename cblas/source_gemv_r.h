@@ -57,6 +57,18 @@
   if (alpha == 0.0)
     return;
 
+#ifdef KERNEL
+  if (incX == 1 && incY == 1) {
+    if ((order == CblasRowMajor && Trans == CblasNoTrans)
+        || (order == CblasColMajor && Trans == CblasTrans)) {
+      (KERNEL)->gemv_n (lenY, lenX, alpha, A, lda, X, Y);
+    } else {
+      (KERNEL)->gemv_t (lenX, lenY, alpha, A, lda, X, Y);
+    }
+    return;
+  }
+#endif
+
   if ((order == CblasRowMajor && Trans == CblasNoTrans)
       || (order == CblasColMajor && Trans == CblasTrans)) {
     /* form  y := alpha*A*x + y */
@@ -0,0 +1,276 @@
+/* cblas/source_kernel_d.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Vector kernels, included once per instruction set from kernels.c
+   with the following macros defined:
+
+   VEC                  vector type holding VLEN doubles
+   LOADU, STOREU        unaligned load and store
+   SET1, SETZERO        broadcast and zero
+   ADD, MUL, FMADD      arithmetic, FMADD(a,b,c) = a*b + c
+   MAXV, ABSV           elementwise maximum and absolute value
+   TARGET               function attribute enabling the instruction set
+   FUNCTION(name)       name of the kernel for this instruction set */
+
+static TARGET double
+FUNCTION (hsum) (const VEC x)
+{
+  double t[VLEN];
+  double r = 0.0;
+  int k;
+
+  STOREU (t, x);
+
+  for (k = 0; k < VLEN; k++)
+    r += t[k];
+
+  return r;
+}
+
+static TARGET void
+FUNCTION (axpy) (const int N, const double alpha, const double *X, double *Y)
+{
+  const VEC a = SET1 (alpha);
+  int i = 0;
+
+  for (; i + 2 * VLEN <= N; i += 2 * VLEN)
+    {
+      VEC y0 = LOADU (Y + i);
+      VEC y1 = LOADU (Y + i + VLEN);
+      y0 = FMADD (a, LOADU (X + i), y0);
+      y1 = FMADD (a, LOADU (X + i + VLEN), y1);
+      STOREU (Y + i, y0);
+      STOREU (Y + i + VLEN, y1);
+    }
+
+  for (; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+static TARGET double
+FUNCTION (dot) (const int N, const double *X, const double *Y)
+{
+  VEC s0 = SETZERO (), s1 = SETZERO (), s2 = SETZERO (), s3 = SETZERO ();
+  double r;
+  int i = 0;
+
+  for (; i + 4 * VLEN <= N; i += 4 * VLEN)
+    {
+      s0 = FMADD (LOADU (X + i), LOADU (Y + i), s0);
+      s1 = FMADD (LOADU (X + i + VLEN), LOADU (Y + i + VLEN), s1);
+      s2 = FMADD (LOADU (X + i + 2 * VLEN), LOADU (Y + i + 2 * VLEN), s2);
+      s3 = FMADD (LOADU (X + i + 3 * VLEN), LOADU (Y + i + 3 * VLEN), s3);
+    }
+
+  for (; i + VLEN <= N; i += VLEN)
+    s0 = FMADD (LOADU (X + i), LOADU (Y + i), s0);
+
+  r = FUNCTION (hsum) (ADD (ADD (s0, s1), ADD (s2, s3)));
+
+  for (; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+static TARGET void
+FUNCTION (scal) (const int N, const double alpha, double *X)
+{
+  const VEC a = SET1 (alpha);
+  int i = 0;
+
+  for (; i + VLEN <= N; i += VLEN)
+    STOREU (X + i, MUL (a, LOADU (X + i)));
+
+  for (; i < N; i++)
+    X[i] *= alpha;
+}
+
+/* Two passes: the first finds max |x(i)|, the second sums the squares
+   either directly, when neither overflow nor harmful underflow can
+   occur, or after scaling by a power of two close to 1/max |x(i)|.
+   Infinities and NaNs are left to the generic one pass algorithm. */
+
+static TARGET double
+FUNCTION (nrm2) (const int N, const double *X)
+{
+  VEC m = SETZERO ();
+  VEC s0 = SETZERO (), s1 = SETZERO ();
+  double amax, t[VLEN];
+  int i = 0, k;
+
+  for (; i + VLEN <= N; i += VLEN)
+    m = MAXV (m, ABSV (LOADU (X + i)));
+
+  STOREU (t, m);
+  amax = 0.0;
+
+  for (k = 0; k < VLEN; k++)
+    amax = GSL_MAX (amax, t[k]);
+
+  for (; i < N; i++)
+    amax = GSL_MAX (amax, fabs (X[i]));
+
+  if (amax == 0.0)
+    return 0.0;
+  else if (!(amax <= DBL_MAX))
+    return nrm2_generic (N, X);
+
+  if (amax > NRM2_TINY && amax < NRM2_HUGE)
+    {
+      double r;
+
+      for (i = 0; i + 2 * VLEN <= N; i += 2 * VLEN)
+        {
+          const VEC x0 = LOADU (X + i);
+          const VEC x1 = LOADU (X + i + VLEN);
+          s0 = FMADD (x0, x0, s0);
+          s1 = FMADD (x1, x1, s1);
+        }
+
+      r = FUNCTION (hsum) (ADD (s0, s1));
+
+      for (; i < N; i++)
+        r += X[i] * X[i];
+
+      return sqrt (r);
+    }
+  else if (amax >= DBL_MIN)
+    {
+      int e;
+      double scale, r;
+      VEC a;
+
+      frexp (amax, &e);
+      scale = ldexp (1.0, -e);
+      a = SET1 (scale);
+
+      for (i = 0; i + VLEN <= N; i += VLEN)
+        {
+          const VEC x = MUL (a, LOADU (X + i));
+          s0 = FMADD (x, x, s0);
+        }
+
+      r = FUNCTION (hsum) (s0);
+
+      for (; i < N; i++)
+        {
+          const double x = scale * X[i];
+          r += x * x;
+        }
+
+      return ldexp (sqrt (r), e);
+    }
+  else
+    {
+      /* all elements are subnormal */
+      return nrm2_generic (N, X);
+    }
+}
+
+static TARGET void
+FUNCTION (gemv_n) (const int M, const int N, const double alpha,
+                   const double *A, const int lda, const double *X, double *Y)
+{
+  int i = 0, j;
+
+  for (; i + 4 <= M; i += 4)
+    {
+      const double *a0 = A + lda * i;
+      const double *a1 = a0 + lda;
+      const double *a2 = a1 + lda;
+      const double *a3 = a2 + lda;
+      VEC s0 = SETZERO (), s1 = SETZERO (), s2 = SETZERO (), s3 = SETZERO ();
+      double t0, t1, t2, t3;
+
+      for (j = 0; j + VLEN <= N; j += VLEN)
+        {
+          const VEC x = LOADU (X + j);
+          s0 = FMADD (LOADU (a0 + j), x, s0);
+          s1 = FMADD (LOADU (a1 + j), x, s1);
+          s2 = FMADD (LOADU (a2 + j), x, s2);
+          s3 = FMADD (LOADU (a3 + j), x, s3);
+        }
+
+      t0 = FUNCTION (hsum) (s0);
+      t1 = FUNCTION (hsum) (s1);
+      t2 = FUNCTION (hsum) (s2);
+      t3 = FUNCTION (hsum) (s3);
+
+      for (; j < N; j++)
+        {
+          t0 += a0[j] * X[j];
+          t1 += a1[j] * X[j];
+          t2 += a2[j] * X[j];
+          t3 += a3[j] * X[j];
+        }
+
+      Y[i] += alpha * t0;
+      Y[i + 1] += alpha * t1;
+      Y[i + 2] += alpha * t2;
+      Y[i + 3] += alpha * t3;
+    }
+
+  for (; i < M; i++)
+    Y[i] += alpha * FUNCTION (dot) (N, A + lda * i, X);
+}
+
+static TARGET void
+FUNCTION (gemv_t) (const int M, const int N, const double alpha,
+                   const double *A, const int lda, const double *X, double *Y)
+{
+  int i = 0, j;
+
+  for (; i + 4 <= M; i += 4)
+    {
+      const double *a0 = A + lda * i;
+      const double *a1 = a0 + lda;
+      const double *a2 = a1 + lda;
+      const double *a3 = a2 + lda;
+      const double b0 = alpha * X[i], b1 = alpha * X[i + 1];
+      const double b2 = alpha * X[i + 2], b3 = alpha * X[i + 3];
+      const VEC v0 = SET1 (b0), v1 = SET1 (b1), v2 = SET1 (b2), v3 = SET1 (b3);
+
+      for (j = 0; j + VLEN <= N; j += VLEN)
+        {
+          VEC y = LOADU (Y + j);
+          y = FMADD (v0, LOADU (a0 + j), y);
+          y = FMADD (v1, LOADU (a1 + j), y);
+          y = FMADD (v2, LOADU (a2 + j), y);
+          y = FMADD (v3, LOADU (a3 + j), y);
+          STOREU (Y + j, y);
+        }
+
+      for (; j < N; j++)
+        Y[j] += b0 * a0[j] + b1 * a1[j] + b2 * a2[j] + b3 * a3[j];
+    }
+
+  for (; i < M; i++)
+    FUNCTION (axpy) (N, alpha * X[i], A + lda * i, Y);
+}
+
+static const cblas_kernel_type FUNCTION (kernel) = {
+  KERNEL_NAME,
+  FUNCTION (axpy),
+  FUNCTION (dot),
+  FUNCTION (nrm2),
+  FUNCTION (scal),
+  FUNCTION (gemv_n),
+  FUNCTION (gemv_t)
+};
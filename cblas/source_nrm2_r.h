@@ -29,6 +29,12 @@
     return fabs(X[0]);
   }
 
+#ifdef KERNEL
+  if (incX == 1) {
+    return (KERNEL)->nrm2 (N, X);
+  }
+#endif
+
   for (i = 0; i < N; i++) {
     const BASE x = X[ix];
 
@@ -25,6 +25,13 @@
     return;
   }
 
+#ifdef KERNEL
+  if (incX == 1) {
+    (KERNEL)->scal (N, alpha, X);
+    return;
+  }
+#endif
+
   for (i = 0; i < N; i++) {
     X[ix] *= alpha;
     ix += incX;
@@ -57,77 +57,102 @@
   if (alpha == 0.0)
     return;
 
-  if (side == CblasLeft && uplo == CblasUpper) {
-
-    /* form  C := alpha*A*B + C */
-
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        const BASE temp1 = alpha * B[ldb * i + j];
-        BASE temp2 = 0.0;
-        C[i * ldc + j] += temp1 * A[i * lda + i];
-        for (k = i + 1; k < n1; k++) {
-          const BASE Aik = A[i * lda + k];
-          C[k * ldc + j] += Aik * temp1;
-          temp2 += Aik * B[ldb * k + j];
-        }
-        C[i * ldc + j] += alpha * temp2;
+  {
+#ifdef _OPENMP
+    const int nthreads = cblas_thread_count ((side == CblasLeft) ?
+                                             (double) n1 * (double) n1 * (double) n2 :
+                                             (double) n1 * (double) n2 * (double) n2);
+#endif
+
+    /* with several threads, the columns (side = left) or rows
+       (side = right) of C are divided between the threads and
+       computed independently */
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1) private(i, j, k)
+#endif
+    {
+      int i0 = 0, i1 = n1, j0 = 0, j1 = n2;
+
+      if (side == CblasLeft) {
+        cblas_thread_range (n2, &j0, &j1);
+      } else {
+        cblas_thread_range (n1, &i0, &i1);
       }
-    }
-
-  } else if (side == CblasLeft && uplo == CblasLower) {
 
-    /* form  C := alpha*A*B + C */
-
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        const BASE temp1 = alpha * B[ldb * i + j];
-        BASE temp2 = 0.0;
-        for (k = 0; k < i; k++) {
-          const BASE Aik = A[i * lda + k];
-          C[k * ldc + j] += Aik * temp1;
-          temp2 += Aik * B[ldb * k + j];
+      if (side == CblasLeft && uplo == CblasUpper) {
+
+        /* form  C := alpha*A*B + C */
+
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            const BASE temp1 = alpha * B[ldb * i + j];
+            BASE temp2 = 0.0;
+            C[i * ldc + j] += temp1 * A[i * lda + i];
+            for (k = i + 1; k < n1; k++) {
+              const BASE Aik = A[i * lda + k];
+              C[k * ldc + j] += Aik * temp1;
+              temp2 += Aik * B[ldb * k + j];
+            }
+            C[i * ldc + j] += alpha * temp2;
+          }
         }
-        C[i * ldc + j] += temp1 * A[i * lda + i] + alpha * temp2;
-      }
-    }
-
-  } else if (side == CblasRight && uplo == CblasUpper) {
 
-    /* form  C := alpha*B*A + C */
-
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        const BASE temp1 = alpha * B[ldb * i + j];
-        BASE temp2 = 0.0;
-        C[i * ldc + j] += temp1 * A[j * lda + j];
-        for (k = j + 1; k < n2; k++) {
-          const BASE Ajk = A[j * lda + k];
-          C[i * ldc + k] += temp1 * Ajk;
-          temp2 += B[ldb * i + k] * Ajk;
+      } else if (side == CblasLeft && uplo == CblasLower) {
+
+        /* form  C := alpha*A*B + C */
+
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            const BASE temp1 = alpha * B[ldb * i + j];
+            BASE temp2 = 0.0;
+            for (k = 0; k < i; k++) {
+              const BASE Aik = A[i * lda + k];
+              C[k * ldc + j] += Aik * temp1;
+              temp2 += Aik * B[ldb * k + j];
+            }
+            C[i * ldc + j] += temp1 * A[i * lda + i] + alpha * temp2;
+          }
         }
-        C[i * ldc + j] += alpha * temp2;
-      }
-    }
-
-  } else if (side == CblasRight && uplo == CblasLower) {
 
-    /* form  C := alpha*B*A + C */
+      } else if (side == CblasRight && uplo == CblasUpper) {
+
+        /* form  C := alpha*B*A + C */
+
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            const BASE temp1 = alpha * B[ldb * i + j];
+            BASE temp2 = 0.0;
+            C[i * ldc + j] += temp1 * A[j * lda + j];
+            for (k = j + 1; k < n2; k++) {
+              const BASE Ajk = A[j * lda + k];
+              C[i * ldc + k] += temp1 * Ajk;
+              temp2 += B[ldb * i + k] * Ajk;
+            }
+            C[i * ldc + j] += alpha * temp2;
+          }
+        }
 
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        const BASE temp1 = alpha * B[ldb * i + j];
-        BASE temp2 = 0.0;
-        for (k = 0; k < j; k++) {
-          const BASE Ajk = A[j * lda + k];
-          C[i * ldc + k] += temp1 * Ajk;
-          temp2 += B[ldb * i + k] * Ajk;
+      } else if (side == CblasRight && uplo == CblasLower) {
+
+        /* form  C := alpha*B*A + C */
+
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            const BASE temp1 = alpha * B[ldb * i + j];
+            BASE temp2 = 0.0;
+            for (k = 0; k < j; k++) {
+              const BASE Ajk = A[j * lda + k];
+              C[i * ldc + k] += temp1 * Ajk;
+              temp2 += B[ldb * i + k] * Ajk;
+            }
+            C[i * ldc + j] += temp1 * A[j * lda + j] + alpha * temp2;
+          }
         }
-        C[i * ldc + j] += temp1 * A[j * lda + j] + alpha * temp2;
+
+      } else {
+        BLAS_ERROR("unrecognized operation");
       }
     }
-
-  } else {
-    BLAS_ERROR("unrecognized operation");
   }
 }
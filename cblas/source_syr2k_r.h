@@ -73,59 +73,76 @@
   if (alpha == 0.0)
     return;
 
-  if (uplo == CblasUpper && trans == CblasNoTrans) {
+  {
+#ifdef _OPENMP
+    const int nthreads = cblas_thread_count ((double) N * (double) N * (double) K);
+#endif
+
+    /* with several threads, the rows of C are dealt out cyclically
+       to balance the work in the triangle */
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1) private(i, j, k)
+#endif
+    {
+      const int i0 = cblas_thread_id ();
+      const int istep = cblas_thread_total ();
+
+      if (uplo == CblasUpper && trans == CblasNoTrans) {
+
+        for (i = i0; i < N; i += istep) {
+          for (j = i; j < N; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += (A[i * lda + k] * B[j * ldb + k]
+                       + B[i * ldb + k] * A[j * lda + k]);
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
+        }
+
+      } else if (uplo == CblasUpper && trans == CblasTrans) {
 
-    for (i = 0; i < N; i++) {
-      for (j = i; j < N; j++) {
-        BASE temp = 0.0;
         for (k = 0; k < K; k++) {
-          temp += (A[i * lda + k] * B[j * ldb + k]
-                   + B[i * ldb + k] * A[j * lda + k]);
+          for (i = i0; i < N; i += istep) {
+            BASE temp1 = alpha * A[k * lda + i];
+            BASE temp2 = alpha * B[k * ldb + i];
+            for (j = i; j < N; j++) {
+              C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
+            }
+          }
         }
-        C[i * ldc + j] += alpha * temp;
-      }
-    }
 
-  } else if (uplo == CblasUpper && trans == CblasTrans) {
+      } else if (uplo == CblasLower && trans == CblasNoTrans) {
 
-    for (k = 0; k < K; k++) {
-      for (i = 0; i < N; i++) {
-        BASE temp1 = alpha * A[k * lda + i];
-        BASE temp2 = alpha * B[k * ldb + i];
-        for (j = i; j < N; j++) {
-          C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
-        }
-      }
-    }
 
-  } else if (uplo == CblasLower && trans == CblasNoTrans) {
+        for (i = i0; i < N; i += istep) {
+          for (j = 0; j <= i; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += (A[i * lda + k] * B[j * ldb + k]
+                       + B[i * ldb + k] * A[j * lda + k]);
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
+        }
 
+      } else if (uplo == CblasLower && trans == CblasTrans) {
 
-    for (i = 0; i < N; i++) {
-      for (j = 0; j <= i; j++) {
-        BASE temp = 0.0;
         for (k = 0; k < K; k++) {
-          temp += (A[i * lda + k] * B[j * ldb + k]
-                   + B[i * ldb + k] * A[j * lda + k]);
+          for (i = i0; i < N; i += istep) {
+            BASE temp1 = alpha * A[k * lda + i];
+            BASE temp2 = alpha * B[k * ldb + i];
+            for (j = 0; j <= i; j++) {
+              C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
+            }
+          }
         }
-        C[i * ldc + j] += alpha * temp;
-      }
-    }
 
-  } else if (uplo == CblasLower && trans == CblasTrans) {
 
-    for (k = 0; k < K; k++) {
-      for (i = 0; i < N; i++) {
-        BASE temp1 = alpha * A[k * lda + i];
-        BASE temp2 = alpha * B[k * ldb + i];
-        for (j = 0; j <= i; j++) {
-          C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
-        }
+      } else {
+        BLAS_ERROR("unrecognized operation");
       }
     }
-
-
-  } else {
-    BLAS_ERROR("unrecognized operation");
   }
 }
@@ -73,55 +73,72 @@
   if (alpha == 0.0)
     return;
 
-  if (uplo == CblasUpper && trans == CblasNoTrans) {
-
-    for (i = 0; i < N; i++) {
-      for (j = i; j < N; j++) {
-        BASE temp = 0.0;
-        for (k = 0; k < K; k++) {
-          temp += A[i * lda + k] * A[j * lda + k];
+  {
+#ifdef _OPENMP
+    const int nthreads = cblas_thread_count (0.5 * (double) N * (double) N * (double) K);
+#endif
+
+    /* with several threads, the rows of C are dealt out cyclically
+       to balance the work in the triangle */
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1) private(i, j, k)
+#endif
+    {
+      const int i0 = cblas_thread_id ();
+      const int istep = cblas_thread_total ();
+
+      if (uplo == CblasUpper && trans == CblasNoTrans) {
+
+        for (i = i0; i < N; i += istep) {
+          for (j = i; j < N; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += A[i * lda + k] * A[j * lda + k];
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
         }
-        C[i * ldc + j] += alpha * temp;
-      }
-    }
 
-  } else if (uplo == CblasUpper && trans == CblasTrans) {
+      } else if (uplo == CblasUpper && trans == CblasTrans) {
 
-    for (i = 0; i < N; i++) {
-      for (j = i; j < N; j++) {
-        BASE temp = 0.0;
-        for (k = 0; k < K; k++) {
-          temp += A[k * lda + i] * A[k * lda + j];
+        for (i = i0; i < N; i += istep) {
+          for (j = i; j < N; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += A[k * lda + i] * A[k * lda + j];
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
         }
-        C[i * ldc + j] += alpha * temp;
-      }
-    }
 
-  } else if (uplo == CblasLower && trans == CblasNoTrans) {
+      } else if (uplo == CblasLower && trans == CblasNoTrans) {
 
-    for (i = 0; i < N; i++) {
-      for (j = 0; j <= i; j++) {
-        BASE temp = 0.0;
-        for (k = 0; k < K; k++) {
-          temp += A[i * lda + k] * A[j * lda + k];
+        for (i = i0; i < N; i += istep) {
+          for (j = 0; j <= i; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += A[i * lda + k] * A[j * lda + k];
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
         }
-        C[i * ldc + j] += alpha * temp;
-      }
-    }
 
-  } else if (uplo == CblasLower && trans == CblasTrans) {
+      } else if (uplo == CblasLower && trans == CblasTrans) {
 
-    for (i = 0; i < N; i++) {
-      for (j = 0; j <= i; j++) {
-        BASE temp = 0.0;
-        for (k = 0; k < K; k++) {
-          temp += A[k * lda + i] * A[k * lda + j];
+        for (i = i0; i < N; i += istep) {
+          for (j = 0; j <= i; j++) {
+            BASE temp = 0.0;
+            for (k = 0; k < K; k++) {
+              temp += A[k * lda + i] * A[k * lda + j];
+            }
+            C[i * ldc + j] += alpha * temp;
+          }
         }
-        C[i * ldc + j] += alpha * temp;
+
+      } else {
+        BLAS_ERROR("unrecognized operation");
       }
     }
-
-  } else {
-    BLAS_ERROR("unrecognized operation");
   }
 }
@@ -40,187 +40,212 @@
     trans = (TransA == CblasConjTrans) ? CblasTrans : TransA;
   }
 
-  if (side == CblasLeft && uplo == CblasUpper && trans == CblasNoTrans) {
+  {
+#ifdef _OPENMP
+    const int nthreads = cblas_thread_count ((side == CblasLeft) ?
+                                             0.5 * (double) n1 * (double) n1 * (double) n2 :
+                                             0.5 * (double) n1 * (double) n2 * (double) n2);
+#endif
+
+    /* with several threads, the columns (side = left) or rows
+       (side = right) of B are divided between the threads and
+       multiplied independently */
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1) private(i, j, k)
+#endif
+    {
+      int i0 = 0, i1 = n1, j0 = 0, j1 = n2;
+
+      if (side == CblasLeft) {
+        cblas_thread_range (n2, &j0, &j1);
+      } else {
+        cblas_thread_range (n1, &i0, &i1);
+      }
 
-    /* form  B := alpha * TriU(A)*B */
+      if (side == CblasLeft && uplo == CblasUpper && trans == CblasNoTrans) {
 
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+        /* form  B := alpha * TriU(A)*B */
 
-        if (nonunit) {
-          temp = A[i * lda + i] * B[i * ldb + j];
-        } else {
-          temp = B[i * ldb + j];
-        }
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
+
+            if (nonunit) {
+              temp = A[i * lda + i] * B[i * ldb + j];
+            } else {
+              temp = B[i * ldb + j];
+            }
+
+            for (k = i + 1; k < n1; k++) {
+              temp += A[lda * i + k] * B[k * ldb + j];
+            }
 
-        for (k = i + 1; k < n1; k++) {
-          temp += A[lda * i + k] * B[k * ldb + j];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+      } else if (side == CblasLeft && uplo == CblasUpper && trans == CblasTrans) {
 
-  } else if (side == CblasLeft && uplo == CblasUpper && trans == CblasTrans) {
+        /* form  B := alpha * (TriU(A))' *B */
 
-    /* form  B := alpha * (TriU(A))' *B */
+        for (i = n1; i > 0 && i--;) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
 
-    for (i = n1; i > 0 && i--;) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+            for (k = 0; k < i; k++) {
+              temp += A[lda * k + i] * B[k * ldb + j];
+            }
 
-        for (k = 0; k < i; k++) {
-          temp += A[lda * k + i] * B[k * ldb + j];
-        }
+            if (nonunit) {
+              temp += A[i * lda + i] * B[i * ldb + j];
+            } else {
+              temp += B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp += A[i * lda + i] * B[i * ldb + j];
-        } else {
-          temp += B[i * ldb + j];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+      } else if (side == CblasLeft && uplo == CblasLower && trans == CblasNoTrans) {
 
-  } else if (side == CblasLeft && uplo == CblasLower && trans == CblasNoTrans) {
+        /* form  B := alpha * TriL(A)*B */
 
-    /* form  B := alpha * TriL(A)*B */
 
+        for (i = n1; i > 0 && i--;) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
 
-    for (i = n1; i > 0 && i--;) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+            for (k = 0; k < i; k++) {
+              temp += A[lda * i + k] * B[k * ldb + j];
+            }
 
-        for (k = 0; k < i; k++) {
-          temp += A[lda * i + k] * B[k * ldb + j];
-        }
+            if (nonunit) {
+              temp += A[i * lda + i] * B[i * ldb + j];
+            } else {
+              temp += B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp += A[i * lda + i] * B[i * ldb + j];
-        } else {
-          temp += B[i * ldb + j];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
 
 
+      } else if (side == CblasLeft && uplo == CblasLower && trans == CblasTrans) {
 
-  } else if (side == CblasLeft && uplo == CblasLower && trans == CblasTrans) {
+        /* form  B := alpha * TriL(A)' *B */
 
-    /* form  B := alpha * TriL(A)' *B */
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
 
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+            if (nonunit) {
+              temp = A[i * lda + i] * B[i * ldb + j];
+            } else {
+              temp = B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp = A[i * lda + i] * B[i * ldb + j];
-        } else {
-          temp = B[i * ldb + j];
-        }
+            for (k = i + 1; k < n1; k++) {
+              temp += A[lda * k + i] * B[k * ldb + j];
+            }
 
-        for (k = i + 1; k < n1; k++) {
-          temp += A[lda * k + i] * B[k * ldb + j];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+      } else if (side == CblasRight && uplo == CblasUpper && trans == CblasNoTrans) {
 
-  } else if (side == CblasRight && uplo == CblasUpper && trans == CblasNoTrans) {
+        /* form  B := alpha * B * TriU(A) */
 
-    /* form  B := alpha * B * TriU(A) */
+        for (i = i0; i < i1; i++) {
+          for (j = n2; j > 0 && j--;) {
+            BASE temp = 0.0;
 
-    for (i = 0; i < n1; i++) {
-      for (j = n2; j > 0 && j--;) {
-        BASE temp = 0.0;
+            for (k = 0; k < j; k++) {
+              temp += A[lda * k + j] * B[i * ldb + k];
+            }
 
-        for (k = 0; k < j; k++) {
-          temp += A[lda * k + j] * B[i * ldb + k];
-        }
+            if (nonunit) {
+              temp += A[j * lda + j] * B[i * ldb + j];
+            } else {
+              temp += B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp += A[j * lda + j] * B[i * ldb + j];
-        } else {
-          temp += B[i * ldb + j];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+      } else if (side == CblasRight && uplo == CblasUpper && trans == CblasTrans) {
 
-  } else if (side == CblasRight && uplo == CblasUpper && trans == CblasTrans) {
+        /* form  B := alpha * B * (TriU(A))' */
 
-    /* form  B := alpha * B * (TriU(A))' */
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
 
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+            if (nonunit) {
+              temp = A[j * lda + j] * B[i * ldb + j];
+            } else {
+              temp = B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp = A[j * lda + j] * B[i * ldb + j];
-        } else {
-          temp = B[i * ldb + j];
-        }
+            for (k = j + 1; k < n2; k++) {
+              temp += A[lda * j + k] * B[i * ldb + k];
+            }
 
-        for (k = j + 1; k < n2; k++) {
-          temp += A[lda * j + k] * B[i * ldb + k];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+      } else if (side == CblasRight && uplo == CblasLower && trans == CblasNoTrans) {
 
-  } else if (side == CblasRight && uplo == CblasLower && trans == CblasNoTrans) {
+        /* form  B := alpha *B * TriL(A) */
 
-    /* form  B := alpha *B * TriL(A) */
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            BASE temp = 0.0;
 
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        BASE temp = 0.0;
+            if (nonunit) {
+              temp = A[j * lda + j] * B[i * ldb + j];
+            } else {
+              temp = B[i * ldb + j];
+            }
 
-        if (nonunit) {
-          temp = A[j * lda + j] * B[i * ldb + j];
-        } else {
-          temp = B[i * ldb + j];
-        }
+            for (k = j + 1; k < n2; k++) {
+              temp += A[lda * k + j] * B[i * ldb + k];
+            }
 
-        for (k = j + 1; k < n2; k++) {
-          temp += A[lda * k + j] * B[i * ldb + k];
+
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
+      } else if (side == CblasRight && uplo == CblasLower && trans == CblasTrans) {
 
-        B[ldb * i + j] = alpha * temp;
-      }
-    }
+        /* form  B := alpha * B * TriL(A)' */
 
-  } else if (side == CblasRight && uplo == CblasLower && trans == CblasTrans) {
+        for (i = i0; i < i1; i++) {
+          for (j = n2; j > 0 && j--;) {
+            BASE temp = 0.0;
 
-    /* form  B := alpha * B * TriL(A)' */
+            for (k = 0; k < j; k++) {
+              temp += A[lda * j + k] * B[i * ldb + k];
+            }
 
-    for (i = 0; i < n1; i++) {
-      for (j = n2; j > 0 && j--;) {
-        BASE temp = 0.0;
+            if (nonunit) {
+              temp += A[j * lda + j] * B[i * ldb + j];
+            } else {
+              temp += B[i * ldb + j];
+            }
 
-        for (k = 0; k < j; k++) {
-          temp += A[lda * j + k] * B[i * ldb + k];
+            B[ldb * i + j] = alpha * temp;
+          }
         }
 
-        if (nonunit) {
-          temp += A[j * lda + j] * B[i * ldb + j];
-        } else {
-          temp += B[i * ldb + j];
-        }
-
-        B[ldb * i + j] = alpha * temp;
+      } else {
+        BLAS_ERROR("unrecognized operation");
       }
     }
-
-  } else {
-    BLAS_ERROR("unrecognized operation");
   }
 }
@@ -40,239 +40,264 @@
     trans = (TransA == CblasConjTrans) ? CblasTrans : TransA;
   }
 
-  if (side == CblasLeft && uplo == CblasUpper && trans == CblasNoTrans) {
+  {
+#ifdef _OPENMP
+    const int nthreads = cblas_thread_count ((side == CblasLeft) ?
+                                             0.5 * (double) n1 * (double) n1 * (double) n2 :
+                                             0.5 * (double) n1 * (double) n2 * (double) n2);
+#endif
+
+    /* with several threads, the columns (side = left) or rows
+       (side = right) of B are divided between the threads and
+       solved independently */
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1) private(i, j, k)
+#endif
+    {
+      int i0 = 0, i1 = n1, j0 = 0, j1 = n2;
+
+      if (side == CblasLeft) {
+        cblas_thread_range (n2, &j0, &j1);
+      } else {
+        cblas_thread_range (n1, &i0, &i1);
+      }
 
-    /* form  B := alpha * inv(TriU(A)) *B */
+      if (side == CblasLeft && uplo == CblasUpper && trans == CblasNoTrans) {
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
-        }
-      }
-    }
+        /* form  B := alpha * inv(TriU(A)) *B */
 
-    for (i = n1; i > 0 && i--;) {
-      if (nonunit) {
-        BASE Aii = A[lda * i + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] /= Aii;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
 
-      for (k = 0; k < i; k++) {
-        const BASE Aki = A[k * lda + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * k + j] -= Aki * B[ldb * i + j];
+        for (i = n1; i > 0 && i--;) {
+          if (nonunit) {
+            BASE Aii = A[lda * i + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] /= Aii;
+            }
+          }
+
+          for (k = 0; k < i; k++) {
+            const BASE Aki = A[k * lda + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * k + j] -= Aki * B[ldb * i + j];
+            }
+          }
         }
-      }
-    }
 
-  } else if (side == CblasLeft && uplo == CblasUpper && trans == CblasTrans) {
+      } else if (side == CblasLeft && uplo == CblasUpper && trans == CblasTrans) {
 
-    /* form  B := alpha * inv(TriU(A))' *B */
+        /* form  B := alpha * inv(TriU(A))' *B */
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
-    }
 
-    for (i = 0; i < n1; i++) {
-      if (nonunit) {
-        BASE Aii = A[lda * i + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] /= Aii;
-        }
-      }
+        for (i = i0; i < i1; i++) {
+          if (nonunit) {
+            BASE Aii = A[lda * i + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] /= Aii;
+            }
+          }
 
-      for (k = i + 1; k < n1; k++) {
-        const BASE Aik = A[i * lda + k];
-        for (j = 0; j < n2; j++) {
-          B[ldb * k + j] -= Aik * B[ldb * i + j];
+          for (k = i + 1; k < n1; k++) {
+            const BASE Aik = A[i * lda + k];
+            for (j = j0; j < j1; j++) {
+              B[ldb * k + j] -= Aik * B[ldb * i + j];
+            }
+          }
         }
-      }
-    }
 
-  } else if (side == CblasLeft && uplo == CblasLower && trans == CblasNoTrans) {
+      } else if (side == CblasLeft && uplo == CblasLower && trans == CblasNoTrans) {
 
-    /* form  B := alpha * inv(TriL(A))*B */
+        /* form  B := alpha * inv(TriL(A))*B */
 
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
-    }
 
-    for (i = 0; i < n1; i++) {
-      if (nonunit) {
-        BASE Aii = A[lda * i + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] /= Aii;
-        }
-      }
+        for (i = i0; i < i1; i++) {
+          if (nonunit) {
+            BASE Aii = A[lda * i + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] /= Aii;
+            }
+          }
 
-      for (k = i + 1; k < n1; k++) {
-        const BASE Aki = A[k * lda + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * k + j] -= Aki * B[ldb * i + j];
+          for (k = i + 1; k < n1; k++) {
+            const BASE Aki = A[k * lda + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * k + j] -= Aki * B[ldb * i + j];
+            }
+          }
         }
-      }
-    }
 
 
-  } else if (side == CblasLeft && uplo == CblasLower && trans == CblasTrans) {
+      } else if (side == CblasLeft && uplo == CblasLower && trans == CblasTrans) {
 
-    /* form  B := alpha * TriL(A)' *B */
+        /* form  B := alpha * TriL(A)' *B */
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
-    }
 
-    for (i = n1; i > 0 && i--;) {
-      if (nonunit) {
-        BASE Aii = A[lda * i + i];
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] /= Aii;
-        }
-      }
+        for (i = n1; i > 0 && i--;) {
+          if (nonunit) {
+            BASE Aii = A[lda * i + i];
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] /= Aii;
+            }
+          }
 
-      for (k = 0; k < i; k++) {
-        const BASE Aik = A[i * lda + k];
-        for (j = 0; j < n2; j++) {
-          B[ldb * k + j] -= Aik * B[ldb * i + j];
+          for (k = 0; k < i; k++) {
+            const BASE Aik = A[i * lda + k];
+            for (j = j0; j < j1; j++) {
+              B[ldb * k + j] -= Aik * B[ldb * i + j];
+            }
+          }
         }
-      }
-    }
 
-  } else if (side == CblasRight && uplo == CblasUpper && trans == CblasNoTrans) {
+      } else if (side == CblasRight && uplo == CblasUpper && trans == CblasNoTrans) {
 
-    /* form  B := alpha * B * inv(TriU(A)) */
+        /* form  B := alpha * B * inv(TriU(A)) */
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
-        }
-      }
-    }
-
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        if (nonunit) {
-          BASE Ajj = A[lda * j + j];
-          B[ldb * i + j] /= Ajj;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
 
-        {
-          BASE Bij = B[ldb * i + j];
-          for (k = j + 1; k < n2; k++) {
-            B[ldb * i + k] -= A[j * lda + k] * Bij;
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            if (nonunit) {
+              BASE Ajj = A[lda * j + j];
+              B[ldb * i + j] /= Ajj;
+            }
+
+            {
+              BASE Bij = B[ldb * i + j];
+              for (k = j + 1; k < n2; k++) {
+                B[ldb * i + k] -= A[j * lda + k] * Bij;
+              }
+            }
           }
         }
-      }
-    }
 
-  } else if (side == CblasRight && uplo == CblasUpper && trans == CblasTrans) {
+      } else if (side == CblasRight && uplo == CblasUpper && trans == CblasTrans) {
 
-    /* form  B := alpha * B * inv(TriU(A))' */
+        /* form  B := alpha * B * inv(TriU(A))' */
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
-    }
 
-    for (i = 0; i < n1; i++) {
-      for (j = n2; j > 0 && j--;) {
+        for (i = i0; i < i1; i++) {
+          for (j = n2; j > 0 && j--;) {
 
-        if (nonunit) {
-          BASE Ajj = A[lda * j + j];
-          B[ldb * i + j] /= Ajj;
-        }
+            if (nonunit) {
+              BASE Ajj = A[lda * j + j];
+              B[ldb * i + j] /= Ajj;
+            }
 
-        {
-          BASE Bij = B[ldb * i + j];
-          for (k = 0; k < j; k++) {
-            B[ldb * i + k] -= A[k * lda + j] * Bij;
+            {
+              BASE Bij = B[ldb * i + j];
+              for (k = 0; k < j; k++) {
+                B[ldb * i + k] -= A[k * lda + j] * Bij;
+              }
+            }
           }
         }
-      }
-    }
 
 
-  } else if (side == CblasRight && uplo == CblasLower && trans == CblasNoTrans) {
+      } else if (side == CblasRight && uplo == CblasLower && trans == CblasNoTrans) {
 
-    /* form  B := alpha * B * inv(TriL(A)) */
+        /* form  B := alpha * B * inv(TriL(A)) */
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
-      }
-    }
 
-    for (i = 0; i < n1; i++) {
-      for (j = n2; j > 0 && j--;) {
+        for (i = i0; i < i1; i++) {
+          for (j = n2; j > 0 && j--;) {
 
-        if (nonunit) {
-          BASE Ajj = A[lda * j + j];
-          B[ldb * i + j] /= Ajj;
-        }
+            if (nonunit) {
+              BASE Ajj = A[lda * j + j];
+              B[ldb * i + j] /= Ajj;
+            }
 
-        {
-          BASE Bij = B[ldb * i + j];
-          for (k = 0; k < j; k++) {
-            B[ldb * i + k] -= A[j * lda + k] * Bij;
+            {
+              BASE Bij = B[ldb * i + j];
+              for (k = 0; k < j; k++) {
+                B[ldb * i + k] -= A[j * lda + k] * Bij;
+              }
+            }
           }
         }
-      }
-    }
 
-  } else if (side == CblasRight && uplo == CblasLower && trans == CblasTrans) {
+      } else if (side == CblasRight && uplo == CblasLower && trans == CblasTrans) {
 
-    /* form  B := alpha * B * inv(TriL(A))' */
+        /* form  B := alpha * B * inv(TriL(A))' */
 
 
-    if (alpha != 1.0) {
-      for (i = 0; i < n1; i++) {
-        for (j = 0; j < n2; j++) {
-          B[ldb * i + j] *= alpha;
-        }
-      }
-    }
-
-    for (i = 0; i < n1; i++) {
-      for (j = 0; j < n2; j++) {
-        if (nonunit) {
-          BASE Ajj = A[lda * j + j];
-          B[ldb * i + j] /= Ajj;
+        if (alpha != 1.0) {
+          for (i = i0; i < i1; i++) {
+            for (j = j0; j < j1; j++) {
+              B[ldb * i + j] *= alpha;
+            }
+          }
         }
 
-        {
-          BASE Bij = B[ldb * i + j];
-          for (k = j + 1; k < n2; k++) {
-            B[ldb * i + k] -= A[k * lda + j] * Bij;
+        for (i = i0; i < i1; i++) {
+          for (j = j0; j < j1; j++) {
+            if (nonunit) {
+              BASE Ajj = A[lda * j + j];
+              B[ldb * i + j] /= Ajj;
+            }
+
+            {
+              BASE Bij = B[ldb * i + j];
+              for (k = j + 1; k < n2; k++) {
+                B[ldb * i + k] -= A[k * lda + j] * Bij;
+              }
+            }
           }
         }
-      }
-    }
 
 
 
-  } else {
-    BLAS_ERROR("unrecognized operation");
+      } else {
+        BLAS_ERROR("unrecognized operation");
+      }
+    }
   }
 }
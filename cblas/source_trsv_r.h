@@ -28,6 +28,50 @@
   if (N == 0)
     return;
 
+#ifdef KERNEL
+  if (incX == 1) {
+    const cblas_kernel_type *kernel = KERNEL;
+
+    if ((order == CblasRowMajor && Trans == CblasNoTrans && Uplo == CblasUpper)
+        || (order == CblasColMajor && Trans == CblasTrans && Uplo == CblasLower)) {
+      /* backsubstitution, rows of A */
+      for (i = N; i-- > 0;) {
+        const BASE tmp = X[i] - kernel->dot (N - 1 - i, A + lda * i + i + 1, X + i + 1);
+        X[i] = nonunit ? tmp / A[lda * i + i] : tmp;
+      }
+    } else if ((order == CblasRowMajor && Trans == CblasNoTrans && Uplo == CblasLower)
+               || (order == CblasColMajor && Trans == CblasTrans && Uplo == CblasUpper)) {
+      /* forward substitution, rows of A */
+      for (i = 0; i < N; i++) {
+        const BASE tmp = X[i] - kernel->dot (i, A + lda * i, X);
+        X[i] = nonunit ? tmp / A[lda * i + i] : tmp;
+      }
+    } else if ((order == CblasRowMajor && Trans == CblasTrans && Uplo == CblasUpper)
+               || (order == CblasColMajor && Trans == CblasNoTrans && Uplo == CblasLower)) {
+      /* forward substitution, eliminating along rows of A */
+      for (j = 0; j < N; j++) {
+        if (nonunit) {
+          X[j] /= A[lda * j + j];
+        }
+        kernel->axpy (N - 1 - j, -X[j], A + lda * j + j + 1, X + j + 1);
+      }
+    } else if ((order == CblasRowMajor && Trans == CblasTrans && Uplo == CblasLower)
+               || (order == CblasColMajor && Trans == CblasNoTrans && Uplo == CblasUpper)) {
+      /* backsubstitution, eliminating along rows of A */
+      for (j = N; j-- > 0;) {
+        if (nonunit) {
+          X[j] /= A[lda * j + j];
+        }
+        kernel->axpy (j, -X[j], A + lda * j, X);
+      }
+    } else {
+      BLAS_ERROR("unrecognized operation");
+    }
+
+    return;
+  }
+#endif
+
   /* form  x := inv( A )*x */
 
   if ((order == CblasRowMajor && Trans == CblasNoTrans && Uplo == CblasUpper)
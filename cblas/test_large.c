@@ -0,0 +1,556 @@
+/* cblas/test_large.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The tables in test_*.c only use tiny operands.  The tests here use
+   problem sizes large enough to go through the blocked and vectorized
+   code paths and compare against a straightforward reference computed
+   in double precision. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+
+#include "tests.h"
+
+static unsigned long int large_seed = 1;
+
+static double
+large_random (void)
+{
+  large_seed = (1103515245UL * large_seed + 12345UL) & 0x7fffffffUL;
+  return 2.0 * (double) large_seed / 2147483648.0 - 1.0;
+}
+
+static void
+large_fill (double *x, const size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    x[i] = large_random ();
+}
+
+/* element (i,j) of op(X) where X is stored with leading dimension ldx
+   in the given order; for complex data (nc = 2) the element is
+   returned in z[0], z[1] */
+static void
+large_op (const int order, const int trans, const double *X, const int ldx,
+          const int nc, const int i, const int j, double z[2])
+{
+  int r = (trans == CblasNoTrans) ? i : j;
+  int c = (trans == CblasNoTrans) ? j : i;
+  size_t idx = (order == CblasRowMajor) ? (size_t) ldx * r + c : (size_t) ldx * c + r;
+
+  z[0] = X[nc * idx];
+  z[1] = (nc == 2) ? X[nc * idx + 1] : 0.0;
+
+  if (trans == CblasConjTrans)
+    z[1] = -z[1];
+}
+
+static void
+large_gemm (const int nc, const int order, const int transA, const int transB,
+            const int M, const int N, const int K, const double *alpha,
+            const double *A, const int lda, const double *B, const int ldb,
+            const double *beta, double *C, const int ldc)
+{
+  int i, j, k;
+
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          size_t idx = (order == CblasRowMajor) ? (size_t) ldc * i + j : (size_t) ldc * j + i;
+          double sr = 0.0, si = 0.0, cr, ci;
+
+          for (k = 0; k < K; ++k)
+            {
+              double a[2], b[2];
+              large_op (order, transA, A, lda, nc, i, k, a);
+              large_op (order, transB, B, ldb, nc, k, j, b);
+              sr += a[0] * b[0] - a[1] * b[1];
+              si += a[0] * b[1] + a[1] * b[0];
+            }
+
+          /* C is not referenced when beta = 0 */
+          cr = (beta[0] == 0.0 && beta[1] == 0.0) ? 0.0 : C[nc * idx];
+          ci = ((beta[0] == 0.0 && beta[1] == 0.0) || nc == 1) ? 0.0 : C[nc * idx + 1];
+
+          C[nc * idx] = alpha[0] * sr - alpha[1] * si + beta[0] * cr - beta[1] * ci;
+          if (nc == 2)
+            C[nc * idx + 1] = alpha[0] * si + alpha[1] * sr + beta[0] * ci + beta[1] * cr;
+        }
+    }
+}
+
+static double
+large_maxdiff (const double *x, const double *y, const size_t n)
+{
+  double d = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      if (gsl_isnan (x[i]) && gsl_isnan (y[i]))
+        continue;
+
+      d = GSL_MAX (d, fabs (x[i] - y[i]));
+    }
+
+  return d;
+}
+
+static void
+test_large_gemm (void)
+{
+  const int M = 67, N = 131, K = 300;
+  const int orders[] = { CblasRowMajor, CblasColMajor };
+  const int trans[] = { CblasNoTrans, CblasTrans, CblasConjTrans };
+  const double alpha[] = { 0.7, -0.3 };
+  const double beta[] = { -1.1, 0.2 };
+  const double alpha1[] = { 0.7, 0.0 };
+  const double beta1[] = { -1.1, 0.0 };
+  const size_t nmax = 2 * (size_t) (N + 3) * (K + 3);
+  double *A = malloc (nmax * sizeof (double));
+  double *B = malloc (nmax * sizeof (double));
+  double *C = malloc (nmax * sizeof (double));
+  double *C_expected = malloc (nmax * sizeof (double));
+  float *Af = malloc (nmax * sizeof (float));
+  float *Bf = malloc (nmax * sizeof (float));
+  float *Cf = malloc (nmax * sizeof (float));
+  int io, ia, ib;
+  size_t i;
+
+  for (io = 0; io < 2; ++io)
+    {
+      for (ia = 0; ia < 3; ++ia)
+        {
+          for (ib = 0; ib < 3; ++ib)
+            {
+              const int order = orders[io];
+              const int tA = trans[ia], tB = trans[ib];
+              const int rowsA = (tA == CblasNoTrans) ? M : K;
+              const int colsA = (tA == CblasNoTrans) ? K : M;
+              const int rowsB = (tB == CblasNoTrans) ? K : N;
+              const int colsB = (tB == CblasNoTrans) ? N : K;
+              const int lda = ((order == CblasRowMajor) ? colsA : rowsA) + 3;
+              const int ldb = ((order == CblasRowMajor) ? colsB : rowsB) + 1;
+              const int ldc = ((order == CblasRowMajor) ? N : M) + 2;
+              const size_t na = (size_t) lda * ((order == CblasRowMajor) ? rowsA : colsA);
+              const size_t nb = (size_t) ldb * ((order == CblasRowMajor) ? rowsB : colsB);
+              const size_t ncc = (size_t) ldc * ((order == CblasRowMajor) ? M : N);
+              int nc;
+
+              for (nc = 1; nc <= 2; ++nc)
+                {
+                  const double tol = 1.0e-12 * K;
+                  const double tolf = 1.0e-4 * K;
+                  const double zero[] = { 0.0, 0.0 };
+                  double d;
+
+                  large_fill (A, nc * na);
+                  large_fill (B, nc * nb);
+                  large_fill (C, nc * ncc);
+
+                  for (i = 0; i < nc * na; ++i)
+                    Af[i] = (float) A[i];
+                  for (i = 0; i < nc * nb; ++i)
+                    Bf[i] = (float) B[i];
+                  for (i = 0; i < nc * ncc; ++i)
+                    {
+                      Cf[i] = (float) C[i];
+                      C_expected[i] = (double) Cf[i];
+                    }
+
+                  /* reference computed from the single precision data */
+                  {
+                    double *Ad = malloc (nc * na * sizeof (double));
+                    double *Bd = malloc (nc * nb * sizeof (double));
+                    const double alphaf[] = { (float) alpha[0], (float) alpha[1] };
+                    const double betaf[] = { (float) beta[0], (float) beta[1] };
+                    const double alphaf1[] = { (float) alpha[0], 0.0 };
+                    const double betaf1[] = { (float) beta[0], 0.0 };
+
+                    for (i = 0; i < nc * na; ++i)
+                      Ad[i] = Af[i];
+                    for (i = 0; i < nc * nb; ++i)
+                      Bd[i] = Bf[i];
+
+                    large_gemm (nc, order, tA, tB, M, N, K,
+                                nc == 2 ? alphaf : alphaf1,
+                                Ad, lda, Bd, ldb,
+                                nc == 2 ? betaf : betaf1,
+                                C_expected, ldc);
+
+                    free (Ad);
+                    free (Bd);
+                  }
+
+                  if (nc == 1)
+                    cblas_sgemm (order, tA, tB, M, N, K, (float) alpha[0], Af, lda,
+                                 Bf, ldb, (float) beta[0], Cf, ldc);
+                  else
+                    {
+                      const float alphaf[] = { (float) alpha[0], (float) alpha[1] };
+                      const float betaf[] = { (float) beta[0], (float) beta[1] };
+                      cblas_cgemm (order, tA, tB, M, N, K, alphaf, Af, lda,
+                                   Bf, ldb, betaf, Cf, ldc);
+                    }
+
+                  d = 0.0;
+                  for (i = 0; i < nc * ncc; ++i)
+                    d = GSL_MAX (d, fabs ((double) Cf[i] - C_expected[i]));
+
+                  gsl_test (d > tolf, "%cgemm large order=%d transA=%d transB=%d maxdiff=%g",
+                            nc == 1 ? 's' : 'c', order, tA, tB, d);
+
+                  /* double precision */
+                  for (i = 0; i < nc * ncc; ++i)
+                    C_expected[i] = C[i];
+
+                  large_gemm (nc, order, tA, tB, M, N, K,
+                              nc == 2 ? alpha : alpha1,
+                              A, lda, B, ldb,
+                              nc == 2 ? beta : beta1,
+                              C_expected, ldc);
+
+                  if (nc == 1)
+                    cblas_dgemm (order, tA, tB, M, N, K, alpha[0], A, lda,
+                                 B, ldb, beta[0], C, ldc);
+                  else
+                    cblas_zgemm (order, tA, tB, M, N, K, alpha, A, lda,
+                                 B, ldb, beta, C, ldc);
+
+                  d = large_maxdiff (C, C_expected, nc * ncc);
+                  gsl_test (d > tol, "%cgemm large order=%d transA=%d transB=%d maxdiff=%g",
+                            nc == 1 ? 'd' : 'z', order, tA, tB, d);
+
+                  /* beta = 0 must overwrite C, including NaNs */
+                  for (i = 0; i < nc * ncc; ++i)
+                    {
+                      C[i] = GSL_NAN;
+                      C_expected[i] = GSL_NAN;
+                    }
+
+                  large_gemm (nc, order, tA, tB, M, N, K,
+                              nc == 2 ? alpha : alpha1,
+                              A, lda, B, ldb, zero, C_expected, ldc);
+
+                  if (nc == 1)
+                    cblas_dgemm (order, tA, tB, M, N, K, alpha[0], A, lda,
+                                 B, ldb, 0.0, C, ldc);
+                  else
+                    cblas_zgemm (order, tA, tB, M, N, K, alpha, A, lda,
+                                 B, ldb, zero, C, ldc);
+
+                  d = large_maxdiff (C, C_expected, nc * ncc);
+                  gsl_test (!(d <= tol), "%cgemm large beta=0 order=%d transA=%d transB=%d maxdiff=%g",
+                            nc == 1 ? 'd' : 'z', order, tA, tB, d);
+                }
+            }
+        }
+    }
+
+  free (A);
+  free (B);
+  free (C);
+  free (C_expected);
+  free (Af);
+  free (Bf);
+  free (Cf);
+}
+
+static void
+test_large_level1 (void)
+{
+  const int N = 1003;
+  const double scales[] = { 1.0, 1.0e300, 1.0e-300, 1.0e-310 };
+  double *X = malloc (2 * N * sizeof (double));
+  double *Y = malloc (2 * N * sizeof (double));
+  double *Y_expected = malloc (2 * N * sizeof (double));
+  double r, r_expected;
+  size_t is;
+  int i;
+
+  large_fill (X, 2 * N);
+  large_fill (Y, 2 * N);
+
+  /* axpy */
+  for (i = 0; i < N; ++i)
+    Y_expected[i] = Y[i] + 0.3 * X[i];
+  cblas_daxpy (N, 0.3, X, 1, Y, 1);
+  r = large_maxdiff (Y, Y_expected, N);
+  gsl_test (r > 1.0e-15, "daxpy large incX=1 maxdiff=%g", r);
+
+  /* scal */
+  for (i = 0; i < N; ++i)
+    Y_expected[i] = -1.7 * Y[i];
+  cblas_dscal (N, -1.7, Y, 1);
+  r = large_maxdiff (Y, Y_expected, N);
+  gsl_test (r > 1.0e-15, "dscal large incX=1 maxdiff=%g", r);
+
+  /* dot, unit and non-unit strides */
+  r_expected = 0.0;
+  for (i = 0; i < N; ++i)
+    r_expected += X[i] * Y[i];
+  r = cblas_ddot (N, X, 1, Y, 1);
+  gsl_test_rel (r, r_expected, 1.0e-12, "ddot large incX=1");
+
+  r_expected = 0.0;
+  for (i = 0; i < N; ++i)
+    r_expected += X[2 * i] * Y[i];
+  r = cblas_ddot (N, X, 2, Y, 1);
+  gsl_test_rel (r, r_expected, 1.0e-12, "ddot large incX=2");
+
+  /* nrm2 must not overflow or underflow */
+  for (is = 0; is < sizeof (scales) / sizeof (scales[0]); ++is)
+    {
+      double ssq = 0.0;
+
+      for (i = 0; i < N; ++i)
+        {
+          Y[i] = scales[is] * X[i];
+          ssq += X[i] * X[i];
+        }
+
+      r = cblas_dnrm2 (N, Y, 1);
+      gsl_test_rel (r / scales[is], sqrt (ssq), (is < 3) ? 1.0e-14 : 1.0e-8,
+                    "dnrm2 large scale=%g", scales[is]);
+    }
+
+  Y[N / 2] = GSL_POSINF;
+  r = cblas_dnrm2 (N, Y, 1);
+  gsl_test (!gsl_isinf (r), "dnrm2 large with infinity");
+
+  Y[N / 3] = GSL_NAN;
+  r = cblas_dnrm2 (N, Y, 1);
+  gsl_test (!gsl_isnan (r), "dnrm2 large with nan");
+
+  free (X);
+  free (Y);
+  free (Y_expected);
+}
+
+static void
+test_large_level2 (void)
+{
+  const int M = 91, N = 173;
+  const int orders[] = { CblasRowMajor, CblasColMajor };
+  const int trans[] = { CblasNoTrans, CblasTrans };
+  const int uplos[] = { CblasUpper, CblasLower };
+  const int diags[] = { CblasNonUnit, CblasUnit };
+  const int lda = N + 5;
+  double *A = malloc ((size_t) lda * N * sizeof (double));
+  double *X = malloc (N * sizeof (double));
+  double *Y = malloc (N * sizeof (double));
+  double *Y_expected = malloc (N * sizeof (double));
+  int io, it, iu, id, i, j;
+
+  large_fill (A, (size_t) lda * N);
+  large_fill (X, N);
+
+  /* gemv */
+  for (io = 0; io < 2; ++io)
+    {
+      for (it = 0; it < 2; ++it)
+        {
+          const int order = orders[io], tA = trans[it];
+          const int lenY = (tA == CblasNoTrans) ? M : N;
+          const int lenX = (tA == CblasNoTrans) ? N : M;
+          double r;
+
+          large_fill (Y, lenY);
+
+          for (i = 0; i < lenY; ++i)
+            {
+              double sum = 0.0;
+              double z[2];
+
+              for (j = 0; j < lenX; ++j)
+                {
+                  large_op (order, tA, A, lda, 1, i, j, z);
+                  sum += z[0] * X[j];
+                }
+
+              Y_expected[i] = 0.5 * Y[i] + 1.3 * sum;
+            }
+
+          cblas_dgemv (order, tA, M, N, 1.3, A, lda, X, 1, 0.5, Y, 1);
+          r = large_maxdiff (Y, Y_expected, lenY);
+          gsl_test (r > 1.0e-12, "dgemv large order=%d trans=%d maxdiff=%g",
+                    order, tA, r);
+        }
+    }
+
+  /* trsv, with a well conditioned triangle */
+  for (i = 0; i < lda * N; ++i)
+    A[i] *= 0.01;
+  for (i = 0; i < N; ++i)
+    A[lda * i + i] += 1.0;
+
+  for (io = 0; io < 2; ++io)
+    {
+      for (it = 0; it < 2; ++it)
+        {
+          for (iu = 0; iu < 2; ++iu)
+            {
+              for (id = 0; id < 2; ++id)
+                {
+                  const int order = orders[io], tA = trans[it];
+                  const int uplo = uplos[iu], diag = diags[id];
+                  double r;
+
+                  /* Y_expected = op(T) X, then solve op(T) Y = Y_expected */
+                  for (i = 0; i < N; ++i)
+                    {
+                      double sum = 0.0;
+                      double z[2];
+
+                      for (j = 0; j < N; ++j)
+                        {
+                          int ti = (tA == CblasNoTrans) ? i : j;
+                          int tj = (tA == CblasNoTrans) ? j : i;
+
+                          if ((uplo == CblasUpper && ti > tj) || (uplo == CblasLower && ti < tj))
+                            continue;
+
+                          if (ti == tj && diag == CblasUnit)
+                            z[0] = 1.0;
+                          else
+                            large_op (order, tA, A, lda, 1, i, j, z);
+
+                          sum += z[0] * X[j];
+                        }
+
+                      Y[i] = sum;
+                    }
+
+                  cblas_dtrsv (order, uplo, tA, diag, N, A, lda, Y, 1);
+                  r = large_maxdiff (Y, X, N);
+                  gsl_test (r > 1.0e-10, "dtrsv large order=%d uplo=%d trans=%d diag=%d maxdiff=%g",
+                            order, uplo, tA, diag, r);
+                }
+            }
+        }
+    }
+
+  free (A);
+  free (X);
+  free (Y);
+  free (Y_expected);
+}
+
+/* the level 3 routines must give identical results for any number of
+   threads */
+static void
+test_large_threads (void)
+{
+  const int N = 157, M = 141;
+  const int nthreads = gsl_cblas_get_num_threads ();
+  const int orders[] = { CblasRowMajor, CblasColMajor };
+  const int sides[] = { CblasLeft, CblasRight };
+  const int uplos[] = { CblasUpper, CblasLower };
+  const int trans[] = { CblasNoTrans, CblasTrans };
+  const size_t n = (size_t) N * N;
+  double *A = malloc (n * sizeof (double));
+  double *B = malloc (n * sizeof (double));
+  double *C1 = malloc (n * sizeof (double));
+  double *C4 = malloc (n * sizeof (double));
+  int io, is, iu, it, pass;
+  size_t i;
+
+  large_fill (A, n);
+  large_fill (B, n);
+
+  for (i = 0; i < (size_t) N; ++i)
+    A[i * N + i] += 4.0;
+
+  for (io = 0; io < 2; ++io)
+    {
+      for (is = 0; is < 2; ++is)
+        {
+          for (iu = 0; iu < 2; ++iu)
+            {
+              for (it = 0; it < 2; ++it)
+                {
+                  const int order = orders[io], side = sides[is];
+                  const int uplo = uplos[iu], tA = trans[it];
+                  const char *names[] = { "dgemm", "dsyrk", "dsyr2k", "dsymm", "dtrmm", "dtrsm" };
+                  int r;
+
+                  for (r = 0; r < 6; ++r)
+                    {
+                      for (pass = 0; pass < 2; ++pass)
+                        {
+                          double *C = (pass == 0) ? C1 : C4;
+
+                          gsl_cblas_set_num_threads ((pass == 0) ? 1 : 4);
+                          memcpy (C, B, n * sizeof (double));
+
+                          switch (r)
+                            {
+                            case 0:
+                              cblas_dgemm (order, tA, (side == CblasLeft) ? CblasNoTrans : CblasTrans,
+                                           M, N, N, 0.5, A, N, B, N, -1.5, C, N);
+                              break;
+                            case 1:
+                              cblas_dsyrk (order, uplo, tA, N, N, 0.5, A, N, -1.5, C, N);
+                              break;
+                            case 2:
+                              cblas_dsyr2k (order, uplo, tA, N, M, 0.5, A, N, B, N, -1.5, C, N);
+                              break;
+                            case 3:
+                              cblas_dsymm (order, side, uplo, M, N - 7, 0.5, A, N, B, N, -1.5, C, N);
+                              break;
+                            case 4:
+                              cblas_dtrmm (order, side, uplo, tA, CblasNonUnit, M, N - 7, 0.5, A, N, C, N);
+                              break;
+                            case 5:
+                              cblas_dtrsm (order, side, uplo, tA, CblasNonUnit, M, N - 7, 0.5, A, N, C, N);
+                              break;
+                            }
+                        }
+
+                      gsl_test (memcmp (C1, C4, n * sizeof (double)) != 0,
+                                "%s threads order=%d side=%d uplo=%d trans=%d",
+                                names[r], order, side, uplo, tA);
+                    }
+                }
+            }
+        }
+    }
+
+  gsl_cblas_set_num_threads (nthreads);
+
+  free (A);
+  free (B);
+  free (C1);
+  free (C4);
+}
+
+void
+test_large (void)
+{
+  test_large_gemm ();
+  test_large_level1 ();
+  test_large_level2 ();
+  test_large_threads ();
+}
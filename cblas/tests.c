@@ -42,3 +42,4 @@
   test_her2k ();
   test_trmm ();
   test_trsm ();
+  test_large ();
@@ -42,3 +42,4 @@ void test_syr2k (void);
 void test_her2k (void);
 void test_trmm (void);
 void test_trsm (void);
+void test_large (void);
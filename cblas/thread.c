@@ -0,0 +1,82 @@
+/* cblas/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <gsl/gsl_cblas.h>
+#include "thread_internal.h"
+#include "thread.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* the thread count is the one shared with libgsl, see sys/thread.c */
+
+void
+gsl_cblas_set_num_threads (const int n)
+{
+  sys_thread_set_num (n);
+}
+
+int
+gsl_cblas_get_num_threads (void)
+{
+  return sys_thread_get_num ();
+}
+
+int
+cblas_thread_count (const double work)
+{
+  int n = sys_thread_count ((size_t) work, (size_t) CBLAS_THREAD_MIN_WORK);
+
+  if (n > 1 && work < n * CBLAS_THREAD_CHUNK)
+    n = (int) (work / CBLAS_THREAD_CHUNK);
+
+  return (n > 1) ? n : 1;
+}
+
+int
+cblas_thread_id (void)
+{
+#ifdef _OPENMP
+  return omp_get_thread_num ();
+#else
+  return 0;
+#endif
+}
+
+int
+cblas_thread_total (void)
+{
+#ifdef _OPENMP
+  return omp_get_num_threads ();
+#else
+  return 1;
+#endif
+}
+
+void
+cblas_thread_range (const int n, int *lo, int *hi)
+{
+  const int id = cblas_thread_id ();
+  const int nt = cblas_thread_total ();
+  const int q = n / nt, r = n % nt;
+
+  *lo = id * q + (id < r ? id : r);
+  *hi = *lo + q + (id < r ? 1 : 0);
+}
@@ -0,0 +1,43 @@
+/* cblas/thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_THREAD_H__
+#define __CBLAS_THREAD_H__
+
+/* Threading of the level 3 routines.  Work is shared out so that each
+   element of the output is computed by a single thread, in the same
+   order of operations as the serial code, so results are independent
+   of the number of threads.  Operations with fewer than
+   CBLAS_THREAD_MIN_WORK multiply-adds stay single-threaded, and each
+   thread is given at least CBLAS_THREAD_CHUNK multiply-adds. */
+
+#define CBLAS_THREAD_MIN_WORK 1.0e6
+#define CBLAS_THREAD_CHUNK 2.5e5
+
+/* number of threads to use for an operation of the given size */
+int cblas_thread_count (const double work);
+
+/* index of the calling thread and size of the current team */
+int cblas_thread_id (void);
+int cblas_thread_total (void);
+
+/* contiguous share [lo, hi) of 0 <= i < n for the calling thread */
+void cblas_thread_range (const int n, int *lo, int *hi);
+
+#endif /* __CBLAS_THREAD_H__ */
@@ -36,6 +36,10 @@
  * It will also optionally compute the full Schur form and matrix of
  * Schur vectors.
  *
+ * Matrices of size MS_NMIN or larger are handled by the small-bulge
+ * multishift QR algorithm with aggressive early deflation in
+ * multishift.c, which uses the double shift code on small blocks.
+ *
  * See Golub & Van Loan, "Matrix Computations" (3rd ed),
  * algorithm 7.5.2
  */
@@ -56,6 +60,10 @@ static inline void francis_schur_standardize(gsl_matrix *A,
                                              gsl_eigen_francis_workspace *w);
 static inline size_t francis_get_submatrix(gsl_matrix *A, gsl_matrix *B);
 static void francis_standard_form(gsl_matrix *A, double *cs, double *sn);
+static int francis_schur(gsl_matrix * H, gsl_vector_complex * eval,
+                         gsl_eigen_francis_workspace * w);
+
+#include "multishift.c"
 
 /*
 gsl_eigen_francis_alloc()
@@ -163,50 +171,15 @@ gsl_eigen_francis (gsl_matrix * H, gsl_vector_complex * eval,
     }
   else
     {
-      const size_t N = H->size1;
-      int j;
-
-      /*
-       * Set internal parameters which depend on matrix size.
-       * The Francis solver can be called with any size matrix
-       * since the workspace does not depend on N.
-       * Furthermore, multishift solvers which call the Francis
-       * solver may need to call it with different sized matrices
-       */
-      w->size = N;
-      w->max_iterations = 30 * N;
-
-      /*
-       * save a pointer to original matrix since francis_schur_decomp
-       * is recursive
-       */
-      w->H = H;
-
-      w->n_iter = 0;
-      w->n_evals = 0;
+      int status = francis_schur(H, eval, w);
 
-      /*
-       * zero out the first two subdiagonals (below the main subdiagonal)
-       * needed as scratch space by the QR sweep routine
-       */
-      for (j = 0; j < (int) N - 3; ++j)
+      if (status == GSL_EMAXITER)
         {
-          gsl_matrix_set(H, (size_t) j + 2, (size_t) j, 0.0);
-          gsl_matrix_set(H, (size_t) j + 3, (size_t) j, 0.0);
+          GSL_ERROR ("maximum iterations reached without finding all eigenvalues", GSL_EMAXITER);
         }
-
-      if (N > 2)
-        gsl_matrix_set(H, N - 1, N - 3, 0.0);
-
-      /*
-       * compute Schur decomposition of H and store eigenvalues
-       * into eval
-       */
-      francis_schur_decomp(H, eval, w);
-
-      if (w->n_evals != N)
+      else if (status != GSL_SUCCESS)
         {
-          GSL_ERROR ("maximum iterations reached without finding all eigenvalues", GSL_EMAXITER);
+          GSL_ERROR ("failed to allocate multishift workspace", status);
         }
 
       return GSL_SUCCESS;
@@ -276,6 +249,83 @@ gsl_eigen_francis_Z (gsl_matrix * H, gsl_vector_complex * eval,
  *           INTERNAL ROUTINES              *
  ********************************************/
 
+/*
+francis_schur()
+  Compute the Schur decomposition of the hessenberg matrix H,
+using the multishift algorithm for large matrices. This is
+gsl_eigen_francis() without the argument checks and error handler,
+so it may also be called on the deflation windows of the
+multishift code.
+
+Inputs: H     - upper hessenberg matrix
+        eval  - where to store eigenvalues
+        w     - workspace
+
+Return: GSL_SUCCESS, GSL_EMAXITER if not all eigenvalues were
+        found, or GSL_ENOMEM
+*/
+
+static int
+francis_schur(gsl_matrix * H, gsl_vector_complex * eval,
+              gsl_eigen_francis_workspace * w)
+{
+  const size_t N = H->size1;
+  int j;
+
+  /*
+   * Set internal parameters which depend on matrix size.
+   * The Francis solver can be called with any size matrix
+   * since the workspace does not depend on N.
+   * Furthermore, multishift solvers which call the Francis
+   * solver may need to call it with different sized matrices
+   */
+  w->size = N;
+  w->max_iterations = 30 * N;
+
+  /*
+   * save a pointer to original matrix since francis_schur_decomp
+   * is recursive
+   */
+  w->H = H;
+
+  w->n_iter = 0;
+  w->n_evals = 0;
+
+  /*
+   * zero out the first two subdiagonals (below the main subdiagonal)
+   * needed as scratch space by the QR sweep routine
+   */
+  for (j = 0; j < (int) N - 3; ++j)
+    {
+      gsl_matrix_set(H, (size_t) j + 2, (size_t) j, 0.0);
+      gsl_matrix_set(H, (size_t) j + 3, (size_t) j, 0.0);
+    }
+
+  if (N > 2)
+    gsl_matrix_set(H, N - 1, N - 3, 0.0);
+
+  /*
+   * compute Schur decomposition of H and store eigenvalues
+   * into eval
+   */
+  if (N >= MS_NMIN)
+    {
+      francis_ms_workspace *ms = francis_ms_alloc(N);
+
+      if (ms == 0)
+        return GSL_ENOMEM;
+
+      francis_ms_schur(H, eval, w, ms);
+      francis_ms_free(ms);
+    }
+  else
+    {
+      francis_schur_decomp(H, eval, w);
+    }
+
+  return (w->n_evals == N) ? GSL_SUCCESS : GSL_EMAXITER;
+} /* francis_schur() */
+
 /*
 francis_schur_decomp()
   Compute the Schur decomposition of the matrix H
@@ -57,6 +57,40 @@ gsl_eigen_symmv_workspace * gsl_eigen_symmv_alloc (const size_t n);
 void gsl_eigen_symmv_free (gsl_eigen_symmv_workspace * w);
 int gsl_eigen_symmv (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_workspace * w);
 
+typedef struct {
+  size_t size;
+  double * d;
+  double * sd;
+  double * gc;
+  double * gs;
+  double * work;
+  size_t * iwork;
+  gsl_matrix * Z;
+  gsl_matrix * W;
+} gsl_eigen_symmvd_workspace;
+
+gsl_eigen_symmvd_workspace * gsl_eigen_symmvd_alloc (const size_t n);
+void gsl_eigen_symmvd_free (gsl_eigen_symmvd_workspace * w);
+int gsl_eigen_symmvd (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmvd_workspace * w);
+
+typedef struct {
+  size_t size;
+  double * d;
+  double * sd;
+  double * tau;
+  double * work;
+  int * iwork;
+} gsl_eigen_symmvx_workspace;
+
+gsl_eigen_symmvx_workspace * gsl_eigen_symmvx_alloc (const size_t n);
+void gsl_eigen_symmvx_free (gsl_eigen_symmvx_workspace * w);
+int gsl_eigen_symmvx_index (gsl_matrix * A, const size_t il, const size_t iu,
+                            gsl_vector * eval, gsl_matrix * evec,
+                            gsl_eigen_symmvx_workspace * w);
+int gsl_eigen_symmvx_range (gsl_matrix * A, const double vl, const double vu,
+                            gsl_vector * eval, gsl_matrix * evec, size_t * nev,
+                            gsl_eigen_symmvx_workspace * w);
+
 typedef struct {
   size_t size;
   double * d;
@@ -0,0 +1,52 @@
+/* eigen/gsl_eigen_rsymmv.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_EIGEN_RSYMMV_H__
+#define __GSL_EIGEN_RSYMMV_H__
+
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_linalg_rsvd.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+#define __BEGIN_DECLS extern "C" {
+#define __END_DECLS }
+#else
+#define __BEGIN_DECLS           /* empty */
+#define __END_DECLS             /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Randomized symmetric eigensolver */
+
+int gsl_eigen_rsymmv (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                      gsl_vector * eval, gsl_matrix * evec,
+                      gsl_linalg_rsvd_workspace * w);
+int gsl_eigen_rsymmv_op (const gsl_linalg_operator * A, const size_t q,
+                         gsl_rng * r, gsl_vector * eval, gsl_matrix * evec,
+                         gsl_linalg_rsvd_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_EIGEN_RSYMMV_H__ */
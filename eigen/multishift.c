@@ -0,0 +1,1312 @@
+/* eigen/multishift.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module implements the small-bulge multishift QR algorithm
+ * with aggressive early deflation for a real upper Hessenberg
+ * matrix. It is included by francis.c and uses its internal routines
+ * for the double shift iteration and the 2-by-2 standard form.
+ *
+ * Each iteration first looks for converged eigenvalues in a window
+ * at the bottom of the active block (aggressive early deflation).
+ * The undeflatable eigenvalues of the window are then used as shifts
+ * for a sweep which chases a tightly packed chain of 3-by-3 bulges
+ * down the diagonal. The reflectors of the chain are applied to a
+ * small diagonal window and accumulated in an orthogonal matrix U,
+ * which is then applied to the rest of H and to Z with Level 3 BLAS.
+ * Blocks smaller than MS_NMIN use the double shift code.
+ *
+ * See:
+ *
+ * K. Braman, R. Byers and R. Mathias, "The Multishift QR Algorithm.
+ * Part I: Maintaining Well-Focused Shifts and Level 3 Performance",
+ * SIAM J. Matrix Anal. Appl. 23 (2002) 929-947.
+ *
+ * K. Braman, R. Byers and R. Mathias, "The Multishift QR Algorithm.
+ * Part II: Aggressive Early Deflation", SIAM J. Matrix Anal. Appl.
+ * 23 (2002) 948-973.
+ *
+ * and LAPACK routines DLAQR0, DLAQR3, DLAQR5 and DLAEXC
+ */
+
+#define MS_NMIN           75   /* crossover to the double shift code */
+#define MS_NIBBLE         14   /* skip the sweep if AED deflates more than this percentage */
+#define MS_KEXSH          6    /* iterations without deflation between exceptional shifts */
+
+/* exceptional shift coefficients - these values are from LAPACK DLAQR0 */
+#define MS_WILK1          (0.75)
+#define MS_WILK2          (-0.4375)
+
+typedef struct
+{
+  size_t size;      /* matrix size */
+  size_t nsmax;     /* maximum number of shifts per sweep */
+  size_t nw;        /* size of the deflation window */
+  gsl_matrix *T;    /* deflation window */
+  gsl_matrix *V;    /* Schur vectors of the deflation window */
+  gsl_matrix *Q;    /* Hessenberg reduction of the deflation window */
+  gsl_matrix *U;    /* accumulated reflectors of a sweep */
+  gsl_vector *tau;  /* Householder coefficients */
+  gsl_vector *work; /* workspace for the updates with U and V */
+  gsl_vector_complex *eval; /* eigenvalues of the deflation window */
+  double *wr, *wi;  /* eigenvalues of the deflation window */
+  double *sr, *si;  /* shifts */
+
+  gsl_eigen_francis_workspace *francis_workspace_p;
+} francis_ms_workspace;
+
+static francis_ms_workspace *francis_ms_alloc (const size_t n);
+static void francis_ms_free (francis_ms_workspace * ms);
+static void francis_ms_schur (gsl_matrix * H, gsl_vector_complex * eval,
+                              gsl_eigen_francis_workspace * w,
+                              francis_ms_workspace * ms);
+static size_t francis_ms_aed (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                              const size_t nw, gsl_vector_complex * eval,
+                              gsl_eigen_francis_workspace * w,
+                              francis_ms_workspace * ms, size_t * nsu);
+static size_t francis_ms_shifts (const gsl_matrix * H, const size_t ktop,
+                                 const size_t kbot, size_t ns, const size_t nsu,
+                                 const int exceptional, francis_ms_workspace * ms);
+static void francis_ms_sweep (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                              const size_t ns, gsl_eigen_francis_workspace * w,
+                              francis_ms_workspace * ms);
+static void francis_ms_apply (const gsl_matrix * U, const size_t j,
+                              const size_t ltop, const size_t rbot,
+                              gsl_eigen_francis_workspace * w, gsl_vector * work);
+static void francis_ms_trexc (gsl_matrix * T, gsl_matrix * V, size_t ifst,
+                              const size_t ilst);
+static int francis_ms_swap (gsl_matrix * T, gsl_matrix * V, const size_t j1,
+                            const size_t n1, const size_t n2);
+static void francis_ms_sylvester (const gsl_matrix * D, const size_t n1,
+                                  const size_t n2, double x[]);
+static void francis_ms_standardize (gsl_matrix * T, gsl_matrix * V, const size_t j);
+static void francis_ms_evals (const gsl_matrix * T, double wr[], double wi[]);
+static void francis_ms_eig2 (double a, double b, double c, double d,
+                             double wr[], double wi[]);
+
+/*
+francis_ms_nshifts()
+  Number of shifts per sweep for an n-by-n matrix, from LAPACK
+routine IPARMQ
+*/
+
+static size_t
+francis_ms_nshifts (const size_t n)
+{
+  size_t ns;
+
+  if (n < 30)
+    ns = 2;
+  else if (n < 60)
+    ns = 4;
+  else if (n < 150)
+    ns = 10;
+  else if (n < 590)
+    ns = GSL_MAX (10, n / (size_t) floor (log ((double) n) / M_LN2 + 0.5));
+  else if (n < 3000)
+    ns = 64;
+  else if (n < 6000)
+    ns = 128;
+  else
+    ns = 256;
+
+  return GSL_MAX (2, ns - (ns % 2));
+} /* francis_ms_nshifts() */
+
+/*
+francis_ms_alloc()
+  Allocate a workspace for the multishift QR algorithm on an n-by-n
+Hessenberg matrix
+*/
+
+static francis_ms_workspace *
+francis_ms_alloc (const size_t n)
+{
+  francis_ms_workspace *ms;
+  size_t kdu;
+
+  ms = (francis_ms_workspace *) calloc (1, sizeof (francis_ms_workspace));
+
+  if (ms == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  ms->size = n;
+  ms->nsmax = GSL_MIN (francis_ms_nshifts (n), GSL_MAX (2, (n + 6) / 9));
+  ms->nsmax -= ms->nsmax % 2;
+  ms->nw = (n <= 500) ? ms->nsmax : 3 * ms->nsmax / 2;
+  ms->nw = GSL_MAX (2, GSL_MIN (ms->nw, (n - 1) / 3));
+
+  /* rows touched by a chain of nsmax/2 bulges moving 3*nsmax/2 rows */
+  kdu = 3 * ms->nsmax;
+
+  ms->T = gsl_matrix_alloc (ms->nw, ms->nw);
+  ms->V = gsl_matrix_alloc (ms->nw, ms->nw);
+  ms->Q = gsl_matrix_alloc (ms->nw, ms->nw);
+  ms->U = gsl_matrix_alloc (kdu, kdu);
+  ms->tau = gsl_vector_alloc (ms->nw);
+  ms->work = gsl_vector_alloc (n * GSL_MAX (ms->nw, kdu));
+  ms->eval = gsl_vector_complex_alloc (ms->nw);
+  ms->wr = malloc (ms->nw * sizeof (double));
+  ms->wi = malloc (ms->nw * sizeof (double));
+  ms->sr = malloc (ms->nsmax * sizeof (double));
+  ms->si = malloc (ms->nsmax * sizeof (double));
+  ms->francis_workspace_p = gsl_eigen_francis_alloc ();
+
+  if (ms->T == 0 || ms->V == 0 || ms->Q == 0 || ms->U == 0 ||
+      ms->tau == 0 || ms->work == 0 || ms->eval == 0 ||
+      ms->wr == 0 || ms->wi == 0 || ms->sr == 0 || ms->si == 0 ||
+      ms->francis_workspace_p == 0)
+    {
+      francis_ms_free (ms);
+      GSL_ERROR_NULL ("failed to allocate space for multishift workspace", GSL_ENOMEM);
+    }
+
+  /* the deflation window is always reduced to Schur form */
+  gsl_eigen_francis_T (1, ms->francis_workspace_p);
+
+  return ms;
+} /* francis_ms_alloc() */
+
+static void
+francis_ms_free (francis_ms_workspace * ms)
+{
+  RETURN_IF_NULL (ms);
+
+  if (ms->T)
+    gsl_matrix_free (ms->T);
+
+  if (ms->V)
+    gsl_matrix_free (ms->V);
+
+  if (ms->Q)
+    gsl_matrix_free (ms->Q);
+
+  if (ms->U)
+    gsl_matrix_free (ms->U);
+
+  if (ms->tau)
+    gsl_vector_free (ms->tau);
+
+  if (ms->work)
+    gsl_vector_free (ms->work);
+
+  if (ms->eval)
+    gsl_vector_complex_free (ms->eval);
+
+  free (ms->wr);
+  free (ms->wi);
+  free (ms->sr);
+  free (ms->si);
+
+  if (ms->francis_workspace_p)
+    gsl_eigen_francis_free (ms->francis_workspace_p);
+
+  free (ms);
+} /* francis_ms_free() */
+
+/*
+francis_ms_schur()
+  Compute the Schur decomposition of the Hessenberg matrix H with
+the multishift QR algorithm. The eigenvalues are stored in eval as
+they are found, as in francis_schur_decomp().
+
+Inputs: H    - upper Hessenberg matrix, H = w->H
+        eval - where to store eigenvalues
+        w    - francis workspace
+        ms   - multishift workspace
+
+Notes: if the iteration does not converge, w->n_evals < N on output
+*/
+
+static void
+francis_ms_schur (gsl_matrix * H, gsl_vector_complex * eval,
+                  gsl_eigen_francis_workspace * w, francis_ms_workspace * ms)
+{
+  const size_t N = H->size1;
+  const size_t itmax = 30 * GSL_MAX (10, N);
+  size_t kbot = N;   /* the active block is H(ktop:kbot-1,ktop:kbot-1) */
+  size_t ndfl = 1;   /* iterations since the last deflation */
+  size_t it;
+
+  for (it = 0; kbot > 0 && it < itmax; ++it)
+    {
+      size_t ktop, nh, nw, nd, nsu;
+
+      /* locate the active block, setting a negligible subdiagonal to zero */
+      for (ktop = kbot - 1; ktop > 0; --ktop)
+        {
+          const double sel = gsl_matrix_get (H, ktop, ktop - 1);
+          const double del = gsl_matrix_get (H, ktop, ktop);
+          const double dpel = gsl_matrix_get (H, ktop - 1, ktop - 1);
+
+          if ((sel == 0.0) ||
+              (fabs (sel) < GSL_DBL_EPSILON * (fabs (del) + fabs (dpel))))
+            {
+              gsl_matrix_set (H, ktop, ktop - 1, 0.0);
+              break;
+            }
+        }
+
+      nh = kbot - ktop;
+
+      if (nh < MS_NMIN)
+        {
+          /* small block: use the double shift code */
+          gsl_matrix_view m = gsl_matrix_submatrix (H, ktop, ktop, nh, nh);
+          const size_t n_evals = w->n_evals;
+
+          w->n_iter = 0;
+          francis_schur_decomp (&m.matrix, eval, w);
+
+          if (w->n_evals != n_evals + nh)
+            return;
+
+          kbot = ktop;
+          ndfl = 1;
+          continue;
+        }
+
+      /* aggressive early deflation */
+      nw = GSL_MIN (ms->nw, nh - 1);
+      nd = francis_ms_aed (H, ktop, kbot, nw, eval, w, ms, &nsu);
+      kbot -= nd;
+      ndfl = (nd > 0) ? 1 : ndfl + 1;
+
+      /*
+       * chase a chain of bulges unless the deflation window found
+       * enough converged eigenvalues to make another try worthwhile
+       */
+      if ((nd == 0) ||
+          ((100 * nd <= MS_NIBBLE * nw) && (kbot - ktop > GSL_MIN (MS_NMIN, ms->nw))))
+        {
+          size_t ns = GSL_MIN (ms->nsmax, kbot - ktop - 1);
+
+          ns = francis_ms_shifts (H, ktop, kbot, ns - (ns % 2), nsu,
+                                  (ndfl % MS_KEXSH) == 0, ms);
+          francis_ms_sweep (H, ktop, kbot, ns, w, ms);
+        }
+    }
+} /* francis_ms_schur() */
+
+/*
+francis_ms_aed()
+  Aggressive early deflation. Compute the Schur form T = V' W V of
+the nw-by-nw window W at the bottom of the active block and deflate
+the eigenvalues whose components in the spike s V(0,:) are
+negligible, where s = H(kwtop,kwtop-1). The undeflatable eigenvalues
+are moved to the top of T and the window is returned to Hessenberg
+form.
+
+Inputs: H    - upper Hessenberg matrix
+        ktop - top of the active block
+        kbot - bottom of the active block (exclusive)
+        nw   - window size, nw < kbot - ktop
+        eval - where to store the deflated eigenvalues
+        w    - francis workspace
+        ms   - multishift workspace; on output the undeflated
+               eigenvalues are in ms->wr and ms->wi
+        nsu  - (output) number of undeflated eigenvalues
+
+Return: number of deflated eigenvalues
+*/
+
+static size_t
+francis_ms_aed (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                const size_t nw, gsl_vector_complex * eval,
+                gsl_eigen_francis_workspace * w, francis_ms_workspace * ms,
+                size_t * nsu)
+{
+  const size_t N = H->size1;
+  const size_t kwtop = kbot - nw;
+  const double ulp = GSL_DBL_EPSILON;
+  const double smlnum = GSL_DBL_MIN * ((double) N / ulp);
+  gsl_matrix_view T = gsl_matrix_submatrix (ms->T, 0, 0, nw, nw);
+  gsl_matrix_view V = gsl_matrix_submatrix (ms->V, 0, 0, nw, nw);
+  gsl_matrix_view W = gsl_matrix_submatrix (H, kwtop, kwtop, nw, nw);
+  gsl_vector_complex_view ev = gsl_vector_complex_subvector (ms->eval, 0, nw);
+  double s = (kwtop > ktop) ? gsl_matrix_get (H, kwtop, kwtop - 1) : 0.0;
+  size_t ns = nw;   /* number of undeflated eigenvalues */
+  size_t ilst = 0;  /* top of the eigenvalues still to check */
+  size_t j;
+  int status;
+
+  *nsu = 0;
+
+  /* Schur form of the window */
+  gsl_matrix_memcpy (&T.matrix, &W.matrix);
+  gsl_linalg_hessenberg_set_zero (&T.matrix);
+  gsl_matrix_set_identity (&V.matrix);
+
+  ms->francis_workspace_p->Z = &V.matrix;
+  status = francis_schur (&T.matrix, &ev.vector, ms->francis_workspace_p);
+  ms->francis_workspace_p->Z = NULL;
+
+  if (status != GSL_SUCCESS)
+    return 0;
+
+  gsl_linalg_hessenberg_set_zero (&T.matrix);
+
+  /* deflation check, from the bottom of the window */
+  while (ilst < ns)
+    {
+      const size_t k = ns - 1;
+
+      if (k == 0 || gsl_matrix_get (&T.matrix, k, k - 1) == 0.0)
+        {
+          /* 1-by-1 block */
+          double foo = fabs (gsl_matrix_get (&T.matrix, k, k));
+
+          if (foo == 0.0)
+            foo = fabs (s);
+
+          if (fabs (s * gsl_matrix_get (&V.matrix, 0, k)) <= GSL_MAX (smlnum, ulp * foo))
+            {
+              ns -= 1;
+            }
+          else
+            {
+              /* undeflatable - move it to the top */
+              francis_ms_trexc (&T.matrix, &V.matrix, k, ilst);
+              ilst += 1;
+            }
+        }
+      else
+        {
+          /* 2-by-2 block */
+          double foo = fabs (gsl_matrix_get (&T.matrix, k, k)) +
+                       sqrt (fabs (gsl_matrix_get (&T.matrix, k, k - 1))) *
+                       sqrt (fabs (gsl_matrix_get (&T.matrix, k - 1, k)));
+
+          if (foo == 0.0)
+            foo = fabs (s);
+
+          if (GSL_MAX (fabs (s * gsl_matrix_get (&V.matrix, 0, k)),
+                       fabs (s * gsl_matrix_get (&V.matrix, 0, k - 1))) <=
+              GSL_MAX (smlnum, ulp * foo))
+            {
+              ns -= 2;
+            }
+          else
+            {
+              francis_ms_trexc (&T.matrix, &V.matrix, k - 1, ilst);
+              ilst += 2;
+            }
+        }
+    }
+
+  if (ns == 0)
+    s = 0.0;
+
+  /* the undeflated eigenvalues are the shifts for the next sweep */
+  if (ns > 0)
+    {
+      gsl_matrix_view T11 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, ns);
+      francis_ms_evals (&T11.matrix, ms->wr, ms->wi);
+    }
+
+  *nsu = ns;
+
+  if (ns == nw && s != 0.0)
+    {
+      /* nothing deflated - leave H unchanged */
+      return 0;
+    }
+
+  if (ns > 1 && s != 0.0)
+    {
+      gsl_vector_view x = gsl_vector_subvector (ms->work, 0, ns);
+      gsl_vector_view v0 = gsl_matrix_subrow (&V.matrix, 0, 0, ns);
+      gsl_matrix_view T1 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, nw);
+      gsl_matrix_view T11 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, ns);
+      gsl_matrix_view V1 = gsl_matrix_submatrix (&V.matrix, 0, 0, nw, ns);
+      gsl_matrix_view Q = gsl_matrix_submatrix (ms->Q, 0, 0, ns, ns);
+      gsl_vector_view tau = gsl_vector_subvector (ms->tau, 0, ns);
+      gsl_matrix_view B;
+      double tau_s;
+
+      /* reflect the spike s V(0,0:ns-1) back to a multiple of e_1 */
+      gsl_vector_memcpy (&x.vector, &v0.vector);
+      gsl_vector_scale (&x.vector, s);
+      tau_s = gsl_linalg_householder_transform (&x.vector);
+      gsl_vector_set (&x.vector, 0, 1.0);
+
+      gsl_linalg_householder_hm (tau_s, &x.vector, &T1.matrix);
+      gsl_linalg_householder_mh (tau_s, &x.vector, &T11.matrix);
+      gsl_linalg_householder_mh (tau_s, &x.vector, &V1.matrix);
+
+      /* return T(0:ns-1,0:ns-1) to Hessenberg form */
+      gsl_linalg_hessenberg_decomp (&T11.matrix, &tau.vector);
+      gsl_linalg_hessenberg_unpack (&T11.matrix, &tau.vector, &Q.matrix);
+      gsl_linalg_hessenberg_set_zero (&T11.matrix);
+
+      if (ns < nw)
+        {
+          gsl_matrix_view T12 = gsl_matrix_submatrix (&T.matrix, 0, ns, ns, nw - ns);
+
+          B = gsl_matrix_view_vector (ms->work, ns, nw - ns);
+          gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Q.matrix, &T12.matrix,
+                          0.0, &B.matrix);
+          gsl_matrix_memcpy (&T12.matrix, &B.matrix);
+        }
+
+      B = gsl_matrix_view_vector (ms->work, nw, ns);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &V1.matrix, &Q.matrix,
+                      0.0, &B.matrix);
+      gsl_matrix_memcpy (&V1.matrix, &B.matrix);
+    }
+
+  /* copy the window back into H and update the rest of H and Z */
+  if (kwtop > ktop)
+    gsl_matrix_set (H, kwtop, kwtop - 1, s * gsl_matrix_get (&V.matrix, 0, 0));
+
+  gsl_matrix_memcpy (&W.matrix, &T.matrix);
+
+  francis_ms_apply (&V.matrix, kwtop, w->compute_t ? 0 : ktop,
+                    w->compute_t ? N : kbot, w, ms->work);
+
+  /* store the deflated eigenvalues */
+  if (ns < nw)
+    {
+      gsl_matrix_view T22 = gsl_matrix_submatrix (&T.matrix, ns, ns, nw - ns, nw - ns);
+
+      francis_ms_evals (&T22.matrix, ms->wr + ns, ms->wi + ns);
+
+      for (j = nw; j > ns; --j)
+        {
+          gsl_complex z;
+          GSL_SET_COMPLEX (&z, ms->wr[j - 1], ms->wi[j - 1]);
+          gsl_vector_complex_set (eval, w->n_evals, z);
+          w->n_evals += 1;
+        }
+    }
+
+  return nw - ns;
+} /* francis_ms_aed() */
+
+/*
+francis_ms_shifts()
+  Choose the shifts for a sweep and store them in ms->sr and ms->si,
+in pairs of complex conjugate or real shifts
+
+Inputs: H           - upper Hessenberg matrix
+        ktop        - top of the active block
+        kbot        - bottom of the active block (exclusive)
+        ns          - requested (even) number of shifts
+        nsu         - number of eigenvalues from the deflation
+                      window in ms->wr, ms->wi
+        exceptional - use exceptional shifts
+        ms          - multishift workspace
+
+Return: number of shifts
+*/
+
+static size_t
+francis_ms_shifts (const gsl_matrix * H, const size_t ktop, const size_t kbot,
+                   size_t ns, const size_t nsu, const int exceptional,
+                   francis_ms_workspace * ms)
+{
+  double *sr = ms->sr, *si = ms->si;
+  size_t n = 0;
+
+  if (exceptional)
+    {
+      /* shifts from modified 2-by-2 blocks at the bottom, see DLAQR0 */
+      size_t i;
+
+      for (i = kbot - 1; i >= ktop + 2 && n < ns; i -= 2)
+        {
+          const double ss = fabs (gsl_matrix_get (H, i, i - 1)) +
+                            fabs (gsl_matrix_get (H, i - 1, i - 2));
+          const double aa = MS_WILK1 * ss + gsl_matrix_get (H, i, i);
+
+          francis_ms_eig2 (aa, ss, MS_WILK2 * ss, aa, sr + n, si + n);
+          n += 2;
+        }
+    }
+  else
+    {
+      /*
+       * take the eigenvalues at the bottom of the deflation window,
+       * keeping complex conjugates together and pairing real shifts
+       */
+      const double *wr = ms->wr, *wi = ms->wi;
+      size_t i = nsu, ipend = 0;
+      int pending = 0;
+
+      while (i > 0 && n < ns)
+        {
+          --i;
+
+          if (wi[i] != 0.0)
+            {
+              if (i == 0)
+                break;
+
+              sr[n] = wr[i - 1];
+              si[n] = wi[i - 1];
+              sr[n + 1] = wr[i];
+              si[n + 1] = wi[i];
+              n += 2;
+              --i;
+            }
+          else if (pending)
+            {
+              sr[n] = wr[ipend];
+              si[n] = 0.0;
+              sr[n + 1] = wr[i];
+              si[n + 1] = 0.0;
+              n += 2;
+              pending = 0;
+            }
+          else
+            {
+              ipend = i;
+              pending = 1;
+            }
+        }
+
+      if (n == 2 && si[0] == 0.0)
+        {
+          /* two real shifts: use the one closer to H(kbot-1,kbot-1) twice */
+          const double hnn = gsl_matrix_get (H, kbot - 1, kbot - 1);
+
+          if (fabs (sr[0] - hnn) < fabs (sr[1] - hnn))
+            sr[1] = sr[0];
+          else
+            sr[0] = sr[1];
+        }
+    }
+
+  if (n < 2)
+    {
+      /* no shifts available: use the eigenvalues of the trailing 2-by-2 block */
+      francis_ms_eig2 (gsl_matrix_get (H, kbot - 2, kbot - 2),
+                       gsl_matrix_get (H, kbot - 2, kbot - 1),
+                       gsl_matrix_get (H, kbot - 1, kbot - 2),
+                       gsl_matrix_get (H, kbot - 1, kbot - 1), sr, si);
+      n = 2;
+    }
+
+  return n;
+} /* francis_ms_shifts() */
+
+/*
+francis_ms_sweep()
+  Perform a small-bulge multishift QR sweep on the active block
+H(ktop:kbot-1,ktop:kbot-1) with the ns shifts in ms->sr, ms->si.
+
+The ns/2 bulges are introduced at the top one after another and
+chased down together, 3 rows apart. Bulge j is at row
+p = ktop + t - 3j at time t, where its reflector acts on rows and
+columns p:p+2. Chasing the lower bulges first at each time reproduces
+the result of chasing the bulges one at a time.
+
+The chain is moved 3*ns/2 rows at a time. The reflectors for each
+move only touch the diagonal window H(w0:w1-1,w0:w1-1) and the rows
+and columns outside it; they are applied to the window directly and
+accumulated in U, which is then applied to the rest of H and to Z
+with dgemm.
+*/
+
+static void
+francis_ms_sweep (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                  const size_t ns, gsl_eigen_francis_workspace * w,
+                  francis_ms_workspace * ms)
+{
+  const size_t N = H->size1;
+  const size_t tda = H->tda;
+  const size_t nbmps = ns / 2;
+  const size_t kstep = 3 * nbmps;
+  const size_t nsteps = kbot - ktop - 1 + 3 * (nbmps - 1);
+  const size_t ltop = w->compute_t ? 0 : ktop;
+  const size_t rbot = w->compute_t ? N : kbot;
+  size_t t0;
+
+  for (t0 = 0; t0 < nsteps; t0 += kstep)
+    {
+      const size_t t1 = GSL_MIN (t0 + kstep, nsteps);
+      const size_t w0 = (t0 > 3 * (nbmps - 1)) ? ktop + t0 - 3 * (nbmps - 1) : ktop;
+      const size_t w1 = GSL_MIN (kbot, ktop + t1 + 3);
+      const size_t nwin = w1 - w0;
+      gsl_matrix_view U = gsl_matrix_submatrix (ms->U, 0, 0, nwin, nwin);
+      size_t t;
+
+      gsl_matrix_set_identity (&U.matrix);
+
+      for (t = t0; t < t1; ++t)
+        {
+          size_t j;
+
+          for (j = 0; j < nbmps && 3 * j <= t; ++j)
+            {
+              const size_t p = ktop + t - 3 * j;
+              size_t nv, i, k;
+              double v[3], tau, *h;
+              gsl_vector_view vv;
+
+              if (p + 2 > kbot)
+                continue;   /* bulge j has left the active block */
+
+              nv = GSL_MIN (3, kbot - p);
+
+              if (p == ktop)
+                {
+                  /*
+                   * introduce the bulge: v is proportional to the first
+                   * column of (H - s1 I)(H - s2 I), see DLAQR1
+                   */
+                  const double sr1 = ms->sr[2 * j], si1 = ms->si[2 * j];
+                  const double sr2 = ms->sr[2 * j + 1], si2 = ms->si[2 * j + 1];
+                  const double h00 = gsl_matrix_get (H, p, p);
+                  const double h10 = gsl_matrix_get (H, p + 1, p);
+                  const double s = fabs (h00 - sr2) + fabs (si2) + fabs (h10);
+
+                  if (s == 0.0)
+                    {
+                      v[0] = v[1] = v[2] = 0.0;
+                    }
+                  else
+                    {
+                      const double h10s = h10 / s;
+
+                      v[0] = h10s * gsl_matrix_get (H, p, p + 1) +
+                             (h00 - sr1) * ((h00 - sr2) / s) - si1 * (si2 / s);
+                      v[1] = h10s * (h00 + gsl_matrix_get (H, p + 1, p + 1) - sr1 - sr2);
+                      v[2] = h10s * gsl_matrix_get (H, p + 2, p + 1);
+                    }
+                }
+              else
+                {
+                  for (i = 0; i < nv; ++i)
+                    v[i] = gsl_matrix_get (H, p + i, p - 1);
+                }
+
+              vv = gsl_vector_view_array (v, nv);
+              tau = gsl_linalg_householder_transform (&vv.vector);
+
+              if (p > ktop)
+                {
+                  gsl_matrix_set (H, p, p - 1, v[0]);
+                  for (i = 1; i < nv; ++i)
+                    gsl_matrix_set (H, p + i, p - 1, 0.0);
+                }
+
+              v[0] = 1.0;
+
+              if (tau == 0.0)
+                continue;
+
+              /* left: rows p:p+nv-1, columns p:w1-1 */
+              for (k = p; k < w1; ++k)
+                {
+                  double sum = 0.0;
+
+                  h = H->data + p * tda + k;
+                  for (i = 0; i < nv; ++i)
+                    sum += v[i] * h[i * tda];
+
+                  sum *= tau;
+                  for (i = 0; i < nv; ++i)
+                    h[i * tda] -= sum * v[i];
+                }
+
+              /* right: columns p:p+nv-1, rows w0:min(p+3,kbot-1) */
+              for (k = w0; k < GSL_MIN (p + 4, kbot); ++k)
+                {
+                  double sum = 0.0;
+
+                  h = H->data + k * tda + p;
+                  for (i = 0; i < nv; ++i)
+                    sum += h[i] * v[i];
+
+                  sum *= tau;
+                  for (i = 0; i < nv; ++i)
+                    h[i] -= sum * v[i];
+                }
+
+              /* accumulate U = U P */
+              for (k = 0; k < nwin; ++k)
+                {
+                  double sum = 0.0;
+
+                  h = gsl_matrix_ptr (&U.matrix, k, p - w0);
+                  for (i = 0; i < nv; ++i)
+                    sum += h[i] * v[i];
+
+                  sum *= tau;
+                  for (i = 0; i < nv; ++i)
+                    h[i] -= sum * v[i];
+                }
+            }
+        }
+
+      francis_ms_apply (&U.matrix, w0, ltop, rbot, w, ms->work);
+    }
+} /* francis_ms_sweep() */
+
+/*
+francis_ms_apply()
+  Apply the orthogonal similarity transformation U of rows and
+columns j:j+n-1 of H to the rest of H and to Z:
+
+H(ltop:j-1,j:j+n-1) = H(ltop:j-1,j:j+n-1) U
+H(j:j+n-1,j+n:rbot-1) = U' H(j:j+n-1,j+n:rbot-1)
+Z(:,j:j+n-1) = Z(:,j:j+n-1) U
+*/
+
+static void
+francis_ms_apply (const gsl_matrix * U, const size_t j, const size_t ltop,
+                  const size_t rbot, gsl_eigen_francis_workspace * w,
+                  gsl_vector * work)
+{
+  const size_t n = U->size1;
+  gsl_matrix_view A, B;
+
+  if (j > ltop)
+    {
+      A = gsl_matrix_submatrix (w->H, ltop, j, j - ltop, n);
+      B = gsl_matrix_view_vector (work, j - ltop, n);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &A.matrix, U, 0.0, &B.matrix);
+      gsl_matrix_memcpy (&A.matrix, &B.matrix);
+    }
+
+  if (rbot > j + n)
+    {
+      A = gsl_matrix_submatrix (w->H, j, j + n, n, rbot - j - n);
+      B = gsl_matrix_view_vector (work, n, rbot - j - n);
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, U, &A.matrix, 0.0, &B.matrix);
+      gsl_matrix_memcpy (&A.matrix, &B.matrix);
+    }
+
+  if (w->Z)
+    {
+      A = gsl_matrix_submatrix (w->Z, 0, j, w->Z->size1, n);
+      B = gsl_matrix_view_vector (work, w->Z->size1, n);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &A.matrix, U, 0.0, &B.matrix);
+      gsl_matrix_memcpy (&A.matrix, &B.matrix);
+    }
+} /* francis_ms_apply() */
+
+/*
+francis_ms_trexc()
+  Move the diagonal block of the quasi-triangular matrix T starting
+at row ifst up to row ilst by swapping adjacent blocks, accumulating
+the transformations in V. Based on LAPACK routine DTREXC. The move
+stops early if a swap is rejected.
+*/
+
+static void
+francis_ms_trexc (gsl_matrix * T, gsl_matrix * V, size_t ifst, const size_t ilst)
+{
+  const size_t n = T->size1;
+  size_t nbf = (ifst + 1 < n && gsl_matrix_get (T, ifst + 1, ifst) != 0.0) ? 2 : 1;
+
+  while (ifst > ilst)
+    {
+      const size_t nbnext =
+        (ifst >= 2 && gsl_matrix_get (T, ifst - 1, ifst - 2) != 0.0) ? 2 : 1;
+
+      if (ifst < ilst + nbnext)
+        break;
+
+      if (francis_ms_swap (T, V, ifst - nbnext, nbnext, nbf))
+        break;
+
+      ifst -= nbnext;
+
+      /* a 2-by-2 block may have split into two 1-by-1 blocks */
+      if (nbf == 2 && gsl_matrix_get (T, ifst + 1, ifst) == 0.0)
+        nbf = 1;
+    }
+} /* francis_ms_trexc() */
+
+/* apply the reflector I - tau v v' to rows i:i+2 of A from the left,
+   in columns j0:j1-1 */
+
+static void
+francis_ms_reflect_rows (gsl_matrix * A, const size_t i, const size_t j0,
+                         const size_t j1, const double v[], const double tau)
+{
+  size_t j;
+
+  for (j = j0; j < j1; ++j)
+    {
+      double sum = v[0] * gsl_matrix_get (A, i, j) +
+                   v[1] * gsl_matrix_get (A, i + 1, j) +
+                   v[2] * gsl_matrix_get (A, i + 2, j);
+
+      sum *= tau;
+      *gsl_matrix_ptr (A, i, j) -= sum * v[0];
+      *gsl_matrix_ptr (A, i + 1, j) -= sum * v[1];
+      *gsl_matrix_ptr (A, i + 2, j) -= sum * v[2];
+    }
+}
+
+/* apply the reflector I - tau v v' to columns j:j+2 of A from the
+   right, in rows i0:i1-1 */
+
+static void
+francis_ms_reflect_cols (gsl_matrix * A, const size_t j, const size_t i0,
+                         const size_t i1, const double v[], const double tau)
+{
+  size_t i;
+
+  for (i = i0; i < i1; ++i)
+    {
+      double *a = gsl_matrix_ptr (A, i, j);
+      double sum = tau * (v[0] * a[0] + v[1] * a[1] + v[2] * a[2]);
+
+      a[0] -= sum * v[0];
+      a[1] -= sum * v[1];
+      a[2] -= sum * v[2];
+    }
+}
+
+/*
+francis_ms_swap()
+  Swap the adjacent diagonal blocks T11 (n1-by-n1) and T22
+(n2-by-n2) of the quasi-triangular matrix T, starting at row j1, with
+an orthogonal similarity transformation which is accumulated in V.
+Based on LAPACK routine DLAEXC.
+
+Return: 0 on success, 1 if the swap was rejected because the
+        eigenvalues of T11 and T22 are too close; T and V are then
+        unchanged
+*/
+
+static int
+francis_ms_swap (gsl_matrix * T, gsl_matrix * V, const size_t j1,
+                 const size_t n1, const size_t n2)
+{
+  const size_t n = T->size1;
+  const size_t nv = V->size1;
+
+  if (n1 == 1 && n2 == 1)
+    {
+      /* rotate T11 = t11 to the bottom */
+      const size_t j2 = j1 + 1;
+      const double t11 = gsl_matrix_get (T, j1, j1);
+      const double t22 = gsl_matrix_get (T, j2, j2);
+      double a = gsl_matrix_get (T, j1, j2), b = t22 - t11, cs, sn;
+      gsl_vector_view x, y;
+
+      gsl_blas_drotg (&a, &b, &cs, &sn);
+
+      if (j2 + 1 < n)
+        {
+          x = gsl_matrix_subrow (T, j1, j2 + 1, n - j2 - 1);
+          y = gsl_matrix_subrow (T, j2, j2 + 1, n - j2 - 1);
+          gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+        }
+
+      if (j1 > 0)
+        {
+          x = gsl_matrix_subcolumn (T, j1, 0, j1);
+          y = gsl_matrix_subcolumn (T, j2, 0, j1);
+          gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+        }
+
+      gsl_matrix_set (T, j1, j1, t22);
+      gsl_matrix_set (T, j2, j2, t11);
+
+      x = gsl_matrix_column (V, j1);
+      y = gsl_matrix_column (V, j2);
+      gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+    }
+  else
+    {
+      const size_t nd = n1 + n2;
+      gsl_matrix_view Tb = gsl_matrix_submatrix (T, j1, j1, nd, nd);
+      double ddata[16], x[4], u1[3], u2[3], tau1, tau2 = 0.0;
+      double dnorm = 0.0, thresh;
+      gsl_matrix_view D = gsl_matrix_view_array (ddata, nd, nd);
+      gsl_vector_view h;
+      size_t i, j;
+
+      /* work on a copy D of the diagonal block first */
+      gsl_matrix_memcpy (&D.matrix, &Tb.matrix);
+
+      for (i = 0; i < nd; ++i)
+        {
+          for (j = 0; j < nd; ++j)
+            dnorm = GSL_MAX (dnorm, fabs (gsl_matrix_get (&D.matrix, i, j)));
+        }
+
+      thresh = GSL_MAX (10.0 * GSL_DBL_EPSILON * dnorm,
+                        GSL_DBL_MIN / GSL_DBL_EPSILON);
+
+      /* solve T11 X - X T22 = T12 */
+      francis_ms_sylvester (&D.matrix, n1, n2, x);
+
+      if (n1 == 1)
+        {
+          /* n2 = 2: reflector annihilating the first two elements of (1, X) */
+          const double t11 = gsl_matrix_get (T, j1, j1);
+          double hdata[3];
+
+          hdata[0] = x[1];
+          hdata[1] = 1.0;
+          hdata[2] = x[0];
+          h = gsl_vector_view_array (hdata, 3);
+          tau1 = gsl_linalg_householder_transform (&h.vector);
+          u1[0] = hdata[1];
+          u1[1] = hdata[2];
+          u1[2] = 1.0;
+
+          francis_ms_reflect_rows (&D.matrix, 0, 0, 3, u1, tau1);
+          francis_ms_reflect_cols (&D.matrix, 0, 0, 3, u1, tau1);
+
+          if (GSL_MAX (GSL_MAX (fabs (gsl_matrix_get (&D.matrix, 2, 0)),
+                                fabs (gsl_matrix_get (&D.matrix, 2, 1))),
+                       fabs (gsl_matrix_get (&D.matrix, 2, 2) - t11)) > thresh)
+            return 1;
+
+          francis_ms_reflect_rows (T, j1, j1, n, u1, tau1);
+          francis_ms_reflect_cols (T, j1, 0, j1 + 2, u1, tau1);
+
+          gsl_matrix_set (T, j1 + 2, j1, 0.0);
+          gsl_matrix_set (T, j1 + 2, j1 + 1, 0.0);
+          gsl_matrix_set (T, j1 + 2, j1 + 2, t11);
+
+          francis_ms_reflect_cols (V, j1, 0, nv, u1, tau1);
+        }
+      else if (n2 == 1)
+        {
+          /* n1 = 2: reflector annihilating the last two elements of (-X, 1) */
+          const double t33 = gsl_matrix_get (T, j1 + 2, j1 + 2);
+          double hdata[3];
+
+          hdata[0] = -x[0];
+          hdata[1] = -x[1];
+          hdata[2] = 1.0;
+          h = gsl_vector_view_array (hdata, 3);
+          tau1 = gsl_linalg_householder_transform (&h.vector);
+          u1[0] = 1.0;
+          u1[1] = hdata[1];
+          u1[2] = hdata[2];
+
+          francis_ms_reflect_rows (&D.matrix, 0, 0, 3, u1, tau1);
+          francis_ms_reflect_cols (&D.matrix, 0, 0, 3, u1, tau1);
+
+          if (GSL_MAX (GSL_MAX (fabs (gsl_matrix_get (&D.matrix, 1, 0)),
+                                fabs (gsl_matrix_get (&D.matrix, 2, 0))),
+                       fabs (gsl_matrix_get (&D.matrix, 0, 0) - t33)) > thresh)
+            return 1;
+
+          francis_ms_reflect_cols (T, j1, 0, j1 + 3, u1, tau1);
+          francis_ms_reflect_rows (T, j1, j1 + 1, n, u1, tau1);
+
+          gsl_matrix_set (T, j1, j1, t33);
+          gsl_matrix_set (T, j1 + 1, j1, 0.0);
+          gsl_matrix_set (T, j1 + 2, j1, 0.0);
+
+          francis_ms_reflect_cols (V, j1, 0, nv, u1, tau1);
+        }
+      else
+        {
+          /* n1 = n2 = 2: two reflectors for the QR factorization of (-X; I) */
+          double hdata[3], temp;
+
+          hdata[0] = -x[0];
+          hdata[1] = -x[2];
+          hdata[2] = 1.0;
+          h = gsl_vector_view_array (hdata, 3);
+          tau1 = gsl_linalg_householder_transform (&h.vector);
+          u1[0] = 1.0;
+          u1[1] = hdata[1];
+          u1[2] = hdata[2];
+
+          temp = -tau1 * (x[1] + u1[1] * x[3]);
+          hdata[0] = -temp * u1[1] - x[3];
+          hdata[1] = -temp * u1[2];
+          hdata[2] = 1.0;
+          tau2 = gsl_linalg_householder_transform (&h.vector);
+          u2[0] = 1.0;
+          u2[1] = hdata[1];
+          u2[2] = hdata[2];
+
+          francis_ms_reflect_rows (&D.matrix, 0, 0, 4, u1, tau1);
+          francis_ms_reflect_cols (&D.matrix, 0, 0, 4, u1, tau1);
+          francis_ms_reflect_rows (&D.matrix, 1, 0, 4, u2, tau2);
+          francis_ms_reflect_cols (&D.matrix, 1, 0, 4, u2, tau2);
+
+          if (GSL_MAX (GSL_MAX (fabs (gsl_matrix_get (&D.matrix, 2, 0)),
+                                fabs (gsl_matrix_get (&D.matrix, 2, 1))),
+                       GSL_MAX (fabs (gsl_matrix_get (&D.matrix, 3, 0)),
+                                fabs (gsl_matrix_get (&D.matrix, 3, 1)))) > thresh)
+            return 1;
+
+          francis_ms_reflect_rows (T, j1, j1, n, u1, tau1);
+          francis_ms_reflect_cols (T, j1, 0, j1 + 4, u1, tau1);
+          francis_ms_reflect_rows (T, j1 + 1, j1, n, u2, tau2);
+          francis_ms_reflect_cols (T, j1 + 1, 0, j1 + 4, u2, tau2);
+
+          gsl_matrix_set (T, j1 + 2, j1, 0.0);
+          gsl_matrix_set (T, j1 + 2, j1 + 1, 0.0);
+          gsl_matrix_set (T, j1 + 3, j1, 0.0);
+          gsl_matrix_set (T, j1 + 3, j1 + 1, 0.0);
+
+          francis_ms_reflect_cols (V, j1, 0, nv, u1, tau1);
+          francis_ms_reflect_cols (V, j1 + 1, 0, nv, u2, tau2);
+        }
+
+      /* put the new 2-by-2 blocks in standard form */
+      if (n2 == 2)
+        francis_ms_standardize (T, V, j1);
+
+      if (n1 == 2)
+        francis_ms_standardize (T, V, j1 + n2);
+    }
+
+  return 0;
+} /* francis_ms_swap() */
+
+/*
+francis_ms_sylvester()
+  Solve the Sylvester equation T11 X - X T22 = T12 for the n1-by-n2
+matrix X, where n1, n2 <= 2 and D = [ T11 T12 ; 0 T22 ], by Gaussian
+elimination with complete pivoting on the Kronecker form of the
+equation. Small pivots are perturbed as in LAPACK routine DLASY2.
+
+Inputs: D  - (n1+n2)-by-(n1+n2) matrix
+        n1 - size of T11
+        n2 - size of T22
+        x  - (output) X in row-major order
+*/
+
+static void
+francis_ms_sylvester (const gsl_matrix * D, const size_t n1, const size_t n2,
+                      double x[])
+{
+  const size_t m = n1 * n2;
+  double K[4][4], b[4], y[4], smin = 0.0;
+  size_t jpiv[4];
+  size_t i, j, k, l;
+
+  for (i = 0; i < n1 + n2; ++i)
+    {
+      for (j = i; j < n1 + n2; ++j)
+        smin = GSL_MAX (smin, fabs (gsl_matrix_get (D, i, j)));
+    }
+
+  smin = GSL_MAX (GSL_DBL_EPSILON * smin, GSL_DBL_MIN / GSL_DBL_EPSILON);
+
+  /* K vec(X) = vec(T12), with X(i,j) at position i + j*n1 */
+  for (j = 0; j < n2; ++j)
+    {
+      for (i = 0; i < n1; ++i)
+        {
+          const size_t r = i + j * n1;
+
+          for (l = 0; l < n2; ++l)
+            {
+              for (k = 0; k < n1; ++k)
+                {
+                  double kval = 0.0;
+
+                  if (j == l)
+                    kval += gsl_matrix_get (D, i, k);
+                  if (i == k)
+                    kval -= gsl_matrix_get (D, n1 + l, n1 + j);
+
+                  K[r][k + l * n1] = kval;
+                }
+            }
+
+          b[r] = gsl_matrix_get (D, i, n1 + j);
+        }
+    }
+
+  /* elimination with complete pivoting */
+  for (k = 0; k < m; ++k)
+    {
+      size_t ip = k, jp = k;
+      double pmax = 0.0;
+
+      for (i = k; i < m; ++i)
+        {
+          for (j = k; j < m; ++j)
+            {
+              if (fabs (K[i][j]) > pmax)
+                {
+                  pmax = fabs (K[i][j]);
+                  ip = i;
+                  jp = j;
+                }
+            }
+        }
+
+      if (ip != k)
+        {
+          double tmp;
+
+          for (j = 0; j < m; ++j)
+            {
+              tmp = K[k][j];
+              K[k][j] = K[ip][j];
+              K[ip][j] = tmp;
+            }
+
+          tmp = b[k];
+          b[k] = b[ip];
+          b[ip] = tmp;
+        }
+
+      if (jp != k)
+        {
+          for (i = 0; i < m; ++i)
+            {
+              double tmp = K[i][k];
+              K[i][k] = K[i][jp];
+              K[i][jp] = tmp;
+            }
+        }
+
+      jpiv[k] = jp;
+
+      if (fabs (K[k][k]) < smin)
+        K[k][k] = smin;
+
+      for (i = k + 1; i < m; ++i)
+        {
+          const double f = K[i][k] / K[k][k];
+
+          for (j = k + 1; j < m; ++j)
+            K[i][j] -= f * K[k][j];
+
+          b[i] -= f * b[k];
+        }
+    }
+
+  for (k = m; k > 0; --k)
+    {
+      double sum = b[k - 1];
+
+      for (j = k; j < m; ++j)
+        sum -= K[k - 1][j] * y[j];
+
+      y[k - 1] = sum / K[k - 1][k - 1];
+    }
+
+  /* undo the column interchanges */
+  for (k = m; k > 0; --k)
+    {
+      const size_t jp = jpiv[k - 1];
+      double tmp = y[k - 1];
+      y[k - 1] = y[jp];
+      y[jp] = tmp;
+    }
+
+  for (i = 0; i < n1; ++i)
+    {
+      for (j = 0; j < n2; ++j)
+        x[i * n2 + j] = y[i + j * n1];
+    }
+} /* francis_ms_sylvester() */
+
+/*
+francis_ms_standardize()
+  Put the 2-by-2 diagonal block of T at row j in standard form and
+apply the rotation to the rest of T and to V
+*/
+
+static void
+francis_ms_standardize (gsl_matrix * T, gsl_matrix * V, const size_t j)
+{
+  const size_t n = T->size1;
+  gsl_matrix_view A = gsl_matrix_submatrix (T, j, j, 2, 2);
+  gsl_vector_view x, y;
+  double cs, sn;
+
+  francis_standard_form (&A.matrix, &cs, &sn);
+
+  if (j + 2 < n)
+    {
+      x = gsl_matrix_subrow (T, j, j + 2, n - j - 2);
+      y = gsl_matrix_subrow (T, j + 1, j + 2, n - j - 2);
+      gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+    }
+
+  if (j > 0)
+    {
+      x = gsl_matrix_subcolumn (T, j, 0, j);
+      y = gsl_matrix_subcolumn (T, j + 1, 0, j);
+      gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+    }
+
+  x = gsl_matrix_column (V, j);
+  y = gsl_matrix_column (V, j + 1);
+  gsl_blas_drot (&x.vector, &y.vector, cs, sn);
+} /* francis_ms_standardize() */
+
+/*
+francis_ms_evals()
+  Eigenvalues of the quasi-triangular matrix T in standard form
+*/
+
+static void
+francis_ms_evals (const gsl_matrix * T, double wr[], double wi[])
+{
+  const size_t n = T->size1;
+  size_t j = 0;
+
+  while (j < n)
+    {
+      if (j + 1 < n && gsl_matrix_get (T, j + 1, j) != 0.0)
+        {
+          const double im = sqrt (fabs (gsl_matrix_get (T, j, j + 1))) *
+                            sqrt (fabs (gsl_matrix_get (T, j + 1, j)));
+
+          wr[j] = gsl_matrix_get (T, j, j);
+          wr[j + 1] = gsl_matrix_get (T, j + 1, j + 1);
+          wi[j] = im;
+          wi[j + 1] = -im;
+          j += 2;
+        }
+      else
+        {
+          wr[j] = gsl_matrix_get (T, j, j);
+          wi[j] = 0.0;
+          j += 1;
+        }
+    }
+} /* francis_ms_evals() */
+
+/*
+francis_ms_eig2()
+  Eigenvalues of the 2-by-2 matrix [ a b ; c d ]
+*/
+
+static void
+francis_ms_eig2 (double a, double b, double c, double d, double wr[], double wi[])
+{
+  double data[4];
+  gsl_matrix_view A = gsl_matrix_view_array (data, 2, 2);
+  double cs, sn;
+
+  data[0] = a;
+  data[1] = b;
+  data[2] = c;
+  data[3] = d;
+
+  francis_standard_form (&A.matrix, &cs, &sn);
+  francis_ms_evals (&A.matrix, wr, wi);
+} /* francis_ms_eig2() */
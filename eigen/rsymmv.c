@@ -0,0 +1,143 @@
+/* eigen/rsymmv.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_linalg_rsvd.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_eigen_rsymmv.h>
+
+/* Compute the k eigenvalues of largest magnitude, and their
+   eigenvectors, of a real symmetric matrix or operator by the
+   randomized range finder of gsl_linalg_rsvd_range.  With Q an
+   orthonormal basis of the dominant range of A, the eigenpairs are
+   approximated by those of the small matrix Q^T A Q (the
+   Rayleigh-Ritz method), computed with gsl_eigen_symmv.
+
+   See N. Halko, P. G. Martinsson and J. A. Tropp, "Finding structure
+   with randomness", SIAM Review 53 (2011), 217-288, Algorithm 5.3. */
+
+static int rsymmv_matrix_mult (CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                               gsl_matrix * Y, void * params);
+
+int
+gsl_eigen_rsymmv_op (const gsl_linalg_operator * A, const size_t q,
+                     gsl_rng * r, gsl_vector * eval, gsl_matrix * evec,
+                     gsl_linalg_rsvd_workspace * w)
+{
+  const size_t N = w->N;
+  const size_t k = w->k;
+  const size_t l = w->l;
+
+  if (A->size1 != A->size2 || w->M != w->N)
+    {
+      GSL_ERROR ("operator must be square", GSL_ENOTSQR);
+    }
+  else if (eval->size != k)
+    {
+      GSL_ERROR ("eigenvalue vector must have length k", GSL_EBADLEN);
+    }
+  else if (evec->size1 != N || evec->size2 != k)
+    {
+      GSL_ERROR ("eigenvector matrix must be N-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_eigen_symmv_workspace * ws;
+      gsl_matrix_view Zk = gsl_matrix_submatrix (w->Vb, 0, 0, l, k);
+      gsl_vector_view ek = gsl_vector_subvector (w->S, 0, k);
+      size_t i, j;
+      int status;
+
+      status = gsl_linalg_rsvd_range (A, q, r, w);
+      if (status)
+        return status;
+
+      /* T = Q^T A Q, symmetrized */
+
+      status = (A->mult) (CblasNoTrans, w->Q, w->Z, A->params);
+      if (status)
+        return status;
+
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, w->Q, w->Z, 0.0, w->T);
+
+      for (i = 0; i < l; ++i)
+        {
+          for (j = 0; j < i; ++j)
+            {
+              double tij = 0.5 * (gsl_matrix_get (w->T, i, j) +
+                                  gsl_matrix_get (w->T, j, i));
+              gsl_matrix_set (w->T, i, j, tij);
+              gsl_matrix_set (w->T, j, i, tij);
+            }
+        }
+
+      ws = gsl_eigen_symmv_alloc (l);
+      if (ws == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for eigensolver", GSL_ENOMEM);
+        }
+
+      status = gsl_eigen_symmv (w->T, w->S, w->Vb, ws);
+      gsl_eigen_symmv_free (ws);
+
+      if (status)
+        return status;
+
+      gsl_eigen_symmv_sort (w->S, w->Vb, GSL_EIGEN_SORT_ABS_DESC);
+
+      /* eigenvectors Q Z */
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, w->Q, &Zk.matrix, 0.0, evec);
+      gsl_vector_memcpy (eval, &ek.vector);
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_eigen_rsymmv (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                  gsl_vector * eval, gsl_matrix * evec,
+                  gsl_linalg_rsvd_workspace * w)
+{
+  gsl_linalg_operator op;
+
+  op.size1 = A->size1;
+  op.size2 = A->size2;
+  op.mult = &rsymmv_matrix_mult;
+  op.params = (void *) A;
+
+  return gsl_eigen_rsymmv_op (&op, q, r, eval, evec, w);
+}
+
+/* Y = A X, using the lower triangle of the symmetric matrix A */
+
+static int
+rsymmv_matrix_mult (CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                    gsl_matrix * Y, void * params)
+{
+  const gsl_matrix * A = (const gsl_matrix *) params;
+  (void) TransA;
+  return gsl_blas_dsymm (CblasLeft, CblasLower, 1.0, A, X, 0.0, Y);
+}
@@ -0,0 +1,705 @@
+/* eigen/symmvd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+
+/* Compute eigenvalues/eigenvectors of real symmetric matrix using
+   reduction to tridiagonal form, followed by the divide and conquer
+   method.
+
+   The tridiagonal matrix is split in two halves by a rank-one
+   modification, T = diag(T1, T2) + rho u u^T, the halves are solved
+   recursively, and the eigenvalues of the merged problem
+   D + rho z z^T are the roots of the secular equation
+
+     f(lambda) = 1 + rho sum_i z_i^2 / (d_i - lambda) = 0
+
+   Negligible components of z and pairs of close poles d_i are
+   deflated first.  The eigenvectors of the rank-one modification are
+   computed from a vector z recomputed from the roots, which keeps them
+   orthogonal, and are combined with those of the halves by a single
+   matrix-matrix product.  Blocks of up to SYMMVD_LEAF rows are solved
+   with the implicit QR method of symmv.c.
+
+   See J. J. M. Cuppen, "A divide and conquer method for the symmetric
+   tridiagonal eigenproblem", Numer. Math. 36 (1981), 177-195, and
+   M. Gu and S. C. Eisenstat, "A divide-and-conquer algorithm for the
+   symmetric tridiagonal eigenproblem", SIAM J. Matrix Anal. Appl. 16
+   (1995), 172-191.  The deflation and the secular equation solver
+   follow the LAPACK routines DLAED2 and DLAED4. */
+
+#include "qrstep.c"
+
+#define SYMMVD_LEAF 25
+
+static void symmvd_dc (double * d, double * sd, gsl_matrix * Z,
+                       gsl_matrix * U, gsl_eigen_symmvd_workspace * w);
+static void symmvd_leaf (double * d, double * sd, gsl_matrix * Z,
+                         gsl_eigen_symmvd_workspace * w);
+static void symmvd_merge (double * d, const size_t n1, const double beta,
+                          gsl_matrix * Z, gsl_matrix * U,
+                          gsl_eigen_symmvd_workspace * w);
+static double symmvd_secular (const size_t k, const size_t j,
+                              const double dl[], const double zl[],
+                              const double rho, double delta[]);
+
+gsl_eigen_symmvd_workspace *
+gsl_eigen_symmvd_alloc (const size_t n)
+{
+  gsl_eigen_symmvd_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_symmvd_workspace *) calloc (1, sizeof (gsl_eigen_symmvd_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+
+  w->d = (double *) malloc (n * sizeof (double));
+  w->sd = (double *) malloc (n * sizeof (double));
+  w->gc = (double *) malloc (n * sizeof (double));
+  w->gs = (double *) malloc (n * sizeof (double));
+  w->work = (double *) malloc (5 * n * sizeof (double));
+  w->iwork = (size_t *) malloc (3 * n * sizeof (size_t));
+
+  if (w->d == 0 || w->sd == 0 || w->gc == 0 || w->gs == 0 ||
+      w->work == 0 || w->iwork == 0)
+    {
+      gsl_eigen_symmvd_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->Z = gsl_matrix_alloc (n, n);
+  w->W = gsl_matrix_alloc (n, n);
+
+  if (w->Z == 0 || w->W == 0)
+    {
+      gsl_eigen_symmvd_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for eigenvectors", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_eigen_symmvd_free (gsl_eigen_symmvd_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->W)
+    gsl_matrix_free (w->W);
+
+  if (w->Z)
+    gsl_matrix_free (w->Z);
+
+  free (w->iwork);
+  free (w->work);
+  free (w->gs);
+  free (w->gc);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+/* The matrix A is destroyed: after the reduction to tridiagonal form
+   it is used as scratch space for the eigenvectors of the rank-one
+   modifications.  The eigenvalues are returned in ascending order. */
+
+int
+gsl_eigen_symmvd (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                  gsl_eigen_symmvd_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (eval->size != A->size1)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != A->size1)
+    {
+      GSL_ERROR ("eigenvector matrix must match matrix size", GSL_EBADLEN);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      double *const d = w->d;
+      double *const sd = w->sd;
+      const size_t N = A->size1;
+      double scale = 0.0;
+      size_t i;
+
+      /* handle special case */
+
+      if (N == 1)
+        {
+          double A00 = gsl_matrix_get (A, 0, 0);
+          gsl_vector_set (eval, 0, A00);
+          gsl_matrix_set (evec, 0, 0, 1.0);
+          return GSL_SUCCESS;
+        }
+
+      /* use sd as the temporary workspace for the decomposition when
+         computing eigenvectors */
+
+      {
+        gsl_vector_view d_vec = gsl_vector_view_array (d, N);
+        gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
+        gsl_vector_view tau = gsl_vector_view_array (sd, N - 1);
+        gsl_linalg_symmtd_decomp (A, &tau.vector);
+        gsl_linalg_symmtd_unpack (A, &tau.vector, evec, &d_vec.vector, &sd_vec.vector);
+      }
+
+      /* scale the tridiagonal matrix to unit max norm, so that the
+         tolerances of the merges are absolute */
+
+      for (i = 0; i < N; i++)
+        {
+          scale = GSL_MAX (scale, fabs (d[i]));
+
+          if (i < N - 1)
+            scale = GSL_MAX (scale, fabs (sd[i]));
+        }
+
+      if (scale == 0.0)
+        {
+          gsl_vector_set_zero (eval);
+          return GSL_SUCCESS;
+        }
+
+      for (i = 0; i < N; i++)
+        {
+          d[i] /= scale;
+
+          if (i < N - 1)
+            sd[i] /= scale;
+        }
+
+      chop_small_elements (N, d, sd);
+
+      /* compute the eigenvectors Z of the tridiagonal matrix */
+
+      gsl_matrix_set_identity (w->Z);
+      symmvd_dc (d, sd, w->Z, A, w);
+
+      /* back-transform, evec = Q Z */
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, evec, w->Z, 0.0, w->W);
+      gsl_matrix_memcpy (evec, w->W);
+
+      for (i = 0; i < N; i++)
+        gsl_vector_set (eval, i, scale * d[i]);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute the eigensystem of the tridiagonal block (d, sd) in place,
+   with the eigenvalues in ascending order in d and the eigenvectors
+   in the diagonal block Z, which is the identity on entry.  U is
+   scratch space for the merges. */
+
+static void
+symmvd_dc (double * d, double * sd, gsl_matrix * Z, gsl_matrix * U,
+           gsl_eigen_symmvd_workspace * w)
+{
+  const size_t n = Z->size1;
+
+  if (n <= SYMMVD_LEAF)
+    {
+      symmvd_leaf (d, sd, Z, w);
+    }
+  else
+    {
+      const size_t n1 = n / 2;
+      const double beta = sd[n1 - 1];
+      gsl_matrix_view Z1 = gsl_matrix_submatrix (Z, 0, 0, n1, n1);
+      gsl_matrix_view Z2 = gsl_matrix_submatrix (Z, n1, n1, n - n1, n - n1);
+
+      /* T = diag(T1 - |beta| e e^T, T2 - |beta| e e^T) + |beta| u u^T,
+         with u = (e_n1, sign(beta) e_1) */
+
+      d[n1 - 1] -= fabs (beta);
+      d[n1] -= fabs (beta);
+
+      symmvd_dc (d, sd, &Z1.matrix, U, w);
+      symmvd_dc (d + n1, sd + n1, &Z2.matrix, U, w);
+
+      symmvd_merge (d, n1, beta, Z, U, w);
+    }
+}
+
+static void
+symmvd_leaf (double * d, double * sd, gsl_matrix * Z,
+             gsl_eigen_symmvd_workspace * w)
+{
+  const size_t n = Z->size1;
+  size_t a, b, i, j;
+
+  if (n > 1)
+    {
+      b = n - 1;
+
+      while (b > 0)
+        {
+          if (sd[b - 1] == 0.0 || isnan (sd[b - 1]))
+            {
+              b--;
+              continue;
+            }
+
+          a = b - 1;
+
+          while (a > 0)
+            {
+              if (sd[a - 1] == 0.0)
+                {
+                  break;
+                }
+              a--;
+            }
+
+          {
+            const size_t n_block = b - a + 1;
+            double * const gc = w->gc;
+            double * const gs = w->gs;
+
+            qrstep (n_block, d + a, sd + a, gc, gs);
+
+            for (i = 0; i < n_block - 1; i++)
+              {
+                const double c = gc[i], s = gs[i];
+                size_t k;
+
+                for (k = 0; k < n; k++)
+                  {
+                    double qki = gsl_matrix_get (Z, k, a + i);
+                    double qkj = gsl_matrix_get (Z, k, a + i + 1);
+                    gsl_matrix_set (Z, k, a + i, qki * c - qkj * s);
+                    gsl_matrix_set (Z, k, a + i + 1, qki * s + qkj * c);
+                  }
+              }
+
+            chop_small_elements (n, d, sd);
+          }
+        }
+    }
+
+  /* selection sort into ascending order */
+
+  for (i = 0; i + 1 < n; i++)
+    {
+      size_t k = i;
+      double dk = d[i];
+
+      for (j = i + 1; j < n; j++)
+        {
+          if (d[j] < dk)
+            {
+              k = j;
+              dk = d[j];
+            }
+        }
+
+      if (k != i)
+        {
+          d[k] = d[i];
+          d[i] = dk;
+          gsl_matrix_swap_columns (Z, i, k);
+        }
+    }
+}
+
+/* Merge the two solved halves of Z, of sizes n1 and n - n1, coupled by
+   the subdiagonal element beta */
+
+static void
+symmvd_merge (double * d, const size_t n1, const double beta,
+              gsl_matrix * Z, gsl_matrix * Ubuf,
+              gsl_eigen_symmvd_workspace * w)
+{
+  const size_t n = Z->size1;
+  const double rho = 2.0 * fabs (beta);
+  const double sign = (beta < 0.0) ? -1.0 : 1.0;
+  double *z = w->work;          /* rank-one vector */
+  double *dl = w->work + n;     /* nondeflated poles in ascending order */
+  double *zl = w->work + 2 * n; /* and their components of z */
+  double *dnew = w->work + 3 * n;       /* new eigenvalues */
+  double *tmp = w->work + 4 * n;
+  size_t *perm = w->iwork;      /* poles in ascending order */
+  size_t *col = w->iwork + n;   /* nondeflated columns, then deflated */
+  size_t *order = w->iwork + 2 * n;
+  gsl_matrix_view Wb = gsl_matrix_submatrix (w->W, 0, 0, n, n);
+  double dmax = 0.0, zmax = 0.0, tol;
+  size_t i, j, k = 0, ndefl = 0;
+
+  /* z = Z^T u / sqrt(2), where u = (e_n1, sign(beta) e_1) */
+
+  for (i = 0; i < n1; i++)
+    z[i] = M_SQRT1_2 * gsl_matrix_get (Z, n1 - 1, i);
+
+  for (i = n1; i < n; i++)
+    z[i] = sign * M_SQRT1_2 * gsl_matrix_get (Z, n1, i);
+
+  /* merge the two sorted halves */
+
+  for (i = 0, j = n1, k = 0; k < n; k++)
+    {
+      if (j >= n || (i < n1 && d[i] <= d[j]))
+        perm[k] = i++;
+      else
+        perm[k] = j++;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      dmax = GSL_MAX (dmax, fabs (d[i]));
+      zmax = GSL_MAX (zmax, fabs (z[i]));
+    }
+
+  tol = 8.0 * GSL_DBL_EPSILON * GSL_MAX (dmax, zmax);
+
+  /* deflation: drop negligible components of z, and rotate away one
+     component of z for each pair of poles which are close together */
+
+  k = 0;
+
+  if (rho * zmax <= tol)
+    {
+      for (i = 0; i < n; i++)
+        col[n - 1 - ndefl++] = perm[i];
+    }
+  else
+    {
+      size_t p = n;            /* previous nondeflated pole, if any */
+
+      for (i = 0; i < n; i++)
+        {
+          const size_t jj = perm[i];
+
+          if (rho * fabs (z[jj]) <= tol)
+            {
+              col[n - 1 - ndefl++] = jj;
+              continue;
+            }
+
+          if (p < n)
+            {
+              double s = z[p], c = z[jj];
+              const double t = hypot (c, s);
+
+              c /= t;
+              s = -s / t;
+
+              if (fabs ((d[jj] - d[p]) * c * s) <= tol)
+                {
+                  gsl_vector_view x = gsl_matrix_column (Z, p);
+                  gsl_vector_view y = gsl_matrix_column (Z, jj);
+                  const double dp = d[p], dj = d[jj];
+
+                  /* x' = c x + s y, y' = c y - s x */
+                  gsl_blas_drot (&x.vector, &y.vector, c, s);
+
+                  z[jj] = t;
+                  z[p] = 0.0;
+                  d[p] = dp * c * c + dj * s * s;
+                  d[jj] = dp * s * s + dj * c * c;
+
+                  col[n - 1 - ndefl++] = p;
+                }
+              else
+                {
+                  col[k++] = p;
+                }
+            }
+
+          p = jj;
+        }
+
+      if (p < n)
+        col[k++] = p;
+    }
+
+  /* the deflated columns were stored from the end backwards */
+
+  for (i = 0; i < ndefl / 2; i++)
+    {
+      const size_t t = col[k + i];
+      col[k + i] = col[n - 1 - i];
+      col[n - 1 - i] = t;
+    }
+
+  /* solve the secular equation and compute the eigenvectors of
+     diag(dl) + rho zl zl^T in U */
+
+  if (k > 0)
+    {
+      gsl_matrix_view U = gsl_matrix_submatrix (Ubuf, 0, 0, k, k);
+
+      for (i = 0; i < k; i++)
+        {
+          dl[i] = d[col[i]];
+          zl[i] = z[col[i]];
+        }
+
+      for (j = 0; j < k; j++)
+        {
+          dnew[j] = symmvd_secular (k, j, dl, zl, rho, tmp);
+
+          for (i = 0; i < k; i++)
+            gsl_matrix_set (&U.matrix, i, j, tmp[i]);
+        }
+
+      /* recompute z from the computed roots (Gu and Eisenstat) so that
+         the eigenvectors are numerically orthogonal,
+
+         zhat_i^2 = (lambda_i - dl_i) / rho
+                      prod_{j != i} (lambda_j - dl_i) / (dl_j - dl_i) */
+
+      for (i = 0; i < k; i++)
+        {
+          double prod = -gsl_matrix_get (&U.matrix, i, i) / rho;
+
+          for (j = 0; j < k; j++)
+            {
+              if (j != i)
+                prod *= gsl_matrix_get (&U.matrix, i, j) / (dl[i] - dl[j]);
+            }
+
+          tmp[i] = (zl[i] < 0.0) ? -sqrt (fabs (prod)) : sqrt (fabs (prod));
+        }
+
+      for (j = 0; j < k; j++)
+        {
+          gsl_vector_view v = gsl_matrix_column (&U.matrix, j);
+
+          for (i = 0; i < k; i++)
+            gsl_vector_set (&v.vector, i, tmp[i] / gsl_vector_get (&v.vector, i));
+
+          gsl_vector_scale (&v.vector, 1.0 / gsl_blas_dnrm2 (&v.vector));
+        }
+
+      /* gather the columns of Z and form Z(:,nondeflated) U */
+
+      for (i = 0; i < n; i++)
+        {
+          gsl_vector_view src = gsl_matrix_column (Z, col[i]);
+          gsl_vector_view dst = gsl_matrix_column (&Wb.matrix, i);
+          gsl_vector_memcpy (&dst.vector, &src.vector);
+        }
+
+      {
+        gsl_matrix_view W1 = gsl_matrix_submatrix (&Wb.matrix, 0, 0, n, k);
+        gsl_matrix_view Z1 = gsl_matrix_submatrix (Z, 0, 0, n, k);
+
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &W1.matrix,
+                        &U.matrix, 0.0, &Z1.matrix);
+      }
+
+      for (i = k; i < n; i++)
+        {
+          gsl_vector_view src = gsl_matrix_column (&Wb.matrix, i);
+          gsl_vector_view dst = gsl_matrix_column (Z, i);
+          gsl_vector_memcpy (&dst.vector, &src.vector);
+        }
+    }
+  else
+    {
+      for (i = 0; i < n; i++)
+        {
+          gsl_vector_view src = gsl_matrix_column (Z, col[i]);
+          gsl_vector_view dst = gsl_matrix_column (&Wb.matrix, i);
+          gsl_vector_memcpy (&dst.vector, &src.vector);
+        }
+
+      gsl_matrix_memcpy (Z, &Wb.matrix);
+    }
+
+  for (i = k; i < n; i++)
+    dnew[i] = d[col[i]];
+
+  /* sort the eigenvalues and eigenvectors into ascending order */
+
+  gsl_sort_index (order, dnew, 1, n);
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_vector_view src = gsl_matrix_column (Z, order[i]);
+      gsl_vector_view dst = gsl_matrix_column (&Wb.matrix, i);
+      gsl_vector_memcpy (&dst.vector, &src.vector);
+      d[i] = dnew[order[i]];
+    }
+
+  gsl_matrix_memcpy (Z, &Wb.matrix);
+}
+
+/* Find the j-th root lambda_j of the secular equation
+
+     f(lambda) = 1/rho + sum_i zl_i^2 / (dl_i - lambda) = 0
+
+   with distinct poles dl in ascending order, and return it together
+   with the differences delta_i = dl_i - lambda_j, which are computed
+   relative to the nearest pole to avoid cancellation.  The iteration
+   interpolates psi (the poles up to the root) and phi (the poles
+   beyond it) by simple rational functions, which is the "middle way"
+   of DLAED4, safeguarded by bisection. */
+
+static double
+symmvd_secular (const size_t k, const size_t j, const double dl[],
+                const double zl[], const double rho, double delta[])
+{
+  const size_t ip = (j < k - 1) ? j : k - 2;
+  double origin, lo, hi, tau;
+  size_t i, iter;
+
+  if (k == 1)
+    {
+      delta[0] = -rho * zl[0] * zl[0];
+      return dl[0] + rho * zl[0] * zl[0];
+    }
+
+  if (j < k - 1)
+    {
+      /* the root lies in (dl_j, dl_j+1); take as origin the pole on
+         the same side of the midpoint */
+
+      const double mid = 0.5 * (dl[j + 1] - dl[j]);
+      double f = 1.0 / rho;
+
+      for (i = 0; i < k; i++)
+        f += zl[i] * zl[i] / ((dl[i] - dl[j]) - mid);
+
+      if (f >= 0.0)
+        {
+          origin = dl[j];
+          lo = 0.0;
+          hi = mid;
+        }
+      else
+        {
+          origin = dl[j + 1];
+          lo = -mid;
+          hi = 0.0;
+        }
+    }
+  else
+    {
+      /* the largest root lies in (dl_k-1, dl_k-1 + rho |z|^2] */
+
+      double zz = 0.0;
+
+      for (i = 0; i < k; i++)
+        zz += zl[i] * zl[i];
+
+      origin = dl[k - 1];
+      lo = 0.0;
+      hi = rho * zz;
+    }
+
+  tau = 0.5 * (lo + hi);
+
+  for (iter = 0; iter < 100; iter++)
+    {
+      double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+      double f, a, b, c, eta, di, di1;
+
+      for (i = 0; i < k; i++)
+        {
+          const double del = (dl[i] - origin) - tau;
+          const double t = zl[i] / del;
+
+          delta[i] = del;
+
+          if (i <= ip)
+            {
+              psi += zl[i] * t;
+              dpsi += t * t;
+            }
+          else
+            {
+              phi += zl[i] * t;
+              dphi += t * t;
+            }
+        }
+
+      f = 1.0 / rho + psi + phi;
+
+      if (fabs (f) <= 8.0 * GSL_DBL_EPSILON * (1.0 / rho + fabs (psi) + fabs (phi)))
+        break;
+
+      /* f is increasing in lambda */
+
+      if (f < 0.0)
+        lo = tau;
+      else
+        hi = tau;
+
+      if (hi - lo <= 2.0 * GSL_DBL_EPSILON * GSL_MAX (fabs (lo), fabs (hi)))
+        break;
+
+      di = delta[ip];
+      di1 = delta[ip + 1];
+      a = (di + di1) * f - di * di1 * (dpsi + dphi);
+      b = di * di1 * f;
+      c = f - di * dpsi - di1 * dphi;
+
+      if (c == 0.0)
+        eta = (a != 0.0) ? b / a : 0.0;
+      else if (a <= 0.0)
+        eta = (a - sqrt (fabs (a * a - 4.0 * b * c))) / (2.0 * c);
+      else
+        eta = 2.0 * b / (a + sqrt (fabs (a * a - 4.0 * b * c)));
+
+      /* take a Newton step if eta has the wrong sign */
+
+      if (f * eta >= 0.0)
+        eta = -f / (dpsi + dphi);
+
+      eta += tau;
+
+      if (!(eta > lo && eta < hi))
+        eta = 0.5 * (lo + hi);
+
+      tau = eta;
+    }
+
+  for (i = 0; i < k; i++)
+    delta[i] = (dl[i] - origin) - tau;
+
+  return origin + tau;
+}
@@ -0,0 +1,551 @@
+/* eigen/symmvx.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+
+/* Compute selected eigenvalues/eigenvectors of a real symmetric
+   matrix, either by their index in ascending order or by an interval
+   of values, using reduction to tridiagonal form, bisection with Sturm
+   sequence counts for the eigenvalues, and inverse iteration for the
+   eigenvectors, followed by back-transformation of only the selected
+   vectors.  The cost is O(N^3) for the reduction and O(N m^2) at most
+   for m eigenvectors, instead of the O(N^3) needed for all of them.
+
+   Eigenvectors of close eigenvalues are reorthogonalized with modified
+   Gram-Schmidt, as in LAPACK's DSTEIN; the bisection follows DSTEBZ.
+
+   See Golub & Van Loan, "Matrix Computations" (3rd ed), Sections
+   8.5.1 and 8.5.2 */
+
+#define SYMMVX_MAXITS 5         /* maximum inverse iterations */
+#define SYMMVX_EXTRA 2          /* iterations after convergence */
+
+static void symmvx_reduce (gsl_matrix * A, gsl_eigen_symmvx_workspace * w);
+static void symmvx_bounds (const size_t N, const double d[], const double sd[],
+                           double e2[], double *gl, double *gu,
+                           double *pivmin);
+static size_t symmvx_count (const size_t N, const double d[],
+                            const double e2[], const double pivmin,
+                            const double x);
+static void symmvx_compute (const gsl_matrix * A, const size_t il,
+                            const size_t m, gsl_vector * eval,
+                            gsl_matrix * evec, gsl_eigen_symmvx_workspace * w);
+
+gsl_eigen_symmvx_workspace *
+gsl_eigen_symmvx_alloc (const size_t n)
+{
+  gsl_eigen_symmvx_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_symmvx_workspace *) calloc (1, sizeof (gsl_eigen_symmvx_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+
+  w->d = (double *) malloc (n * sizeof (double));
+  w->sd = (double *) malloc (n * sizeof (double));
+  w->tau = (double *) malloc (n * sizeof (double));
+  w->work = (double *) malloc (8 * n * sizeof (double));
+  w->iwork = (int *) malloc (n * sizeof (int));
+
+  if (w->d == 0 || w->sd == 0 || w->tau == 0 || w->work == 0 ||
+      w->iwork == 0)
+    {
+      gsl_eigen_symmvx_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_eigen_symmvx_free (gsl_eigen_symmvx_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->iwork);
+  free (w->work);
+  free (w->tau);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+/* Compute the eigenvalues il..iu (counting from zero in ascending
+   order) and their eigenvectors.  The diagonal and lower triangular
+   part of A are destroyed. */
+
+int
+gsl_eigen_symmvx_index (gsl_matrix * A, const size_t il, const size_t iu,
+                        gsl_vector * eval, gsl_matrix * evec,
+                        gsl_eigen_symmvx_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (il > iu || iu >= A->size1)
+    {
+      GSL_ERROR ("eigenvalue indices must satisfy il <= iu < N", GSL_EINVAL);
+    }
+  else if (eval->size != iu - il + 1)
+    {
+      GSL_ERROR ("eigenvalue vector must have length iu - il + 1", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != iu - il + 1)
+    {
+      GSL_ERROR ("eigenvector matrix must be N-by-(iu - il + 1)", GSL_EBADLEN);
+    }
+  else
+    {
+      symmvx_reduce (A, w);
+      symmvx_compute (A, il, iu - il + 1, eval, evec, w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute the eigenvalues in the interval [vl, vu) and their
+   eigenvectors.  The number found is returned in nev and they are
+   stored in the first nev elements of eval and columns of evec. */
+
+int
+gsl_eigen_symmvx_range (gsl_matrix * A, const double vl, const double vu,
+                        gsl_vector * eval, gsl_matrix * evec, size_t * nev,
+                        gsl_eigen_symmvx_workspace * w)
+{
+  *nev = 0;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (!(vl <= vu))
+    {
+      GSL_ERROR ("interval must satisfy vl <= vu", GSL_EINVAL);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != eval->size)
+    {
+      GSL_ERROR ("eigenvector matrix must be N-by-(length of eval)", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N = A->size1;
+      double *e2 = w->work;
+      double gl, gu, pivmin;
+      size_t il, iu;
+
+      symmvx_reduce (A, w);
+      symmvx_bounds (N, w->d, w->sd, e2, &gl, &gu, &pivmin);
+
+      il = (vl <= gl) ? 0 : symmvx_count (N, w->d, e2, pivmin, vl);
+      iu = (vu > gu) ? N : symmvx_count (N, w->d, e2, pivmin, vu);
+
+      if (iu <= il)
+        return GSL_SUCCESS;
+
+      if (iu - il > eval->size)
+        {
+          GSL_ERROR ("eigenvalue vector too short for the eigenvalues in range",
+                     GSL_EBADLEN);
+        }
+
+      {
+        gsl_vector_view e = gsl_vector_subvector (eval, 0, iu - il);
+        gsl_matrix_view Z = gsl_matrix_submatrix (evec, 0, 0, N, iu - il);
+
+        symmvx_compute (A, il, iu - il, &e.vector, &Z.matrix, w);
+      }
+
+      *nev = iu - il;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* reduce A to tridiagonal form, keeping the Householder vectors in A */
+
+static void
+symmvx_reduce (gsl_matrix * A, gsl_eigen_symmvx_workspace * w)
+{
+  const size_t N = A->size1;
+  size_t i;
+
+  if (N > 1)
+    {
+      gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+      gsl_linalg_symmtd_decomp (A, &tau.vector);
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      w->d[i] = gsl_matrix_get (A, i, i);
+
+      if (i < N - 1)
+        w->sd[i] = gsl_matrix_get (A, i + 1, i);
+    }
+}
+
+/* Gershgorin bounds [gl, gu] of the spectrum, the squared subdiagonal
+   e2, and the minimum pivot allowed in the Sturm sequences */
+
+static void
+symmvx_bounds (const size_t N, const double d[], const double sd[],
+               double e2[], double *gl, double *gu, double *pivmin)
+{
+  double lo = d[0], hi = d[0], e2max = 0.0, tnorm, margin;
+  size_t i;
+
+  for (i = 0; i < N; i++)
+    {
+      const double r = ((i > 0) ? fabs (sd[i - 1]) : 0.0)
+        + ((i < N - 1) ? fabs (sd[i]) : 0.0);
+
+      lo = GSL_MIN (lo, d[i] - r);
+      hi = GSL_MAX (hi, d[i] + r);
+
+      if (i < N - 1)
+        {
+          e2[i] = sd[i] * sd[i];
+          e2max = GSL_MAX (e2max, e2[i]);
+        }
+    }
+
+  *pivmin = GSL_DBL_MIN * GSL_MAX (1.0, e2max);
+
+  tnorm = GSL_MAX (fabs (lo), fabs (hi));
+  margin = 2.0 * GSL_DBL_EPSILON * tnorm * N + 2.0 * (*pivmin);
+
+  *gl = lo - margin;
+  *gu = hi + margin;
+}
+
+/* number of eigenvalues less than x, from the signs of the pivots of
+   the LDL^T factorization of T - x I */
+
+static size_t
+symmvx_count (const size_t N, const double d[], const double e2[],
+              const double pivmin, const double x)
+{
+  double q = d[0] - x;
+  size_t i, count;
+
+  if (fabs (q) <= pivmin)
+    q = -pivmin;
+
+  count = (q < 0.0);
+
+  for (i = 1; i < N; i++)
+    {
+      q = d[i] - x - e2[i - 1] / q;
+
+      if (fabs (q) <= pivmin)
+        q = -pivmin;
+
+      count += (q < 0.0);
+    }
+
+  return count;
+}
+
+/* compute eigenvalues il..il+m-1 and their eigenvectors from the
+   tridiagonal matrix in w and the Householder vectors in A */
+
+static void
+symmvx_compute (const gsl_matrix * A, const size_t il, const size_t m,
+                gsl_vector * eval, gsl_matrix * evec,
+                gsl_eigen_symmvx_workspace * w)
+{
+  const size_t N = A->size1;
+  const double *d = w->d;
+  const double *sd = w->sd;
+  double *e2 = w->work;
+  double *u0 = w->work + N;     /* U = diagonal and two superdiagonals */
+  double *u1 = w->work + 2 * N;
+  double *u2 = w->work + 3 * N;
+  double *l = w->work + 4 * N;  /* multipliers of L */
+  double *b = w->work + 5 * N;  /* iterate */
+  double *hw = w->work + 6 * N; /* workspace for the back-transformation */
+  double *hv = w->work + 7 * N; /* Householder vector */
+  int *piv = w->iwork;
+  double gl, gu, pivmin, atol, onenrm = 0.0, ortol, tiny, dtpcrt;
+  double xjm = 0.0;
+  unsigned long int seed = 1;
+  size_t i, j, gpind = 0;
+
+  symmvx_bounds (N, d, sd, e2, &gl, &gu, &pivmin);
+
+  /* eigenvalues by bisection, to an absolute accuracy of eps |T| */
+
+  atol = GSL_DBL_EPSILON * GSL_MAX (fabs (gl), fabs (gu)) + 2.0 * pivmin;
+
+  for (j = 0; j < m; j++)
+    {
+      double lo = (j > 0) ? gsl_vector_get (eval, j - 1) - 4.0 * pivmin : gl;
+      double hi = gu;
+
+      lo = GSL_MAX (lo, gl);
+
+      /* maintain count(lo) <= il + j < count(hi) */
+
+      if (symmvx_count (N, d, e2, pivmin, lo) > il + j)
+        lo = gl;
+
+      while (hi - lo > 2.0 * GSL_DBL_EPSILON * GSL_MAX (fabs (lo), fabs (hi))
+             + atol)
+        {
+          const double mid = 0.5 * (lo + hi);
+
+          if (mid <= lo || mid >= hi)
+            break;
+
+          if (symmvx_count (N, d, e2, pivmin, mid) <= il + j)
+            lo = mid;
+          else
+            hi = mid;
+        }
+
+      gsl_vector_set (eval, j, 0.5 * (lo + hi));
+    }
+
+  /* eigenvectors by inverse iteration */
+
+  for (i = 0; i < N; i++)
+    {
+      double r = fabs (d[i]);
+
+      if (i > 0)
+        r += fabs (sd[i - 1]);
+      if (i < N - 1)
+        r += fabs (sd[i]);
+
+      onenrm = GSL_MAX (onenrm, r);
+    }
+
+  ortol = 1.0e-3 * onenrm;
+  tiny = GSL_DBL_EPSILON * onenrm;
+  dtpcrt = sqrt (0.1 / N);
+
+  for (j = 0; j < m; j++)
+    {
+      gsl_vector_view z = gsl_matrix_column (evec, j);
+      double xj = gsl_vector_get (eval, j);
+      double cur0, cur1, nrm = 0.0;
+      size_t its, nrmchk = 0, jmax = 0;
+
+      if (N == 1)
+        {
+          gsl_vector_set (&z.vector, 0, 1.0);
+          continue;
+        }
+
+      /* perturb equal eigenvalues, so that the iterates differ, and
+         start a new cluster after a gap */
+
+      if (j > 0)
+        {
+          const double pertol = 10.0 * fabs (GSL_DBL_EPSILON * xj);
+
+          if (xj - xjm < pertol)
+            xj = xjm + pertol;
+
+          if (xj - xjm > ortol)
+            gpind = j;
+        }
+      else
+        {
+          gpind = 0;
+        }
+
+      xjm = xj;
+
+      /* LU factorization of T - xj I with partial pivoting */
+
+      cur0 = d[0] - xj;
+      cur1 = sd[0];
+
+      for (i = 0; i < N - 1; i++)
+        {
+          const double sub = sd[i];
+          const double next0 = d[i + 1] - xj;
+          const double next1 = (i + 2 < N) ? sd[i + 1] : 0.0;
+
+          if (fabs (cur0) >= fabs (sub))
+            {
+              piv[i] = 0;
+              l[i] = (cur0 != 0.0) ? sub / cur0 : 0.0;
+              u0[i] = cur0;
+              u1[i] = cur1;
+              u2[i] = 0.0;
+              cur0 = next0 - l[i] * cur1;
+              cur1 = next1;
+            }
+          else
+            {
+              piv[i] = 1;
+              l[i] = cur0 / sub;
+              u0[i] = sub;
+              u1[i] = next0;
+              u2[i] = next1;
+              cur0 = cur1 - l[i] * next0;
+              cur1 = -l[i] * next1;
+            }
+        }
+
+      u0[N - 1] = cur0;
+
+      for (i = 0; i < N; i++)
+        {
+          if (fabs (u0[i]) < tiny)
+            u0[i] = (u0[i] < 0.0) ? -tiny : tiny;
+        }
+
+      /* starting vector from a fixed pseudo-random sequence */
+
+      for (i = 0; i < N; i++)
+        {
+          seed = (1103515245UL * seed + 12345UL) & 0x7fffffffUL;
+          b[i] = 2.0 * seed / 2147483648.0 - 1.0;
+        }
+
+      for (its = 0; its < SYMMVX_MAXITS; its++)
+        {
+          double scl;
+
+          /* scale the right hand side */
+
+          jmax = 0;
+          for (i = 1; i < N; i++)
+            {
+              if (fabs (b[i]) > fabs (b[jmax]))
+                jmax = i;
+            }
+
+          scl = N * onenrm * GSL_MAX (GSL_DBL_EPSILON, fabs (u0[N - 1]))
+            / fabs (b[jmax]);
+
+          for (i = 0; i < N; i++)
+            b[i] *= scl;
+
+          /* solve P L U x = b */
+
+          for (i = 0; i < N - 1; i++)
+            {
+              if (piv[i])
+                {
+                  const double t = b[i];
+                  b[i] = b[i + 1];
+                  b[i + 1] = t;
+                }
+
+              b[i + 1] -= l[i] * b[i];
+            }
+
+          b[N - 1] /= u0[N - 1];
+          b[N - 2] = (b[N - 2] - u1[N - 2] * b[N - 1]) / u0[N - 2];
+
+          for (i = N - 2; i-- > 0;)
+            b[i] = (b[i] - u1[i] * b[i + 1] - u2[i] * b[i + 2]) / u0[i];
+
+          /* reorthogonalize against the previous vectors of the cluster */
+
+          {
+            gsl_vector_view bv = gsl_vector_view_array (b, N);
+            size_t k;
+
+            for (k = gpind; k < j; k++)
+              {
+                gsl_vector_view zk = gsl_matrix_column (evec, k);
+                double ztr;
+
+                gsl_blas_ddot (&bv.vector, &zk.vector, &ztr);
+                gsl_blas_daxpy (-ztr, &zk.vector, &bv.vector);
+              }
+          }
+
+          /* continue for a few iterations after the growth of the
+             iterate shows convergence */
+
+          jmax = 0;
+          for (i = 1; i < N; i++)
+            {
+              if (fabs (b[i]) > fabs (b[jmax]))
+                jmax = i;
+            }
+
+          nrm = fabs (b[jmax]);
+
+          if (nrm < dtpcrt)
+            continue;
+
+          if (++nrmchk >= SYMMVX_EXTRA + 1)
+            break;
+        }
+
+      /* normalize with the largest component positive */
+
+      {
+        gsl_vector_view bv = gsl_vector_view_array (b, N);
+        double scl = 1.0 / gsl_blas_dnrm2 (&bv.vector);
+
+        if (b[jmax] < 0.0)
+          scl = -scl;
+
+        gsl_vector_scale (&bv.vector, scl);
+        gsl_vector_memcpy (&z.vector, &bv.vector);
+      }
+    }
+
+  /* back-transform the eigenvectors, Z = Q Z */
+
+  for (i = (N > 2) ? N - 2 : 0; i-- > 0;)
+    {
+      gsl_vector_const_view h = gsl_matrix_const_subcolumn (A, i, i + 1, N - i - 1);
+      gsl_matrix_view Zi = gsl_matrix_submatrix (evec, i + 1, 0, N - i - 1, m);
+      gsl_vector_view work = gsl_vector_view_array (hw, m);
+      gsl_vector_view v = gsl_vector_view_array (hv, N - i - 1);
+
+      /* copy the vector, since A is not modified here */
+      gsl_vector_memcpy (&v.vector, &h.vector);
+      gsl_vector_set (&v.vector, 0, 1.0);
+      gsl_linalg_householder_left (w->tau[i], &v.vector, &Zi.matrix, &work.vector);
+    }
+}
@@ -28,7 +28,9 @@
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_complex_math.h>
 #include <gsl/gsl_eigen.h>
+#include <gsl/gsl_eigen_rsymmv.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_linalg_rsvd.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_errno.h>
@@ -330,6 +332,74 @@ test_eigen_symm_results (const gsl_matrix * A,
   gsl_vector_free(y);
 }
 
+/* check the eigenpairs il.. of a subset against all the eigenvalues
+   of A in ascending order.  Inverse iteration only reorthogonalizes
+   within clusters, so the orthogonality is O(eps |A| / gap) */
+
+void
+test_eigen_symm_subset (const gsl_matrix * A,
+                        const gsl_vector * eval_all,
+                        const size_t il,
+                        const gsl_vector * eval,
+                        const gsl_matrix * evec,
+                        const char * desc,
+                        const char * desc2)
+{
+  const size_t N = A->size1;
+  const size_t M = eval->size;
+  size_t i, j;
+  double emax = 0;
+
+  gsl_vector * y = gsl_vector_alloc(N);
+
+  for (i = 0; i < N; i++)
+    {
+      double ei = gsl_vector_get (eval_all, i);
+      if (fabs(ei) > emax) emax = fabs(ei);
+    }
+
+  for (i = 0; i < M; i++)
+    {
+      double ei = gsl_vector_get (eval, i);
+      gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
+
+      gsl_test_abs(ei, gsl_vector_get (eval_all, il + i),
+                   emax * 1e8 * GSL_DBL_EPSILON,
+                   "%s, subset eigenvalue(%d), %s", desc, il + i, desc2);
+
+      /* compute y = A x (should = lambda v) */
+      gsl_blas_dgemv (CblasNoTrans, 1.0, A, &vi.vector, 0.0, y);
+      for (j = 0; j < N; j++)
+        {
+          double xj = gsl_vector_get (&vi.vector, j);
+          double yj = gsl_vector_get (y, j);
+          gsl_test_abs(yj, chop_subnormals(ei * xj), emax * 1e8 * GSL_DBL_EPSILON,
+                       "%s, eigenvalue(%d,%d), %s", desc, il + i, j, desc2);
+        }
+    }
+
+  /* check eigenvectors are orthonormal */
+
+  for (i = 0; i < M; i++)
+    {
+      gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
+      double nrm_v = gsl_blas_dnrm2(&vi.vector);
+      gsl_test_rel (nrm_v, 1.0, N * GSL_DBL_EPSILON, "%s, normalized(%d), %s",
+                    desc, il + i, desc2);
+
+      for (j = i + 1; j < M; j++)
+        {
+          gsl_vector_const_view vj = gsl_matrix_const_column(evec, j);
+          double vivj;
+          gsl_blas_ddot (&vi.vector, &vj.vector, &vivj);
+          gsl_test_abs (vivj, 0.0, 100 * N * GSL_DBL_EPSILON,
+                        "%s, orthogonal(%d,%d), %s", desc, il + i, il + j, desc2);
+        }
+    }
+
+  gsl_vector_free(y);
+}
+
 void
 test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
                        const char * desc)
@@ -343,6 +413,8 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix * evec = gsl_matrix_alloc(N, N);
   gsl_eigen_symm_workspace * w = gsl_eigen_symm_alloc(N);
   gsl_eigen_symmv_workspace * wv = gsl_eigen_symmv_alloc(N);
+  gsl_eigen_symmvd_workspace * wd = gsl_eigen_symmvd_alloc(N);
+  gsl_eigen_symmvx_workspace * wx = gsl_eigen_symmvx_alloc(N);
 
   gsl_matrix_memcpy(A, m);
 
@@ -372,6 +444,48 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_eigen_symmv_sort(evalv, evec, GSL_EIGEN_SORT_ABS_DESC);
   test_eigen_symm_results(m, evalv, evec, count, desc, "abs/desc");
 
+  /* divide and conquer, which returns the eigenvalues in ascending order */
+
+  gsl_matrix_memcpy(A, m);
+  gsl_eigen_symmvd(A, evalv, evec, wd);
+  test_eigen_symm_results(m, evalv, evec, count, desc, "symmvd");
+  test_eigenvalues_real(evalv, x, desc, "symmvd");
+
+  /* subsets by index and by value */
+
+  {
+    const size_t il = N / 3, iu = (2 * N) / 3;
+    const size_t M = iu - il + 1;
+    const double gap = sqrt(GSL_DBL_EPSILON) * (1.0 + fabs(gsl_vector_get(x, 0))
+                                                + fabs(gsl_vector_get(x, N - 1)));
+    gsl_vector_view e = gsl_vector_subvector(evalv, 0, M);
+    gsl_matrix_view Z = gsl_matrix_submatrix(evec, 0, 0, N, M);
+    double vl, vu;
+    size_t nev;
+
+    gsl_matrix_memcpy(A, m);
+    gsl_eigen_symmvx_index(A, il, iu, &e.vector, &Z.matrix, wx);
+    test_eigen_symm_subset(m, x, il, &e.vector, &Z.matrix, desc, "symmvx index");
+
+    /* choose the interval in gaps of the spectrum around il..iu */
+
+    vl = (il > 0) ? 0.5 * (gsl_vector_get(x, il - 1) + gsl_vector_get(x, il))
+                  : gsl_vector_get(x, 0) - 1.0;
+    vu = (iu < N - 1) ? 0.5 * (gsl_vector_get(x, iu) + gsl_vector_get(x, iu + 1))
+                      : gsl_vector_get(x, N - 1) + 1.0;
+
+    if ((il == 0 || gsl_vector_get(x, il) - gsl_vector_get(x, il - 1) > gap) &&
+        (iu == N - 1 || gsl_vector_get(x, iu + 1) - gsl_vector_get(x, iu) > gap))
+      {
+        gsl_matrix_memcpy(A, m);
+        gsl_eigen_symmvx_range(A, vl, vu, evalv, evec, &nev, wx);
+        gsl_test_int(nev, M, "%s, symmvx range count", desc);
+
+        if (nev == M)
+          test_eigen_symm_subset(m, x, il, &e.vector, &Z.matrix, desc, "symmvx range");
+      }
+  }
+
   gsl_matrix_free(A);
   gsl_vector_free(eval);
   gsl_vector_free(evalv);
@@ -380,6 +494,8 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix_free(evec);
   gsl_eigen_symm_free(w);
   gsl_eigen_symmv_free(wv);
+  gsl_eigen_symmvd_free(wd);
+  gsl_eigen_symmvx_free(wx);
 } /* test_eigen_symm_matrix() */
 
 void
@@ -458,6 +574,111 @@ test_eigen_symm(void)
     test_eigen_symm_matrix(&m.matrix, 0, "symm(27)");
   };
 
+  /* larger matrices, for the merges of the divide and conquer method */
+
+  {
+    const size_t sizes[] = { 26, 60, 101, 200 };
+
+    r = gsl_rng_alloc(gsl_rng_default);
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+      {
+        const size_t N = sizes[i];
+        gsl_matrix * A = gsl_matrix_alloc(N, N);
+        size_t j;
+
+        create_random_symm_matrix(A, r, -10, 10);
+        test_eigen_symm_matrix(A, 0, "symm random large");
+
+        /* J + 2 I, with a single eigenvalue N + 2 and the rest equal
+           to 2, for the deflation */
+
+        gsl_matrix_set_all(A, 1.0);
+        for (j = 0; j < N; ++j)
+          gsl_matrix_set(A, j, j, 3.0);
+
+        test_eigen_symm_matrix(A, 0, "symm J + 2I");
+
+        /* second difference matrix, with close eigenvalues */
+
+        gsl_matrix_set_zero(A);
+        for (j = 0; j < N; ++j)
+          {
+            gsl_matrix_set(A, j, j, 2.0);
+            if (j + 1 < N)
+              {
+                gsl_matrix_set(A, j, j + 1, -1.0);
+                gsl_matrix_set(A, j + 1, j, -1.0);
+              }
+          }
+
+        test_eigen_symm_matrix(A, 0, "symm second difference");
+
+        gsl_matrix_free(A);
+      }
+
+    gsl_rng_free(r);
+  }
+
+  /* randomized eigensolver, on matrices Q diag(x) Q^T with
+     eigenvalues x_i = (-1)^i 2^{-i} */
+
+  {
+    const size_t N = 150, k = 8, p = 10, q = 2;
+    gsl_matrix * A = gsl_matrix_alloc(N, N);
+    gsl_matrix * QR = gsl_matrix_alloc(N, N);
+    gsl_matrix * Q = gsl_matrix_alloc(N, N);
+    gsl_matrix * R = gsl_matrix_alloc(N, N);
+    gsl_matrix * evec = gsl_matrix_alloc(N, k);
+    gsl_vector * eval = gsl_vector_alloc(k);
+    gsl_vector * tau = gsl_vector_alloc(N);
+    gsl_vector * res = gsl_vector_alloc(N);
+    gsl_linalg_rsvd_workspace * w = gsl_linalg_rsvd_alloc(N, N, k, p);
+
+    r = gsl_rng_alloc(gsl_rng_default);
+
+    create_random_nonsymm_matrix(QR, r, -1, 1);
+    gsl_linalg_QR_decomp(QR, tau);
+    gsl_linalg_QR_unpack(QR, tau, Q, R);
+
+    gsl_matrix_set_zero(A);
+    for (i = 0; i < N; ++i)
+      {
+        gsl_vector_view qi = gsl_matrix_column(Q, i);
+        double xi = ((i % 2) ? -1.0 : 1.0) * pow(2.0, -(double) i);
+        gsl_blas_dsyr(CblasLower, xi, &qi.vector, A);
+      }
+
+    gsl_eigen_rsymmv(A, q, r, eval, evec, w);
+
+    for (i = 0; i < k; ++i)
+      {
+        gsl_vector_view vi = gsl_matrix_column(evec, i);
+        double xi = ((i % 2) ? -1.0 : 1.0) * pow(2.0, -(double) i);
+        double ei = gsl_vector_get(eval, i);
+
+        gsl_test_rel(ei, xi, 1.0e3 * GSL_DBL_EPSILON,
+                     "rsymmv(%zu), eigenvalue %zu", N, i);
+
+        /* A v - lambda v */
+        gsl_vector_memcpy(res, &vi.vector);
+        gsl_blas_dsymv(CblasLower, 1.0, A, &vi.vector, -ei, res);
+        gsl_test(gsl_blas_dnrm2(res) > 1.0e-6,
+                 "rsymmv(%zu), residual %zu", N, i);
+      }
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(QR);
+    gsl_matrix_free(Q);
+    gsl_matrix_free(R);
+    gsl_matrix_free(evec);
+    gsl_vector_free(eval);
+    gsl_vector_free(tau);
+    gsl_vector_free(res);
+    gsl_linalg_rsvd_free(w);
+    gsl_rng_free(r);
+  }
+
 } /* test_eigen_symm() */
 
 /******************************************
@@ -759,6 +980,28 @@ test_eigen_nonsymm(void)
       gsl_eigen_nonsymmv_free(w);
     }
 
+  /* larger matrices, which use the multishift QR algorithm */
+  {
+    const size_t sizes[] = { 80, 150, 300 };
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+      {
+        gsl_matrix * m = gsl_matrix_alloc(sizes[i], sizes[i]);
+        gsl_eigen_nonsymmv_workspace * w = gsl_eigen_nonsymmv_alloc(sizes[i]);
+
+        create_random_nonsymm_matrix(m, r, -10, 10);
+
+        gsl_eigen_nonsymmv_params(0, w);
+        test_eigen_nonsymm_matrix(m, i, "random, unbalanced", w);
+
+        gsl_eigen_nonsymmv_params(1, w);
+        test_eigen_nonsymm_matrix(m, i, "random, balanced", w);
+
+        gsl_matrix_free(m);
+        gsl_eigen_nonsymmv_free(w);
+      }
+  }
+
   gsl_rng_free(r);
 
   {
@@ -21,128 +21,148 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
-#include <float.h>
 
 #include <time.h>
 
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_plan.h>
 
 #include <gsl/gsl_errno.h>
 
 #include "complex_internal.h"
-#include "bitreverse.h"
 #include "urand.c"
 
+/* Usage: benchmark n [howmany]
+   Time forward transforms of length n with the mixed-radix, radix-2
+   and planned routines, and report the rate in MFLOPS using the
+   nominal operation count of 5 n log2(n) per transform. */
+
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+static void
+report (const char *name, size_t n, size_t howmany, size_t count,
+        clock_t start, clock_t end)
+{
+  const double t = (end - start) / ((double) count) / ((double) CLOCKS_PER_SEC);
+  const double flops = 5.0 * n * log ((double) n) / M_LN2 * howmany;
+
+  printf ("n = %d howmany = %d %-32s %e seconds %10.1f MFLOPS\n",
+          (int) n, (int) howmany, name, t, (t > 0) ? flops / t * 1e-6 : 0.0);
+}
+
 int
 main (int argc, char *argv[])
 {
   double *data, *fft_data;
   gsl_fft_complex_wavetable * cw;
-  unsigned int i, logn;
-  int result;
-  int status;
+  gsl_fft_complex_workspace * cwork;
+  gsl_fft_plan * plan;
+  size_t i, b;
+  int status = 0;
   clock_t start, end;
-  int resolution = CLOCKS_PER_SEC;
-  unsigned int n = 1;
+  const clock_t resolution = CLOCKS_PER_SEC;
+  size_t n = 1, howmany = 1;
 
   gsl_set_error_handler (&my_error_handler);
 
-  if (argc == 2)
+  if (argc == 2 || argc == 3)
     {
       n = strtol (argv[1], NULL, 0);
+
+      if (argc == 3)
+        howmany = strtol (argv[2], NULL, 0);
     }
   else
     {
-      printf ("test n\n");
+      printf ("benchmark n [howmany]\n");
       exit (EXIT_FAILURE);
     }
 
   cw = gsl_fft_complex_wavetable_alloc (n);
-  cwork = gsl_fft_complex_wavetable_workspace_alloc (n);
-  status = gsl_fft_complex_init (n, cw, cwork);
-  status = gsl_fft_complex_generate (n, cw, cwork);
+  cwork = gsl_fft_complex_workspace_alloc (n);
+  plan = gsl_fft_plan_alloc (n, 1, howmany, gsl_fft_forward,
+                             GSL_FFT_PLAN_DEFAULT);
 
-  data = (double *) malloc (n * 2 * sizeof (double));
-  fft_data = (double *) malloc (n * 2 * sizeof (double));
+  data = (double *) malloc (n * howmany * 2 * sizeof (double));
+  fft_data = (double *) malloc (n * howmany * 2 * sizeof (double));
 
-  for (i = 0; i < n; i++)
+  for (i = 0; i < n * howmany; i++)
     {
       REAL(data,1,i) = urand ();
       IMAG(data,1,i) = urand ();
     }
 
+  /* mixed-radix fft, one transform at a time */
 
-  /* compute the fft */
-
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  memcpy (fft_data, data, n * howmany * 2 * sizeof (double));
 
   start = clock ();
   i = 0;
   do
     {
-      status = gsl_fft_complex_forward (fft_data, 1, n, cw, cwork);
+      for (b = 0; b < howmany && status == 0; b++)
+        status = gsl_fft_complex_forward (fft_data + 2 * n * b, 1, n, cw, cwork);
       i++;
       end = clock ();
     }
   while (end < start + resolution && status == 0);
 
   if (status == 0)
-    {
-      printf ("n = %d gsl_fft_complex_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
-    }
+    report ("gsl_fft_complex_forward", n, howmany, i, start, end);
   else
-    {
-      printf ("MR fft failed\n");
-    }
+    printf ("MR fft failed\n");
 
+  /* radix-2 fft, for powers of two */
 
-  /* compute the fft with radix2 */
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  memcpy (fft_data, data, n * howmany * 2 * sizeof (double));
 
-  result = fft_binary_logn(n) ;
-
-  if (result == -1) {
-    exit(EXIT_SUCCESS) ;
-  } else {
-    logn = result ;
-  }
-
-  start = clock ();
-  i = 0;
-  do
+  if ((n & (n - 1)) == 0)
     {
-      status = gsl_fft_complex_radix2_forward (fft_data, 1, n);
-      i++;
-      end = clock ();
+      start = clock ();
+      i = 0;
+      do
+        {
+          for (b = 0; b < howmany && status == 0; b++)
+            status = gsl_fft_complex_radix2_forward (fft_data + 2 * n * b, 1, n);
+          i++;
+          end = clock ();
+        }
+      while (end < start + resolution && status == 0);
+
+      if (status == 0)
+        report ("gsl_fft_complex_radix2_forward", n, howmany, i, start, end);
+      else
+        printf ("radix-2 fft failed\n");
     }
-  while (end < start + resolution && status == 0);
 
-  if (status == 0)
-    {
-      printf ("n = %d gsl_fft_complex_radix2_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
-    }
-  else
-    {
-      printf ("fft_radix2: not a power of 2\n");
-    }
+  /* planned fft */
+
+  memcpy (fft_data, data, n * howmany * 2 * sizeof (double));
 
   start = clock ();
   i = 0;
   do
     {
-      status = fft_complex_bitreverse_order (fft_data, 1, n, logn);
+      status = gsl_fft_plan_execute (plan, fft_data);
       i++;
       end = clock ();
     }
   while (end < start + resolution && status == 0);
 
-  printf ("n = %d gsl_fft_complex_bitreverse_order %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+  if (status == 0)
+    report ("gsl_fft_plan_execute", n, howmany, i, start, end);
+  else
+    printf ("planned fft failed\n");
 
+  gsl_fft_plan_free (plan);
+  gsl_fft_complex_wavetable_free (cw);
+  gsl_fft_complex_workspace_free (cwork);
+  free (data);
+  free (fft_data);
 
   return 0;
 }
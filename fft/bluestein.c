@@ -0,0 +1,275 @@
+/* fft/bluestein.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Bluestein's algorithm for transforms of length n with large prime
+   factors.  Writing jk = (j^2 + k^2 - (k-j)^2)/2, the forward
+   transform becomes
+
+     x_k = c_k sum_j (z_j c_j) conj(c_(k-j)),   c_k = exp(-i pi k^2/n)
+
+   which is a convolution.  It is computed with complex transforms of
+   a power of 2 length nconv >= 2n - 1, whose factors and twiddle
+   factors are stored in the wavetable in place of those for n.  The
+   wavetable also holds the chirp c_k, k < n, followed by the forward
+   transform of the filter conj(c_k), scaled by 1/nconv. */
+
+static void
+FUNCTION(fft_bluestein,wavetable) (TYPE(gsl_fft_complex_wavetable) * w,
+                                   const size_t nconv,
+                                   const size_t nf,
+                                   const size_t factor[],
+                                   TYPE(gsl_complex) * const twiddle[])
+{
+  size_t i;
+
+  w->n = nconv;
+  w->nf = nf;
+
+  for (i = 0; i < nf; i++)
+    {
+      w->factor[i] = factor[i];
+      w->twiddle[i] = twiddle[i];
+    }
+
+  w->trig = twiddle[0];
+  w->nconv = 0;
+  w->chirp = NULL;
+}
+
+/* Allocate and fill the tables for a Bluestein transform of length
+   n: the twiddle factors of the length nconv transform in trig, and
+   the chirp and filter in chirp. */
+
+static int
+FUNCTION(fft_bluestein,alloc) (const size_t n,
+                               const size_t nconv,
+                               size_t * nf,
+                               size_t factor[],
+                               TYPE(gsl_complex) * twiddle[],
+                               TYPE(gsl_complex) ** trig,
+                               TYPE(gsl_complex) ** chirp)
+{
+  int status;
+  size_t t;
+
+  *trig = (TYPE(gsl_complex) *) malloc (nconv * sizeof (TYPE(gsl_complex)));
+
+  if (*trig == NULL)
+    {
+      GSL_ERROR ("failed to allocate trigonometric lookup table", GSL_ENOMEM);
+    }
+
+  status = fft_complex_factorize (nconv, nf, factor);
+
+  if (status)
+    {
+      free (*trig);
+      GSL_ERROR ("factorization failed", GSL_EFACTOR);
+    }
+
+  t = FUNCTION(fft_complex,init_trig) (nconv, *nf, factor, *trig, twiddle);
+
+  if (t > nconv)
+    {
+      free (*trig);
+      GSL_ERROR ("overflowed trigonometric lookup table", GSL_ESANITY);
+    }
+
+  *chirp = (TYPE(gsl_complex) *) 
+    malloc ((n + nconv) * sizeof (TYPE(gsl_complex)));
+
+  if (*chirp == NULL)
+    {
+      free (*trig);
+      GSL_ERROR ("failed to allocate chirp table", GSL_ENOMEM);
+    }
+
+  status = FUNCTION(fft_bluestein,init) (n, nconv, *nf, factor, twiddle, *chirp);
+
+  if (status)
+    {
+      free (*chirp);
+      free (*trig);
+      return status;
+    }
+
+  return 0;
+}
+
+static int
+FUNCTION(fft_bluestein,init) (const size_t n,
+                              const size_t nconv,
+                              const size_t nf,
+                              const size_t factor[],
+                              TYPE(gsl_complex) * const twiddle[],
+                              TYPE(gsl_complex) chirp[])
+{
+  TYPE(gsl_fft_complex_wavetable) w;
+  TYPE(gsl_complex) * const filter = chirp + n;
+  const double norm = 1.0 / (double) nconv;
+  size_t k, m = 0;
+
+  BASE * scratch = (BASE *) malloc (2 * nconv * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      /* m = k^2 mod 2n */
+
+      const double theta = -M_PI * (double) m / (double) n;
+      GSL_REAL(chirp[k]) = cos (theta);
+      GSL_IMAG(chirp[k]) = sin (theta);
+
+      m = (m + 2 * k + 1) % (2 * n);
+    }
+
+  for (k = 0; k < nconv; k++)
+    {
+      GSL_REAL(filter[k]) = 0;
+      GSL_IMAG(filter[k]) = 0;
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      GSL_REAL(filter[k]) = norm * GSL_REAL(chirp[k]);
+      GSL_IMAG(filter[k]) = -norm * GSL_IMAG(chirp[k]);
+
+      if (k > 0)
+        {
+          filter[nconv - k] = filter[k];
+        }
+    }
+
+  FUNCTION(fft_bluestein,wavetable) (&w, nconv, nf, factor, twiddle);
+  FUNCTION(fft_complex,passes) ((BASE *) filter, 1, 0, nconv, 1, &w, scratch,
+                                gsl_fft_forward);
+
+  free (scratch);
+
+  return 0;
+}
+
+/* Replace a[0..n-1] by its forward transform.  The array a must have
+   room for nconv complex values, and scratch for another nconv. */
+
+static void
+FUNCTION(fft_bluestein,convolve) (BASE a[],
+                                  const size_t n,
+                                  const size_t nconv,
+                                  const size_t nf,
+                                  const size_t factor[],
+                                  TYPE(gsl_complex) * const twiddle[],
+                                  const TYPE(gsl_complex) chirp[],
+                                  BASE scratch[])
+{
+  TYPE(gsl_fft_complex_wavetable) w;
+  const TYPE(gsl_complex) * const filter = chirp + n;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      const ATOMIC z_real = REAL(a,1,k);
+      const ATOMIC z_imag = IMAG(a,1,k);
+      const ATOMIC c_real = GSL_REAL(chirp[k]);
+      const ATOMIC c_imag = GSL_IMAG(chirp[k]);
+
+      REAL(a,1,k) = z_real * c_real - z_imag * c_imag;
+      IMAG(a,1,k) = z_real * c_imag + z_imag * c_real;
+    }
+
+  for (k = n; k < nconv; k++)
+    {
+      REAL(a,1,k) = 0;
+      IMAG(a,1,k) = 0;
+    }
+
+  FUNCTION(fft_bluestein,wavetable) (&w, nconv, nf, factor, twiddle);
+  FUNCTION(fft_complex,passes) (a, 1, 0, nconv, 1, &w, scratch,
+                                gsl_fft_forward);
+
+  for (k = 0; k < nconv; k++)
+    {
+      const ATOMIC z_real = REAL(a,1,k);
+      const ATOMIC z_imag = IMAG(a,1,k);
+      const ATOMIC f_real = GSL_REAL(filter[k]);
+      const ATOMIC f_imag = GSL_IMAG(filter[k]);
+
+      REAL(a,1,k) = z_real * f_real - z_imag * f_imag;
+      IMAG(a,1,k) = z_real * f_imag + z_imag * f_real;
+    }
+
+  FUNCTION(fft_complex,passes) (a, 1, 0, nconv, 1, &w, scratch,
+                                gsl_fft_backward);
+
+  for (k = 0; k < n; k++)
+    {
+      const ATOMIC z_real = REAL(a,1,k);
+      const ATOMIC z_imag = IMAG(a,1,k);
+      const ATOMIC c_real = GSL_REAL(chirp[k]);
+      const ATOMIC c_imag = GSL_IMAG(chirp[k]);
+
+      REAL(a,1,k) = z_real * c_real - z_imag * c_imag;
+      IMAG(a,1,k) = z_real * c_imag + z_imag * c_real;
+    }
+}
+
+/* Compute howmany complex transforms with Bluestein's algorithm, using
+   the identity backward(z) = conj(forward(conj(z))).  The scratch
+   space must hold 2 nconv complex values. */
+
+static void
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t dist,
+                                 const size_t n,
+                                 const size_t howmany,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign)
+{
+  const size_t nconv = wavetable->nconv;
+  const ATOMIC s = (sign == gsl_fft_forward) ? 1 : -1;
+  BASE * const a = scratch;
+  size_t b, k;
+
+  for (b = 0; b < howmany; b++)
+    {
+      BASE * z = data + 2 * dist * b;
+
+      for (k = 0; k < n; k++)
+        {
+          REAL(a,1,k) = REAL(z,stride,k);
+          IMAG(a,1,k) = s * IMAG(z,stride,k);
+        }
+
+      FUNCTION(fft_bluestein,convolve) (a, n, nconv, wavetable->nf,
+                                        wavetable->factor, wavetable->twiddle,
+                                        wavetable->chirp, scratch + 2 * nconv);
+
+      for (k = 0; k < n; k++)
+        {
+          REAL(z,stride,k) = REAL(a,1,k);
+          IMAG(z,stride,k) = s * IMAG(a,1,k);
+        }
+    }
+}
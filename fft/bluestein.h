@@ -0,0 +1,55 @@
+/* fft/bluestein.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+static int
+FUNCTION(fft_bluestein,alloc) (const size_t n,
+                               const size_t nconv,
+                               size_t * nf,
+                               size_t factor[],
+                               TYPE(gsl_complex) * twiddle[],
+                               TYPE(gsl_complex) ** trig,
+                               TYPE(gsl_complex) ** chirp);
+
+static int
+FUNCTION(fft_bluestein,init) (const size_t n,
+                              const size_t nconv,
+                              const size_t nf,
+                              const size_t factor[],
+                              TYPE(gsl_complex) * const twiddle[],
+                              TYPE(gsl_complex) chirp[]);
+
+static void
+FUNCTION(fft_bluestein,convolve) (BASE a[],
+                                  const size_t n,
+                                  const size_t nconv,
+                                  const size_t nf,
+                                  const size_t factor[],
+                                  TYPE(gsl_complex) * const twiddle[],
+                                  const TYPE(gsl_complex) chirp[],
+                                  BASE scratch[]);
+
+static void
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t dist,
+                                 const size_t n,
+                                 const size_t howmany,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign);
@@ -17,14 +17,62 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include "bluestein.h"
+
+/* Fill trig with the twiddle factors for a complex transform of
+   length n with the given factors, and return the number used. */
+
+static size_t
+FUNCTION(fft_complex,init_trig) (const size_t n,
+                                 const size_t n_factors,
+                                 const size_t factor[],
+                                 TYPE(gsl_complex) trig[],
+                                 TYPE(gsl_complex) * twiddle[])
+{
+  size_t i;
+  size_t t, product, product_1, q;
+  double d_theta;
+
+  d_theta = -2.0 * M_PI / ((double) n);
+
+  t = 0;
+  product = 1;
+  for (i = 0; i < n_factors; i++)
+    {
+      size_t j;
+      const size_t f = factor[i];
+      twiddle[i] = trig + t;
+      product_1 = product;      /* product_1 = p_(i-1) */
+      product *= f;
+      q = n / product;
+
+      for (j = 1; j < f; j++)
+        {
+          size_t k;
+          size_t m = 0;
+          for (k = 1; k <= q; k++)
+            {
+              double theta;
+              m = m + j * product_1;
+              m = m % n;
+              theta = d_theta * m;      /*  d_theta*j*k*p_(i-1) */
+              GSL_REAL(trig[t]) = cos (theta);
+              GSL_IMAG(trig[t]) = sin (theta);
+
+              t++;
+            }
+        }
+    }
+
+  return t;
+}
+
 TYPE(gsl_fft_complex_wavetable) * 
 FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
 {
   int status ;
-  size_t i;
   size_t n_factors;
-  size_t t, product, product_1, q;
-  double d_theta;
+  size_t t, nconv;
 
   TYPE(gsl_fft_complex_wavetable) * wavetable ;
 
@@ -41,6 +89,32 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->n = n ;
+
+  /* lengths with large prime factors are computed as a convolution,
+     see bluestein.c */
+
+  nconv = fft_bluestein_length (n);
+
+  wavetable->nconv = nconv ;
+  wavetable->chirp = NULL ;
+
+  if (nconv > 0)
+    {
+      status = FUNCTION(fft_bluestein,alloc) (n, nconv, &(wavetable->nf),
+                                              wavetable->factor,
+                                              wavetable->twiddle,
+                                              &(wavetable->trig),
+                                              &(wavetable->chirp));
+      if (status)
+        {
+          free (wavetable);     /* error already reported */
+          return 0;
+        }
+
+      return wavetable;
+    }
+
   wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
@@ -51,8 +125,6 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
                         GSL_ENOMEM, 0);
     }
 
-  wavetable->n = n ;
-
   status = fft_complex_factorize (n, &n_factors, wavetable->factor);
 
   if (status)
@@ -67,36 +139,8 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
 
   wavetable->nf = n_factors;
 
-  d_theta = -2.0 * M_PI / ((double) n);
-
-  t = 0;
-  product = 1;
-  for (i = 0; i < n_factors; i++)
-    {
-      size_t j;
-      const size_t factor = wavetable->factor[i];
-      wavetable->twiddle[i] = wavetable->trig + t;
-      product_1 = product;      /* product_1 = p_(i-1) */
-      product *= factor;
-      q = n / product;
-
-      for (j = 1; j < factor; j++)
-        {
-          size_t k;
-          size_t m = 0;
-          for (k = 1; k <= q; k++)
-            {
-              double theta;
-              m = m + j * product_1;
-              m = m % n;
-              theta = d_theta * m;      /*  d_theta*j*k*p_(i-1) */
-              GSL_REAL(wavetable->trig[t]) = cos (theta);
-              GSL_IMAG(wavetable->trig[t]) = sin (theta);
-
-              t++;
-            }
-        }
-    }
+  t = FUNCTION(fft_complex,init_trig) (n, n_factors, wavetable->factor,
+                                       wavetable->trig, wavetable->twiddle);
 
   if (t > n)
     {
@@ -117,6 +161,7 @@ TYPE(gsl_fft_complex_workspace) *
 FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
 {
   TYPE(gsl_fft_complex_workspace) * workspace ;
+  size_t nscratch;
 
   if (n == 0)
     {
@@ -133,7 +178,12 @@ FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
 
   workspace->n = n ;
 
-  workspace->scratch = (BASE *) malloc (2 * n * sizeof (BASE));
+  /* a Bluestein transform needs two complex arrays of the
+     convolution length */
+
+  nscratch = GSL_MAX (n, 2 * fft_bluestein_length (n));
+
+  workspace->scratch = (BASE *) malloc (2 * nscratch * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -155,6 +205,9 @@ FUNCTION(gsl_fft_complex_wavetable,free) (TYPE(gsl_fft_complex_wavetable) * wave
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  free (wavetable->chirp);
+  wavetable->chirp = NULL;
+
   free (wavetable) ;
 }
 
@@ -174,17 +227,23 @@ int
 FUNCTION(gsl_fft_complex,memcpy) (TYPE(gsl_fft_complex_wavetable) * dest,
                                   TYPE(gsl_fft_complex_wavetable) * src)
 {
-  int i, n, nf ;
+  size_t i, n, nf ;
 
   if (dest->n != src->n) 
     {
       GSL_ERROR ("length of src and dest do not match", GSL_EINVAL);
     } 
   
-  n = dest->n ;
+  n = (dest->nconv > 0) ? dest->nconv : dest->n ;
   nf = dest->nf ;
 
-  memcpy(dest->trig, src->trig, n * sizeof (double)) ;
+  memcpy(dest->trig, src->trig, n * sizeof (TYPE(gsl_complex))) ;
+
+  if (dest->nconv > 0)
+    {
+      memcpy(dest->chirp, src->chirp,
+             (dest->n + dest->nconv) * sizeof (TYPE(gsl_complex))) ;
+    }
   
   for (i = 0 ; i < nf ; i++)
     {
@@ -18,6 +18,17 @@
  */
 
 #include "c_pass.h"
+#include "bluestein.h"
+
+static void
+FUNCTION(fft_complex,passes) (BASE data[],
+                              const size_t stride,
+                              const size_t dist,
+                              const size_t n,
+                              const size_t howmany,
+                              const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                              BASE scratch[],
+                              const gsl_fft_direction sign);
 
 int
 FUNCTION(gsl_fft_complex,forward) (TYPE(gsl_complex_packed_array) data, 
@@ -75,6 +86,75 @@ FUNCTION(gsl_fft_complex,inverse) (TYPE(gsl_complex_packed_array) data,
   return status;
 }
 
+int
+FUNCTION(gsl_fft_complex,forward_batch) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t n,
+                                         const size_t howmany,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_workspace) * work)
+{
+  gsl_fft_direction sign = gsl_fft_forward;
+  int status = FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist, n,
+                                                          howmany, wavetable,
+                                                          work, sign);
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,backward_batch) (TYPE(gsl_complex_packed_array) data,
+                                          const size_t stride,
+                                          const size_t dist,
+                                          const size_t n,
+                                          const size_t howmany,
+                                          const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                          TYPE(gsl_fft_complex_workspace) * work)
+{
+  gsl_fft_direction sign = gsl_fft_backward;
+  int status = FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist, n,
+                                                          howmany, wavetable,
+                                                          work, sign);
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,inverse_batch) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t n,
+                                         const size_t howmany,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_workspace) * work)
+{
+  gsl_fft_direction sign = gsl_fft_backward;
+  int status = FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist, n,
+                                                          howmany, wavetable,
+                                                          work, sign);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/n */
+
+  {
+    const ATOMIC norm = ONE / (ATOMIC)n;
+    size_t b, i;
+    for (b = 0; b < howmany; b++)
+      {
+        BASE * z = data + 2 * dist * b;
+        for (i = 0; i < n; i++)
+          {
+            REAL(z,stride,i) *= norm;
+            IMAG(z,stride,i) *= norm;
+          }
+      }
+  }
+  return status;
+}
+
 int
 FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data, 
                                      const size_t stride, 
@@ -83,45 +163,137 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
                                      TYPE(gsl_fft_complex_workspace) * work,
                                      const gsl_fft_direction sign)
 {
-  const size_t nf = wavetable->nf;
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
 
-  size_t i;
+  if (n == 1)
+    {                           /* FFT of 1 data point is the identity */
+      return 0;
+    }
 
-  size_t q, product = 1;
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
 
-  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
-    *twiddle5, *twiddle6;
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
 
-  size_t state = 0;
+  if (wavetable->nconv > 0)
+    {
+      FUNCTION(fft_complex,bluestein) (data, stride, 0, n, 1, wavetable,
+                                       work->scratch, sign);
+      return 0;
+    }
 
-  BASE * const scratch = work->scratch;
+  FUNCTION(fft_complex,passes) (data, stride, 0, n, 1, wavetable, work->scratch,
+                                sign);
 
-  BASE * in = data;
-  size_t istride = stride;
+  return 0;
+}
 
-  BASE * out = scratch;
-  size_t ostride = 1;
+int
+FUNCTION(gsl_fft_complex,transform_batch) (TYPE(gsl_complex_packed_array) data,
+                                           const size_t stride,
+                                           const size_t dist,
+                                           const size_t n,
+                                           const size_t howmany,
+                                           const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                           TYPE(gsl_fft_complex_workspace) * work,
+                                           const gsl_fft_direction sign)
+{
+  size_t b, group;
 
   if (n == 0)
     {
       GSL_ERROR ("length n must be positive integer", GSL_EDOM);
     }
 
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (work->n < n)
+    {
+      GSL_ERROR ("workspace is smaller than length of data", GSL_EINVAL);
+    }
+
   if (n == 1)
     {                           /* FFT of 1 data point is the identity */
       return 0;
     }
 
-  if (n != wavetable->n)
+  if (wavetable->nconv > 0)
     {
-      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+      /* Bluestein transforms are computed one at a time, in scratch
+         space of twice the convolution length */
+
+      const size_t nscratch = GSL_MAX (work->n, 2 * fft_bluestein_length (work->n));
+
+      if (nscratch < 2 * wavetable->nconv)
+        {
+          GSL_ERROR ("workspace is too small for length of data", GSL_EINVAL);
+        }
+
+      FUNCTION(fft_complex,bluestein) (data, stride, dist, n, howmany,
+                                       wavetable, work->scratch, sign);
+      return 0;
     }
 
-  if (n != work->n)
+  /* the workspace holds the intermediate results of work->n / n
+     transforms, which are computed together */
+
+  group = work->n / n;
+
+  for (b = 0; b < howmany; b += group)
     {
-      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+      const size_t nb = GSL_MIN (group, howmany - b);
+      FUNCTION(fft_complex,passes) (data + 2 * dist * b, stride, dist, n, nb,
+                                    wavetable, work->scratch, sign);
     }
 
+  return 0;
+}
+
+/* Compute howmany transforms of length n > 1, the b-th starting at
+   data[2*dist*b], with the intermediate results of the b-th transform
+   stored at scratch[2*n*b].  Each pass applies its twiddle factors to
+   all of the transforms before moving on to the next ones. */
+
+static void
+FUNCTION(fft_complex,passes) (BASE data[],
+                              const size_t stride,
+                              const size_t dist,
+                              const size_t n,
+                              const size_t howmany,
+                              const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                              BASE scratch[],
+                              const gsl_fft_direction sign)
+{
+  const size_t nf = wavetable->nf;
+
+  size_t i, b;
+
+  size_t q, product = 1;
+
+  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
+    *twiddle5, *twiddle6;
+
+  size_t state = 0;
+
+  BASE * in = data;
+  size_t istride = stride;
+  size_t idist = dist;
+
+  BASE * out = scratch;
+  size_t ostride = 1;
+  size_t odist = n;
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -132,30 +304,36 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
         {
           in = data;
           istride = stride;
+          idist = dist;
           out = scratch;
           ostride = 1;
+          odist = n;
           state = 1;
         }
       else
         {
           in = scratch;
           istride = 1;
+          idist = n;
           out = data;
           ostride = stride;
+          odist = dist;
           state = 0;
         }
 
       if (factor == 2)
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_complex,pass_2) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_2) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1);
         }
       else if (factor == 3)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + q;
-          FUNCTION(fft_complex,pass_3) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_3) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1, twiddle2);
         }
       else if (factor == 4)
@@ -163,7 +341,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + q;
           twiddle3 = twiddle2 + q;
-          FUNCTION(fft_complex,pass_4) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_4) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1, twiddle2, 
                                         twiddle3);
         }
@@ -173,7 +352,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle2 = twiddle1 + q;
           twiddle3 = twiddle2 + q;
           twiddle4 = twiddle3 + q;
-          FUNCTION(fft_complex,pass_5) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_5) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1, twiddle2, 
                                         twiddle3, twiddle4);
         }
@@ -184,7 +364,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle3 = twiddle2 + q;
           twiddle4 = twiddle3 + q;
           twiddle5 = twiddle4 + q;
-          FUNCTION(fft_complex,pass_6) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_6) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1, twiddle2, 
                                         twiddle3, twiddle4, twiddle5);
         }
@@ -196,7 +377,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle4 = twiddle3 + q;
           twiddle5 = twiddle4 + q;
           twiddle6 = twiddle5 + q;
-          FUNCTION(fft_complex,pass_7) (in, istride, out, ostride, sign, 
+          FUNCTION(fft_complex,pass_7) (in, istride, idist, out, ostride, odist,
+                                        howmany, sign, 
                                         product, n, twiddle1, twiddle2, 
                                         twiddle3, twiddle4, twiddle5, 
                                         twiddle6);
@@ -204,20 +386,27 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
       else
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_complex,pass_n) (in, istride, out, ostride, sign, 
-                                        factor, product, n, twiddle1);
+          for (b = 0; b < howmany; b++)
+            {
+              FUNCTION(fft_complex,pass_n) (in + 2 * idist * b, istride,
+                                            out + 2 * odist * b, ostride,
+                                            sign, factor, product, n,
+                                            twiddle1);
+            }
         }
     }
 
   if (state == 1)               /* copy results back from scratch to data */
     {
-      for (i = 0; i < n; i++)
+      for (b = 0; b < howmany; b++)
         {
-          REAL(data,stride,i) = REAL(scratch,1,i) ;
-          IMAG(data,stride,i) = IMAG(scratch,1,i) ;
+          BASE * z = data + 2 * dist * b;
+          const BASE * t = scratch + 2 * n * b;
+          for (i = 0; i < n; i++)
+            {
+              REAL(z,stride,i) = REAL(t,1,i) ;
+              IMAG(z,stride,i) = IMAG(t,1,i) ;
+            }
         }
     }
-
-  return 0;
-
 }
@@ -18,20 +18,26 @@
  */
 
 static int
-FUNCTION(fft_complex,pass_2) (const BASE in[],
+FUNCTION(fft_complex,pass_2) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[]);
 
 static int
-FUNCTION(fft_complex,pass_3) (const BASE in[],
+FUNCTION(fft_complex,pass_3) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -39,10 +45,13 @@ FUNCTION(fft_complex,pass_3) (const BASE in[],
                               const TYPE(gsl_complex) twiddle2[]);
 
 static int
-FUNCTION(fft_complex,pass_4) (const BASE in[],
+FUNCTION(fft_complex,pass_4) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -51,10 +60,13 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
                               const TYPE(gsl_complex) twiddle3[]);
 
 static int
-FUNCTION(fft_complex,pass_5) (const BASE in[],
+FUNCTION(fft_complex,pass_5) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -64,10 +76,13 @@ FUNCTION(fft_complex,pass_5) (const BASE in[],
                               const TYPE(gsl_complex) twiddle4[]);
 
 static int
-FUNCTION(fft_complex,pass_6) (const BASE in[],
+FUNCTION(fft_complex,pass_6) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -78,10 +93,13 @@ FUNCTION(fft_complex,pass_6) (const BASE in[],
                               const TYPE(gsl_complex) twiddle5[]);
 
 static int
-FUNCTION(fft_complex,pass_7) (const BASE in[],
+FUNCTION(fft_complex,pass_7) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -18,23 +18,25 @@
  */
 
 static int
-FUNCTION(fft_complex,pass_2) (const BASE in[],
+FUNCTION(fft_complex,pass_2) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[])
 {
-  size_t i = 0, j = 0;
-  size_t k, k1;
+  size_t i, j;
+  size_t k, k1, b;
 
   const size_t factor = 2;
   const size_t m = n / factor;
   const size_t q = n / product;
   const size_t product_1 = product / factor;
-  const size_t jump = (factor - 1) * product_1;
 
   for (k = 0; k < q; k++)
     {
@@ -61,38 +63,46 @@ FUNCTION(fft_complex,pass_2) (const BASE in[],
             }
         }
 
-      for (k1 = 0; k1 < product_1; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const ATOMIC z0_real = REAL(in,istride,i);
-          const ATOMIC z0_imag = IMAG(in,istride,i);
+          const BASE *in = in0 + 2 * idist * b;
+          BASE *out = out0 + 2 * odist * b;
 
-          const ATOMIC z1_real = REAL(in,istride,i+m);
-          const ATOMIC z1_imag = IMAG(in,istride,i+m);
+          i = product_1 * k;
+          j = product * k;
 
-          /* compute x = W(2) z */
+          for (k1 = 0; k1 < product_1; k1++)
+            {
+              const ATOMIC z0_real = REAL(in,istride,i);
+              const ATOMIC z0_imag = IMAG(in,istride,i);
+
+              const ATOMIC z1_real = REAL(in,istride,i+m);
+              const ATOMIC z1_imag = IMAG(in,istride,i+m);
 
-          /* x0 = z0 + z1 */
-          const ATOMIC x0_real = z0_real + z1_real;
-          const ATOMIC x0_imag = z0_imag + z1_imag;
+              /* compute x = W(2) z */
 
-          /* x1 = z0 - z1 */
-          const ATOMIC x1_real = z0_real - z1_real;
-          const ATOMIC x1_imag = z0_imag - z1_imag;
+              /* x0 = z0 + z1 */
+              const ATOMIC x0_real = z0_real + z1_real;
+              const ATOMIC x0_imag = z0_imag + z1_imag;
 
-          /* apply twiddle factors */
+              /* x1 = z0 - z1 */
+              const ATOMIC x1_real = z0_real - z1_real;
+              const ATOMIC x1_imag = z0_imag - z1_imag;
+
+              /* apply twiddle factors */
           
-          /* out0 = 1 * x0 */
-          REAL(out,ostride,j) = x0_real;
-          IMAG(out,ostride,j) = x0_imag;
+              /* out0 = 1 * x0 */
+              REAL(out,ostride,j) = x0_real;
+              IMAG(out,ostride,j) = x0_imag;
           
-          /* out1 = w * x1 */
-          REAL(out,ostride,j+product_1) = w_real * x1_real - w_imag * x1_imag;
-          IMAG(out,ostride,j+product_1) = w_real * x1_imag + w_imag * x1_real;
+              /* out1 = w * x1 */
+              REAL(out,ostride,j+product_1) = w_real * x1_real - w_imag * x1_imag;
+              IMAG(out,ostride,j+product_1) = w_real * x1_imag + w_imag * x1_real;
           
-          i++;
-          j++;
+              i++;
+              j++;
+            }
         }
-      j += jump;
     }
   return 0;
 }
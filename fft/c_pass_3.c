@@ -18,24 +18,26 @@
  */
 
 static int
-FUNCTION(fft_complex,pass_3) (const BASE in[],
+FUNCTION(fft_complex,pass_3) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
                               const TYPE(gsl_complex) * twiddle1,
                               const TYPE(gsl_complex) * twiddle2)
 {
-  size_t i = 0, j = 0;
-  size_t k, k1;
+  size_t i, j;
+  size_t k, k1, b;
 
   const size_t factor = 3;
   const size_t m = n / factor;
   const size_t q = n / product;
   const size_t product_1 = product / factor;
-  const size_t jump = (factor - 1) * product_1;
 
   const ATOMIC tau = sqrt (3.0) / 2.0;
 
@@ -70,58 +72,66 @@ FUNCTION(fft_complex,pass_3) (const BASE in[],
             }
         }
 
-      for (k1 = 0; k1 < product_1; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const ATOMIC z0_real = REAL(in,istride,i);
-          const ATOMIC z0_imag = IMAG(in,istride,i);
-          const ATOMIC z1_real = REAL(in,istride,i+m);
-          const ATOMIC z1_imag = IMAG(in,istride,i+m);
-          const ATOMIC z2_real = REAL(in,istride,i+2*m);
-          const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+          const BASE *in = in0 + 2 * idist * b;
+          BASE *out = out0 + 2 * odist * b;
 
-          /* compute x = W(3) z */
+          i = product_1 * k;
+          j = product * k;
 
-          /* t1 = z1 + z2 */
-          const ATOMIC t1_real = z1_real + z2_real;
-          const ATOMIC t1_imag = z1_imag + z2_imag;
+          for (k1 = 0; k1 < product_1; k1++)
+            {
+              const ATOMIC z0_real = REAL(in,istride,i);
+              const ATOMIC z0_imag = IMAG(in,istride,i);
+              const ATOMIC z1_real = REAL(in,istride,i+m);
+              const ATOMIC z1_imag = IMAG(in,istride,i+m);
+              const ATOMIC z2_real = REAL(in,istride,i+2*m);
+              const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+
+              /* compute x = W(3) z */
+
+              /* t1 = z1 + z2 */
+              const ATOMIC t1_real = z1_real + z2_real;
+              const ATOMIC t1_imag = z1_imag + z2_imag;
           
-          /* t2 = z0 - t1/2 */
-          const ATOMIC t2_real = z0_real - t1_real / 2.0;
-          const ATOMIC t2_imag = z0_imag - t1_imag / 2.0;
+              /* t2 = z0 - t1/2 */
+              const ATOMIC t2_real = z0_real - t1_real / 2.0;
+              const ATOMIC t2_imag = z0_imag - t1_imag / 2.0;
           
-          /* t3 = (+/-) sin(pi/3)*(z1 - z2) */
-          const ATOMIC t3_real = ((int) sign) * tau * (z1_real - z2_real);
-          const ATOMIC t3_imag = ((int) sign) * tau * (z1_imag - z2_imag);
+              /* t3 = (+/-) sin(pi/3)*(z1 - z2) */
+              const ATOMIC t3_real = ((int) sign) * tau * (z1_real - z2_real);
+              const ATOMIC t3_imag = ((int) sign) * tau * (z1_imag - z2_imag);
           
-          /* x0 = z0 + t1 */
-          const ATOMIC x0_real = z0_real + t1_real;
-          const ATOMIC x0_imag = z0_imag + t1_imag;
+              /* x0 = z0 + t1 */
+              const ATOMIC x0_real = z0_real + t1_real;
+              const ATOMIC x0_imag = z0_imag + t1_imag;
           
-          /* x1 = t2 + i t3 */
-          const ATOMIC x1_real = t2_real - t3_imag;
-          const ATOMIC x1_imag = t2_imag + t3_real;
+              /* x1 = t2 + i t3 */
+              const ATOMIC x1_real = t2_real - t3_imag;
+              const ATOMIC x1_imag = t2_imag + t3_real;
           
-          /* x2 = t2 - i t3 */
-          const ATOMIC x2_real = t2_real + t3_imag;
-          const ATOMIC x2_imag = t2_imag - t3_real;
+              /* x2 = t2 - i t3 */
+              const ATOMIC x2_real = t2_real + t3_imag;
+              const ATOMIC x2_imag = t2_imag - t3_real;
 
-          /* apply twiddle factors */
+              /* apply twiddle factors */
 
-          /* to0 = 1 * x0 */
-          REAL(out,ostride,j) = x0_real;
-          IMAG(out,ostride,j) = x0_imag;
+              /* to0 = 1 * x0 */
+              REAL(out,ostride,j) = x0_real;
+              IMAG(out,ostride,j) = x0_imag;
           
-          /* to1 = w1 * x1 */
-          REAL(out,ostride,j+product_1) = w1_real * x1_real - w1_imag * x1_imag;
-          IMAG(out,ostride,j+product_1) = w1_real * x1_imag + w1_imag * x1_real;
+              /* to1 = w1 * x1 */
+              REAL(out,ostride,j+product_1) = w1_real * x1_real - w1_imag * x1_imag;
+              IMAG(out,ostride,j+product_1) = w1_real * x1_imag + w1_imag * x1_real;
           
-          /* to2 = w2 * x2 */
-          REAL(out,ostride,j+2*product_1) = w2_real * x2_real - w2_imag * x2_imag;
-          IMAG(out,ostride,j+2*product_1) = w2_real * x2_imag + w2_imag * x2_real;
+              /* to2 = w2 * x2 */
+              REAL(out,ostride,j+2*product_1) = w2_real * x2_real - w2_imag * x2_imag;
+              IMAG(out,ostride,j+2*product_1) = w2_real * x2_imag + w2_imag * x2_real;
 
-          i++; j++;
+              i++; j++;
+            }
         }
-      j += jump;
     }
   return 0;
 }
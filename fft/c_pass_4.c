@@ -18,10 +18,13 @@
  */
 
 static int
-FUNCTION(fft_complex,pass_4) (const BASE in[],
+FUNCTION(fft_complex,pass_4) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -29,14 +32,13 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
                               const TYPE(gsl_complex) twiddle2[],
                               const TYPE(gsl_complex) twiddle3[])
 {
-  size_t i = 0, j = 0;
-  size_t k, k1;
+  size_t i, j;
+  size_t k, k1, b;
 
   const size_t factor = 4;
   const size_t m = n / factor;
   const size_t q = n / product;
   const size_t p_1 = product / factor;
-  const size_t jump = (factor - 1) * p_1;
 
   for (k = 0; k < q; k++)
     {
@@ -75,73 +77,81 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
             }
         }
 
-      for (k1 = 0; k1 < p_1; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const ATOMIC z0_real = REAL(in,istride,i);
-          const ATOMIC z0_imag = IMAG(in,istride,i);
-          const ATOMIC z1_real = REAL(in,istride,i+m);
-          const ATOMIC z1_imag = IMAG(in,istride,i+m);
-          const ATOMIC z2_real = REAL(in,istride,i+2*m);
-          const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
-          const ATOMIC z3_real = REAL(in,istride,i+3*m);
-          const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
+          const BASE *in = in0 + 2 * idist * b;
+          BASE *out = out0 + 2 * odist * b;
 
-          /* compute x = W(4) z */
+          i = p_1 * k;
+          j = product * k;
+
+          for (k1 = 0; k1 < p_1; k1++)
+            {
+              const ATOMIC z0_real = REAL(in,istride,i);
+              const ATOMIC z0_imag = IMAG(in,istride,i);
+              const ATOMIC z1_real = REAL(in,istride,i+m);
+              const ATOMIC z1_imag = IMAG(in,istride,i+m);
+              const ATOMIC z2_real = REAL(in,istride,i+2*m);
+              const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+              const ATOMIC z3_real = REAL(in,istride,i+3*m);
+              const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
+
+              /* compute x = W(4) z */
           
-          /* t1 = z0 + z2 */
-          const ATOMIC t1_real = z0_real + z2_real;
-          const ATOMIC t1_imag = z0_imag + z2_imag;
+              /* t1 = z0 + z2 */
+              const ATOMIC t1_real = z0_real + z2_real;
+              const ATOMIC t1_imag = z0_imag + z2_imag;
           
-          /* t2 = z1 + z3 */
-          const ATOMIC t2_real = z1_real + z3_real;
-          const ATOMIC t2_imag = z1_imag + z3_imag;
+              /* t2 = z1 + z3 */
+              const ATOMIC t2_real = z1_real + z3_real;
+              const ATOMIC t2_imag = z1_imag + z3_imag;
           
-          /* t3 = z0 - z2 */
-          const ATOMIC t3_real = z0_real - z2_real;
-          const ATOMIC t3_imag = z0_imag - z2_imag;
+              /* t3 = z0 - z2 */
+              const ATOMIC t3_real = z0_real - z2_real;
+              const ATOMIC t3_imag = z0_imag - z2_imag;
           
-          /* t4 = (+/-) (z1 - z3) */
-          const ATOMIC t4_real = ((int) sign) * (z1_real - z3_real);
-          const ATOMIC t4_imag = ((int) sign) * (z1_imag - z3_imag);
+              /* t4 = (+/-) (z1 - z3) */
+              const ATOMIC t4_real = ((int) sign) * (z1_real - z3_real);
+              const ATOMIC t4_imag = ((int) sign) * (z1_imag - z3_imag);
 
-            /* x0 = t1 + t2 */
-          const ATOMIC x0_real = t1_real + t2_real;
-          const ATOMIC x0_imag = t1_imag + t2_imag;
+                /* x0 = t1 + t2 */
+              const ATOMIC x0_real = t1_real + t2_real;
+              const ATOMIC x0_imag = t1_imag + t2_imag;
 
-            /* x1 = t3 + i t4 */
-          const ATOMIC x1_real = t3_real - t4_imag;
-          const ATOMIC x1_imag = t3_imag + t4_real;
+                /* x1 = t3 + i t4 */
+              const ATOMIC x1_real = t3_real - t4_imag;
+              const ATOMIC x1_imag = t3_imag + t4_real;
 
-            /* x2 = t1 - t2 */
-          const ATOMIC x2_real = t1_real - t2_real;
-          const ATOMIC x2_imag = t1_imag - t2_imag;
+                /* x2 = t1 - t2 */
+              const ATOMIC x2_real = t1_real - t2_real;
+              const ATOMIC x2_imag = t1_imag - t2_imag;
 
-            /* x3 = t3 - i t4 */
-          const ATOMIC x3_real = t3_real + t4_imag;
-          const ATOMIC x3_imag = t3_imag - t4_real;
+                /* x3 = t3 - i t4 */
+              const ATOMIC x3_real = t3_real + t4_imag;
+              const ATOMIC x3_imag = t3_imag - t4_real;
 
-          /* apply twiddle factors */
+              /* apply twiddle factors */
 
-          /* to0 = 1 * x0 */
-          REAL(out,ostride,j) = x0_real;
-          IMAG(out,ostride,j) = x0_imag;
+              /* to0 = 1 * x0 */
+              REAL(out,ostride,j) = x0_real;
+              IMAG(out,ostride,j) = x0_imag;
 
-          /* to1 = w1 * x1 */
-          REAL(out, ostride, j + p_1) = w1_real * x1_real - w1_imag * x1_imag;
-          IMAG(out, ostride, j + p_1) = w1_real * x1_imag + w1_imag * x1_real;
+              /* to1 = w1 * x1 */
+              REAL(out, ostride, j + p_1) = w1_real * x1_real - w1_imag * x1_imag;
+              IMAG(out, ostride, j + p_1) = w1_real * x1_imag + w1_imag * x1_real;
           
-          /* to2 = w2 * x2 */
-          REAL(out, ostride, j + 2 * p_1) = w2_real * x2_real - w2_imag * x2_imag;
-          IMAG(out, ostride, j + 2 * p_1) = w2_real * x2_imag + w2_imag * x2_real;
+              /* to2 = w2 * x2 */
+              REAL(out, ostride, j + 2 * p_1) = w2_real * x2_real - w2_imag * x2_imag;
+              IMAG(out, ostride, j + 2 * p_1) = w2_real * x2_imag + w2_imag * x2_real;
           
-          /* to3 = w3 * x3 */
-          REAL(out, ostride, j + 3 * p_1) = w3_real * x3_real - w3_imag * x3_imag;
-          IMAG(out, ostride, j + 3 * p_1) = w3_real * x3_imag + w3_imag * x3_real;
+              /* to3 = w3 * x3 */
+              REAL(out, ostride, j + 3 * p_1) = w3_real * x3_real - w3_imag * x3_imag;
+              IMAG(out, ostride, j + 3 * p_1) = w3_real * x3_imag + w3_imag * x3_real;
           
-          i++;
-          j++;
+              i++;
+              j++;
+            }
         }
-      j += jump;
     }
   return 0;
 }
@@ -18,10 +18,13 @@
  */
 
 static int
-FUNCTION(fft_complex,pass_6) (const BASE in[],
+FUNCTION(fft_complex,pass_6) (const BASE in0[],
                               const size_t istride,
-                              BASE out[],
+                              const size_t idist,
+                              BASE out0[],
                               const size_t ostride,
+                              const size_t odist,
+                              const size_t howmany,
                               const gsl_fft_direction sign,
                               const size_t product,
                               const size_t n,
@@ -32,14 +35,13 @@ FUNCTION(fft_complex,pass_6) (const BASE in[],
                               const TYPE(gsl_complex) twiddle5[])
 {
 
-  size_t i = 0, j = 0;
-  size_t k, k1;
+  size_t i, j;
+  size_t k, k1, b;
 
   const size_t factor = 6;
   const size_t m = n / factor;
   const size_t q = n / product;
   const size_t p_1 = product / factor;
-  const size_t jump = (factor - 1) * p_1;
 
   const ATOMIC tau = sqrt (3.0) / 2.0;
 
@@ -93,128 +95,136 @@ FUNCTION(fft_complex,pass_6) (const BASE in[],
             }
         }
 
-      for (k1 = 0; k1 < p_1; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const ATOMIC z0_real = REAL(in,istride,i);
-          const ATOMIC z0_imag = IMAG(in,istride,i);
-          const ATOMIC z1_real = REAL(in,istride,i+m);
-          const ATOMIC z1_imag = IMAG(in,istride,i+m);
-          const ATOMIC z2_real = REAL(in,istride,i+2*m);
-          const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
-          const ATOMIC z3_real = REAL(in,istride,i+3*m);
-          const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
-          const ATOMIC z4_real = REAL(in,istride,i+4*m);
-          const ATOMIC z4_imag = IMAG(in,istride,i+4*m);
-          const ATOMIC z5_real = REAL(in,istride,i+5*m);
-          const ATOMIC z5_imag = IMAG(in,istride,i+5*m);
+          const BASE *in = in0 + 2 * idist * b;
+          BASE *out = out0 + 2 * odist * b;
 
-          /* compute x = W(6) z */
+          i = p_1 * k;
+          j = product * k;
 
-          /* W(6) is a combination of sums and differences of W(3) acting
-             on the even and odd elements of z */
+          for (k1 = 0; k1 < p_1; k1++)
+            {
+              const ATOMIC z0_real = REAL(in,istride,i);
+              const ATOMIC z0_imag = IMAG(in,istride,i);
+              const ATOMIC z1_real = REAL(in,istride,i+m);
+              const ATOMIC z1_imag = IMAG(in,istride,i+m);
+              const ATOMIC z2_real = REAL(in,istride,i+2*m);
+              const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+              const ATOMIC z3_real = REAL(in,istride,i+3*m);
+              const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
+              const ATOMIC z4_real = REAL(in,istride,i+4*m);
+              const ATOMIC z4_imag = IMAG(in,istride,i+4*m);
+              const ATOMIC z5_real = REAL(in,istride,i+5*m);
+              const ATOMIC z5_imag = IMAG(in,istride,i+5*m);
+
+              /* compute x = W(6) z */
+
+              /* W(6) is a combination of sums and differences of W(3) acting
+                 on the even and odd elements of z */
           
-          /* ta1 = z2 + z4 */
-          const ATOMIC ta1_real = z2_real + z4_real;
-          const ATOMIC ta1_imag = z2_imag + z4_imag;
+              /* ta1 = z2 + z4 */
+              const ATOMIC ta1_real = z2_real + z4_real;
+              const ATOMIC ta1_imag = z2_imag + z4_imag;
           
-          /* ta2 = z0 - ta1/2 */
-          const ATOMIC ta2_real = z0_real - ta1_real / 2;
-          const ATOMIC ta2_imag = z0_imag - ta1_imag / 2;
+              /* ta2 = z0 - ta1/2 */
+              const ATOMIC ta2_real = z0_real - ta1_real / 2;
+              const ATOMIC ta2_imag = z0_imag - ta1_imag / 2;
           
-          /* ta3 = (+/-) sin(pi/3)*(z2 - z4) */
-          const ATOMIC ta3_real = ((int) sign) * tau * (z2_real - z4_real);
-          const ATOMIC ta3_imag = ((int) sign) * tau * (z2_imag - z4_imag);
+              /* ta3 = (+/-) sin(pi/3)*(z2 - z4) */
+              const ATOMIC ta3_real = ((int) sign) * tau * (z2_real - z4_real);
+              const ATOMIC ta3_imag = ((int) sign) * tau * (z2_imag - z4_imag);
           
-          /* a0 = z0 + ta1 */
-          const ATOMIC a0_real = z0_real + ta1_real;
-          const ATOMIC a0_imag = z0_imag + ta1_imag;
+              /* a0 = z0 + ta1 */
+              const ATOMIC a0_real = z0_real + ta1_real;
+              const ATOMIC a0_imag = z0_imag + ta1_imag;
           
-          /* a1 = ta2 + i ta3 */
-          const ATOMIC a1_real = ta2_real - ta3_imag;
-          const ATOMIC a1_imag = ta2_imag + ta3_real;
+              /* a1 = ta2 + i ta3 */
+              const ATOMIC a1_real = ta2_real - ta3_imag;
+              const ATOMIC a1_imag = ta2_imag + ta3_real;
           
-          /* a2 = ta2 - i ta3 */
-          const ATOMIC a2_real = ta2_real + ta3_imag;
-          const ATOMIC a2_imag = ta2_imag - ta3_real;
+              /* a2 = ta2 - i ta3 */
+              const ATOMIC a2_real = ta2_real + ta3_imag;
+              const ATOMIC a2_imag = ta2_imag - ta3_real;
           
-          /* tb1 = z5 + z1 */
-          const ATOMIC tb1_real = z5_real + z1_real;
-          const ATOMIC tb1_imag = z5_imag + z1_imag;
+              /* tb1 = z5 + z1 */
+              const ATOMIC tb1_real = z5_real + z1_real;
+              const ATOMIC tb1_imag = z5_imag + z1_imag;
           
-          /* tb2 = z3 - tb1/2 */
-          const ATOMIC tb2_real = z3_real - tb1_real / 2;
-          const ATOMIC tb2_imag = z3_imag - tb1_imag / 2;
+              /* tb2 = z3 - tb1/2 */
+              const ATOMIC tb2_real = z3_real - tb1_real / 2;
+              const ATOMIC tb2_imag = z3_imag - tb1_imag / 2;
           
-          /* tb3 = (+/-) sin(pi/3)*(z5 - z1) */
-          const ATOMIC tb3_real = ((int) sign) * tau * (z5_real - z1_real);
-          const ATOMIC tb3_imag = ((int) sign) * tau * (z5_imag - z1_imag);
+              /* tb3 = (+/-) sin(pi/3)*(z5 - z1) */
+              const ATOMIC tb3_real = ((int) sign) * tau * (z5_real - z1_real);
+              const ATOMIC tb3_imag = ((int) sign) * tau * (z5_imag - z1_imag);
           
-          /* b0 = z3 + tb1 */
-          const ATOMIC b0_real = z3_real + tb1_real;
-          const ATOMIC b0_imag = z3_imag + tb1_imag;
+              /* b0 = z3 + tb1 */
+              const ATOMIC b0_real = z3_real + tb1_real;
+              const ATOMIC b0_imag = z3_imag + tb1_imag;
           
-          /* b1 = tb2 + i tb3 */
-          const ATOMIC b1_real = tb2_real - tb3_imag;
-          const ATOMIC b1_imag = tb2_imag + tb3_real;
+              /* b1 = tb2 + i tb3 */
+              const ATOMIC b1_real = tb2_real - tb3_imag;
+              const ATOMIC b1_imag = tb2_imag + tb3_real;
           
-          /* b2 = tb2 - i tb3 */
-          const ATOMIC b2_real = tb2_real + tb3_imag;
-          const ATOMIC b2_imag = tb2_imag - tb3_real;
+              /* b2 = tb2 - i tb3 */
+              const ATOMIC b2_real = tb2_real + tb3_imag;
+              const ATOMIC b2_imag = tb2_imag - tb3_real;
           
-          /* x0 = a0 + b0 */
-          const ATOMIC x0_real = a0_real + b0_real;
-          const ATOMIC x0_imag = a0_imag + b0_imag;
+              /* x0 = a0 + b0 */
+              const ATOMIC x0_real = a0_real + b0_real;
+              const ATOMIC x0_imag = a0_imag + b0_imag;
           
-          /* x4 = a1 + b1 */
-          const ATOMIC x4_real = a1_real + b1_real;
-          const ATOMIC x4_imag = a1_imag + b1_imag;
+              /* x4 = a1 + b1 */
+              const ATOMIC x4_real = a1_real + b1_real;
+              const ATOMIC x4_imag = a1_imag + b1_imag;
           
-          /* x2 = a2 + b2 */
-          const ATOMIC x2_real = a2_real + b2_real;
-          const ATOMIC x2_imag = a2_imag + b2_imag;
+              /* x2 = a2 + b2 */
+              const ATOMIC x2_real = a2_real + b2_real;
+              const ATOMIC x2_imag = a2_imag + b2_imag;
           
-          /* x3 = a0 - b0 */
-          const ATOMIC x3_real = a0_real - b0_real;
-          const ATOMIC x3_imag = a0_imag - b0_imag;
+              /* x3 = a0 - b0 */
+              const ATOMIC x3_real = a0_real - b0_real;
+              const ATOMIC x3_imag = a0_imag - b0_imag;
           
-          /* x1 = a1 - b1 */
-          const ATOMIC x1_real = a1_real - b1_real;
-          const ATOMIC x1_imag = a1_imag - b1_imag;
+              /* x1 = a1 - b1 */
+              const ATOMIC x1_real = a1_real - b1_real;
+              const ATOMIC x1_imag = a1_imag - b1_imag;
           
-          /* x5 = a2 - b2 */
-          const ATOMIC x5_real = a2_real - b2_real;
-          const ATOMIC x5_imag = a2_imag - b2_imag;
+              /* x5 = a2 - b2 */
+              const ATOMIC x5_real = a2_real - b2_real;
+              const ATOMIC x5_imag = a2_imag - b2_imag;
 
-          /* apply twiddle factors */
+              /* apply twiddle factors */
           
-          /* to0 = 1 * x0 */
-          REAL(out,ostride,j) = x0_real;
-          IMAG(out,ostride,j) = x0_imag;
+              /* to0 = 1 * x0 */
+              REAL(out,ostride,j) = x0_real;
+              IMAG(out,ostride,j) = x0_imag;
           
-          /* to1 = w1 * x1 */
-          REAL(out,ostride,j+p_1) = w1_real * x1_real - w1_imag * x1_imag;
-          IMAG(out,ostride,j+p_1) = w1_real * x1_imag + w1_imag * x1_real;
+              /* to1 = w1 * x1 */
+              REAL(out,ostride,j+p_1) = w1_real * x1_real - w1_imag * x1_imag;
+              IMAG(out,ostride,j+p_1) = w1_real * x1_imag + w1_imag * x1_real;
           
-          /* to2 = w2 * x2 */
-          REAL(out,ostride,j+2*p_1) = w2_real * x2_real - w2_imag * x2_imag;
-          IMAG(out,ostride,j+2*p_1) = w2_real * x2_imag + w2_imag * x2_real;
+              /* to2 = w2 * x2 */
+              REAL(out,ostride,j+2*p_1) = w2_real * x2_real - w2_imag * x2_imag;
+              IMAG(out,ostride,j+2*p_1) = w2_real * x2_imag + w2_imag * x2_real;
           
-          /* to3 = w3 * x3 */
-          REAL(out,ostride,j+3*p_1) = w3_real * x3_real - w3_imag * x3_imag;
-          IMAG(out,ostride,j+3*p_1) = w3_real * x3_imag + w3_imag * x3_real;
+              /* to3 = w3 * x3 */
+              REAL(out,ostride,j+3*p_1) = w3_real * x3_real - w3_imag * x3_imag;
+              IMAG(out,ostride,j+3*p_1) = w3_real * x3_imag + w3_imag * x3_real;
           
-          /* to4 = w4 * x4 */
-          REAL(out,ostride,j+4*p_1) = w4_real * x4_real - w4_imag * x4_imag;
-          IMAG(out,ostride,j+4*p_1) = w4_real * x4_imag + w4_imag * x4_real;
+              /* to4 = w4 * x4 */
+              REAL(out,ostride,j+4*p_1) = w4_real * x4_real - w4_imag * x4_imag;
+              IMAG(out,ostride,j+4*p_1) = w4_real * x4_imag + w4_imag * x4_real;
           
-          /* to5 = w5 * x5 */
-          REAL(out,ostride,j+5*p_1) = w5_real * x5_real - w5_imag * x5_imag;
-          IMAG(out,ostride,j+5*p_1) = w5_real * x5_imag + w5_imag * x5_real;
+              /* to5 = w5 * x5 */
+              REAL(out,ostride,j+5*p_1) = w5_real * x5_real - w5_imag * x5_imag;
+              IMAG(out,ostride,j+5*p_1) = w5_real * x5_imag + w5_imag * x5_real;
 
-          i++;
-          j++;
+              i++;
+              j++;
+            }
         }
-      j += jump;
     }
   return 0;
 }
@@ -0,0 +1,486 @@
+/* fft/conv.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Convolution and cross-correlation of a signal with a fixed kernel
+   h of length m,
+
+     conv:   y_t = sum_k h_k x_(t-k)
+     xcorr:  r_t = sum_k h_k x_(t-m+1+k)
+
+   The signal is processed in blocks of nstep = nfft - m + 1 samples,
+   either by direct summation or with real FFTs of length nfft using
+   the transform of the kernel computed once by gsl_conv_set_kernel.
+   The m - 1 values carried from one block to the next are the partial
+   outputs of the last block (overlap-add) or its last inputs
+   (overlap-save).  The cross-correlation uses the conjugate kernel
+   spectrum, which is the transform of the kernel reversed and
+   circularly shifted by m - 1.  The shift is absorbed by placing the
+   input block at offset m - 1 (overlap-add) or reading the output
+   block from offset 0 (overlap-save). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_conv.h>
+
+/* streaming state, the mode in use and whether it is a correlation */
+
+#define CONV_OVERLAP_ADD  1
+#define CONV_OVERLAP_SAVE 2
+#define CONV_CORRELATE    4
+
+/* measured cost of an FFT convolution block of length nfft, in units
+   of nfft log2(nfft) multiply-adds of the direct method */
+
+#define CONV_FFT_COST 3.0
+
+/* smallest block length, so that short kernels are not processed a
+   few samples at a time */
+
+#define CONV_MIN_NFFT 64
+
+static double conv_fft_cost (const size_t m, const size_t nfft);
+static int conv_stream (const double x[], const size_t xstride,
+                        const size_t n, double y[], const size_t ystride,
+                        gsl_conv_workspace * w, const int state);
+static int conv_block_fft (gsl_conv_workspace * w, const int corr);
+
+gsl_conv_workspace *
+gsl_conv_alloc (const size_t m, const size_t n)
+{
+  gsl_conv_workspace *w;
+  size_t nfft, nmax;
+
+  if (m == 0)
+    {
+      GSL_ERROR_NULL ("kernel length m must be positive integer", GSL_EDOM);
+    }
+
+  w = calloc (1, sizeof (gsl_conv_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace struct", GSL_ENOMEM);
+    }
+
+  w->m = m;
+  w->nhint = n;
+
+  /* choose the power of 2 block length with the smallest cost per
+     output sample, no longer than needed for calls of n samples */
+
+  nfft = CONV_MIN_NFFT;
+  while (nfft <= m)
+    nfft *= 2;
+
+  nmax = nfft;
+  while (nmax < ((n > 0) ? n + m - 1 : 64 * m))
+    nmax *= 2;
+
+  w->nfft = nfft;
+
+  for (nfft *= 2; nfft <= nmax; nfft *= 2)
+    {
+      if (conv_fft_cost (m, nfft) < conv_fft_cost (m, w->nfft))
+        w->nfft = nfft;
+    }
+
+  w->nstep = w->nfft - m + 1;
+
+  w->kernel = calloc (m, sizeof (double));
+  w->rkernel = calloc (m, sizeof (double));
+  w->tail = calloc (m, sizeof (double));
+  w->spectrum = calloc (w->nfft, sizeof (double));
+  w->buf = malloc (w->nfft * sizeof (double));
+  w->real_wavetable = gsl_fft_real_wavetable_alloc (w->nfft);
+  w->hc_wavetable = gsl_fft_halfcomplex_wavetable_alloc (w->nfft);
+  w->work = gsl_fft_real_workspace_alloc (w->nfft);
+
+  if (w->kernel == NULL || w->rkernel == NULL || w->tail == NULL
+      || w->spectrum == NULL || w->buf == NULL || w->real_wavetable == NULL
+      || w->hc_wavetable == NULL || w->work == NULL)
+    {
+      gsl_conv_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  gsl_conv_set_method (GSL_CONV_AUTO, w);
+
+  return w;
+}
+
+void
+gsl_conv_free (gsl_conv_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->kernel)
+    free (w->kernel);
+
+  if (w->rkernel)
+    free (w->rkernel);
+
+  if (w->tail)
+    free (w->tail);
+
+  if (w->spectrum)
+    free (w->spectrum);
+
+  if (w->buf)
+    free (w->buf);
+
+  if (w->real_wavetable)
+    gsl_fft_real_wavetable_free (w->real_wavetable);
+
+  if (w->hc_wavetable)
+    gsl_fft_halfcomplex_wavetable_free (w->hc_wavetable);
+
+  if (w->work)
+    gsl_fft_real_workspace_free (w->work);
+
+  free (w);
+}
+
+/* Store the kernel h of length m and the transform of h padded with
+   zeros to nfft, scaled by 1/nfft for the inverse transform */
+
+int
+gsl_conv_set_kernel (const double h[], const size_t stride,
+                     gsl_conv_workspace * w)
+{
+  const size_t m = w->m;
+  const double norm = 1.0 / (double) w->nfft;
+  size_t i;
+  int status;
+
+  for (i = 0; i < m; i++)
+    {
+      w->kernel[i] = h[i * stride];
+      w->rkernel[m - 1 - i] = h[i * stride];
+    }
+
+  memcpy (w->spectrum, w->kernel, m * sizeof (double));
+
+  for (i = m; i < w->nfft; i++)
+    w->spectrum[i] = 0.0;
+
+  status = gsl_fft_real_transform (w->spectrum, 1, w->nfft,
+                                   w->real_wavetable, w->work);
+  if (status)
+    return status;
+
+  for (i = 0; i < w->nfft; i++)
+    w->spectrum[i] *= norm;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_conv_set_method (const gsl_conv_method method, gsl_conv_workspace * w)
+{
+  switch (method)
+    {
+    case GSL_CONV_AUTO:
+      w->method = (conv_fft_cost (w->m, w->nfft) < (double) w->m) ?
+        GSL_CONV_FFT : GSL_CONV_DIRECT;
+      break;
+
+    case GSL_CONV_DIRECT:
+    case GSL_CONV_FFT:
+      w->method = method;
+      break;
+
+    default:
+      GSL_ERROR ("unknown convolution method", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_conv_reset (gsl_conv_workspace * w)
+{
+  size_t i;
+
+  for (i = 0; i < w->m; i++)
+    w->tail[i] = 0.0;
+
+  w->state = 0;
+}
+
+/* full convolution, y has length n + m - 1 */
+
+int
+gsl_conv (const double x[], const size_t xstride, const size_t n,
+          double y[], const size_t ystride, gsl_conv_workspace * w)
+{
+  int status;
+
+  gsl_conv_reset (w);
+
+  status = gsl_conv_overlap_add (x, xstride, n, y, ystride, w);
+  if (status)
+    return status;
+
+  return gsl_conv_flush (y + n * ystride, ystride, w);
+}
+
+int
+gsl_conv_overlap_add (const double x[], const size_t xstride,
+                      const size_t n, double y[], const size_t ystride,
+                      gsl_conv_workspace * w)
+{
+  return conv_stream (x, xstride, n, y, ystride, w, CONV_OVERLAP_ADD);
+}
+
+int
+gsl_conv_overlap_save (const double x[], const size_t xstride,
+                       const size_t n, double y[], const size_t ystride,
+                       gsl_conv_workspace * w)
+{
+  return conv_stream (x, xstride, n, y, ystride, w, CONV_OVERLAP_SAVE);
+}
+
+/* Output the last m - 1 samples of a stream, which depend on the
+   inputs already seen, and reset the workspace */
+
+int
+gsl_conv_flush (double y[], const size_t ystride, gsl_conv_workspace * w)
+{
+  const double zero = 0.0;
+  const int state = (w->state != 0) ? w->state : CONV_OVERLAP_SAVE;
+  int status;
+
+  status = conv_stream (&zero, 0, w->m - 1, y, ystride, w, state);
+
+  gsl_conv_reset (w);
+
+  return status;
+}
+
+/* full cross-correlation, r has length n + m - 1 with r[j] holding
+   the lag j - (m - 1) */
+
+int
+gsl_xcorr (const double x[], const size_t xstride, const size_t n,
+           double r[], const size_t rstride, gsl_conv_workspace * w)
+{
+  int status;
+
+  gsl_conv_reset (w);
+
+  status = gsl_xcorr_overlap_add (x, xstride, n, r, rstride, w);
+  if (status)
+    return status;
+
+  return gsl_conv_flush (r + n * rstride, rstride, w);
+}
+
+int
+gsl_xcorr_overlap_add (const double x[], const size_t xstride,
+                       const size_t n, double r[], const size_t rstride,
+                       gsl_conv_workspace * w)
+{
+  return conv_stream (x, xstride, n, r, rstride, w,
+                      CONV_OVERLAP_ADD | CONV_CORRELATE);
+}
+
+int
+gsl_xcorr_overlap_save (const double x[], const size_t xstride,
+                        const size_t n, double r[], const size_t rstride,
+                        gsl_conv_workspace * w)
+{
+  return conv_stream (x, xstride, n, r, rstride, w,
+                      CONV_OVERLAP_SAVE | CONV_CORRELATE);
+}
+
+/* cost per output sample of FFT blocks of length nfft, in units of a
+   direct multiply-add */
+
+static double
+conv_fft_cost (const size_t m, const size_t nfft)
+{
+  const double logn = log ((double) nfft) / M_LN2;
+
+  return CONV_FFT_COST * (double) nfft * logn / (double) (nfft - m + 1);
+}
+
+/* Pass n samples of x through the filter and write the n outputs to
+   y, or discard them if y is NULL.  Each block reads all its inputs
+   before writing its outputs, so y may be the same array as x. */
+
+static int
+conv_stream (const double x[], const size_t xstride, const size_t n,
+             double y[], const size_t ystride, gsl_conv_workspace * w,
+             const int state)
+{
+  const size_t m1 = w->m - 1;
+  const int corr = (state & CONV_CORRELATE) != 0;
+  double *buf = w->buf;
+  double *tail = w->tail;
+  size_t i, j, k;
+  int status;
+
+  if (w->state != 0 && w->state != state)
+    {
+      GSL_ERROR ("workspace is in use by another streaming mode", GSL_EINVAL);
+    }
+
+  w->state = state;
+
+  for (i = 0; i < n; i += w->nstep)
+    {
+      const size_t ns = GSL_MIN (w->nstep, n - i);
+      const double *xb = x + i * xstride;
+      size_t off = 0;
+
+      if (state & CONV_OVERLAP_ADD)
+        {
+          /* full convolution of the block in buf[0 .. ns+m-2] */
+
+          if (w->method == GSL_CONV_FFT)
+            {
+              const size_t shift = corr ? m1 : 0;
+
+              for (j = 0; j < w->nfft; j++)
+                buf[j] = 0.0;
+
+              for (j = 0; j < ns; j++)
+                buf[shift + j] = xb[j * xstride];
+
+              status = conv_block_fft (w, corr);
+              if (status)
+                return status;
+            }
+          else
+            {
+              const double *g = corr ? w->rkernel : w->kernel;
+
+              for (j = 0; j < ns + m1; j++)
+                {
+                  const size_t k0 = (j >= ns) ? j - ns + 1 : 0;
+                  const size_t k1 = GSL_MIN (m1, j);
+                  double sum = 0.0;
+
+                  for (k = k0; k <= k1; k++)
+                    sum += g[k] * xb[(j - k) * xstride];
+
+                  buf[j] = sum;
+                }
+            }
+
+          for (j = 0; j < m1; j++)
+            buf[j] += tail[j];
+
+          for (j = 0; j < m1; j++)
+            tail[j] = buf[ns + j];
+        }
+      else
+        {
+          /* the previous m - 1 inputs followed by the block */
+
+          memcpy (buf, tail, m1 * sizeof (double));
+
+          for (j = 0; j < ns; j++)
+            buf[m1 + j] = xb[j * xstride];
+
+          memcpy (tail, buf + ns, m1 * sizeof (double));
+
+          if (w->method == GSL_CONV_FFT)
+            {
+              for (j = m1 + ns; j < w->nfft; j++)
+                buf[j] = 0.0;
+
+              status = conv_block_fft (w, corr);
+              if (status)
+                return status;
+
+              off = corr ? 0 : m1;
+            }
+          else
+            {
+              /* output t only reads buf[t .. t+m-1], so it can
+                 overwrite buf[t] */
+
+              const double *g = corr ? w->kernel : w->rkernel;
+
+              for (j = 0; j < ns; j++)
+                {
+                  double sum = 0.0;
+
+                  for (k = 0; k <= m1; k++)
+                    sum += g[k] * buf[j + k];
+
+                  buf[j] = sum;
+                }
+            }
+        }
+
+      if (y != NULL)
+        {
+          double *yb = y + i * ystride;
+
+          for (j = 0; j < ns; j++)
+            yb[j * ystride] = buf[off + j];
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Replace buf by its circular convolution with the kernel, or its
+   circular correlation if corr is nonzero */
+
+static int
+conv_block_fft (gsl_conv_workspace * w, const int corr)
+{
+  const size_t nfft = w->nfft;
+  const double *h = w->spectrum;
+  double *buf = w->buf;
+  const double s = corr ? -1.0 : 1.0;
+  size_t k;
+  int status;
+
+  status = gsl_fft_real_transform (buf, 1, nfft, w->real_wavetable, w->work);
+  if (status)
+    return status;
+
+  buf[0] *= h[0];
+
+  for (k = 1; k < nfft - k; k++)
+    {
+      const double a_re = buf[2 * k - 1];
+      const double a_im = buf[2 * k];
+      const double h_re = h[2 * k - 1];
+      const double h_im = s * h[2 * k];
+
+      buf[2 * k - 1] = a_re * h_re - a_im * h_im;
+      buf[2 * k] = a_re * h_im + a_im * h_re;
+    }
+
+  if (k == nfft - k)
+    buf[nfft - 1] *= h[nfft - 1];
+
+  return gsl_fft_halfcomplex_backward (buf, 1, nfft, w->hc_wavetable, w->work);
+}
@@ -172,5 +172,62 @@ fft_binary_logn (const size_t n)
 }
 
 
+/* Bluestein's algorithm computes a transform of length n as a
+   convolution of length nconv >= 2n - 1, using power of 2 transforms
+   of length nconv.  It is used when n has prime factors which are not
+   implemented as subtransforms and the general-n module, which takes
+   O(n p) operations for each such factor p, would be slower.
 
+   Returns nconv, or 0 if the mixed radix algorithm should be used.
+   The constant below is the measured ratio of the cost of the two
+   methods per operation, the crossover for a prime n is near 29. */
 
+#define FFT_BLUESTEIN_COST 2
+
+static size_t
+fft_bluestein_length (const size_t n)
+{
+  const size_t implemented[] = { 2, 3, 5, 7, 0 };
+  size_t ntest = n, factor, sum = 0, i;
+  size_t nconv = 1, logn = 0;
+
+  for (i = 0; implemented[i]; i++)
+    {
+      while (ntest % implemented[i] == 0)
+        {
+          ntest /= implemented[i];
+        }
+    }
+
+  for (factor = 11; ntest > 1 && factor <= ntest / factor; factor += 2)
+    {
+      while (ntest % factor == 0)
+        {
+          ntest /= factor;
+          sum += factor;
+        }
+    }
+
+  if (ntest > 1)
+    {
+      sum += ntest;             /* remaining prime factor */
+    }
+
+  if (sum == 0)
+    {
+      return 0;
+    }
+
+  while (nconv < 2 * n - 1)
+    {
+      nconv *= 2;
+      logn++;
+    }
+
+  if (n * sum > FFT_BLUESTEIN_COST * nconv * logn)
+    {
+      return nconv;
+    }
+
+  return 0;
+}
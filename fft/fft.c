@@ -28,6 +28,7 @@
 #include "templates_on.h"
 #include "c_init.c"
 #include "c_main.c"
+#include "bluestein.c"
 #include "c_pass_2.c"
 #include "c_pass_3.c"
 #include "c_pass_4.c"
@@ -43,6 +44,7 @@
 #include "templates_on.h"
 #include "c_init.c"
 #include "c_main.c"
+#include "bluestein.c"
 #include "c_pass_2.c"
 #include "c_pass_3.c"
 #include "c_pass_4.c"
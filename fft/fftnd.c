@@ -0,0 +1,540 @@
+/* fft/fftnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Multidimensional FFTs of row-major arrays, computed one dimension
+   at a time with the mixed-radix routines.
+
+   The last dimension is contiguous, so it is transformed as a batch
+   of rows in place.  For the other dimensions the elements of each
+   line are far apart in memory, so instead of transforming them with
+   a large stride, blocks of FFTND_BLOCK adjacent lines are copied
+   into a contiguous buffer, transformed as a batch and copied back.
+   Each row of the array then contributes FFTND_BLOCK consecutive
+   complex values to a copy, which makes full use of every cache line
+   that is loaded.
+
+   An array is described by its dimensions and by the distance
+   "pitch" between the starts of consecutive rows, counted in complex
+   elements for complex arrays and real elements for real arrays.  The
+   pitch is n[rank-1] for packed arrays and the tda for matrices. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fftnd.h>
+#include <gsl/gsl_fft2d.h>
+
+#define FFTND_BLOCK 16
+
+/* Transform the lines of length n which start at data[2*j], j < nlines,
+   with a stride of s complex elements between the elements of a line */
+
+static int
+fftnd_lines (double data[], const size_t s, const size_t n,
+             const size_t nlines, gsl_fftnd_workspace * w,
+             const gsl_fft_complex_wavetable * wavetable,
+             const gsl_fft_direction sign)
+{
+  double *buf = w->buf;
+  size_t j0, j, i;
+  int status;
+
+  for (j0 = 0; j0 < nlines; j0 += FFTND_BLOCK)
+    {
+      const size_t nb = GSL_MIN (FFTND_BLOCK, nlines - j0);
+
+      for (i = 0; i < n; i++)
+        {
+          const double *row = data + 2 * (i * s + j0);
+
+          for (j = 0; j < nb; j++)
+            {
+              buf[2 * (j * n + i)] = row[2 * j];
+              buf[2 * (j * n + i) + 1] = row[2 * j + 1];
+            }
+        }
+
+      status = gsl_fft_complex_transform_batch (buf, 1, n, n, nb, wavetable,
+                                                w->work, sign);
+      if (status)
+        return status;
+
+      for (i = 0; i < n; i++)
+        {
+          double *row = data + 2 * (i * s + j0);
+
+          for (j = 0; j < nb; j++)
+            {
+              row[2 * j] = buf[2 * (j * n + i)];
+              row[2 * j + 1] = buf[2 * (j * n + i) + 1];
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Transform the complex array data along every dimension except the
+   last one, which has length nlast */
+
+static int
+fftnd_complex_outer (double data[], const size_t pitch, const size_t nlast,
+                     gsl_fftnd_workspace * w, const gsl_fft_direction sign)
+{
+  const size_t rank = w->rank;
+  size_t d, outer = 1;
+
+  for (d = 0; d + 1 < rank; d++)
+    {
+      const size_t n = w->dims[d];
+      size_t inner = 1, e, o, k;
+
+      /* inner is the number of rows between consecutive elements of a
+         line along dimension d */
+
+      for (e = d + 1; e + 1 < rank; e++)
+        inner *= w->dims[e];
+
+      if (n > 1)
+        {
+          for (o = 0; o < outer; o++)
+            {
+              for (k = 0; k < inner; k++)
+                {
+                  double *p = data + 2 * pitch * (o * n * inner + k);
+                  int status = fftnd_lines (p, inner * pitch, n, nlast, w,
+                                            w->wavetable[d], sign);
+                  if (status)
+                    return status;
+                }
+            }
+        }
+
+      outer *= n;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static size_t
+fftnd_rows (const gsl_fftnd_workspace * w)
+{
+  size_t d, nrows = 1;
+
+  for (d = 0; d + 1 < w->rank; d++)
+    nrows *= w->dims[d];
+
+  return nrows;
+}
+
+static int
+fftnd_complex (double data[], const size_t pitch,
+               gsl_fftnd_workspace * w, const gsl_fft_direction sign)
+{
+  const size_t nlast = w->dims[w->rank - 1];
+  int status;
+
+  status = gsl_fft_complex_transform_batch (data, 1, pitch, nlast,
+                                            fftnd_rows (w),
+                                            w->wavetable[w->rank - 1],
+                                            w->work, sign);
+  if (status)
+    return status;
+
+  return fftnd_complex_outer (data, pitch, nlast, w, sign);
+}
+
+/* Forward transform of a real array, giving the n[rank-1]/2 + 1
+   nonredundant complex values along the last dimension */
+
+static int
+fftnd_real (const double in[], const size_t ipitch, double out[],
+            const size_t opitch, gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+  const size_t nrows = fftnd_rows (w);
+  size_t r;
+  int status;
+
+  for (r = 0; r < nrows; r++)
+    memcpy (out + 2 * opitch * r, in + ipitch * r, n * sizeof (double));
+
+  status = gsl_fft_real_transform_batch (out, 1, 2 * opitch, n, nrows,
+                                         w->real_wavetable, w->real_work);
+  if (status)
+    return status;
+
+  /* convert each row from half-complex storage r0, r1, i1, r2, i2, ...
+     to complex storage r0, 0, r1, i1, r2, i2, ... */
+
+  for (r = 0; r < nrows; r++)
+    {
+      double *z = out + 2 * opitch * r;
+
+      memmove (z + 2, z + 1, (n - 1) * sizeof (double));
+      z[1] = 0.0;
+
+      if (n % 2 == 0)
+        z[n + 1] = 0.0;
+    }
+
+  return fftnd_complex_outer (out, opitch, n / 2 + 1, w, gsl_fft_forward);
+}
+
+/* Backward transform of the nonredundant complex values computed by
+   fftnd_real, which are overwritten */
+
+static int
+fftnd_halfcomplex (double in[], const size_t ipitch, double out[],
+                   const size_t opitch, gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+  const size_t nrows = fftnd_rows (w);
+  size_t r;
+  int status;
+
+  status = fftnd_complex_outer (in, ipitch, n / 2 + 1, w, gsl_fft_backward);
+  if (status)
+    return status;
+
+  for (r = 0; r < nrows; r++)
+    {
+      const double *z = in + 2 * ipitch * r;
+      double *x = out + opitch * r;
+
+      x[0] = z[0];
+      memcpy (x + 1, z + 2, (n - 1) * sizeof (double));
+    }
+
+  return gsl_fft_halfcomplex_transform_batch (out, 1, opitch, n, nrows,
+                                              w->hc_wavetable, w->real_work);
+}
+
+/* multiply the first len values of each of nrows rows by norm */
+
+static void
+fftnd_scale (double data[], const size_t pitch, const size_t nrows,
+             const size_t len, const double norm)
+{
+  size_t r, i;
+
+  for (r = 0; r < nrows; r++)
+    {
+      double *x = data + pitch * r;
+
+      for (i = 0; i < len; i++)
+        x[i] *= norm;
+    }
+}
+
+gsl_fftnd_workspace *
+gsl_fftnd_workspace_alloc (const size_t rank, const size_t dims[])
+{
+  gsl_fftnd_workspace *w;
+  size_t d, nwork, nbuf = 0;
+
+  if (rank == 0)
+    {
+      GSL_ERROR_NULL ("rank must be positive integer", GSL_EDOM);
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      if (dims[d] == 0)
+        {
+          GSL_ERROR_NULL ("dimensions must be positive integers", GSL_EDOM);
+        }
+    }
+
+  w = calloc (1, sizeof (gsl_fftnd_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace struct", GSL_ENOMEM);
+    }
+
+  w->rank = rank;
+  w->dims = malloc (rank * sizeof (size_t));
+  w->wavetable = calloc (rank, sizeof (gsl_fft_complex_wavetable *));
+
+  if (w->dims == NULL || w->wavetable == NULL)
+    {
+      gsl_fftnd_workspace_free (w);
+      GSL_ERROR_NULL ("failed to allocate dimensions", GSL_ENOMEM);
+    }
+
+  /* the contiguous rows need a workspace of length dims[rank-1], the
+     other dimensions one that holds FFTND_BLOCK lines, or the scratch
+     space of a Bluestein transform */
+
+  nwork = dims[rank - 1];
+
+  for (d = 0; d < rank; d++)
+    {
+      w->dims[d] = dims[d];
+      w->wavetable[d] = gsl_fft_complex_wavetable_alloc (dims[d]);
+
+      if (w->wavetable[d] == NULL)
+        {
+          gsl_fftnd_workspace_free (w);
+          GSL_ERROR_NULL ("failed to allocate wavetable", GSL_ENOMEM);
+        }
+
+      nwork = GSL_MAX (nwork, 2 * w->wavetable[d]->nconv);
+
+      if (d + 1 < rank)
+        {
+          nbuf = GSL_MAX (nbuf, dims[d] * FFTND_BLOCK);
+          nwork = GSL_MAX (nwork, dims[d] * FFTND_BLOCK);
+        }
+    }
+
+  w->real_wavetable = gsl_fft_real_wavetable_alloc (dims[rank - 1]);
+  w->hc_wavetable = gsl_fft_halfcomplex_wavetable_alloc (dims[rank - 1]);
+  w->work = gsl_fft_complex_workspace_alloc (nwork);
+  w->real_work = gsl_fft_real_workspace_alloc (dims[rank - 1]);
+
+  if (nbuf > 0)
+    w->buf = malloc (2 * nbuf * sizeof (double));
+
+  if (w->real_wavetable == NULL || w->hc_wavetable == NULL
+      || w->work == NULL || w->real_work == NULL
+      || (nbuf > 0 && w->buf == NULL))
+    {
+      gsl_fftnd_workspace_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_fftnd_workspace_free (gsl_fftnd_workspace * w)
+{
+  size_t d;
+
+  RETURN_IF_NULL (w);
+
+  if (w->wavetable != NULL)
+    {
+      for (d = 0; d < w->rank; d++)
+        {
+          if (w->wavetable[d] != NULL)
+            gsl_fft_complex_wavetable_free (w->wavetable[d]);
+        }
+
+      free (w->wavetable);
+    }
+
+  if (w->real_wavetable != NULL)
+    gsl_fft_real_wavetable_free (w->real_wavetable);
+
+  if (w->hc_wavetable != NULL)
+    gsl_fft_halfcomplex_wavetable_free (w->hc_wavetable);
+
+  if (w->work != NULL)
+    gsl_fft_complex_workspace_free (w->work);
+
+  if (w->real_work != NULL)
+    gsl_fft_real_workspace_free (w->real_work);
+
+  free (w->buf);
+  free (w->dims);
+  free (w);
+}
+
+int
+gsl_fftnd_complex_transform (gsl_complex_packed_array data,
+                             const gsl_fft_direction sign,
+                             gsl_fftnd_workspace * w)
+{
+  return fftnd_complex (data, w->dims[w->rank - 1], w, sign);
+}
+
+int
+gsl_fftnd_complex_forward (gsl_complex_packed_array data,
+                           gsl_fftnd_workspace * w)
+{
+  return gsl_fftnd_complex_transform (data, gsl_fft_forward, w);
+}
+
+int
+gsl_fftnd_complex_backward (gsl_complex_packed_array data,
+                            gsl_fftnd_workspace * w)
+{
+  return gsl_fftnd_complex_transform (data, gsl_fft_backward, w);
+}
+
+int
+gsl_fftnd_complex_inverse (gsl_complex_packed_array data,
+                           gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+  int status = gsl_fftnd_complex_transform (data, gsl_fft_backward, w);
+
+  if (status)
+    return status;
+
+  fftnd_scale (data, 2 * n, fftnd_rows (w), 2 * n,
+               1.0 / ((double) fftnd_rows (w) * (double) n));
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_fftnd_real_transform (const double in[], gsl_complex_packed_array out,
+                          gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+
+  return fftnd_real (in, n, out, n / 2 + 1, w);
+}
+
+int
+gsl_fftnd_halfcomplex_backward (gsl_complex_packed_array in, double out[],
+                                gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+
+  return fftnd_halfcomplex (in, n / 2 + 1, out, n, w);
+}
+
+int
+gsl_fftnd_halfcomplex_inverse (gsl_complex_packed_array in, double out[],
+                               gsl_fftnd_workspace * w)
+{
+  const size_t n = w->dims[w->rank - 1];
+  int status = fftnd_halfcomplex (in, n / 2 + 1, out, n, w);
+
+  if (status)
+    return status;
+
+  fftnd_scale (out, n, fftnd_rows (w), n,
+               1.0 / ((double) fftnd_rows (w) * (double) n));
+
+  return GSL_SUCCESS;
+}
+
+gsl_fft2d_workspace *
+gsl_fft2d_workspace_alloc (const size_t size1, const size_t size2)
+{
+  size_t dims[2];
+
+  dims[0] = size1;
+  dims[1] = size2;
+
+  return gsl_fftnd_workspace_alloc (2, dims);
+}
+
+void
+gsl_fft2d_workspace_free (gsl_fft2d_workspace * w)
+{
+  gsl_fftnd_workspace_free (w);
+}
+
+int
+gsl_fft2d_complex_transform (gsl_matrix_complex * m,
+                             const gsl_fft_direction sign,
+                             gsl_fft2d_workspace * w)
+{
+  if (w->rank != 2 || m->size1 != w->dims[0] || m->size2 != w->dims[1])
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+
+  return fftnd_complex (m->data, m->tda, w, sign);
+}
+
+int
+gsl_fft2d_complex_forward (gsl_matrix_complex * m, gsl_fft2d_workspace * w)
+{
+  return gsl_fft2d_complex_transform (m, gsl_fft_forward, w);
+}
+
+int
+gsl_fft2d_complex_backward (gsl_matrix_complex * m, gsl_fft2d_workspace * w)
+{
+  return gsl_fft2d_complex_transform (m, gsl_fft_backward, w);
+}
+
+int
+gsl_fft2d_complex_inverse (gsl_matrix_complex * m, gsl_fft2d_workspace * w)
+{
+  int status = gsl_fft2d_complex_transform (m, gsl_fft_backward, w);
+
+  if (status)
+    return status;
+
+  fftnd_scale (m->data, 2 * m->tda, m->size1, 2 * m->size2,
+               1.0 / ((double) m->size1 * (double) m->size2));
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_fft2d_real_transform (const gsl_matrix * a, gsl_matrix_complex * b,
+                          gsl_fft2d_workspace * w)
+{
+  if (w->rank != 2 || a->size1 != w->dims[0] || a->size2 != w->dims[1])
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (b->size1 != a->size1 || b->size2 != a->size2 / 2 + 1)
+    {
+      GSL_ERROR ("output matrix must be size1-by-(size2/2+1)", GSL_EBADLEN);
+    }
+
+  return fftnd_real (a->data, a->tda, b->data, b->tda, w);
+}
+
+int
+gsl_fft2d_halfcomplex_backward (gsl_matrix_complex * b, gsl_matrix * a,
+                                gsl_fft2d_workspace * w)
+{
+  if (w->rank != 2 || a->size1 != w->dims[0] || a->size2 != w->dims[1])
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (b->size1 != a->size1 || b->size2 != a->size2 / 2 + 1)
+    {
+      GSL_ERROR ("input matrix must be size1-by-(size2/2+1)", GSL_EBADLEN);
+    }
+
+  return fftnd_halfcomplex (b->data, b->tda, a->data, a->tda, w);
+}
+
+int
+gsl_fft2d_halfcomplex_inverse (gsl_matrix_complex * b, gsl_matrix * a,
+                               gsl_fft2d_workspace * w)
+{
+  int status = gsl_fft2d_halfcomplex_backward (b, a, w);
+
+  if (status)
+    return status;
+
+  fftnd_scale (a->data, a->tda, a->size1, a->size2,
+               1.0 / ((double) a->size1 * (double) a->size2));
+
+  return GSL_SUCCESS;
+}
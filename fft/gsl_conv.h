@@ -0,0 +1,97 @@
+/* fft/gsl_conv.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_CONV_H__
+#define __GSL_CONV_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef enum
+{
+  GSL_CONV_AUTO,     /* choose the faster method for the kernel length */
+  GSL_CONV_DIRECT,   /* direct summation */
+  GSL_CONV_FFT       /* FFTs of blocks of nfft samples */
+}
+gsl_conv_method;
+
+typedef struct
+{
+  size_t m;                                 /* kernel length */
+  size_t nhint;                             /* typical samples per call */
+  size_t nfft;                              /* FFT block length */
+  size_t nstep;                             /* new samples per block */
+  gsl_conv_method method;                   /* DIRECT or FFT */
+  int state;                                /* streaming mode in progress */
+  double *kernel;                           /* kernel, size m */
+  double *rkernel;                          /* reversed kernel, size m */
+  double *spectrum;                         /* halfcomplex transform of kernel */
+  double *buf;                              /* current block, size nfft */
+  double *tail;                             /* saved inputs or partial outputs */
+  gsl_fft_real_wavetable *real_wavetable;
+  gsl_fft_halfcomplex_wavetable *hc_wavetable;
+  gsl_fft_real_workspace *work;
+}
+gsl_conv_workspace;
+
+gsl_conv_workspace *gsl_conv_alloc (const size_t m, const size_t n);
+void gsl_conv_free (gsl_conv_workspace * w);
+
+int gsl_conv_set_kernel (const double h[], const size_t stride,
+                         gsl_conv_workspace * w);
+int gsl_conv_set_method (const gsl_conv_method method,
+                         gsl_conv_workspace * w);
+void gsl_conv_reset (gsl_conv_workspace * w);
+
+int gsl_conv (const double x[], const size_t xstride, const size_t n,
+              double y[], const size_t ystride, gsl_conv_workspace * w);
+int gsl_conv_overlap_add (const double x[], const size_t xstride,
+                          const size_t n, double y[], const size_t ystride,
+                          gsl_conv_workspace * w);
+int gsl_conv_overlap_save (const double x[], const size_t xstride,
+                           const size_t n, double y[], const size_t ystride,
+                           gsl_conv_workspace * w);
+int gsl_conv_flush (double y[], const size_t ystride, gsl_conv_workspace * w);
+
+int gsl_xcorr (const double x[], const size_t xstride, const size_t n,
+               double r[], const size_t rstride, gsl_conv_workspace * w);
+int gsl_xcorr_overlap_add (const double x[], const size_t xstride,
+                           const size_t n, double r[], const size_t rstride,
+                           gsl_conv_workspace * w);
+int gsl_xcorr_overlap_save (const double x[], const size_t xstride,
+                            const size_t n, double r[], const size_t rstride,
+                            gsl_conv_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_CONV_H__ */
@@ -0,0 +1,69 @@
+/* fft/gsl_fft2d.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT2D_H__
+#define __GSL_FFT2D_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_matrix_double.h>
+#include <gsl/gsl_matrix_complex_double.h>
+#include <gsl/gsl_fftnd.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef gsl_fftnd_workspace gsl_fft2d_workspace;
+
+gsl_fft2d_workspace *gsl_fft2d_workspace_alloc (const size_t size1,
+                                                const size_t size2);
+void gsl_fft2d_workspace_free (gsl_fft2d_workspace * w);
+
+int gsl_fft2d_complex_forward (gsl_matrix_complex * m,
+                               gsl_fft2d_workspace * w);
+int gsl_fft2d_complex_backward (gsl_matrix_complex * m,
+                                gsl_fft2d_workspace * w);
+int gsl_fft2d_complex_inverse (gsl_matrix_complex * m,
+                               gsl_fft2d_workspace * w);
+int gsl_fft2d_complex_transform (gsl_matrix_complex * m,
+                                 const gsl_fft_direction sign,
+                                 gsl_fft2d_workspace * w);
+
+int gsl_fft2d_real_transform (const gsl_matrix * a,
+                              gsl_matrix_complex * b,
+                              gsl_fft2d_workspace * w);
+int gsl_fft2d_halfcomplex_backward (gsl_matrix_complex * b,
+                                    gsl_matrix * a,
+                                    gsl_fft2d_workspace * w);
+int gsl_fft2d_halfcomplex_inverse (gsl_matrix_complex * b,
+                                   gsl_matrix * a,
+                                   gsl_fft2d_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFT2D_H__ */
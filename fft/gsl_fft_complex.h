@@ -84,6 +84,8 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    size_t nconv;
+    gsl_complex *chirp;
   }
 gsl_fft_complex_wavetable;
 
@@ -131,6 +133,31 @@ int gsl_fft_complex_transform (gsl_complex_packed_array data,
                                gsl_fft_complex_workspace * work,
                                const gsl_fft_direction sign);
 
+int gsl_fft_complex_forward_batch (gsl_complex_packed_array data,
+                                   const size_t stride, const size_t dist,
+                                   const size_t n, const size_t howmany,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_backward_batch (gsl_complex_packed_array data,
+                                    const size_t stride, const size_t dist,
+                                    const size_t n, const size_t howmany,
+                                    const gsl_fft_complex_wavetable * wavetable,
+                                    gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_inverse_batch (gsl_complex_packed_array data,
+                                   const size_t stride, const size_t dist,
+                                   const size_t n, const size_t howmany,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_transform_batch (gsl_complex_packed_array data,
+                                     const size_t stride, const size_t dist,
+                                     const size_t n, const size_t howmany,
+                                     const gsl_fft_complex_wavetable * wavetable,
+                                     gsl_fft_complex_workspace * work,
+                                     const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_H__ */
@@ -84,6 +84,8 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    size_t nconv;
+    gsl_complex_float *chirp;
   }
 gsl_fft_complex_wavetable_float;
 
@@ -132,6 +134,31 @@ int gsl_fft_complex_float_transform (gsl_complex_packed_array_float data,
                                      gsl_fft_complex_workspace_float * work,
                                      const gsl_fft_direction sign);
 
+int gsl_fft_complex_float_forward_batch (gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t dist,
+                                         const size_t n, const size_t howmany,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_backward_batch (gsl_complex_packed_array_float data,
+                                          const size_t stride, const size_t dist,
+                                          const size_t n, const size_t howmany,
+                                          const gsl_fft_complex_wavetable_float * wavetable,
+                                          gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_inverse_batch (gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t dist,
+                                         const size_t n, const size_t howmany,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_transform_batch (gsl_complex_packed_array_float data,
+                                           const size_t stride, const size_t dist,
+                                           const size_t n, const size_t howmany,
+                                           const gsl_fft_complex_wavetable_float * wavetable,
+                                           gsl_fft_complex_workspace_float * work,
+                                           const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_FLOAT_H__ */
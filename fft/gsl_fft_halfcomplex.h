@@ -50,6 +50,8 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    size_t nconv;
+    gsl_complex *chirp;
   }
 gsl_fft_halfcomplex_wavetable;
 
@@ -71,6 +73,21 @@ int gsl_fft_halfcomplex_transform (double data[], const size_t stride, const siz
                                    const gsl_fft_halfcomplex_wavetable * wavetable,
                                    gsl_fft_real_workspace * work);
 
+int gsl_fft_halfcomplex_backward_batch (double data[], const size_t stride, const size_t dist,
+                                        const size_t n, const size_t howmany,
+                                        const gsl_fft_halfcomplex_wavetable * wavetable,
+                                        gsl_fft_real_workspace * work);
+
+int gsl_fft_halfcomplex_inverse_batch (double data[], const size_t stride, const size_t dist,
+                                       const size_t n, const size_t howmany,
+                                       const gsl_fft_halfcomplex_wavetable * wavetable,
+                                       gsl_fft_real_workspace * work);
+
+int gsl_fft_halfcomplex_transform_batch (double data[], const size_t stride, const size_t dist,
+                                         const size_t n, const size_t howmany,
+                                         const gsl_fft_halfcomplex_wavetable * wavetable,
+                                         gsl_fft_real_workspace * work);
+
 int
 gsl_fft_halfcomplex_unpack (const double halfcomplex_coefficient[],
                             double complex_coefficient[],
@@ -0,0 +1,74 @@
+/* fft/gsl_fft_plan.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_PLAN_H__
+#define __GSL_FFT_PLAN_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* flags for gsl_fft_plan_alloc */
+
+#define GSL_FFT_PLAN_DEFAULT   0
+#define GSL_FFT_PLAN_NORMALIZE 1   /* scale the result by 1/n */
+#define GSL_FFT_PLAN_GENERIC   2   /* use only the portable passes */
+
+typedef struct
+{
+  size_t n;                     /* length of each transform */
+  size_t stride;                /* stride between elements */
+  size_t howmany;               /* number of transforms per execution */
+  gsl_fft_direction sign;       /* direction of the transform */
+  unsigned int flags;
+  size_t nf;                    /* number of passes */
+  size_t factor[64];            /* radix of each pass */
+  double *twiddle[64];          /* twiddle factors of each pass */
+  double *root[64];             /* roots of unity for general radix passes */
+  double *trig;                 /* storage for twiddle and root tables */
+  double *scratch;              /* two buffers of n complex values */
+  double *work;                 /* temporary for general radix passes */
+}
+gsl_fft_plan;
+
+gsl_fft_plan *gsl_fft_plan_alloc (const size_t n, const size_t stride,
+                                  const size_t howmany,
+                                  const gsl_fft_direction direction,
+                                  const unsigned int flags);
+void gsl_fft_plan_free (gsl_fft_plan * plan);
+int gsl_fft_plan_execute (gsl_fft_plan * plan, gsl_complex_packed_array data);
+double gsl_fft_plan_flops (const gsl_fft_plan * plan);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_PLAN_H__ */
@@ -47,6 +47,8 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    size_t nconv;
+    gsl_complex *chirp;
   }
 gsl_fft_real_wavetable;
 
@@ -70,6 +72,11 @@ int gsl_fft_real_transform (double data[], const size_t stride, const size_t n,
                             const gsl_fft_real_wavetable * wavetable,
                             gsl_fft_real_workspace * work);
 
+int gsl_fft_real_transform_batch (double data[], const size_t stride, const size_t dist,
+                                  const size_t n, const size_t howmany,
+                                  const gsl_fft_real_wavetable * wavetable,
+                                  gsl_fft_real_workspace * work);
+
 
 int gsl_fft_real_unpack (const double real_coefficient[],
                          double complex_coefficient[],
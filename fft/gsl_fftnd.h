@@ -0,0 +1,83 @@
+/* fft/gsl_fftnd.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFTND_H__
+#define __GSL_FFTND_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct
+{
+  size_t rank;                                 /* number of dimensions */
+  size_t *dims;                                /* length of each dimension */
+  gsl_fft_complex_wavetable **wavetable;       /* one for each dimension */
+  gsl_fft_real_wavetable *real_wavetable;      /* last dimension */
+  gsl_fft_halfcomplex_wavetable *hc_wavetable; /* last dimension */
+  gsl_fft_complex_workspace *work;
+  gsl_fft_real_workspace *real_work;
+  double *buf;                                 /* copies of strided lines */
+}
+gsl_fftnd_workspace;
+
+gsl_fftnd_workspace *gsl_fftnd_workspace_alloc (const size_t rank,
+                                                const size_t dims[]);
+void gsl_fftnd_workspace_free (gsl_fftnd_workspace * w);
+
+int gsl_fftnd_complex_forward (gsl_complex_packed_array data,
+                               gsl_fftnd_workspace * w);
+int gsl_fftnd_complex_backward (gsl_complex_packed_array data,
+                                gsl_fftnd_workspace * w);
+int gsl_fftnd_complex_inverse (gsl_complex_packed_array data,
+                               gsl_fftnd_workspace * w);
+int gsl_fftnd_complex_transform (gsl_complex_packed_array data,
+                                 const gsl_fft_direction sign,
+                                 gsl_fftnd_workspace * w);
+
+int gsl_fftnd_real_transform (const double in[],
+                              gsl_complex_packed_array out,
+                              gsl_fftnd_workspace * w);
+int gsl_fftnd_halfcomplex_backward (gsl_complex_packed_array in,
+                                    double out[],
+                                    gsl_fftnd_workspace * w);
+int gsl_fftnd_halfcomplex_inverse (gsl_complex_packed_array in,
+                                   double out[],
+                                   gsl_fftnd_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFTND_H__ */
@@ -23,7 +23,7 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
   int status;
   size_t i;
   size_t n_factors;
-  size_t t, product, product_1, q;
+  size_t t, product, product_1, q, nconv;
   double d_theta;
 
   TYPE(gsl_fft_halfcomplex_wavetable) * wavetable ;
@@ -41,6 +41,32 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  /* lengths with large prime factors are computed as a complex
+     convolution, see bluestein.c */
+
+  nconv = fft_bluestein_length (n);
+
+  wavetable->nconv = nconv;
+  wavetable->chirp = NULL;
+
+  if (nconv > 0)
+    {
+      wavetable->n = n;
+
+      status = FUNCTION(fft_bluestein,alloc) (n, nconv, &(wavetable->nf),
+                                              wavetable->factor,
+                                              wavetable->twiddle,
+                                              &(wavetable->trig),
+                                              &(wavetable->chirp));
+      if (status)
+        {
+          free (wavetable);     /* error already reported */
+          return 0;
+        }
+
+      return wavetable;
+    }
+
   wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
@@ -123,6 +149,9 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  free (wavetable->chirp);
+  wavetable->chirp = NULL;
+
   free (wavetable);
 }
 
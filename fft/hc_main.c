@@ -26,6 +26,21 @@
 #include <gsl/gsl_fft_halfcomplex.h>
 
 #include "hc_pass.h"
+#include "bluestein.h"
+
+static void
+FUNCTION(fft_halfcomplex,passes) (BASE data[], const size_t stride,
+                                  const size_t dist, const size_t n,
+                                  const size_t howmany,
+                                  const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                  BASE scratch[]);
+
+static void
+FUNCTION(fft_halfcomplex,bluestein) (BASE data[], const size_t stride,
+                                     const size_t dist, const size_t n,
+                                     const size_t howmany,
+                                     const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                     BASE scratch[]);
 
 int
 FUNCTION(gsl_fft_halfcomplex,backward) (BASE data[], const size_t stride, 
@@ -64,25 +79,55 @@ FUNCTION(gsl_fft_halfcomplex,inverse) (BASE data[], const size_t stride,
 }
 
 int
-FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const size_t n,
-                                         const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
-                                         TYPE(gsl_fft_real_workspace) * work)
+FUNCTION(gsl_fft_halfcomplex,backward_batch) (BASE data[], const size_t stride,
+                                              const size_t dist, const size_t n,
+                                              const size_t howmany,
+                                              const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                              TYPE(gsl_fft_real_workspace) * work)
 {
-  BASE * const scratch = work->scratch;
+  int status = FUNCTION(gsl_fft_halfcomplex,transform_batch) (data, stride, dist, n,
+                                                              howmany, wavetable,
+                                                              work) ;
+  return status ;
+}
 
-  BASE * in;
-  BASE * out;
-  size_t istride, ostride ;
+int
+FUNCTION(gsl_fft_halfcomplex,inverse_batch) (BASE data[], const size_t stride,
+                                             const size_t dist, const size_t n,
+                                             const size_t howmany,
+                                             const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                             TYPE(gsl_fft_real_workspace) * work)
+{
+  int status = FUNCTION(gsl_fft_halfcomplex,transform_batch) (data, stride, dist, n,
+                                                              howmany, wavetable,
+                                                              work);
+
+  if (status)
+    {
+      return status;
+    }
 
+  /* normalize inverse fft with 1/n */
 
-  size_t factor, product, q;
-  size_t i;
-  size_t nf;
-  int state;
-  int product_1;
-  int tskip;
-  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4;
+  {
+    const double norm = 1.0 / n;
+    size_t b, i;
+    for (b = 0; b < howmany; b++)
+      {
+        for (i = 0; i < n; i++)
+          {
+            data[dist*b + stride*i] *= norm;
+          }
+      }
+  }
+  return status;
+}
 
+int
+FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const size_t n,
+                                         const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_real_workspace) * work)
+{
   if (n == 0)
     {
       GSL_ERROR ("length n must be positive integer", GSL_EDOM);
@@ -103,6 +148,154 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->nconv > 0)
+    {
+      FUNCTION(fft_halfcomplex,bluestein) (data, stride, 0, n, 1, wavetable,
+                                           work->scratch);
+      return 0;
+    }
+
+  FUNCTION(fft_halfcomplex,passes) (data, stride, 0, n, 1, wavetable,
+                                    work->scratch);
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,transform_batch) (BASE data[], const size_t stride,
+                                               const size_t dist, const size_t n,
+                                               const size_t howmany,
+                                               const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                               TYPE(gsl_fft_real_workspace) * work)
+{
+  size_t b, group;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (work->n < n)
+    {
+      GSL_ERROR ("workspace is smaller than length of data", GSL_EINVAL);
+    }
+
+  if (n == 1)
+    {                           /* FFT of one data point is the identity */
+      return 0;
+    }
+
+  if (wavetable->nconv > 0)
+    {
+      /* Bluestein transforms are computed one at a time, in scratch
+         space of two complex arrays of the convolution length */
+
+      const size_t nscratch = GSL_MAX (work->n, 4 * fft_bluestein_length (work->n));
+
+      if (nscratch < 4 * wavetable->nconv)
+        {
+          GSL_ERROR ("workspace is too small for length of data", GSL_EINVAL);
+        }
+
+      FUNCTION(fft_halfcomplex,bluestein) (data, stride, dist, n, howmany,
+                                           wavetable, work->scratch);
+      return 0;
+    }
+
+  /* the workspace holds the intermediate results of work->n / n
+     transforms, which are computed together */
+
+  group = work->n / n;
+
+  for (b = 0; b < howmany; b += group)
+    {
+      const size_t nb = GSL_MIN (group, howmany - b);
+      FUNCTION(fft_halfcomplex,passes) (data + dist * b, stride, dist, n, nb,
+                                        wavetable, work->scratch);
+    }
+
+  return 0;
+}
+
+/* Compute howmany transforms of length n > 1 as complex convolutions,
+   see bluestein.c, using backward(z) = conj(forward(conj(z))) on the
+   full hermitian sequence, whose transform is real */
+
+static void
+FUNCTION(fft_halfcomplex,bluestein) (BASE data[], const size_t stride,
+                                     const size_t dist, const size_t n,
+                                     const size_t howmany,
+                                     const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                     BASE scratch[])
+{
+  const size_t nconv = wavetable->nconv;
+  BASE * const a = scratch;
+  size_t b, k;
+
+  for (b = 0; b < howmany; b++)
+    {
+      BASE * x = data + dist * b;
+
+      REAL(a,1,0) = VECTOR(x,stride,0);
+      IMAG(a,1,0) = 0;
+
+      for (k = 1; k < n - k; k++)
+        {
+          const ATOMIC z_real = VECTOR(x,stride,2 * k - 1);
+          const ATOMIC z_imag = VECTOR(x,stride,2 * k);
+
+          REAL(a,1,k) = z_real;
+          IMAG(a,1,k) = -z_imag;
+          REAL(a,1,n - k) = z_real;
+          IMAG(a,1,n - k) = z_imag;
+        }
+
+      if (k == n - k)
+        {
+          REAL(a,1,k) = VECTOR(x,stride,n - 1);
+          IMAG(a,1,k) = 0;
+        }
+
+      FUNCTION(fft_bluestein,convolve) (a, n, nconv, wavetable->nf,
+                                        wavetable->factor, wavetable->twiddle,
+                                        wavetable->chirp, scratch + 2 * nconv);
+
+      for (k = 0; k < n; k++)
+        {
+          VECTOR(x,stride,k) = REAL(a,1,k);
+        }
+    }
+}
+
+/* Compute howmany transforms of length n > 1, the b-th starting at
+   data[dist*b], with the intermediate results of the b-th transform
+   stored at scratch[n*b] */
+
+static void
+FUNCTION(fft_halfcomplex,passes) (BASE data[], const size_t stride,
+                                  const size_t dist, const size_t n,
+                                  const size_t howmany,
+                                  const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                  BASE scratch[])
+{
+  BASE * in;
+  BASE * out;
+  size_t istride, ostride ;
+  size_t idist, odist ;
+
+  size_t factor, product, q;
+  size_t i, b;
+  size_t nf;
+  int state;
+  int product_1;
+  int tskip;
+  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4;
+
   nf = wavetable->nf;
   product = 1;
   state = 0;
@@ -120,40 +313,46 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
         {
           in = data;
           istride = stride;
+          idist = dist;
           out = scratch;
           ostride = 1;
+          odist = n;
           state = 1;
         }
       else
         {
           in = scratch;
           istride = 1;
+          idist = n;
           out = data;
           ostride = stride;
+          odist = dist;
           state = 0;
         }
 
       if (factor == 2)
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_halfcomplex,pass_2) (in, istride, out, ostride, 
-                                            product, n, twiddle1);
+          FUNCTION(fft_halfcomplex,pass_2) (in, istride, idist, out, ostride,
+                                            odist, howmany, product, n,
+                                            twiddle1);
         }
       else if (factor == 3)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + tskip;
-          FUNCTION(fft_halfcomplex,pass_3) (in, istride, out, ostride,
-                                            product, n, twiddle1, twiddle2);
+          FUNCTION(fft_halfcomplex,pass_3) (in, istride, idist, out, ostride,
+                                            odist, howmany, product, n,
+                                            twiddle1, twiddle2);
         }
       else if (factor == 4)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + tskip;
           twiddle3 = twiddle2 + tskip;
-          FUNCTION(fft_halfcomplex,pass_4) (in, istride, out, ostride,
-                                            product, n, twiddle1, twiddle2, 
-                                            twiddle3);
+          FUNCTION(fft_halfcomplex,pass_4) (in, istride, idist, out, ostride,
+                                            odist, howmany, product, n,
+                                            twiddle1, twiddle2, twiddle3);
         }
       else if (factor == 5)
         {
@@ -161,28 +360,31 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
           twiddle2 = twiddle1 + tskip;
           twiddle3 = twiddle2 + tskip;
           twiddle4 = twiddle3 + tskip;
-          FUNCTION(fft_halfcomplex,pass_5) (in, istride, out, ostride,
-                                            product, n, twiddle1, twiddle2, 
-                                            twiddle3, twiddle4);
+          FUNCTION(fft_halfcomplex,pass_5) (in, istride, idist, out, ostride,
+                                            odist, howmany, product, n,
+                                            twiddle1, twiddle2, twiddle3,
+                                            twiddle4);
         }
       else
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_halfcomplex,pass_n) (in, istride, out, ostride,
-                                            factor, product, n, twiddle1);
+          for (b = 0; b < howmany; b++)
+            {
+              FUNCTION(fft_halfcomplex,pass_n) (in + idist * b, istride,
+                                                out + odist * b, ostride,
+                                                factor, product, n, twiddle1);
+            }
         }
     }
 
   if (state == 1)               /* copy results back from scratch to data */
     {
-      for (i = 0; i < n; i++)
+      for (b = 0; b < howmany; b++)
         {
-          data[stride*i] = scratch[i] ;
+          for (i = 0; i < n; i++)
+            {
+              data[dist*b + stride*i] = scratch[n*b + i] ;
+            }
         }
     }
-
-  return 0;
-
 }
-
-
@@ -20,29 +20,38 @@
 #include "complex_internal.h"
 
 static void
-FUNCTION(fft_halfcomplex,pass_2) (const BASE in[],
+FUNCTION(fft_halfcomplex,pass_2) (const BASE in0[],
                                   const size_t istride,
-                                  BASE out[],
+                                  const size_t idist,
+                                  BASE out0[],
                                   const size_t ostride,
+                                  const size_t odist,
+                                  const size_t howmany,
                                   const size_t product,
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle[]);
 
 static void
-FUNCTION(fft_halfcomplex,pass_3) (const BASE in[], 
+FUNCTION(fft_halfcomplex,pass_3) (const BASE in0[],
                                   const size_t istride,
-                                  BASE out[],
+                                  const size_t idist,
+                                  BASE out0[],
                                   const size_t ostride,
+                                  const size_t odist,
+                                  const size_t howmany,
                                   const size_t product,
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle1[],
                                   const TYPE(gsl_complex) twiddle2[]);
 
 static void
-FUNCTION(fft_halfcomplex,pass_4) (const BASE in[],
+FUNCTION(fft_halfcomplex,pass_4) (const BASE in0[],
                                   const size_t istride,
-                                  BASE out[],
+                                  const size_t idist,
+                                  BASE out0[],
                                   const size_t ostride,
+                                  const size_t odist,
+                                  const size_t howmany,
                                   const size_t product,
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle1[],
@@ -50,10 +59,13 @@ FUNCTION(fft_halfcomplex,pass_4) (const BASE in[],
                                   const TYPE(gsl_complex) twiddle3[]);
 
 static void
-FUNCTION(fft_halfcomplex,pass_5) (const BASE in[],
+FUNCTION(fft_halfcomplex,pass_5) (const BASE in0[],
                                   const size_t istride,
-                                  BASE out[],
+                                  const size_t idist,
+                                  BASE out0[],
                                   const size_t ostride,
+                                  const size_t odist,
+                                  const size_t howmany,
                                   const size_t product,
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle1[],
@@ -18,16 +18,19 @@
  */
 
 static void
-FUNCTION(fft_halfcomplex,pass_3) (const BASE in[],
+FUNCTION(fft_halfcomplex,pass_3) (const BASE in0[],
                                   const size_t istride,
-                                  BASE out[],
+                                  const size_t idist,
+                                  BASE out0[],
                                   const size_t ostride,
+                                  const size_t odist,
+                                  const size_t howmany,
                                   const size_t product,
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle1[],
                                   const TYPE(gsl_complex) twiddle2[])
 {
-  size_t i, j, k, k1, jump;
+  size_t i, j, k, k1, b, jump;
   size_t factor, q, m, product_1;
 
   ATOMIC tau = sqrt (3.0) / 2.0;
@@ -41,27 +44,33 @@ FUNCTION(fft_halfcomplex,pass_3) (const BASE in[],
   product_1 = product / factor;
   jump = (factor - 1) * q;
 
-  for (k1 = 0; k1 < product_1; k1++)
+  for (b = 0; b < howmany; b++)
     {
-      const size_t from0 = 3 * k1 * q;
-      const size_t from1 = from0 + 2 * q - 1;
+      const BASE *in = in0 + idist * b;
+      BASE *out = out0 + odist * b;
 
-      const ATOMIC z0_real = VECTOR(in,istride,from0);
-      const ATOMIC z1_real = VECTOR(in,istride,from1);
-      const ATOMIC z1_imag = VECTOR(in,istride,from1 + 1);
+      for (k1 = 0; k1 < product_1; k1++)
+        {
+          const size_t from0 = 3 * k1 * q;
+          const size_t from1 = from0 + 2 * q - 1;
+
+          const ATOMIC z0_real = VECTOR(in,istride,from0);
+          const ATOMIC z1_real = VECTOR(in,istride,from1);
+          const ATOMIC z1_imag = VECTOR(in,istride,from1 + 1);
 
-      const ATOMIC t1_real = 2 * z1_real;
-      const ATOMIC t2_real = z0_real - z1_real;
-      const ATOMIC t3_imag = 2 * tau * z1_imag;
+          const ATOMIC t1_real = 2 * z1_real;
+          const ATOMIC t2_real = z0_real - z1_real;
+          const ATOMIC t3_imag = 2 * tau * z1_imag;
 
-      const size_t to0 = q * k1;
-      const size_t to1 = to0 + m;
-      const size_t to2 = to1 + m;
+          const size_t to0 = q * k1;
+          const size_t to1 = to0 + m;
+          const size_t to2 = to1 + m;
 
-      VECTOR(out,ostride,to0) = z0_real + t1_real;
-      VECTOR(out,ostride,to1) = t2_real - t3_imag;
-      VECTOR(out,ostride,to2) = t2_real + t3_imag;
+          VECTOR(out,ostride,to0) = z0_real + t1_real;
+          VECTOR(out,ostride,to1) = t2_real - t3_imag;
+          VECTOR(out,ostride,to2) = t2_real + t3_imag;
 
+        }
     }
 
   if (q == 1)
@@ -74,89 +83,101 @@ FUNCTION(fft_halfcomplex,pass_3) (const BASE in[],
       const ATOMIC w2_real = GSL_REAL(twiddle2[k - 1]);
       const ATOMIC w2_imag = GSL_IMAG(twiddle2[k - 1]);
 
-      for (k1 = 0; k1 < product_1; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const size_t from0 = 3 * k1 * q + 2 * k - 1;
-          const size_t from1 = from0 + 2 * q;
-          const size_t from2 = 3 * k1 * q - 2 * k + 2 * q - 1;
+          const BASE *in = in0 + idist * b;
+          BASE *out = out0 + odist * b;
 
-          const ATOMIC z0_real = VECTOR(in,istride,from0);
-          const ATOMIC z0_imag = VECTOR(in,istride,from0 + 1);
+          for (k1 = 0; k1 < product_1; k1++)
+            {
+              const size_t from0 = 3 * k1 * q + 2 * k - 1;
+              const size_t from1 = from0 + 2 * q;
+              const size_t from2 = 3 * k1 * q - 2 * k + 2 * q - 1;
 
-          const ATOMIC z1_real = VECTOR(in,istride,from1);
-          const ATOMIC z1_imag = VECTOR(in,istride,from1 + 1);
+              const ATOMIC z0_real = VECTOR(in,istride,from0);
+              const ATOMIC z0_imag = VECTOR(in,istride,from0 + 1);
 
-          const ATOMIC z2_real = VECTOR(in,istride,from2);
-          const ATOMIC z2_imag = -VECTOR(in,istride,from2 + 1);
+              const ATOMIC z1_real = VECTOR(in,istride,from1);
+              const ATOMIC z1_imag = VECTOR(in,istride,from1 + 1);
 
-          /* compute x = W(3) z */
+              const ATOMIC z2_real = VECTOR(in,istride,from2);
+              const ATOMIC z2_imag = -VECTOR(in,istride,from2 + 1);
 
-          /* t1 = z1 + z2 */
-          const ATOMIC t1_real = z1_real + z2_real;
-          const ATOMIC t1_imag = z1_imag + z2_imag;
+              /* compute x = W(3) z */
 
-          /* t2 = z0 - t1/2 */
-          const ATOMIC t2_real = z0_real - t1_real / 2.0;
-          const ATOMIC t2_imag = z0_imag - t1_imag / 2.0;
+              /* t1 = z1 + z2 */
+              const ATOMIC t1_real = z1_real + z2_real;
+              const ATOMIC t1_imag = z1_imag + z2_imag;
 
-          /* t3 = sin(pi/3)*(z1 - z2) */
-          const ATOMIC t3_real = tau * (z1_real - z2_real);
-          const ATOMIC t3_imag = tau * (z1_imag - z2_imag);
+              /* t2 = z0 - t1/2 */
+              const ATOMIC t2_real = z0_real - t1_real / 2.0;
+              const ATOMIC t2_imag = z0_imag - t1_imag / 2.0;
 
-          /* x0 = z0 + t1 */
-          const ATOMIC x0_real = z0_real + t1_real;
-          const ATOMIC x0_imag = z0_imag + t1_imag;
+              /* t3 = sin(pi/3)*(z1 - z2) */
+              const ATOMIC t3_real = tau * (z1_real - z2_real);
+              const ATOMIC t3_imag = tau * (z1_imag - z2_imag);
 
-          /* x1 = t2 + i t3 */
-          const ATOMIC x1_real = t2_real - t3_imag;
-          const ATOMIC x1_imag = t2_imag + t3_real;
+              /* x0 = z0 + t1 */
+              const ATOMIC x0_real = z0_real + t1_real;
+              const ATOMIC x0_imag = z0_imag + t1_imag;
 
-          /* x2 = t2 - i t3 */
-          const ATOMIC x2_real = t2_real + t3_imag;
-          const ATOMIC x2_imag = t2_imag - t3_real;
+              /* x1 = t2 + i t3 */
+              const ATOMIC x1_real = t2_real - t3_imag;
+              const ATOMIC x1_imag = t2_imag + t3_real;
 
-          const size_t to0 = k1 * q + 2 * k - 1;
-          const size_t to1 = to0 + m;
-          const size_t to2 = to1 + m;
+              /* x2 = t2 - i t3 */
+              const ATOMIC x2_real = t2_real + t3_imag;
+              const ATOMIC x2_imag = t2_imag - t3_real;
 
-          VECTOR(out,ostride,to0) = x0_real;
-          VECTOR(out,ostride,to0 + 1) = x0_imag;
+              const size_t to0 = k1 * q + 2 * k - 1;
+              const size_t to1 = to0 + m;
+              const size_t to2 = to1 + m;
+
+              VECTOR(out,ostride,to0) = x0_real;
+              VECTOR(out,ostride,to0 + 1) = x0_imag;
 
-          VECTOR(out,ostride,to1) = w1_real * x1_real - w1_imag * x1_imag;
-          VECTOR(out,ostride,to1 + 1) = w1_imag * x1_real + w1_real * x1_imag;
+              VECTOR(out,ostride,to1) = w1_real * x1_real - w1_imag * x1_imag;
+              VECTOR(out,ostride,to1 + 1) = w1_imag * x1_real + w1_real * x1_imag;
 
-          VECTOR(out,ostride,to2) = w2_real * x2_real - w2_imag * x2_imag;
-          VECTOR(out,ostride,to2 + 1) = w2_imag * x2_real + w2_real * x2_imag;
+              VECTOR(out,ostride,to2) = w2_real * x2_real - w2_imag * x2_imag;
+              VECTOR(out,ostride,to2 + 1) = w2_imag * x2_real + w2_real * x2_imag;
 
+            }
         }
     }
 
   if (q % 2 == 1)
     return;
 
-  for (k1 = 0; k1 < product_1; k1++)
+  for (b = 0; b < howmany; b++)
     {
-      const size_t from0 = 3 * k1 * q + q - 1;
-      const size_t from1 = from0 + 2 * q;
+      const BASE *in = in0 + idist * b;
+      BASE *out = out0 + odist * b;
 
-      const ATOMIC z0_real = VECTOR(in,istride,from0);
-      const ATOMIC z0_imag = VECTOR(in,istride,from0 + 1);
-      const ATOMIC z1_real = VECTOR(in,istride,from1);
+      for (k1 = 0; k1 < product_1; k1++)
+        {
+          const size_t from0 = 3 * k1 * q + q - 1;
+          const size_t from1 = from0 + 2 * q;
 
-      const ATOMIC t1_real = z0_real - z1_real;
-      const ATOMIC t2_real = 2 * tau * z0_imag;
+          const ATOMIC z0_real = VECTOR(in,istride,from0);
+          const ATOMIC z0_imag = VECTOR(in,istride,from0 + 1);
+          const ATOMIC z1_real = VECTOR(in,istride,from1);
 
-      const ATOMIC x0_real = 2 * z0_real + z1_real;
-      const ATOMIC x1_real = t1_real - t2_real;
-      const ATOMIC x2_real = -t1_real - t2_real;
+          const ATOMIC t1_real = z0_real - z1_real;
+          const ATOMIC t2_real = 2 * tau * z0_imag;
 
-      const size_t to0 = k1 * q + q - 1;
-      const size_t to1 = to0 + m;
-      const size_t to2 = to1 + m;
+          const ATOMIC x0_real = 2 * z0_real + z1_real;
+          const ATOMIC x1_real = t1_real - t2_real;
+          const ATOMIC x2_real = -t1_real - t2_real;
 
-      VECTOR(out,ostride,to0) = x0_real;
-      VECTOR(out,ostride,to1) = x1_real;
-      VECTOR(out,ostride,to2) = x2_real;
+          const size_t to0 = k1 * q + q - 1;
+          const size_t to1 = to0 + m;
+          const size_t to2 = to1 + m;
+
+          VECTOR(out,ostride,to0) = x0_real;
+          VECTOR(out,ostride,to1) = x1_real;
+          VECTOR(out,ostride,to2) = x2_real;
+        }
     }
   return;
 }
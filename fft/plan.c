@@ -0,0 +1,493 @@
+/* fft/plan.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Planned complex FFTs.
+
+   The transform is computed by a sequence of self-sorting (Stockham)
+   passes.  Before a pass of radix r the data holds r*m interleaved
+   transforms of length l, with element j of transform s stored at
+   x[s + r*m*j].  The pass combines them into m transforms of length
+   l*r, stored as y[k + m*f],
+
+     y[k + m*(j + l*p)] = sum_q w(l*r)^(q*j) w(r)^(q*p) x[k + m*q + r*m*j]
+
+   for j < l, k < m and p, q < r, where w(N) = exp(sign 2 pi i / N).
+   Both sides are accessed with unit stride in k, and the twiddle
+   factors w(l*r)^(q*j) of each pass are precomputed and stored
+   consecutively for q = 1 .. r-1, so that the inner loop of each pass
+   reads only contiguous data.  No bit-reversal or final permutation
+   is needed. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_plan.h>
+
+/* vector passes need the target attribute and __builtin_cpu_supports */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    !defined(GSL_FFT_NO_SIMD)
+#define HAVE_X86_PLAN 1
+#include <immintrin.h>
+#endif
+
+/* radices without a specialised butterfly */
+
+#define GENERIC_RADIX(r) ((r) == 7 || (r) > 8)
+
+/* multiply (zr,zi) by the complex number w[0] + i w[1] */
+
+#define CMUL(zr, zi, w) do { const double t_ = (zr) * (w)[0] - (zi) * (w)[1]; \
+    (zi) = (zr) * (w)[1] + (zi) * (w)[0]; (zr) = t_; } while (0)
+
+static size_t
+plan_factorize (size_t n, size_t factor[])
+{
+  size_t nf = 0, e = 0, n8, n4 = 0, n2 = 0, p, i;
+
+  while (n % 2 == 0)
+    {
+      n /= 2;
+      e++;
+    }
+
+  /* use radix 8 as far as possible, with radix 4 for the remainder
+     since two radix-4 passes are cheaper than a radix-8 and a radix-2
+     pass */
+
+  n8 = e / 3;
+
+  if (e % 3 == 1)
+    {
+      if (n8 > 0)
+        {
+          n8--;
+          n4 = 2;
+        }
+      else
+        {
+          n2 = 1;
+        }
+    }
+  else if (e % 3 == 2)
+    {
+      n4 = 1;
+    }
+
+  /* odd factors come first, so that the passes of radix 8, 4 and 2
+     have either an even m or m = 1 and an even l, as required by the
+     vector instances of the passes */
+
+  for (p = 3; n > 1; p += 2)
+    {
+      if (p * p > n)
+        p = n;                  /* remaining factor is prime */
+
+      while (n % p == 0)
+        {
+          n /= p;
+          factor[nf++] = p;
+        }
+    }
+
+  for (i = 0; i < n8; i++)
+    factor[nf++] = 8;
+
+  for (i = 0; i < n4; i++)
+    factor[nf++] = 4;
+
+  for (i = 0; i < n2; i++)
+    factor[nf++] = 2;
+
+  return nf;
+}
+
+/* scalar instance of the passes, one complex number per lane */
+
+typedef struct
+{
+  double re;
+  double im;
+}
+plan_complex;
+
+static inline plan_complex
+plan_complex_make (const double re, const double im)
+{
+  plan_complex z;
+  z.re = re;
+  z.im = im;
+  return z;
+}
+
+#define CT plan_complex
+#define VL 1
+#define C_LOAD(p) plan_complex_make ((p)[0], (p)[1])
+#define C_STORE(p, a) do { (p)[0] = (a).re; (p)[1] = (a).im; } while (0)
+#define C_GATHER(p, s) C_LOAD (p)
+#define C_BCAST(p) C_LOAD (p)
+#define C_ADD(a, b) plan_complex_make ((a).re + (b).re, (a).im + (b).im)
+#define C_SUB(a, b) plan_complex_make ((a).re - (b).re, (a).im - (b).im)
+#define C_SCALE(a, c) plan_complex_make ((c) * (a).re, (c) * (a).im)
+#define C_MULJ(a, sj) plan_complex_make ((sj).re * (a).im, (sj).im * (a).re)
+#define C_CMUL(a, w) plan_complex_make ((a).re * (w).re - (a).im * (w).im, \
+                                        (a).re * (w).im + (a).im * (w).re)
+#define C_SIGNJ(s) plan_complex_make (-(s), (s))
+#define TARGET
+#define FUNCTION(name) plan_ ## name ## _generic
+#include "plan_pass.c"
+#undef CT
+#undef VL
+#undef C_LOAD
+#undef C_STORE
+#undef C_GATHER
+#undef C_BCAST
+#undef C_ADD
+#undef C_SUB
+#undef C_SCALE
+#undef C_MULJ
+#undef C_CMUL
+#undef C_SIGNJ
+#undef TARGET
+#undef FUNCTION
+
+#ifdef HAVE_X86_PLAN
+
+/* AVX2 + FMA, two complex numbers per vector */
+
+#define CT __m256d
+#define VL 2
+#define C_LOAD(p) _mm256_loadu_pd (p)
+#define C_STORE(p, a) _mm256_storeu_pd ((p), (a))
+#define C_GATHER(p, s) _mm256_insertf128_pd (_mm256_castpd128_pd256 ( \
+                         _mm_loadu_pd (p)), _mm_loadu_pd ((p) + (s)), 1)
+#define C_BCAST(p) _mm256_broadcast_pd ((const __m128d *) (p))
+#define C_ADD(a, b) _mm256_add_pd ((a), (b))
+#define C_SUB(a, b) _mm256_sub_pd ((a), (b))
+#define C_SCALE(a, c) _mm256_mul_pd ((a), _mm256_set1_pd (c))
+#define C_MULJ(a, sj) _mm256_mul_pd (_mm256_permute_pd ((a), 0x5), (sj))
+#define C_CMUL(a, w) _mm256_fmaddsub_pd ((a), _mm256_movedup_pd (w), \
+                       _mm256_mul_pd (_mm256_permute_pd ((a), 0x5), \
+                                      _mm256_permute_pd ((w), 0xf)))
+#define C_SIGNJ(s) _mm256_set_pd ((s), -(s), (s), -(s))
+#define TARGET __attribute__ ((target ("avx2,fma")))
+#define FUNCTION(name) plan_ ## name ## _avx2
+#include "plan_pass.c"
+#undef CT
+#undef VL
+#undef C_LOAD
+#undef C_STORE
+#undef C_GATHER
+#undef C_BCAST
+#undef C_ADD
+#undef C_SUB
+#undef C_SCALE
+#undef C_MULJ
+#undef C_CMUL
+#undef C_SIGNJ
+#undef TARGET
+#undef FUNCTION
+
+static int
+plan_have_avx2 (void)
+{
+  /* the test is idempotent, so a race between threads calling this
+     for the first time only repeats the work */
+  static int have_avx2 = -1;
+
+  if (have_avx2 < 0)
+    {
+      __builtin_cpu_init ();
+      have_avx2 = __builtin_cpu_supports ("avx2")
+        && __builtin_cpu_supports ("fma");
+    }
+
+  return have_avx2;
+}
+
+#endif /* HAVE_X86_PLAN */
+
+/* general odd radix, using the table root[t] = w(r)^t */
+
+static void
+bfly_n (const double *x, const size_t xs, double *y, const size_t ys,
+        const double *w, const size_t r, const double *root, double *c)
+{
+  size_t p, q;
+
+  c[0] = x[0];
+  c[1] = x[1];
+
+  for (q = 1; q < r; q++)
+    {
+      c[2 * q] = x[2 * xs * q];
+      c[2 * q + 1] = x[2 * xs * q + 1];
+
+      if (w != NULL)
+        CMUL (c[2 * q], c[2 * q + 1], w + 2 * (q - 1));
+    }
+
+  for (p = 0; p < r; p++)
+    {
+      double sr = c[0], si = c[1];
+      size_t t = 0;
+
+      for (q = 1; q < r; q++)
+        {
+          t += p;
+          if (t >= r)
+            t -= r;
+
+          sr += c[2 * q] * root[2 * t] - c[2 * q + 1] * root[2 * t + 1];
+          si += c[2 * q] * root[2 * t + 1] + c[2 * q + 1] * root[2 * t];
+        }
+
+      y[2 * ys * p] = sr;
+      y[2 * ys * p + 1] = si;
+    }
+}
+
+/* one pass of radix r, from x to y */
+
+static void
+plan_pass (const gsl_fft_plan * plan, const size_t i,
+           const double *x, double *y, const size_t l, const size_t m)
+{
+  const size_t r = plan->factor[i];
+  const double s = (double) plan->sign;
+  const double *tw = plan->twiddle[i];
+  size_t j, k;
+
+#ifdef HAVE_X86_PLAN
+  if (!(plan->flags & GSL_FFT_PLAN_GENERIC) && plan_have_avx2 ()
+      && plan_pass_avx2 (r, x, y, l, m, tw, s) == 0)
+    return;
+#endif
+
+  if (plan_pass_generic (r, x, y, l, m, tw, s) == 0)
+    return;
+
+  for (j = 0; j < l; j++)
+    {
+      const double *w = (j == 0) ? NULL : tw + 2 * (r - 1) * j;
+      const double *xj = x + 2 * r * m * j;
+      double *yj = y + 2 * m * j;
+
+      for (k = 0; k < m; k++)
+        bfly_n (xj + 2 * k, m, yj + 2 * k, m * l, w, r, plan->root[i],
+                plan->work);
+    }
+}
+
+/* transform one sequence of length n with elements z[2*stride*i] */
+
+static void
+plan_transform (gsl_fft_plan * plan, double *z)
+{
+  const size_t n = plan->n;
+  const size_t stride = plan->stride;
+  const double norm = (plan->flags & GSL_FFT_PLAN_NORMALIZE) ? 1.0 / n : 1.0;
+  double *x, *y;
+  size_t i, l = 1, m = n;
+
+  if (stride == 1)
+    {
+      x = z;
+      y = plan->scratch;
+    }
+  else
+    {
+      x = plan->scratch;
+      y = plan->scratch + 2 * n;
+
+      for (i = 0; i < n; i++)
+        {
+          x[2 * i] = z[2 * stride * i];
+          x[2 * i + 1] = z[2 * stride * i + 1];
+        }
+    }
+
+  for (i = 0; i < plan->nf; i++)
+    {
+      double *t;
+
+      m /= plan->factor[i];
+      plan_pass (plan, i, x, y, l, m);
+      l *= plan->factor[i];
+
+      t = x;
+      x = y;
+      y = t;
+    }
+
+  if (x != z)
+    {
+      for (i = 0; i < n; i++)
+        {
+          z[2 * stride * i] = norm * x[2 * i];
+          z[2 * stride * i + 1] = norm * x[2 * i + 1];
+        }
+    }
+  else if (norm != 1.0)
+    {
+      for (i = 0; i < 2 * n; i++)
+        z[i] *= norm;
+    }
+}
+
+gsl_fft_plan *
+gsl_fft_plan_alloc (const size_t n, const size_t stride, const size_t howmany,
+                    const gsl_fft_direction direction,
+                    const unsigned int flags)
+{
+  gsl_fft_plan *plan;
+  size_t i, ntrig = 0, rmax = 0, l;
+  double *t;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+  else if (stride == 0)
+    {
+      GSL_ERROR_NULL ("stride must be positive integer", GSL_EDOM);
+    }
+  else if (direction != gsl_fft_forward && direction != gsl_fft_backward)
+    {
+      GSL_ERROR_NULL ("invalid direction", GSL_EINVAL);
+    }
+  else if (flags & ~((unsigned int) (GSL_FFT_PLAN_NORMALIZE | GSL_FFT_PLAN_GENERIC)))
+    {
+      GSL_ERROR_NULL ("invalid flags", GSL_EINVAL);
+    }
+
+  plan = calloc (1, sizeof (gsl_fft_plan));
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate plan struct", GSL_ENOMEM);
+    }
+
+  plan->n = n;
+  plan->stride = stride;
+  plan->howmany = howmany;
+  plan->sign = direction;
+  plan->flags = flags;
+  plan->nf = plan_factorize (n, plan->factor);
+
+  l = 1;
+  for (i = 0; i < plan->nf; i++)
+    {
+      const size_t r = plan->factor[i];
+
+      ntrig += 2 * (r - 1) * l;
+      l *= r;
+
+      if (GENERIC_RADIX (r))
+        {
+          ntrig += 2 * r;
+          rmax = GSL_MAX (rmax, r);
+        }
+    }
+
+  plan->trig = malloc ((ntrig + 2 * rmax + 1) * sizeof (double));
+  plan->scratch = malloc ((stride == 1 ? 2 : 4) * n * sizeof (double));
+
+  if (plan->trig == NULL || plan->scratch == NULL)
+    {
+      gsl_fft_plan_free (plan);
+      GSL_ERROR_NULL ("failed to allocate plan tables", GSL_ENOMEM);
+    }
+
+  /* twiddle factors w(l*r)^(q*j), j < l, 0 < q < r, stored with q
+     varying fastest */
+
+  t = plan->trig;
+  l = 1;
+  for (i = 0; i < plan->nf; i++)
+    {
+      const size_t r = plan->factor[i];
+      const size_t lr = l * r;
+      const double d_theta = (double) direction * 2.0 * M_PI / (double) lr;
+      size_t j, q;
+
+      plan->twiddle[i] = t;
+
+      for (j = 0; j < l; j++)
+        {
+          for (q = 1; q < r; q++)
+            {
+              const double theta = d_theta * (double) ((q * j) % lr);
+              *t++ = cos (theta);
+              *t++ = sin (theta);
+            }
+        }
+
+      if (GENERIC_RADIX (r))
+        {
+          const double d_phi = (double) direction * 2.0 * M_PI / (double) r;
+
+          plan->root[i] = t;
+
+          for (q = 0; q < r; q++)
+            {
+              *t++ = cos (d_phi * q);
+              *t++ = sin (d_phi * q);
+            }
+        }
+
+      l = lr;
+    }
+
+  plan->work = t;
+
+  return plan;
+}
+
+void
+gsl_fft_plan_free (gsl_fft_plan * plan)
+{
+  RETURN_IF_NULL (plan);
+  free (plan->trig);
+  free (plan->scratch);
+  free (plan);
+}
+
+int
+gsl_fft_plan_execute (gsl_fft_plan * plan, gsl_complex_packed_array data)
+{
+  const size_t dist = 2 * plan->n * plan->stride;
+  size_t b;
+
+  for (b = 0; b < plan->howmany; b++)
+    plan_transform (plan, data + dist * b);
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_fft_plan_flops (const gsl_fft_plan * plan)
+{
+  /* nominal count 5 n log2(n) used for comparing FFT implementations */
+
+  const double n = (double) plan->n;
+
+  return 5.0 * n * log (n) / M_LN2 * (double) plan->howmany;
+}
@@ -0,0 +1,260 @@
+/* fft/plan_pass.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Passes of radix 2, 3, 4, 5 and 8 for the planned FFT, included from
+   plan.c once for each instruction set with the following macros:
+
+   CT                   type holding VL complex numbers
+   C_LOAD, C_STORE      load and store VL consecutive complex numbers
+   C_GATHER(p,s)        load VL complex numbers spaced s doubles apart
+   C_BCAST(p)           load one complex number into every lane
+   C_ADD, C_SUB         complex addition and subtraction
+   C_SCALE(a,c)         multiply by the real number c
+   C_MULJ(a,sj)         multiply by i*sign, with sj = C_SIGNJ(sign)
+   C_CMUL(a,w)          complex multiplication
+   TARGET               function attribute enabling the instruction set
+   FUNCTION(name)       name of the function for this instruction set
+
+   The lanes of a vector hold consecutive values of k when m is a
+   multiple of VL, or consecutive values of j when m = 1, in the
+   notation of plan.c.  Other passes must use the scalar instance. */
+
+static inline TARGET void
+FUNCTION (dft4) (CT * z, const CT sj)
+{
+  const CT t0 = C_ADD (z[0], z[2]);
+  const CT t1 = C_SUB (z[0], z[2]);
+  const CT t2 = C_ADD (z[1], z[3]);
+  const CT t3 = C_MULJ (C_SUB (z[1], z[3]), sj);
+
+  z[0] = C_ADD (t0, t2);
+  z[1] = C_ADD (t1, t3);
+  z[2] = C_SUB (t0, t2);
+  z[3] = C_SUB (t1, t3);
+}
+
+static inline TARGET void
+FUNCTION (dft2) (CT * z, const CT sj)
+{
+  const CT t = z[1];
+
+  (void) sj;
+
+  z[1] = C_SUB (z[0], t);
+  z[0] = C_ADD (z[0], t);
+}
+
+static inline TARGET void
+FUNCTION (dft3) (CT * z, const CT sj)
+{
+  const double tau = 0.86602540378443864676;   /* sin(2 pi/3) */
+  const CT t1 = C_ADD (z[1], z[2]);
+  const CT t2 = C_SUB (z[0], C_SCALE (t1, 0.5));
+  const CT t3 = C_MULJ (C_SCALE (C_SUB (z[1], z[2]), tau), sj);
+
+  z[0] = C_ADD (z[0], t1);
+  z[1] = C_ADD (t2, t3);
+  z[2] = C_SUB (t2, t3);
+}
+
+static inline TARGET void
+FUNCTION (dft5) (CT * z, const CT sj)
+{
+  const double c1 = 0.30901699437494742410;  /* cos(2 pi/5) */
+  const double c2 = -0.80901699437494742410; /* cos(4 pi/5) */
+  const double s1 = 0.95105651629515357212;  /* sin(2 pi/5) */
+  const double s2 = 0.58778525229247312917;  /* sin(4 pi/5) */
+  const CT a1 = C_ADD (z[1], z[4]);
+  const CT b1 = C_SUB (z[1], z[4]);
+  const CT a2 = C_ADD (z[2], z[3]);
+  const CT b2 = C_SUB (z[2], z[3]);
+  const CT u1 = C_ADD (z[0], C_ADD (C_SCALE (a1, c1), C_SCALE (a2, c2)));
+  const CT u2 = C_ADD (z[0], C_ADD (C_SCALE (a1, c2), C_SCALE (a2, c1)));
+  const CT v1 = C_MULJ (C_ADD (C_SCALE (b1, s1), C_SCALE (b2, s2)), sj);
+  const CT v2 = C_MULJ (C_SUB (C_SCALE (b1, s2), C_SCALE (b2, s1)), sj);
+
+  z[0] = C_ADD (z[0], C_ADD (a1, a2));
+  z[1] = C_ADD (u1, v1);
+  z[4] = C_SUB (u1, v1);
+  z[2] = C_ADD (u2, v2);
+  z[3] = C_SUB (u2, v2);
+}
+
+static inline TARGET void
+FUNCTION (dft8) (CT * z, const CT sj)
+{
+  const double r = M_SQRT1_2;
+  CT e[4], o[4], t;
+
+  e[0] = z[0];
+  e[1] = z[2];
+  e[2] = z[4];
+  e[3] = z[6];
+  o[0] = z[1];
+  o[1] = z[3];
+  o[2] = z[5];
+  o[3] = z[7];
+
+  FUNCTION (dft4) (e, sj);
+  FUNCTION (dft4) (o, sj);
+
+  /* z(p) = e(p) + w8^p o(p), z(p+4) = e(p) - w8^p o(p) */
+
+  z[0] = C_ADD (e[0], o[0]);
+  z[4] = C_SUB (e[0], o[0]);
+
+  t = C_MULJ (o[1], sj);
+  t = C_SCALE (C_ADD (o[1], t), r);
+  z[1] = C_ADD (e[1], t);
+  z[5] = C_SUB (e[1], t);
+
+  t = C_MULJ (o[2], sj);
+  z[2] = C_ADD (e[2], t);
+  z[6] = C_SUB (e[2], t);
+
+  t = C_MULJ (o[3], sj);
+  t = C_SCALE (C_SUB (t, o[3]), r);
+  z[3] = C_ADD (e[3], t);
+  z[7] = C_SUB (e[3], t);
+}
+
+/* Define a pass of radix R using the butterfly FUNCTION(dft ## R).  In
+   the first loop the lanes run over k, and the twiddle factors
+   w[q-1] are the same for all lanes.  In the second loop (m = 1) the
+   lanes run over j, and each lane has its own twiddle factors.  The
+   loops over q are unrolled explicitly with PLAN_REP ## R (q = 0 ..
+   R-1) and PLAN_REPW ## R (q = 1 .. R-1), so that z is kept in
+   registers. */
+
+#ifndef PLAN_REP2
+#define PLAN_REPW2(M) M(1)
+#define PLAN_REPW3(M) M(1) M(2)
+#define PLAN_REPW4(M) M(1) M(2) M(3)
+#define PLAN_REPW5(M) M(1) M(2) M(3) M(4)
+#define PLAN_REPW8(M) M(1) M(2) M(3) M(4) M(5) M(6) M(7)
+#define PLAN_REP2(M) M(0) PLAN_REPW2(M)
+#define PLAN_REP3(M) M(0) PLAN_REPW3(M)
+#define PLAN_REP4(M) M(0) PLAN_REPW4(M)
+#define PLAN_REP5(M) M(0) PLAN_REPW5(M)
+#define PLAN_REP8(M) M(0) PLAN_REPW8(M)
+#endif
+
+#define PLAN_KLOAD(q) z[q] = C_LOAD (xj + 2 * (k + m * (q)));
+#define PLAN_KTWIDDLE(q) z[q] = C_CMUL (z[q], C_BCAST (w + 2 * ((q) - 1)));
+#define PLAN_KSTORE(q) C_STORE (yj + 2 * k + ys * (q), z[q]);
+#define PLAN_JLOAD(q) z[q] = C_CMUL (C_GATHER (xj + 2 * (q), 2 * r), \
+                                     C_GATHER (w + 2 * ((q) - 1), 2 * (r - 1)));
+#define PLAN_JSTORE(q) C_STORE (y + 2 * (j + l * (q)), z[q]);
+
+#define PLAN_PASS(R)                                                    \
+static TARGET void                                                      \
+FUNCTION (pass_ ## R) (const double *x, double *y, const size_t l,      \
+                       const size_t m, const double *tw, const CT sj)   \
+{                                                                       \
+  const size_t r = R;                                                   \
+  CT z[R];                                                              \
+  size_t j, k;                                                          \
+                                                                        \
+  if (m % VL == 0)                                                      \
+    {                                                                   \
+      const size_t ys = 2 * m * l;                                      \
+                                                                        \
+      for (j = 0; j < l; j++)                                           \
+        {                                                               \
+          const double *w = tw + 2 * (r - 1) * j;                       \
+          const double *xj = x + 2 * r * m * j;                         \
+          double *yj = y + 2 * m * j;                                   \
+                                                                        \
+          for (k = 0; k < m; k += VL)                                   \
+            {                                                           \
+              PLAN_REP ## R (PLAN_KLOAD)                                \
+                                                                        \
+              if (j > 0)                                                \
+                {                                                       \
+                  PLAN_REPW ## R (PLAN_KTWIDDLE)                        \
+                }                                                       \
+                                                                        \
+              FUNCTION (dft ## R) (z, sj);                              \
+              PLAN_REP ## R (PLAN_KSTORE)                               \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+  else                                                                  \
+    {                                                                   \
+      for (j = 0; j < l; j += VL)                                       \
+        {                                                               \
+          const double *w = tw + 2 * (r - 1) * j;                       \
+          const double *xj = x + 2 * r * j;                             \
+                                                                        \
+          z[0] = C_GATHER (xj, 2 * r);                                  \
+          PLAN_REPW ## R (PLAN_JLOAD)                                   \
+          FUNCTION (dft ## R) (z, sj);                                  \
+          PLAN_REP ## R (PLAN_JSTORE)                                   \
+        }                                                               \
+    }                                                                   \
+}
+
+PLAN_PASS (2)
+PLAN_PASS (3)
+PLAN_PASS (4)
+PLAN_PASS (5)
+PLAN_PASS (8)
+
+#undef PLAN_PASS
+#undef PLAN_KLOAD
+#undef PLAN_KTWIDDLE
+#undef PLAN_KSTORE
+#undef PLAN_JLOAD
+#undef PLAN_JSTORE
+
+/* returns 0 if the pass was computed, or -1 if the radix or the
+   lengths l, m are not supported by this instance */
+
+static TARGET int
+FUNCTION (pass) (const size_t r, const double *x, double *y, const size_t l,
+                 const size_t m, const double *tw, const double s)
+{
+  const CT sj = C_SIGNJ (s);
+
+  if (m % VL != 0 && (m != 1 || l % VL != 0))
+    return -1;
+
+  switch (r)
+    {
+    case 2:
+      FUNCTION (pass_2) (x, y, l, m, tw, sj);
+      break;
+    case 3:
+      FUNCTION (pass_3) (x, y, l, m, tw, sj);
+      break;
+    case 4:
+      FUNCTION (pass_4) (x, y, l, m, tw, sj);
+      break;
+    case 5:
+      FUNCTION (pass_5) (x, y, l, m, tw, sj);
+      break;
+    case 8:
+      FUNCTION (pass_8) (x, y, l, m, tw, sj);
+      break;
+    default:
+      return -1;
+    }
+
+  return 0;
+}
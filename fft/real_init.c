@@ -23,7 +23,7 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
   int status;
   size_t i;
   size_t n_factors;
-  size_t t, product, product_1, q;
+  size_t t, product, product_1, q, nconv;
   double d_theta;
 
   TYPE(gsl_fft_real_wavetable) * wavetable;
@@ -41,6 +41,32 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  /* lengths with large prime factors are computed as a complex
+     convolution, see bluestein.c */
+
+  nconv = fft_bluestein_length (n);
+
+  wavetable->nconv = nconv;
+  wavetable->chirp = NULL;
+
+  if (nconv > 0)
+    {
+      wavetable->n = n;
+
+      status = FUNCTION(fft_bluestein,alloc) (n, nconv, &(wavetable->nf),
+                                              wavetable->factor,
+                                              wavetable->twiddle,
+                                              &(wavetable->trig),
+                                              &(wavetable->chirp));
+      if (status)
+        {
+          free (wavetable);     /* error already reported */
+          return 0;
+        }
+
+      return wavetable;
+    }
+
   if (n == 1) 
     {
       wavetable->trig = 0;
@@ -126,6 +152,7 @@ TYPE(gsl_fft_real_workspace) *
 FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 {
   TYPE(gsl_fft_real_workspace) * workspace;
+  size_t nscratch;
 
   if (n == 0)
     {
@@ -142,7 +169,12 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 
   workspace->n = n;
 
-  workspace->scratch = (BASE *) malloc (n * sizeof (BASE));
+  /* a Bluestein transform needs two complex arrays of the
+     convolution length */
+
+  nscratch = GSL_MAX (n, 4 * fft_bluestein_length (n));
+
+  workspace->scratch = (BASE *) malloc (nscratch * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -167,6 +199,9 @@ FUNCTION(gsl_fft_real_wavetable,free) (TYPE(gsl_fft_real_wavetable) * wavetable)
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  free (wavetable->chirp);
+  wavetable->chirp = NULL;
+
   free (wavetable) ;
 }
 
@@ -26,29 +26,25 @@
 #include <gsl/gsl_fft_real.h>
 
 #include "real_pass.h"
+#include "bluestein.h"
+
+static void
+FUNCTION(fft_real,passes) (BASE data[], const size_t stride, const size_t dist,
+                           const size_t n, const size_t howmany,
+                           const TYPE(gsl_fft_real_wavetable) * wavetable,
+                           BASE scratch[]);
+
+static void
+FUNCTION(fft_real,bluestein) (BASE data[], const size_t stride, const size_t dist,
+                              const size_t n, const size_t howmany,
+                              const TYPE(gsl_fft_real_wavetable) * wavetable,
+                              BASE scratch[]);
 
 int
 FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t n,
                                   const TYPE(gsl_fft_real_wavetable) * wavetable,
                                   TYPE(gsl_fft_real_workspace) * work)
 {
-  const size_t nf = wavetable->nf;
-
-  size_t i;
-
-  size_t q, product = 1;
-  size_t tskip;
-  size_t product_1;
-
-  BASE *const scratch = work->scratch;
-  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4;
-
-  size_t state = 0;
-  BASE *in = data;
-  size_t istride = stride ;
-  BASE *out = scratch;
-  size_t ostride = 1 ;
-  
   if (n == 0)
     {
       GSL_ERROR ("length n must be positive integer", GSL_EDOM);
@@ -69,6 +65,149 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->nconv > 0)
+    {
+      FUNCTION(fft_real,bluestein) (data, stride, 0, n, 1, wavetable,
+                                    work->scratch);
+      return 0;
+    }
+
+  FUNCTION(fft_real,passes) (data, stride, 0, n, 1, wavetable, work->scratch);
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_real,transform_batch) (BASE data[], const size_t stride,
+                                        const size_t dist, const size_t n,
+                                        const size_t howmany,
+                                        const TYPE(gsl_fft_real_wavetable) * wavetable,
+                                        TYPE(gsl_fft_real_workspace) * work)
+{
+  size_t b, group;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (work->n < n)
+    {
+      GSL_ERROR ("workspace is smaller than length of data", GSL_EINVAL);
+    }
+
+  if (n == 1)
+    {                           /* FFT of one data point is the identity */
+      return 0;
+    }
+
+  if (wavetable->nconv > 0)
+    {
+      /* Bluestein transforms are computed one at a time, in scratch
+         space of two complex arrays of the convolution length */
+
+      const size_t nscratch = GSL_MAX (work->n, 4 * fft_bluestein_length (work->n));
+
+      if (nscratch < 4 * wavetable->nconv)
+        {
+          GSL_ERROR ("workspace is too small for length of data", GSL_EINVAL);
+        }
+
+      FUNCTION(fft_real,bluestein) (data, stride, dist, n, howmany,
+                                    wavetable, work->scratch);
+      return 0;
+    }
+
+  /* the workspace holds the intermediate results of work->n / n
+     transforms, which are computed together */
+
+  group = work->n / n;
+
+  for (b = 0; b < howmany; b += group)
+    {
+      const size_t nb = GSL_MIN (group, howmany - b);
+      FUNCTION(fft_real,passes) (data + dist * b, stride, dist, n, nb,
+                                 wavetable, work->scratch);
+    }
+
+  return 0;
+}
+
+/* Compute howmany transforms of length n > 1 as complex convolutions,
+   see bluestein.c, and pack the results in halfcomplex order */
+
+static void
+FUNCTION(fft_real,bluestein) (BASE data[], const size_t stride, const size_t dist,
+                              const size_t n, const size_t howmany,
+                              const TYPE(gsl_fft_real_wavetable) * wavetable,
+                              BASE scratch[])
+{
+  const size_t nconv = wavetable->nconv;
+  BASE * const a = scratch;
+  size_t b, k;
+
+  for (b = 0; b < howmany; b++)
+    {
+      BASE * x = data + dist * b;
+
+      for (k = 0; k < n; k++)
+        {
+          REAL(a,1,k) = VECTOR(x,stride,k);
+          IMAG(a,1,k) = 0;
+        }
+
+      FUNCTION(fft_bluestein,convolve) (a, n, nconv, wavetable->nf,
+                                        wavetable->factor, wavetable->twiddle,
+                                        wavetable->chirp, scratch + 2 * nconv);
+
+      VECTOR(x,stride,0) = REAL(a,1,0);
+
+      for (k = 1; k < n - k; k++)
+        {
+          VECTOR(x,stride,2 * k - 1) = REAL(a,1,k);
+          VECTOR(x,stride,2 * k) = IMAG(a,1,k);
+        }
+
+      if (k == n - k)
+        {
+          VECTOR(x,stride,n - 1) = REAL(a,1,k);
+        }
+    }
+}
+
+/* Compute howmany transforms of length n > 1, the b-th starting at
+   data[dist*b], with the intermediate results of the b-th transform
+   stored at scratch[n*b] */
+
+static void
+FUNCTION(fft_real,passes) (BASE data[], const size_t stride, const size_t dist,
+                           const size_t n, const size_t howmany,
+                           const TYPE(gsl_fft_real_wavetable) * wavetable,
+                           BASE scratch[])
+{
+  const size_t nf = wavetable->nf;
+
+  size_t i, b;
+
+  size_t q, product = 1;
+  size_t tskip;
+  size_t product_1;
+
+  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4;
+
+  size_t state = 0;
+  BASE *in = data;
+  size_t istride = stride ;
+  size_t idist = dist ;
+  BASE *out = scratch;
+  size_t ostride = 1 ;
+  size_t odist = n ;
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -82,38 +221,44 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
         {
           in = data;
           istride = stride;
+          idist = dist;
           out = scratch;
           ostride = 1;
+          odist = n;
           state = 1;
         }
       else
         {
           in = scratch;
           istride = 1;
+          idist = n;
           out = data;
           ostride = stride;
+          odist = dist;
           state = 0;
         }
 
       if (factor == 2)
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_real,pass_2) (in, istride, out, ostride, product, n, twiddle1);
+          FUNCTION(fft_real,pass_2) (in, istride, idist, out, ostride, odist,
+                                     howmany, product, n, twiddle1);
         }
       else if (factor == 3)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + tskip;
-          FUNCTION(fft_real,pass_3) (in, istride, out, ostride, product, n, twiddle1,
-                               twiddle2);
+          FUNCTION(fft_real,pass_3) (in, istride, idist, out, ostride, odist,
+                                     howmany, product, n, twiddle1, twiddle2);
         }
       else if (factor == 4)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + tskip;
           twiddle3 = twiddle2 + tskip;
-          FUNCTION(fft_real,pass_4) (in, istride, out, ostride, product, n, twiddle1,
-                                     twiddle2, twiddle3);
+          FUNCTION(fft_real,pass_4) (in, istride, idist, out, ostride, odist,
+                                     howmany, product, n, twiddle1, twiddle2,
+                                     twiddle3);
         }
       else if (factor == 5)
         {
@@ -121,25 +266,30 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
           twiddle2 = twiddle1 + tskip;
           twiddle3 = twiddle2 + tskip;
           twiddle4 = twiddle3 + tskip;
-          FUNCTION(fft_real,pass_5) (in, istride, out, ostride, product, n, twiddle1,
-                                     twiddle2, twiddle3, twiddle4);
+          FUNCTION(fft_real,pass_5) (in, istride, idist, out, ostride, odist,
+                                     howmany, product, n, twiddle1, twiddle2,
+                                     twiddle3, twiddle4);
         }
       else
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_real,pass_n) (in, istride, out, ostride, factor, product, n,
-                                     twiddle1);
+          for (b = 0; b < howmany; b++)
+            {
+              FUNCTION(fft_real,pass_n) (in + idist * b, istride,
+                                         out + odist * b, ostride,
+                                         factor, product, n, twiddle1);
+            }
         }
     }
 
   if (state == 1)               /* copy results back from scratch to data */
     {
-      for (i = 0; i < n; i++)
+      for (b = 0; b < howmany; b++)
         {
-          data[stride*i] = scratch[i] ;
+          for (i = 0; i < n; i++)
+            {
+              data[dist*b + stride*i] = scratch[n*b + i] ;
+            }
         }
     }
-
-  return 0;
-
 }
@@ -17,37 +17,49 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
-static void FUNCTION(fft_real,pass_2) (const BASE in[],
+static void FUNCTION(fft_real,pass_2) (const BASE in0[],
                                        const size_t istride,
-                                       BASE out[],
+                                       const size_t idist,
+                                       BASE out0[],
                                        const size_t ostride,
+                                       const size_t odist,
+                                       const size_t howmany,
                                        const size_t product,
                                        const size_t n,
                                        const TYPE(gsl_complex) twiddle[]);
 
-static void FUNCTION(fft_real,pass_3) (const BASE in[], 
+static void FUNCTION(fft_real,pass_3) (const BASE in0[], 
                                        const size_t istride,
-                                       BASE out[],
+                                       const size_t idist,
+                                       BASE out0[],
                                        const size_t ostride,
+                                       const size_t odist,
+                                       const size_t howmany,
                                        const size_t product,
                                        const size_t n,
                                        const TYPE(gsl_complex) twiddle1[],
                                        const TYPE(gsl_complex) twiddle2[]);
 
-static void FUNCTION(fft_real,pass_4) (const BASE in[],
+static void FUNCTION(fft_real,pass_4) (const BASE in0[],
                                        const size_t istride,
-                                       BASE out[],
+                                       const size_t idist,
+                                       BASE out0[],
                                        const size_t ostride,
+                                       const size_t odist,
+                                       const size_t howmany,
                                        const size_t product,
                                        const size_t n,
                                        const TYPE(gsl_complex) twiddle1[],
                                        const TYPE(gsl_complex) twiddle2[],
                                        const TYPE(gsl_complex) twiddle3[]);
 
-static void FUNCTION(fft_real,pass_5) (const BASE in[],
+static void FUNCTION(fft_real,pass_5) (const BASE in0[],
                                        const size_t istride,
-                                       BASE out[],
+                                       const size_t idist,
+                                       BASE out0[],
                                        const size_t ostride,
+                                       const size_t odist,
+                                       const size_t howmany,
                                        const size_t product,
                                        const size_t n,
                                        const TYPE(gsl_complex) twiddle1[],
@@ -18,16 +18,19 @@
  */
 
 static void
-FUNCTION(fft_real,pass_3) (const BASE in[], 
+FUNCTION(fft_real,pass_3) (const BASE in0[],
                            const size_t istride,
-                           BASE out[],
+                           const size_t idist,
+                           BASE out0[],
                            const size_t ostride,
+                           const size_t odist,
+                           const size_t howmany,
                            const size_t product,
                            const size_t n,
                            const TYPE(gsl_complex) twiddle1[],
                            const TYPE(gsl_complex) twiddle2[])
 {
-  size_t k, k1;
+  size_t k, k1, b;
 
   const size_t factor = 3;
   const size_t m = n / factor;
@@ -36,28 +39,34 @@ FUNCTION(fft_real,pass_3) (const BASE in[],
 
   const ATOMIC tau = sqrt (3.0) / 2.0;
 
-  for (k1 = 0; k1 < q; k1++)
+  for (b = 0; b < howmany; b++)
     {
-      const size_t from0 = k1 * product_1;
-      const size_t from1 = from0 + m;
-      const size_t from2 = from1 + m;
+      const BASE *in = in0 + idist * b;
+      BASE *out = out0 + odist * b;
+
+      for (k1 = 0; k1 < q; k1++)
+        {
+          const size_t from0 = k1 * product_1;
+          const size_t from1 = from0 + m;
+          const size_t from2 = from1 + m;
       
-      const ATOMIC z0_real = VECTOR(in,istride,from0);
-      const ATOMIC z1_real = VECTOR(in,istride,from1);
-      const ATOMIC z2_real = VECTOR(in,istride,from2);
+          const ATOMIC z0_real = VECTOR(in,istride,from0);
+          const ATOMIC z1_real = VECTOR(in,istride,from1);
+          const ATOMIC z2_real = VECTOR(in,istride,from2);
       
-      const ATOMIC t1 = z1_real + z2_real;
+          const ATOMIC t1 = z1_real + z2_real;
 
-      const ATOMIC x0_real = z0_real + t1;
-      const ATOMIC x1_real = z0_real - t1 / 2.0;
-      const ATOMIC x1_imag = -tau * (z1_real - z2_real);
+          const ATOMIC x0_real = z0_real + t1;
+          const ATOMIC x1_real = z0_real - t1 / 2.0;
+          const ATOMIC x1_imag = -tau * (z1_real - z2_real);
 
-      const size_t to0 = product * k1;
-      const size_t to1 = to0 + 2 * product_1 - 1;
+          const size_t to0 = product * k1;
+          const size_t to1 = to0 + 2 * product_1 - 1;
 
-      VECTOR(out,ostride,to0) = x0_real;
-      VECTOR(out,ostride,to1) = x1_real;
-      VECTOR(out,ostride,to1 + 1) = x1_imag;
+          VECTOR(out,ostride,to0) = x0_real;
+          VECTOR(out,ostride,to1) = x1_real;
+          VECTOR(out,ostride,to1 + 1) = x1_imag;
+        }
     }
 
   if (product_1 == 1)
@@ -70,96 +79,108 @@ FUNCTION(fft_real,pass_3) (const BASE in[],
       const ATOMIC w2_real = GSL_REAL(twiddle2[k - 1]);
       const ATOMIC w2_imag = -GSL_IMAG(twiddle2[k - 1]);
 
-      for (k1 = 0; k1 < q; k1++)
+      for (b = 0; b < howmany; b++)
         {
-          const size_t from0 = k1 * product_1 + 2 * k - 1;
-          const size_t from1 = from0 + m;
-          const size_t from2 = from1 + m;
+          const BASE *in = in0 + idist * b;
+          BASE *out = out0 + odist * b;
+
+          for (k1 = 0; k1 < q; k1++)
+            {
+              const size_t from0 = k1 * product_1 + 2 * k - 1;
+              const size_t from1 = from0 + m;
+              const size_t from2 = from1 + m;
           
-          const ATOMIC f0_real = VECTOR(in,istride,from0);
-          const ATOMIC f0_imag = VECTOR(in,istride,from0 + 1);
-          const ATOMIC f1_real = VECTOR(in,istride,from1);
-          const ATOMIC f1_imag = VECTOR(in,istride,from1 + 1);
-          const ATOMIC f2_real = VECTOR(in,istride,from2);
-          const ATOMIC f2_imag = VECTOR(in,istride,from2 + 1);
+              const ATOMIC f0_real = VECTOR(in,istride,from0);
+              const ATOMIC f0_imag = VECTOR(in,istride,from0 + 1);
+              const ATOMIC f1_real = VECTOR(in,istride,from1);
+              const ATOMIC f1_imag = VECTOR(in,istride,from1 + 1);
+              const ATOMIC f2_real = VECTOR(in,istride,from2);
+              const ATOMIC f2_imag = VECTOR(in,istride,from2 + 1);
           
-          const ATOMIC z0_real = f0_real;
-          const ATOMIC z0_imag = f0_imag;
-          const ATOMIC z1_real = w1_real * f1_real - w1_imag * f1_imag;
-          const ATOMIC z1_imag = w1_real * f1_imag + w1_imag * f1_real;
-          const ATOMIC z2_real = w2_real * f2_real - w2_imag * f2_imag;
-          const ATOMIC z2_imag = w2_real * f2_imag + w2_imag * f2_real;
-
-          /* compute x = W(3) z */
-
-          /* t1 = z1 + z2 */
-          const ATOMIC t1_real = z1_real + z2_real;
-          const ATOMIC t1_imag = z1_imag + z2_imag;
+              const ATOMIC z0_real = f0_real;
+              const ATOMIC z0_imag = f0_imag;
+              const ATOMIC z1_real = w1_real * f1_real - w1_imag * f1_imag;
+              const ATOMIC z1_imag = w1_real * f1_imag + w1_imag * f1_real;
+              const ATOMIC z2_real = w2_real * f2_real - w2_imag * f2_imag;
+              const ATOMIC z2_imag = w2_real * f2_imag + w2_imag * f2_real;
+
+              /* compute x = W(3) z */
+
+              /* t1 = z1 + z2 */
+              const ATOMIC t1_real = z1_real + z2_real;
+              const ATOMIC t1_imag = z1_imag + z2_imag;
           
-          /* t2 = z0 - t1/2 */
-          const ATOMIC t2_real = z0_real - t1_real / 2;
-          const ATOMIC t2_imag = z0_imag - t1_imag / 2;
+              /* t2 = z0 - t1/2 */
+              const ATOMIC t2_real = z0_real - t1_real / 2;
+              const ATOMIC t2_imag = z0_imag - t1_imag / 2;
           
-          /* t3 = (+/-) sin(pi/3)*(z1 - z2) */
-          const ATOMIC t3_real = -tau * (z1_real - z2_real);
-          const ATOMIC t3_imag = -tau * (z1_imag - z2_imag);
+              /* t3 = (+/-) sin(pi/3)*(z1 - z2) */
+              const ATOMIC t3_real = -tau * (z1_real - z2_real);
+              const ATOMIC t3_imag = -tau * (z1_imag - z2_imag);
           
-          /* x0 = z0 + t1 */
-          const ATOMIC x0_real = z0_real + t1_real;
-          const ATOMIC x0_imag = z0_imag + t1_imag;
+              /* x0 = z0 + t1 */
+              const ATOMIC x0_real = z0_real + t1_real;
+              const ATOMIC x0_imag = z0_imag + t1_imag;
           
-          /* x1 = t2 + i t3 */
-          const ATOMIC x1_real = t2_real - t3_imag;
-          const ATOMIC x1_imag = t2_imag + t3_real;
+              /* x1 = t2 + i t3 */
+              const ATOMIC x1_real = t2_real - t3_imag;
+              const ATOMIC x1_imag = t2_imag + t3_real;
 
-            /* x2 = t2 - i t3 */
-          const ATOMIC x2_real = t2_real + t3_imag;
-          const ATOMIC x2_imag = t2_imag - t3_real;
+                /* x2 = t2 - i t3 */
+              const ATOMIC x2_real = t2_real + t3_imag;
+              const ATOMIC x2_imag = t2_imag - t3_real;
 
-          /* apply twiddle factors */
+              /* apply twiddle factors */
           
-          const size_t to0 = k1 * product + 2 * k - 1;
-          const size_t to1 = to0 + 2 * product_1;
-          const size_t to2 = 2 * product_1 - 2 * k + k1 * product - 1;
+              const size_t to0 = k1 * product + 2 * k - 1;
+              const size_t to1 = to0 + 2 * product_1;
+              const size_t to2 = 2 * product_1 - 2 * k + k1 * product - 1;
           
-          /* to0 = 1 * x0 */
-          VECTOR(out,ostride,to0) = x0_real;
-          VECTOR(out,ostride,to0 + 1) = x0_imag;
+              /* to0 = 1 * x0 */
+              VECTOR(out,ostride,to0) = x0_real;
+              VECTOR(out,ostride,to0 + 1) = x0_imag;
           
-          /* to1 = 1 * x1 */
-          VECTOR(out,ostride,to1) = x1_real;
-          VECTOR(out,ostride,to1 + 1) = x1_imag;
+              /* to1 = 1 * x1 */
+              VECTOR(out,ostride,to1) = x1_real;
+              VECTOR(out,ostride,to1 + 1) = x1_imag;
           
-          /* to2 = 1 * x2 */
-          VECTOR(out,ostride,to2) = x2_real;
-          VECTOR(out,ostride,to2 + 1) = -x2_imag;
+              /* to2 = 1 * x2 */
+              VECTOR(out,ostride,to2) = x2_real;
+              VECTOR(out,ostride,to2 + 1) = -x2_imag;
+            }
         }
     }
   
   if (product_1 % 2 == 1)
     return;
 
-  for (k1 = 0; k1 < q; k1++)
+  for (b = 0; b < howmany; b++)
     {
-      const size_t from0 = k1 * product_1 + product_1 - 1;
-      const size_t from1 = from0 + m;
-      const size_t from2 = from1 + m;
+      const BASE *in = in0 + idist * b;
+      BASE *out = out0 + odist * b;
+
+      for (k1 = 0; k1 < q; k1++)
+        {
+          const size_t from0 = k1 * product_1 + product_1 - 1;
+          const size_t from1 = from0 + m;
+          const size_t from2 = from1 + m;
       
-      const ATOMIC z0_real = VECTOR(in,istride,from0);
-      const ATOMIC z1_real = VECTOR(in,istride,from1);
-      const ATOMIC z2_real = VECTOR(in,istride,from2);
+          const ATOMIC z0_real = VECTOR(in,istride,from0);
+          const ATOMIC z1_real = VECTOR(in,istride,from1);
+          const ATOMIC z2_real = VECTOR(in,istride,from2);
 
-      const ATOMIC t1 = z1_real - z2_real;
-      const ATOMIC x0_real = z0_real + t1 / 2.0;
-      const ATOMIC x0_imag = -tau * (z1_real + z2_real);
-      const ATOMIC x1_real = z0_real - t1;
+          const ATOMIC t1 = z1_real - z2_real;
+          const ATOMIC x0_real = z0_real + t1 / 2.0;
+          const ATOMIC x0_imag = -tau * (z1_real + z2_real);
+          const ATOMIC x1_real = z0_real - t1;
 
-      const size_t to0 = k1 * product + product_1 - 1;
-      const size_t to1 = to0 + 2 * product_1;
+          const size_t to0 = k1 * product + product_1 - 1;
+          const size_t to1 = to0 + 2 * product_1;
       
-      VECTOR(out,ostride,to0) = x0_real;
-      VECTOR(out,ostride,to0 + 1) = x0_imag;
-      VECTOR(out,ostride,to1) = x1_real;
+          VECTOR(out,ostride,to0) = x0_real;
+          VECTOR(out,ostride,to0 + 1) = x0_imag;
+          VECTOR(out,ostride,to1) = x1_real;
+        }
     }
 
   return;
@@ -34,12 +34,19 @@
 #include <gsl/gsl_fft_real_float.h>
 #include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_fft_halfcomplex_float.h>
+#include <gsl/gsl_fft_plan.h>
+#include <gsl/gsl_fftnd.h>
+#include <gsl/gsl_fft2d.h>
+#include <gsl/gsl_conv.h>
+#include <gsl/gsl_matrix.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+double urand (void);
+
 #include "complex_internal.h"
 
 /* Usage: test [n]
@@ -66,6 +73,10 @@ void my_error_handler (const char *reason, const char *file,
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
+#include "test_plan_source.c"
+#include "test_nd_source.c"
+#include "test_conv_source.c"
+
 int
 main (int argc, char *argv[])
 {
@@ -108,12 +119,90 @@ main (int argc, char *argv[])
           test_complex_float_func (stride, i) ;
           test_real_func (stride, i) ;
           test_real_float_func (stride, i) ;
+          test_plan (stride, i, GSL_FFT_PLAN_DEFAULT) ;
+          test_plan (stride, i, GSL_FFT_PLAN_GENERIC) ;
+        }
+
+      test_complex_batch (i, 3, 0) ;
+      test_complex_batch (i, 3, 1) ;
+      test_complex_float_batch (i, 3, 1) ;
+      test_real_batch (i, 3, 0) ;
+      test_real_batch (i, 3, 1) ;
+      test_real_float_batch (i, 3, 1) ;
+    }
+
+  if (n == 0)
+    {
+      const size_t plan_n[] = { 1000, 1001, 2048, 3072, 4096, 0 };
+
+      for (i = 0 ; plan_n[i] != 0 ; i++)
+        {
+          test_plan (1, plan_n[i], GSL_FFT_PLAN_DEFAULT) ;
+          test_plan (3, plan_n[i], GSL_FFT_PLAN_DEFAULT) ;
+          test_plan (1, plan_n[i], GSL_FFT_PLAN_GENERIC) ;
         }
+
+      test_plan_howmany (24, 5) ;
+      test_plan_howmany (35, 3) ;
+
+      /* lengths with large prime factors, computed by Bluestein's
+         algorithm */
+
+      {
+        const size_t prime_n[] = { 1009, 1965, 0 };
+
+        for (i = 0 ; prime_n[i] != 0 ; i++)
+          {
+            test_complex_func (1, prime_n[i]) ;
+            test_complex_func (2, prime_n[i]) ;
+            test_complex_float_func (1, prime_n[i]) ;
+            test_real_func (1, prime_n[i]) ;
+            test_real_float_func (1, prime_n[i]) ;
+            test_complex_batch (prime_n[i], 2, 1) ;
+            test_real_batch (prime_n[i], 2, 0) ;
+          }
+      }
+
+      {
+        const size_t dims3[3] = { 3, 4, 5 }, dims4[3] = { 2, 7, 6 };
+        const size_t dims1[1] = { 12 };
+
+        test_fftnd (1, dims1) ;
+        test_fftnd (3, dims3) ;
+        test_fftnd (3, dims4) ;
+      }
+
+      test_fft2d (5, 6) ;
+      test_fft2d (8, 12) ;
+      test_fft2d (3, 17) ;
+      test_fft2d (20, 7) ;
+      test_fft2d (31, 37) ;
+      test_fft2d (1, 9) ;
+      test_fft2d (9, 1) ;
+
+      {
+        const size_t conv_m[] = { 1, 5, 40, 300, 0 };
+        const size_t conv_n[] = { 1, 100, 2000, 0 };
+        size_t j ;
+
+        for (i = 0 ; conv_m[i] != 0 ; i++)
+          {
+            for (j = 0 ; conv_n[j] != 0 ; j++)
+              {
+                test_conv (conv_m[i], conv_n[j], 0, GSL_CONV_DIRECT) ;
+                test_conv (conv_m[i], conv_n[j], 0, GSL_CONV_FFT) ;
+                test_conv (conv_m[i], conv_n[j], conv_n[j], GSL_CONV_AUTO) ;
+              }
+          }
+      }
     }
 
   gsl_set_error_handler (&my_error_handler);
   test_trap () ;
   test_float_trap () ;
+  test_plan_trap () ;
+  test_fftnd_trap () ;
+  test_conv_trap () ;
 
   exit (gsl_test_summary ());
 }
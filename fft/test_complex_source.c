@@ -26,6 +26,7 @@ int FUNCTION(test,offset) (const BASE data[], size_t stride,
                            size_t n, size_t offset);
 void FUNCTION(test_complex,bitreverse_order) (size_t stride, size_t n) ;
 void FUNCTION(test_complex,radix2) (size_t stride, size_t n);
+void FUNCTION(test_complex,batch) (size_t n, size_t howmany, int interleaved);
 
 int FUNCTION(test,offset) (const BASE data[], size_t stride, 
                            size_t n, size_t offset)
@@ -446,3 +447,76 @@ void FUNCTION(test_complex,radix2) (size_t stride, size_t n)
   free (fft_complex_tmp);
 }
 
+
+
+/* Test a batch of transforms, either stored one after another
+   (stride = 1, dist = n) or interleaved (stride = howmany, dist = 1).
+   The workspace has room for two transforms, so that odd batches also
+   exercise a final group of one transform, and for the two arrays of
+   length nconv used by a Bluestein transform. */
+
+void FUNCTION(test_complex,batch) (size_t n, size_t howmany, int interleaved)
+{
+  size_t b ;
+  int status = 0 ;
+
+  const size_t stride = interleaved ? howmany : 1 ;
+  const size_t dist = interleaved ? 1 : n ;
+
+  TYPE(gsl_fft_complex_wavetable) * cw ;
+  TYPE(gsl_fft_complex_workspace) * cwork ;
+
+  BASE * complex_data = (BASE *) malloc (2 * n * howmany * sizeof (BASE));
+  BASE * complex_tmp = (BASE *) malloc (2 * n * howmany * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * howmany * sizeof (BASE));
+
+  gsl_set_error_handler (NULL); /* abort on any errors */
+
+  cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (GSL_MAX (2 * n, 2 * cw->nconv));
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      FUNCTION(fft_signal,complex_noise) (n, stride, complex_data + 2 * dist * b,
+                                          fft_complex_data + 2 * dist * b);
+    }
+
+  memcpy (complex_tmp, complex_data, 2 * n * howmany * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,forward_batch) (complex_data, stride, dist, n, 
+                                           howmany, cw, cwork);
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      status |= FUNCTION(compare_complex,results) ("dft", fft_complex_data + 2 * dist * b,
+                                                   "fft of noise", complex_data + 2 * dist * b,
+                                                   stride, n, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft_complex) 
+            "_forward_batch with signal_noise, n = %d, howmany = %d, stride = %d", 
+            n, howmany, stride);
+
+  FUNCTION(gsl_fft_complex,inverse_batch) (complex_data, stride, dist, n, 
+                                           howmany, cw, cwork);
+
+  status = 0 ;
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      status |= FUNCTION(compare_complex,results) ("orig", complex_tmp + 2 * dist * b,
+                                                   "fft inverse", complex_data + 2 * dist * b,
+                                                   stride, n, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft_complex) 
+            "_inverse_batch with signal_noise, n = %d, howmany = %d, stride = %d", 
+            n, howmany, stride);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork);
+
+  free (complex_data);
+  free (complex_tmp);
+  free (fft_complex_data);
+}
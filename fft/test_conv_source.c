@@ -0,0 +1,162 @@
+/* fft/test_conv_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void test_conv (size_t m, size_t n, size_t nhint, gsl_conv_method method);
+void test_conv_trap (void);
+
+static int
+test_conv_compare (const double a[], const double b[], size_t n, double tol)
+{
+  size_t i;
+  int status = 0;
+
+  for (i = 0; i < n; i++)
+    status |= fabs (a[i] - b[i]) > tol;
+
+  return status;
+}
+
+/* compare the full convolution and correlation with direct sums, and
+   the streaming modes with the signal passed in uneven chunks */
+
+void
+test_conv (size_t m, size_t n, size_t nhint, gsl_conv_method method)
+{
+  const size_t ny = n + m - 1;
+  const size_t chunk[] = { 1, 7, 64, 3, 250 };
+  const char *desc[] = { "direct", "fft", "auto" };
+  const char *name = desc[(method == GSL_CONV_DIRECT) ? 0 :
+                          (method == GSL_CONV_FFT) ? 1 : 2];
+  gsl_conv_workspace *w = gsl_conv_alloc (m, nhint);
+  double *h = malloc (m * sizeof (double));
+  double *x = malloc (n * sizeof (double));
+  double *y = malloc (2 * ny * sizeof (double));
+  double *yc = malloc (ny * sizeof (double));
+  double *rc = malloc (ny * sizeof (double));
+  double tol;
+  size_t i, j, k, c;
+  int mode, status;
+
+  for (i = 0; i < m; i++)
+    h[i] = urand () - 0.5;
+
+  for (i = 0; i < n; i++)
+    x[i] = urand () - 0.5;
+
+  for (j = 0; j < ny; j++)
+    {
+      yc[j] = 0.0;
+      rc[j] = 0.0;
+
+      for (k = 0; k < m; k++)
+        {
+          if (j >= k && j - k < n)
+            yc[j] += h[k] * x[j - k];
+
+          if (j + k >= m - 1 && j + k - (m - 1) < n)
+            rc[j] += h[k] * x[j + k - (m - 1)];
+        }
+    }
+
+  tol = 1e-12 * (double) m;
+
+  gsl_conv_set_kernel (h, 1, w);
+  gsl_conv_set_method (method, w);
+
+  gsl_conv (x, 1, n, y, 2, w);
+
+  for (j = 0; j < ny; j++)
+    y[j] = y[2 * j];
+
+  status = test_conv_compare (yc, y, ny, tol);
+  gsl_test (status, "gsl_conv %s, m = %d, n = %d, nhint = %d",
+            name, m, n, nhint);
+
+  gsl_xcorr (x, 1, n, y, 1, w);
+  status = test_conv_compare (rc, y, ny, tol);
+  gsl_test (status, "gsl_xcorr %s, m = %d, n = %d, nhint = %d",
+            name, m, n, nhint);
+
+  for (mode = 0; mode < 4; mode++)
+    {
+      const double *ref = (mode & 2) ? rc : yc;
+
+      /* stream in place, in chunks of varying length */
+
+      memcpy (y, x, n * sizeof (double));
+
+      for (i = 0, c = 0; i < n; i += k, c++)
+        {
+          k = GSL_MIN (chunk[c % 5], n - i);
+
+          switch (mode)
+            {
+            case 0:
+              gsl_conv_overlap_add (y + i, 1, k, y + i, 1, w);
+              break;
+            case 1:
+              gsl_conv_overlap_save (y + i, 1, k, y + i, 1, w);
+              break;
+            case 2:
+              gsl_xcorr_overlap_add (y + i, 1, k, y + i, 1, w);
+              break;
+            case 3:
+              gsl_xcorr_overlap_save (y + i, 1, k, y + i, 1, w);
+              break;
+            }
+        }
+
+      gsl_conv_flush (y + n, 1, w);
+
+      status = test_conv_compare (ref, y, ny, tol);
+      gsl_test (status, "gsl_%s_overlap_%s %s, m = %d, n = %d, nhint = %d",
+                (mode & 2) ? "xcorr" : "conv", (mode & 1) ? "save" : "add",
+                name, m, n, nhint);
+    }
+
+  gsl_conv_free (w);
+  free (h);
+  free (x);
+  free (y);
+  free (yc);
+  free (rc);
+}
+
+void
+test_conv_trap (void)
+{
+  gsl_conv_workspace *w;
+  double x[4] = { 1.0, 2.0, 3.0, 4.0 };
+  double y[4];
+  int status;
+
+  w = gsl_conv_alloc (0, 10);
+  gsl_test (w != 0, "trap for m = 0 in gsl_conv_alloc");
+
+  w = gsl_conv_alloc (3, 10);
+  gsl_conv_set_kernel (x, 1, w);
+  gsl_conv_overlap_add (x, 1, 4, y, 1, w);
+  status = gsl_conv_overlap_save (x, 1, 4, y, 1, w);
+  gsl_test (!status, "trap for changing streaming mode in gsl_conv_overlap_save");
+
+  status = gsl_conv_set_method ((gsl_conv_method) 99, w);
+  gsl_test (!status, "trap for unknown method in gsl_conv_set_method");
+
+  gsl_conv_free (w);
+}
@@ -0,0 +1,255 @@
+/* fft/test_nd_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void test_nd_dft (size_t rank, const size_t dims[], const double in[],
+                  double out[], double sign);
+void test_fftnd (size_t rank, const size_t dims[]);
+void test_fft2d (size_t size1, size_t size2);
+void test_fftnd_trap (void);
+
+/* direct multidimensional DFT of the packed complex array in */
+
+void
+test_nd_dft (size_t rank, const size_t dims[], const double in[],
+             double out[], double sign)
+{
+  size_t ntotal = 1, a, b, d;
+
+  for (d = 0; d < rank; d++)
+    ntotal *= dims[d];
+
+  for (a = 0; a < ntotal; a++)
+    {
+      double sum_re = 0, sum_im = 0;
+
+      for (b = 0; b < ntotal; b++)
+        {
+          size_t ia = a, ib = b;
+          double theta = 0;
+
+          for (d = rank; d-- > 0;)
+            {
+              theta += (double) ((ia % dims[d]) * (ib % dims[d]) % dims[d])
+                / (double) dims[d];
+              ia /= dims[d];
+              ib /= dims[d];
+            }
+
+          theta *= sign * 2.0 * M_PI;
+          sum_re += in[2 * b] * cos (theta) - in[2 * b + 1] * sin (theta);
+          sum_im += in[2 * b] * sin (theta) + in[2 * b + 1] * cos (theta);
+        }
+
+      out[2 * a] = sum_re;
+      out[2 * a + 1] = sum_im;
+    }
+}
+
+void
+test_fftnd (size_t rank, const size_t dims[])
+{
+  size_t ntotal = 1, nhalf, d, i, r;
+  int status;
+  gsl_fftnd_workspace *w = gsl_fftnd_workspace_alloc (rank, dims);
+  const size_t n = dims[rank - 1], h = n / 2 + 1;
+  double *data, *orig, *dft, *half, *real;
+
+  for (d = 0; d < rank; d++)
+    ntotal *= dims[d];
+
+  nhalf = ntotal / n * h;
+
+  data = malloc (2 * ntotal * sizeof (double));
+  orig = malloc (2 * ntotal * sizeof (double));
+  dft = malloc (2 * ntotal * sizeof (double));
+  half = malloc (2 * nhalf * sizeof (double));
+  real = malloc (ntotal * sizeof (double));
+
+  for (i = 0; i < 2 * ntotal; i++)
+    data[i] = urand () - 0.5;
+
+  memcpy (orig, data, 2 * ntotal * sizeof (double));
+
+  test_nd_dft (rank, dims, data, dft, -1.0);
+  gsl_fftnd_complex_forward (data, w);
+  status = compare_complex_results ("dft", dft, "fftnd", data, 1, ntotal, 1e6);
+  gsl_test (status, "gsl_fftnd_complex_forward, rank = %d, n = %d", rank, ntotal);
+
+  gsl_fftnd_complex_inverse (data, w);
+  status = compare_complex_results ("orig", orig, "fftnd inverse", data, 1,
+                                    ntotal, 1e6);
+  gsl_test (status, "gsl_fftnd_complex_inverse, rank = %d, n = %d", rank, ntotal);
+
+  /* real input, compared with the first h columns of the complex
+     transform */
+
+  for (i = 0; i < ntotal; i++)
+    {
+      real[i] = orig[2 * i];
+      data[2 * i] = orig[2 * i];
+      data[2 * i + 1] = 0.0;
+    }
+
+  test_nd_dft (rank, dims, data, dft, -1.0);
+  gsl_fftnd_real_transform (real, half, w);
+
+  status = 0;
+  for (r = 0; r < ntotal / n; r++)
+    status |= compare_complex_results ("dft", dft + 2 * n * r, "fftnd real",
+                                       half + 2 * h * r, 1, h, 1e6);
+  gsl_test (status, "gsl_fftnd_real_transform, rank = %d, n = %d", rank, ntotal);
+
+  gsl_fftnd_halfcomplex_inverse (half, real, w);
+
+  status = 0;
+  for (i = 0; i < ntotal; i++)
+    status |= fabs (real[i] - orig[2 * i]) > 1e-10;
+  gsl_test (status, "gsl_fftnd_halfcomplex_inverse, rank = %d, n = %d",
+            rank, ntotal);
+
+  gsl_fftnd_workspace_free (w);
+  free (data);
+  free (orig);
+  free (dft);
+  free (half);
+  free (real);
+}
+
+/* test the matrix interface with rows padded to tda = size2 + 3 */
+
+void
+test_fft2d (size_t size1, size_t size2)
+{
+  const size_t h = size2 / 2 + 1;
+  const size_t dims[2] = { size1, size2 };
+  size_t i, j;
+  int status;
+  gsl_fft2d_workspace *w = gsl_fft2d_workspace_alloc (size1, size2);
+  gsl_matrix_complex *mbig = gsl_matrix_complex_alloc (size1, size2 + 3);
+  gsl_matrix_complex *hbig = gsl_matrix_complex_alloc (size1, h + 3);
+  gsl_matrix *abig = gsl_matrix_alloc (size1, size2 + 3);
+  gsl_matrix_complex_view m = gsl_matrix_complex_submatrix (mbig, 0, 0, size1, size2);
+  gsl_matrix_complex_view hm = gsl_matrix_complex_submatrix (hbig, 0, 0, size1, h);
+  gsl_matrix_view a = gsl_matrix_submatrix (abig, 0, 0, size1, size2);
+  double *in = malloc (2 * size1 * size2 * sizeof (double));
+  double *dft = malloc (2 * size1 * size2 * sizeof (double));
+
+  for (i = 0; i < size1; i++)
+    {
+      for (j = 0; j < size2 + 3; j++)
+        {
+          const double x = urand () - 0.5, y = urand () - 0.5;
+
+          GSL_REAL (*gsl_matrix_complex_ptr (mbig, i, j)) = x;
+          GSL_IMAG (*gsl_matrix_complex_ptr (mbig, i, j)) = y;
+          gsl_matrix_set (abig, i, j, x);
+
+          if (j < size2)
+            {
+              in[2 * (i * size2 + j)] = x;
+              in[2 * (i * size2 + j) + 1] = y;
+            }
+        }
+    }
+
+  test_nd_dft (2, dims, in, dft, -1.0);
+  gsl_fft2d_complex_forward (&m.matrix, w);
+
+  status = 0;
+  for (i = 0; i < size1; i++)
+    status |= compare_complex_results ("dft", dft + 2 * size2 * i, "fft2d",
+                                       (double *) gsl_matrix_complex_ptr (mbig, i, 0),
+                                       1, size2, 1e6);
+  gsl_test (status, "gsl_fft2d_complex_forward, size1 = %d, size2 = %d",
+            size1, size2);
+
+  gsl_fft2d_complex_inverse (&m.matrix, w);
+
+  status = 0;
+  for (i = 0; i < size1; i++)
+    status |= compare_complex_results ("orig", in + 2 * size2 * i,
+                                       "fft2d inverse",
+                                       (double *) gsl_matrix_complex_ptr (mbig, i, 0),
+                                       1, size2, 1e6);
+  gsl_test (status, "gsl_fft2d_complex_inverse, size1 = %d, size2 = %d",
+            size1, size2);
+
+  /* the padding columns must be untouched */
+
+  status = 0;
+  for (i = 0; i < size1; i++)
+    for (j = size2; j < size2 + 3; j++)
+      status |= GSL_REAL (gsl_matrix_complex_get (mbig, i, j)) != gsl_matrix_get (abig, i, j);
+  gsl_test (status, "gsl_fft2d_complex avoids padding, size1 = %d, size2 = %d",
+            size1, size2);
+
+  for (i = 0; i < size1 * size2; i++)
+    in[2 * i + 1] = 0.0;
+
+  test_nd_dft (2, dims, in, dft, -1.0);
+  gsl_fft2d_real_transform (&a.matrix, &hm.matrix, w);
+
+  status = 0;
+  for (i = 0; i < size1; i++)
+    status |= compare_complex_results ("dft", dft + 2 * size2 * i, "fft2d real",
+                                       (double *) gsl_matrix_complex_ptr (hbig, i, 0),
+                                       1, h, 1e6);
+  gsl_test (status, "gsl_fft2d_real_transform, size1 = %d, size2 = %d",
+            size1, size2);
+
+  gsl_matrix_set_zero (&a.matrix);
+  gsl_fft2d_halfcomplex_inverse (&hm.matrix, &a.matrix, w);
+
+  status = 0;
+  for (i = 0; i < size1; i++)
+    for (j = 0; j < size2; j++)
+      status |= fabs (gsl_matrix_get (abig, i, j) - in[2 * (i * size2 + j)]) > 1e-10;
+  gsl_test (status, "gsl_fft2d_halfcomplex_inverse, size1 = %d, size2 = %d",
+            size1, size2);
+
+  gsl_fft2d_workspace_free (w);
+  gsl_matrix_complex_free (mbig);
+  gsl_matrix_complex_free (hbig);
+  gsl_matrix_free (abig);
+  free (in);
+  free (dft);
+}
+
+void
+test_fftnd_trap (void)
+{
+  const size_t dims[3] = { 4, 0, 5 };
+  gsl_fftnd_workspace *w;
+  gsl_matrix_complex *m;
+  int status;
+
+  w = gsl_fftnd_workspace_alloc (0, dims);
+  gsl_test (w != 0, "trap for rank = 0 in gsl_fftnd_workspace_alloc");
+
+  w = gsl_fftnd_workspace_alloc (3, dims);
+  gsl_test (w != 0, "trap for zero dimension in gsl_fftnd_workspace_alloc");
+
+  w = gsl_fft2d_workspace_alloc (4, 5);
+  m = gsl_matrix_complex_alloc (5, 4);
+  status = gsl_fft2d_complex_forward (m, w);
+  gsl_test (!status, "trap for matrix size in gsl_fft2d_complex_forward");
+
+  gsl_matrix_complex_free (m);
+  gsl_fft2d_workspace_free (w);
+}
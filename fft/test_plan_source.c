@@ -0,0 +1,137 @@
+/* fft/test_plan_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void test_plan (size_t stride, size_t n, unsigned int flags);
+void test_plan_howmany (size_t n, size_t howmany);
+void test_plan_trap (void);
+
+void
+test_plan (size_t stride, size_t n, unsigned int flags)
+{
+  size_t i;
+  int status;
+  gsl_fft_plan *fwd, *inv;
+
+  double *data = malloc (2 * n * stride * sizeof (double));
+  double *orig = malloc (2 * n * stride * sizeof (double));
+  double *fft_data = malloc (2 * n * stride * sizeof (double));
+
+  for (i = 0; i < 2 * n * stride; i++)
+    {
+      data[i] = (double) i;
+      fft_data[i] = (double) (i + 2000.0);
+    }
+
+  fwd = gsl_fft_plan_alloc (n, stride, 1, gsl_fft_forward, flags);
+  inv = gsl_fft_plan_alloc (n, stride, 1, gsl_fft_backward,
+                            flags | GSL_FFT_PLAN_NORMALIZE);
+  gsl_test (fwd == 0 || inv == 0,
+            "gsl_fft_plan_alloc, n = %d, stride = %d, flags = %u", n, stride, flags);
+
+  fft_signal_complex_noise (n, stride, data, fft_data);
+  memcpy (orig, data, 2 * n * stride * sizeof (double));
+
+  gsl_fft_plan_execute (fwd, data);
+  status = compare_complex_results ("dft", fft_data, "plan fft of noise", data,
+                                    stride, n, 1e6);
+  gsl_test (status, "gsl_fft_plan forward with signal_noise, n = %d, stride = %d",
+            n, stride);
+
+  if (stride > 1)
+    {
+      status = test_offset (data, stride, n, 0);
+      gsl_test (status, "gsl_fft_plan forward avoids unstrided data, "
+                "n = %d, stride = %d, flags = %u", n, stride, flags);
+    }
+
+  gsl_fft_plan_execute (inv, data);
+  status = compare_complex_results ("orig", orig, "plan inverse", data,
+                                    stride, n, 1e6);
+  gsl_test (status, "gsl_fft_plan normalized backward with signal_noise, "
+            "n = %d, stride = %d, flags = %u", n, stride, flags);
+
+  gsl_fft_plan_free (fwd);
+  gsl_fft_plan_free (inv);
+
+  /* a backward plan without normalization gives n times the input,
+     so the absolute error also grows with n */
+
+  inv = gsl_fft_plan_alloc (n, stride, 1, gsl_fft_backward, flags);
+  memcpy (data, fft_data, 2 * n * stride * sizeof (double));
+  gsl_fft_plan_execute (inv, data);
+
+  for (i = 0; i < n; i++)
+    {
+      REAL (orig, stride, i) *= n;
+      IMAG (orig, stride, i) *= n;
+    }
+
+  status = compare_complex_results ("orig", orig, "plan backward", data,
+                                    stride, n, 1e6 * GSL_MAX (1.0, n / 100.0));
+  gsl_test (status, "gsl_fft_plan backward with signal_noise, n = %d, stride = %d",
+            n, stride);
+
+  gsl_fft_plan_free (inv);
+
+  free (data);
+  free (orig);
+  free (fft_data);
+}
+
+void
+test_plan_howmany (size_t n, size_t howmany)
+{
+  size_t b;
+  int status = 0;
+  gsl_fft_plan *plan = gsl_fft_plan_alloc (n, 1, howmany, gsl_fft_forward,
+                                           GSL_FFT_PLAN_DEFAULT);
+  double *data = malloc (2 * n * howmany * sizeof (double));
+  double *fft_data = malloc (2 * n * howmany * sizeof (double));
+
+  for (b = 0; b < howmany; b++)
+    fft_signal_complex_noise (n, 1, data + 2 * n * b, fft_data + 2 * n * b);
+
+  gsl_fft_plan_execute (plan, data);
+
+  for (b = 0; b < howmany; b++)
+    status |= compare_complex_results ("dft", fft_data + 2 * n * b,
+                                       "plan fft", data + 2 * n * b,
+                                       1, n, 1e6);
+
+  gsl_test (status, "gsl_fft_plan forward, n = %d, howmany = %d", n, howmany);
+
+  gsl_fft_plan_free (plan);
+  free (data);
+  free (fft_data);
+}
+
+void
+test_plan_trap (void)
+{
+  gsl_fft_plan *plan;
+
+  plan = gsl_fft_plan_alloc (0, 1, 1, gsl_fft_forward, GSL_FFT_PLAN_DEFAULT);
+  gsl_test (plan != 0, "trap for n = 0 in gsl_fft_plan_alloc");
+
+  plan = gsl_fft_plan_alloc (10, 0, 1, gsl_fft_forward, GSL_FFT_PLAN_DEFAULT);
+  gsl_test (plan != 0, "trap for stride = 0 in gsl_fft_plan_alloc");
+
+  plan = gsl_fft_plan_alloc (10, 1, 1, gsl_fft_forward, 0x100);
+  gsl_test (plan != 0, "trap for invalid flags in gsl_fft_plan_alloc");
+}
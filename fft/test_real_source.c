@@ -24,6 +24,7 @@
 void FUNCTION(test_real,func) (size_t stride, size_t n);
 void FUNCTION(test_real,bitreverse_order) (size_t stride, size_t n);
 void FUNCTION(test_real,radix2) (size_t stride, size_t n);
+void FUNCTION(test_real,batch) (size_t n, size_t howmany, int interleaved);
 
 void FUNCTION(test_real,func) (size_t stride, size_t n) 
 {
@@ -233,3 +234,85 @@ void FUNCTION(test_real,radix2) (size_t stride, size_t n)
   free(complex_tmp) ;
   free(fft_complex_data) ;
 }
+
+
+/* Test a batch of real transforms and their halfcomplex inverses, with
+   the same layouts as test_complex_batch */
+
+void FUNCTION(test_real,batch) (size_t n, size_t howmany, int interleaved)
+{
+  size_t b, i ;
+  int status = 0 ;
+
+  const size_t stride = interleaved ? howmany : 1 ;
+  const size_t dist = interleaved ? 1 : n ;
+
+  TYPE(gsl_fft_real_wavetable) * rw ;
+  TYPE(gsl_fft_halfcomplex_wavetable) * hcw ;
+  TYPE(gsl_fft_real_workspace) * rwork ;
+
+  BASE * real_data = (BASE *) malloc (n * howmany * sizeof (BASE));
+  BASE * real_tmp = (BASE *) malloc (n * howmany * sizeof (BASE));
+  BASE * complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * stride * howmany * sizeof (BASE));
+
+  gsl_set_error_handler (NULL); /* abort on any errors */
+
+  rw = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+  hcw = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+  rwork = FUNCTION(gsl_fft_real_workspace,alloc) (GSL_MAX (2 * n, 4 * rw->nconv));
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      FUNCTION(fft_signal,real_noise) (n, stride, complex_data,
+                                       fft_complex_data + 2 * n * stride * b);
+
+      for (i = 0; i < n; i++)
+        {
+          real_data[dist * b + stride * i] = REAL(complex_data,stride,i);
+        }
+    }
+
+  memcpy (real_tmp, real_data, n * howmany * sizeof (BASE));
+
+  FUNCTION(gsl_fft_real,transform_batch) (real_data, stride, dist, n, howmany,
+                                          rw, rwork);
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      FUNCTION(gsl_fft_halfcomplex,unpack) (real_data + dist * b, complex_data, 
+                                            stride, n);
+      status |= FUNCTION(compare_complex,results) ("dft", fft_complex_data + 2 * n * stride * b,
+                                                   "fft of noise", complex_data,
+                                                   stride, n, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft_real) 
+            "_transform_batch with signal_real_noise, n = %d, howmany = %d, stride = %d",
+            n, howmany, stride);
+
+  FUNCTION(gsl_fft_halfcomplex,inverse_batch) (real_data, stride, dist, n, 
+                                               howmany, hcw, rwork);
+
+  status = 0 ;
+
+  for (b = 0 ; b < howmany ; b++)
+    {
+      status |= FUNCTION(compare_real,results) ("orig", real_tmp + dist * b,
+                                                "fft inverse", real_data + dist * b,
+                                                stride, n, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft_halfcomplex) 
+            "_inverse_batch with signal_real_noise, n = %d, howmany = %d, stride = %d",
+            n, howmany, stride);
+
+  FUNCTION(gsl_fft_real_workspace,free) (rwork);
+  FUNCTION(gsl_fft_real_wavetable,free) (rw);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hcw);
+
+  free (real_data);
+  free (real_tmp);
+  free (complex_data);
+  free (fft_complex_data);
+}
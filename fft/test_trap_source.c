@@ -124,6 +124,33 @@ FUNCTION(test,trap) (void)
   status = FUNCTION(gsl_fft_halfcomplex,transform) (real_data, 1, 4, hcw, rwork);
   gsl_test (!status, "trap for n != nw in " NAME(gsl_fft_halfcomplex) "_transform");
 
+  /* workspace smaller than n in batch routines */
+
+  cw->n = 20;
+  status = FUNCTION(gsl_fft_complex,forward_batch) (complex_data, 1, 20, 20, 1, cw, cwork);
+  gsl_test (!status, "trap for nwork < n in " NAME(gsl_fft_complex) "_forward_batch");
+
+  rw->n = 20;
+  status = FUNCTION(gsl_fft_real,transform_batch) (real_data, 1, 20, 20, 1, rw, rwork);
+  gsl_test (!status, "trap for nwork < n in " NAME(gsl_fft_real) "_transform_batch");
+
+  hcw->n = 20;
+  status = FUNCTION(gsl_fft_halfcomplex,transform_batch) (real_data, 1, 20, 20, 1, hcw, rwork);
+  gsl_test (!status, "trap for nwork < n in " NAME(gsl_fft_halfcomplex) "_transform_batch");
+
+  /* workspace too small for a Bluestein transform in batch routines */
+
+  {
+    TYPE(gsl_fft_complex_wavetable) * bw = FUNCTION(gsl_fft_complex_wavetable,alloc) (31);
+    TYPE(gsl_fft_complex_workspace) * bwork = FUNCTION(gsl_fft_complex_workspace,alloc) (32);
+
+    status = FUNCTION(gsl_fft_complex,forward_batch) (complex_data, 1, 31, 31, 1, bw, bwork);
+    gsl_test (!status, "trap for nwork < 2 nconv in " NAME(gsl_fft_complex) "_forward_batch");
+
+    FUNCTION (gsl_fft_complex_workspace,free) (bwork) ;
+    FUNCTION (gsl_fft_complex_wavetable,free) (bw) ;
+  }
+
   FUNCTION (gsl_fft_halfcomplex_wavetable,free) (hcw) ;
   FUNCTION (gsl_fft_real_wavetable,free) (rw) ;
   FUNCTION (gsl_fft_complex_wavetable,free) (cw) ;
@@ -49,6 +49,10 @@ static int gaussian_delete(void * vstate);
 static int gaussian_get(void * params, gaussian_type_t * result, const void * vstate);
 
 static const gsl_movstat_accum gaussian_accum_type;
+static int gaussian_conv(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+                         gsl_conv_workspace * w);
+static int gaussian_conv_stream(const double * x, const size_t stride, const size_t n, size_t * skip,
+                                gsl_vector * y, size_t * pos, gsl_conv_workspace * w);
 
 /*
 gsl_filter_gaussian_alloc()
@@ -92,6 +96,13 @@ gsl_filter_gaussian_alloc(const size_t K)
       GSL_ERROR_NULL ("failed to allocate space for movstat workspace", GSL_ENOMEM);
     }
 
+  w->conv_workspace_p = gsl_conv_alloc(w->K, 0);
+  if (!w->conv_workspace_p)
+    {
+      gsl_filter_gaussian_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for convolution workspace", GSL_ENOMEM);
+    }
+
   return w;
 }
 
@@ -104,6 +115,9 @@ gsl_filter_gaussian_free(gsl_filter_gaussian_workspace * w)
   if (w->movstat_workspace_p)
     gsl_movstat_free(w->movstat_workspace_p);
 
+  if (w->conv_workspace_p)
+    gsl_conv_free(w->conv_workspace_p);
+
   free(w);
 }
 
@@ -143,8 +157,20 @@ gsl_filter_gaussian(const gsl_filter_end_t endtype, const double alpha, const si
       /* construct Gaussian kernel of length K */
       gsl_filter_gaussian_kernel(alpha, order, 1, &kernel.vector);
 
-      status = gsl_movstat_apply_accum(endtype, x, &gaussian_accum_type, (void *) w->kernel, y,
-                                       NULL, w->movstat_workspace_p);
+      if (endtype != GSL_FILTER_END_TRUNCATE && w->conv_workspace_p->method == GSL_CONV_FFT)
+        {
+          /* wide kernel: FFT convolution of the padded signal */
+          status = gsl_conv_set_kernel(w->kernel, 1, w->conv_workspace_p);
+          if (status)
+            return status;
+
+          status = gaussian_conv(endtype, x, y, w->conv_workspace_p);
+        }
+      else
+        {
+          status = gsl_movstat_apply_accum(endtype, x, &gaussian_accum_type, (void *) w->kernel, y,
+                                           NULL, w->movstat_workspace_p);
+        }
 
       return status;
     }
@@ -268,6 +294,74 @@ gsl_filter_gaussian_kernel(const double alpha, const size_t order, const int nor
     }
 }
 
+/*
+gaussian_conv()
+  Apply the kernel to x padded with H = (K-1)/2 values at each end,
+by streaming the padded signal through an FFT convolution
+
+Inputs: endtype - GSL_FILTER_END_PADZERO or GSL_FILTER_END_PADVALUE
+        x       - input vector, size n
+        y       - (output) filtered vector, size n, may be x
+        w       - convolution workspace, with kernel set
+
+Notes:
+1) The output y_i = sum_k kernel_k xpad_{i+2H-k} of the convolution of the
+padded signal is delayed by 2H samples, so the first 2H outputs are
+discarded
+*/
+
+static int
+gaussian_conv(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+              gsl_conv_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t H = (w->m - 1) / 2;
+  const double xleft = (endtype == GSL_FILTER_END_PADZERO) ? 0.0 : gsl_vector_get(x, 0);
+  const double xright = (endtype == GSL_FILTER_END_PADZERO) ? 0.0 : gsl_vector_get(x, n - 1);
+  size_t skip = 2 * H;
+  size_t pos = 0;
+  int status;
+
+  gsl_conv_reset(w);
+
+  /* the padding is passed with stride 0 */
+  status = gaussian_conv_stream(&xleft, 0, H, &skip, y, &pos, w);
+  if (status)
+    return status;
+
+  status = gaussian_conv_stream(x->data, x->stride, n, &skip, y, &pos, w);
+  if (status)
+    return status;
+
+  status = gaussian_conv_stream(&xright, 0, H, &skip, y, &pos, w);
+
+  gsl_conv_reset(w);
+
+  return status;
+}
+
+/* pass n samples through the convolution, discarding the first *skip outputs
+ * and storing the rest in y starting at *pos */
+static int
+gaussian_conv_stream(const double * x, const size_t stride, const size_t n, size_t * skip,
+                     gsl_vector * y, size_t * pos, gsl_conv_workspace * w)
+{
+  const size_t nskip = GSL_MIN(*skip, n);
+  int status;
+
+  status = gsl_conv_overlap_save(x, stride, nskip, NULL, 0, w);
+  if (status)
+    return status;
+
+  *skip -= nskip;
+
+  status = gsl_conv_overlap_save(x + nskip * stride, stride, n - nskip,
+                                 y->data + *pos * y->stride, y->stride, w);
+  *pos += n - nskip;
+
+  return status;
+}
+
 static size_t
 gaussian_size(const size_t n)
 {
@@ -23,6 +23,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_movstat.h>
+#include <gsl/gsl_conv.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -59,6 +60,7 @@ typedef struct
   size_t K;        /* window size */
   double *kernel;  /* Gaussian kernel, size K */
   gsl_movstat_workspace *movstat_workspace_p;
+  gsl_conv_workspace *conv_workspace_p; /* FFT convolution for wide kernels */
 } gsl_filter_gaussian_workspace;
 
 gsl_filter_gaussian_workspace *gsl_filter_gaussian_alloc(const size_t K);
@@ -212,4 +212,19 @@ test_gaussian(gsl_rng * r)
       test_gaussian_proc(tol, 1.0, order, 50, 101, GSL_FILTER_END_TRUNCATE, r);
       test_gaussian_proc(tol, 2.0, order, 50, 11, GSL_FILTER_END_TRUNCATE, r);
     }
+
+  /* wide kernels, which use FFT convolution; a separate generator keeps
+   * the random sequence of the other tests unchanged */
+  {
+    gsl_rng * r2 = gsl_rng_alloc(gsl_rng_default);
+
+    for (order = 0; order <= 3; ++order)
+      {
+        test_gaussian_proc(tol, 3.0, order, 2000, 301, GSL_FILTER_END_PADZERO, r2);
+        test_gaussian_proc(tol, 3.0, order, 2000, 301, GSL_FILTER_END_PADVALUE, r2);
+        test_gaussian_proc(tol, 1.5, order, 120, 401, GSL_FILTER_END_PADVALUE, r2);
+      }
+
+    gsl_rng_free(r2);
+  }
 }
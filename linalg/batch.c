@@ -0,0 +1,368 @@
+/* linalg/batch.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batched factorizations of many small matrices of the same order N.
+ * The matrices are stored interleaved, element (i,j) of matrix b being
+ *
+ *   A[(i*N + j)*nbatch + b]
+ *
+ * so that the same element of consecutive matrices is contiguous in
+ * memory.  Each operation is applied to groups of BATCH_LANES matrices
+ * at a time, with the innermost loops running across the group, which
+ * lets the compiler use SIMD instructions over independent matrices.
+ * For orders up to BATCH_MAX the kernels are compiled separately for
+ * each order, with the loop bounds known at compile time.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+
+#include "thread.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define BATCH_LANES 8
+#define BATCH_MAX   16
+
+#define BATCH_CONCAT2(a,b) a ## _ ## b
+#define BATCH_CONCAT(a,b) BATCH_CONCAT2(a,b)
+
+/* generic kernels */
+#include "batch_source.c"
+
+#define BATCH_N 2
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 3
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 4
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 5
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 6
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 7
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 8
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 9
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 10
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 11
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 12
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 13
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 14
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 15
+#include "batch_source.c"
+#undef BATCH_N
+#define BATCH_N 16
+#include "batch_source.c"
+#undef BATCH_N
+
+typedef void (*cholesky_decomp_kernel) (const size_t N, double * T, int * fail);
+typedef void (*LU_decomp_kernel) (const size_t N, double * T, size_t * P);
+typedef void (*cholesky_svx_kernel) (const size_t N, const size_t s, const size_t nl,
+                                     const double * LLT, double * x);
+typedef void (*LU_svx_kernel) (const size_t N, const size_t s, const size_t nl,
+                               const double * LU, const size_t * ipiv, double * x);
+
+#define BATCH_KERNELS(name) \
+  { BATCH_CONCAT(name, n), BATCH_CONCAT(name, n), BATCH_CONCAT(name, 2), \
+    BATCH_CONCAT(name, 3), BATCH_CONCAT(name, 4), BATCH_CONCAT(name, 5), \
+    BATCH_CONCAT(name, 6), BATCH_CONCAT(name, 7), BATCH_CONCAT(name, 8), \
+    BATCH_CONCAT(name, 9), BATCH_CONCAT(name, 10), BATCH_CONCAT(name, 11), \
+    BATCH_CONCAT(name, 12), BATCH_CONCAT(name, 13), BATCH_CONCAT(name, 14), \
+    BATCH_CONCAT(name, 15), BATCH_CONCAT(name, 16) }
+
+static const cholesky_decomp_kernel cholesky_decomp_kernels[BATCH_MAX + 1] =
+  BATCH_KERNELS (cholesky_decomp);
+static const LU_decomp_kernel LU_decomp_kernels[BATCH_MAX + 1] =
+  BATCH_KERNELS (LU_decomp);
+static const cholesky_svx_kernel cholesky_svx_kernels[BATCH_MAX + 1] =
+  BATCH_KERNELS (cholesky_svx);
+static const LU_svx_kernel LU_svx_kernels[BATCH_MAX + 1] =
+  BATCH_KERNELS (LU_svx);
+
+#define BATCH_KERNEL(table, N) ((N) <= BATCH_MAX ? (table)[N] : (table)[0])
+
+/* copy matrices b0,...,b0+nl-1 into the tile T, padding the unused
+   lanes with the identity matrix; only the lower triangle is copied
+   when lower is set */
+static void
+batch_gather (const size_t N, const size_t nbatch, const size_t b0, const size_t nl,
+              const int lower, const double * A, double * T)
+{
+  size_t i, j, l;
+
+  for (i = 0; i < N; ++i)
+    {
+      const size_t jmax = lower ? i + 1 : N;
+
+      for (j = 0; j < jmax; ++j)
+        {
+          const double * a = A + (i * N + j) * nbatch + b0;
+          double * t = T + (i * N + j) * BATCH_LANES;
+
+          for (l = 0; l < nl; ++l)
+            t[l] = a[l];
+
+          for (; l < BATCH_LANES; ++l)
+            t[l] = (i == j) ? 1.0 : 0.0;
+        }
+    }
+}
+
+/* copy the first nl matrices of the tile T back to A */
+static void
+batch_scatter (const size_t N, const size_t nbatch, const size_t b0, const size_t nl,
+               const int lower, const double * T, double * A)
+{
+  size_t i, j, l;
+
+  for (i = 0; i < N; ++i)
+    {
+      const size_t jmax = lower ? i + 1 : N;
+
+      for (j = 0; j < jmax; ++j)
+        {
+          const double * t = T + (i * N + j) * BATCH_LANES;
+          double * a = A + (i * N + j) * nbatch + b0;
+
+          for (l = 0; l < nl; ++l)
+            a[l] = t[l];
+        }
+    }
+}
+
+int
+gsl_linalg_cholesky_decomp_batch (const size_t N, const size_t nbatch, double * A, int * info)
+{
+  if (N == 0 || nbatch == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const cholesky_decomp_kernel kernel = BATCH_KERNEL (cholesky_decomp_kernels, N);
+      const long ngroups = (long) ((nbatch + BATCH_LANES - 1) / BATCH_LANES);
+#ifdef _OPENMP
+      const int nthreads = linalg_thread_count (nbatch);
+#else
+      const int nthreads = 1;
+#endif
+      const size_t tsize = N * N * BATCH_LANES;
+      double * work = malloc (nthreads * tsize * sizeof (double));
+      size_t nfail = 0;
+      long g;
+
+      if (work == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static) reduction(+:nfail)
+#endif
+      for (g = 0; g < ngroups; ++g)
+        {
+          const size_t b0 = (size_t) g * BATCH_LANES;
+          const size_t nl = GSL_MIN (BATCH_LANES, nbatch - b0);
+          int fail[BATCH_LANES];
+          double * T = work;
+          size_t l;
+
+#ifdef _OPENMP
+          T += omp_get_thread_num () * tsize;
+#endif
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            fail[l] = 0;
+
+          batch_gather (N, nbatch, b0, nl, 1, A, T);
+          kernel (N, T, fail);
+          batch_scatter (N, nbatch, b0, nl, 1, T, A);
+
+          for (l = 0; l < nl; ++l)
+            {
+              if (info != NULL)
+                info[b0 + l] = fail[l] ? GSL_EDOM : GSL_SUCCESS;
+
+              nfail += (fail[l] != 0);
+            }
+        }
+
+      free (work);
+
+      if (nfail == 0)
+        return GSL_SUCCESS;
+
+      /* the failures are reported in info[], so the error handler is
+         only called when there is no other way to report them */
+      if (info != NULL)
+        return GSL_EDOM;
+
+      GSL_ERROR ("matrix is not positive definite", GSL_EDOM);
+    }
+}
+
+int
+gsl_linalg_cholesky_svx_batch (const size_t N, const size_t nbatch, const double * LLT, double * x)
+{
+  const cholesky_svx_kernel kernel = BATCH_KERNEL (cholesky_svx_kernels, N);
+  const long ngroups = (long) ((nbatch + BATCH_LANES - 1) / BATCH_LANES);
+#ifdef _OPENMP
+  const int nthreads = linalg_thread_count (nbatch);
+#endif
+  long g;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (g = 0; g < ngroups; ++g)
+    {
+      const size_t b0 = (size_t) g * BATCH_LANES;
+      const size_t nl = GSL_MIN (BATCH_LANES, nbatch - b0);
+
+      kernel (N, nbatch, nl, LLT + b0, x + b0);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_linalg_LU_decomp_batch (const size_t N, const size_t nbatch, double * A, size_t * ipiv)
+{
+  if (N == 0 || nbatch == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const LU_decomp_kernel kernel = BATCH_KERNEL (LU_decomp_kernels, N);
+      const long ngroups = (long) ((nbatch + BATCH_LANES - 1) / BATCH_LANES);
+#ifdef _OPENMP
+      const int nthreads = linalg_thread_count (nbatch);
+#else
+      const int nthreads = 1;
+#endif
+      const size_t tsize = N * N * BATCH_LANES;
+      double * work = malloc (nthreads * tsize * sizeof (double));
+      size_t * pwork = malloc (nthreads * N * BATCH_LANES * sizeof (size_t));
+      long g;
+
+      if (work == NULL || pwork == NULL)
+        {
+          free (work);
+          free (pwork);
+          GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+      for (g = 0; g < ngroups; ++g)
+        {
+          const size_t b0 = (size_t) g * BATCH_LANES;
+          const size_t nl = GSL_MIN (BATCH_LANES, nbatch - b0);
+          double * T = work;
+          size_t * P = pwork;
+          size_t k, l;
+
+#ifdef _OPENMP
+          T += omp_get_thread_num () * tsize;
+          P += omp_get_thread_num () * N * BATCH_LANES;
+#endif
+
+          batch_gather (N, nbatch, b0, nl, 0, A, T);
+          kernel (N, T, P);
+          batch_scatter (N, nbatch, b0, nl, 0, T, A);
+
+          for (k = 0; k < N; ++k)
+            {
+              for (l = 0; l < nl; ++l)
+                ipiv[k * nbatch + b0 + l] = P[k * BATCH_LANES + l];
+            }
+        }
+
+      free (work);
+      free (pwork);
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_linalg_LU_svx_batch (const size_t N, const size_t nbatch, const double * LU,
+                         const size_t * ipiv, double * x)
+{
+  const LU_svx_kernel kernel = BATCH_KERNEL (LU_svx_kernels, N);
+  const long ngroups = (long) ((nbatch + BATCH_LANES - 1) / BATCH_LANES);
+#ifdef _OPENMP
+  const int nthreads = linalg_thread_count (nbatch);
+#endif
+  size_t nsingular = 0;
+  long g;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static) reduction(+:nsingular)
+#endif
+  for (g = 0; g < ngroups; ++g)
+    {
+      const size_t b0 = (size_t) g * BATCH_LANES;
+      const size_t nl = GSL_MIN (BATCH_LANES, nbatch - b0);
+      size_t i, l;
+
+      kernel (N, nbatch, nl, LU + b0, ipiv + b0, x + b0);
+
+      for (i = 0; i < N; ++i)
+        {
+          const double * uii = LU + (i * N + i) * nbatch + b0;
+
+          for (l = 0; l < nl; ++l)
+            nsingular += (uii[l] == 0.0);
+        }
+    }
+
+  /* the other systems are solved, so a singular matrix is reported
+     in the return value without calling the error handler */
+  return (nsingular > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
@@ -0,0 +1,348 @@
+/* linalg/batch_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Kernels for the batched factorizations, included from batch.c.
+ * When BATCH_N is defined the matrix order is the compile-time
+ * constant BATCH_N, so that all index arithmetic is constant and the
+ * loops over rows and columns can be unrolled by the compiler;
+ * otherwise the order is the argument N.
+ *
+ * The decompositions work on a tile of BATCH_LANES matrices, with
+ * element (i,j) of matrix l stored in T[(i*N + j)*BATCH_LANES + l].
+ * The solves work in place on the user arrays, with element (i,j) of
+ * matrix l stored in A[(i*N + j)*s + l] for l < nl.  In both cases the
+ * innermost loop runs over the matrices, so that it can be vectorized.
+ */
+
+#ifdef BATCH_N
+#define NN BATCH_N
+#define FUNCTION(name) BATCH_CONCAT(name, BATCH_N)
+#else
+#define NN ((int) N)
+#define FUNCTION(name) BATCH_CONCAT(name, n)
+#endif
+
+#define TILE(i,j) (T + ((i) * NN + (j)) * BATCH_LANES)
+
+/* Cholesky factorization A = L L^T of a tile; L overwrites the
+   lower triangle and fail[l] is set for matrices which are not
+   positive definite.  The updates are accumulated in local arrays,
+   which the compiler knows are not aliased to the tile. */
+static void
+FUNCTION (cholesky_decomp) (const size_t N, double * T, int * fail)
+{
+  double acc[BATCH_LANES], d[BATCH_LANES];
+  int i, j, k;
+  size_t l;
+
+  (void) N;
+
+  for (j = 0; j < NN; ++j)
+    {
+      double * ajj = TILE (j, j);
+
+      for (l = 0; l < BATCH_LANES; ++l)
+        acc[l] = ajj[l];
+
+      for (k = 0; k < j; ++k)
+        {
+          const double * ajk = TILE (j, k);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            acc[l] -= ajk[l] * ajk[l];
+        }
+
+      for (l = 0; l < BATCH_LANES; ++l)
+        {
+          fail[l] |= !(acc[l] > 0.0);
+          ajj[l] = sqrt (acc[l]);
+          d[l] = 1.0 / ajj[l];
+        }
+
+      for (i = j + 1; i < NN; ++i)
+        {
+          double * aij = TILE (i, j);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            acc[l] = aij[l];
+
+          for (k = 0; k < j; ++k)
+            {
+              const double * aik = TILE (i, k);
+              const double * ajk = TILE (j, k);
+
+              for (l = 0; l < BATCH_LANES; ++l)
+                acc[l] -= aik[l] * ajk[l];
+            }
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            aij[l] = acc[l] * d[l];
+        }
+    }
+}
+
+/* LU factorization P A = L U of a tile with partial pivoting, in the
+   left-looking (Crout) order so that the updates can be accumulated
+   locally as above.  The row interchanged with row k at step k is
+   stored in P[k*BATCH_LANES + l]. */
+static void
+FUNCTION (LU_decomp) (const size_t N, double * T, size_t * P)
+{
+  double acc[BATCH_LANES], d[BATCH_LANES], m[BATCH_LANES];
+  int i, j, k;
+  size_t l;
+
+  (void) N;
+
+  for (k = 0; k < NN; ++k)
+    {
+      const double * akk = TILE (k, k);
+      size_t * p = P + k * BATCH_LANES;
+
+      /* update column k of the remaining rows */
+      for (i = k; i < NN; ++i)
+        {
+          double * aik = TILE (i, k);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            acc[l] = aik[l];
+
+          for (j = 0; j < k; ++j)
+            {
+              const double * aij = TILE (i, j);
+              const double * ajk = TILE (j, k);
+
+              for (l = 0; l < BATCH_LANES; ++l)
+                acc[l] -= aij[l] * ajk[l];
+            }
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            aik[l] = acc[l];
+        }
+
+      /* find the pivot of column k in each matrix */
+      for (l = 0; l < BATCH_LANES; ++l)
+        {
+          p[l] = (size_t) k;
+          m[l] = fabs (akk[l]);
+        }
+
+      for (i = k + 1; i < NN; ++i)
+        {
+          const double * aik = TILE (i, k);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            {
+              const double v = fabs (aik[l]);
+
+              if (v > m[l])
+                {
+                  m[l] = v;
+                  p[l] = (size_t) i;
+                }
+            }
+        }
+
+      for (l = 0; l < BATCH_LANES; ++l)
+        {
+          if (p[l] != (size_t) k)
+            {
+              double * ak = TILE (k, 0) + l;
+              double * ap = TILE (p[l], 0) + l;
+
+              for (j = 0; j < NN; ++j)
+                {
+                  const double tmp = ak[j * BATCH_LANES];
+                  ak[j * BATCH_LANES] = ap[j * BATCH_LANES];
+                  ap[j * BATCH_LANES] = tmp;
+                }
+            }
+        }
+
+      /* update row k of U */
+      for (j = k + 1; j < NN; ++j)
+        {
+          double * akj = TILE (k, j);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            acc[l] = akj[l];
+
+          for (i = 0; i < k; ++i)
+            {
+              const double * aki = TILE (k, i);
+              const double * aij = TILE (i, j);
+
+              for (l = 0; l < BATCH_LANES; ++l)
+                acc[l] -= aki[l] * aij[l];
+            }
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            akj[l] = acc[l];
+        }
+
+      /* scale column k of L; a zero pivot leaves a zero column */
+      for (l = 0; l < BATCH_LANES; ++l)
+        d[l] = (akk[l] != 0.0) ? 1.0 / akk[l] : 0.0;
+
+      for (i = k + 1; i < NN; ++i)
+        {
+          double * aik = TILE (i, k);
+
+          for (l = 0; l < BATCH_LANES; ++l)
+            aik[l] *= d[l];
+        }
+    }
+}
+
+#undef TILE
+
+#define ELEM(A,i,j) ((A) + ((i) * NN + (j)) * s)
+
+/* solve L L^T x = b in place for nl <= BATCH_LANES matrices with
+   stride s */
+static void
+FUNCTION (cholesky_svx) (const size_t N, const size_t s, const size_t nl,
+                         const double * LLT, double * x)
+{
+  double acc[BATCH_LANES];
+  int i, k;
+  size_t l;
+
+  (void) N;
+
+  /* forward substitution L y = b */
+  for (i = 0; i < NN; ++i)
+    {
+      double * xi = x + i * s;
+      const double * lii = ELEM (LLT, i, i);
+
+      for (l = 0; l < nl; ++l)
+        acc[l] = xi[l];
+
+      for (k = 0; k < i; ++k)
+        {
+          const double * lik = ELEM (LLT, i, k);
+          const double * xk = x + k * s;
+
+          for (l = 0; l < nl; ++l)
+            acc[l] -= lik[l] * xk[l];
+        }
+
+      for (l = 0; l < nl; ++l)
+        xi[l] = acc[l] / lii[l];
+    }
+
+  /* back substitution L^T x = y */
+  for (i = NN; i-- > 0; )
+    {
+      double * xi = x + i * s;
+      const double * lii = ELEM (LLT, i, i);
+
+      for (l = 0; l < nl; ++l)
+        acc[l] = xi[l];
+
+      for (k = i + 1; k < NN; ++k)
+        {
+          const double * lki = ELEM (LLT, k, i);
+          const double * xk = x + k * s;
+
+          for (l = 0; l < nl; ++l)
+            acc[l] -= lki[l] * xk[l];
+        }
+
+      for (l = 0; l < nl; ++l)
+        xi[l] = acc[l] / lii[l];
+    }
+}
+
+/* solve P A x = L U x = b in place for nl <= BATCH_LANES matrices
+   with stride s */
+static void
+FUNCTION (LU_svx) (const size_t N, const size_t s, const size_t nl,
+                   const double * LU, const size_t * ipiv, double * x)
+{
+  double acc[BATCH_LANES];
+  int i, k;
+  size_t l;
+
+  (void) N;
+
+  /* x := P b */
+  for (k = 0; k < NN; ++k)
+    {
+      const size_t * p = ipiv + k * s;
+
+      for (l = 0; l < nl; ++l)
+        {
+          if (p[l] != (size_t) k)
+            {
+              const double tmp = x[k * s + l];
+              x[k * s + l] = x[p[l] * s + l];
+              x[p[l] * s + l] = tmp;
+            }
+        }
+    }
+
+  /* forward substitution with unit lower triangular L */
+  for (i = 1; i < NN; ++i)
+    {
+      double * xi = x + i * s;
+
+      for (l = 0; l < nl; ++l)
+        acc[l] = xi[l];
+
+      for (k = 0; k < i; ++k)
+        {
+          const double * lik = ELEM (LU, i, k);
+          const double * xk = x + k * s;
+
+          for (l = 0; l < nl; ++l)
+            acc[l] -= lik[l] * xk[l];
+        }
+
+      for (l = 0; l < nl; ++l)
+        xi[l] = acc[l];
+    }
+
+  /* back substitution with U */
+  for (i = NN; i-- > 0; )
+    {
+      double * xi = x + i * s;
+      const double * uii = ELEM (LU, i, i);
+
+      for (l = 0; l < nl; ++l)
+        acc[l] = xi[l];
+
+      for (k = i + 1; k < NN; ++k)
+        {
+          const double * uik = ELEM (LU, i, k);
+          const double * xk = x + k * s;
+
+          for (l = 0; l < nl; ++l)
+            acc[l] -= uik[l] * xk[l];
+        }
+
+      for (l = 0; l < nl; ++l)
+        xi[l] = acc[l] / uii[l];
+    }
+}
+
+#undef ELEM
+#undef NN
+#undef FUNCTION
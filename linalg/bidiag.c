@@ -56,6 +56,13 @@
  *
  *       v_i = [0, .. , 0, 1, A(i,i+2), A(i,i+3), .. , A(i,N)]
  *
+ * For N > CROSSOVER_BIDIAG the leading rows and columns are reduced in
+ * panels of BIDIAG_BLOCK.  The reflectors of a panel are accumulated
+ * together with matrices X and Y, so that the trailing matrix is
+ * updated once per panel with A = A - U Y' - X V', as in LAPACK's
+ * dgebrd.f and dlabrd.f.  The last CROSSOVER_BIDIAG columns are
+ * reduced with the Level 2 algorithm.
+ *
  * See Golub & Van Loan, "Matrix Computations" (3rd ed), Algorithm 5.4.2 
  *
  * Note: this description uses 1-based indices. The code below uses
@@ -71,6 +78,13 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "recurse.h"
+
+static int bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V);
+static void bidiag_decomp_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                                 gsl_vector * d, gsl_vector * e,
+                                 gsl_matrix * X, gsl_matrix * Y, gsl_vector * work);
+
 int 
 gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)  
 {
@@ -90,51 +104,298 @@ gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V
     {
       const size_t M = A->size1;
       const size_t N = A->size2;
-      gsl_vector * tmp = gsl_vector_alloc(M);
-      size_t j;
-  
-      for (j = 0 ; j < N; j++)
-        {
-          /* apply Householder transformation to current column */
-          gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
-          double tau_j = gsl_linalg_householder_transform (&v.vector);
+      size_t i = 0;
 
-          /* apply the transformation to the remaining columns */
-          if (j + 1 < N)
+      if (N > CROSSOVER_BIDIAG)
+        {
+          const size_t nb = BIDIAG_BLOCK;
+          gsl_matrix *X = gsl_matrix_alloc (M, nb);
+          gsl_matrix *Y = gsl_matrix_alloc (N, nb);
+          gsl_vector *d = gsl_vector_alloc (nb);
+          gsl_vector *e = gsl_vector_alloc (nb);
+          gsl_vector *work = gsl_vector_alloc (2 * M + N);
+
+          if (X == NULL || Y == NULL || d == NULL || e == NULL || work == NULL)
             {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
-              gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
-              double * ptr = gsl_vector_ptr(&v.vector, 0);
-              double tmp = *ptr;
-
-              *ptr = 1.0;
-              gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
-              *ptr = tmp;
+              if (X)
+                gsl_matrix_free (X);
+              if (Y)
+                gsl_matrix_free (Y);
+              if (d)
+                gsl_vector_free (d);
+              if (e)
+                gsl_vector_free (e);
+              if (work)
+                gsl_vector_free (work);
+
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
             }
 
-          gsl_vector_set (tau_U, j, tau_j);            
-
-          /* apply Householder transformation to current row */
-          if (j + 1 < N)
+          while (i + CROSSOVER_BIDIAG < N)
             {
-              v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
-              tau_j = gsl_linalg_householder_transform (&v.vector);
-              
-              /* apply the transformation to the remaining rows */
-              if (j + 1 < M)
+              const size_t m = M - i;
+              const size_t n = N - i;
+              const size_t ib = GSL_MIN (nb, N - CROSSOVER_BIDIAG - i);
+              gsl_matrix_view A22 = gsl_matrix_submatrix (A, i, i, m, n);
+              gsl_vector_view tauU = gsl_vector_subvector (tau_U, i, ib);
+              gsl_vector_view tauV = gsl_vector_subvector (tau_V, i, ib);
+              gsl_vector_view d22 = gsl_vector_subvector (d, 0, ib);
+              gsl_vector_view e22 = gsl_vector_subvector (e, 0, ib);
+              gsl_matrix_view X22 = gsl_matrix_submatrix (X, 0, 0, m, ib);
+              gsl_matrix_view Y22 = gsl_matrix_submatrix (Y, 0, 0, n, ib);
+              size_t j;
+
+              bidiag_decomp_panel (&A22.matrix, &tauU.vector, &tauV.vector,
+                                   &d22.vector, &e22.vector, &X22.matrix, &Y22.matrix,
+                                   work);
+
+              /* update the trailing matrix, A = A - U Y' - X V' */
+              {
+                gsl_matrix_view A33 = gsl_matrix_submatrix (&A22.matrix, ib, ib, m - ib, n - ib);
+                gsl_matrix_view U = gsl_matrix_submatrix (&A22.matrix, ib, 0, m - ib, ib);
+                gsl_matrix_view V = gsl_matrix_submatrix (&A22.matrix, 0, ib, ib, n - ib);
+                gsl_matrix_view X2 = gsl_matrix_submatrix (&X22.matrix, ib, 0, m - ib, ib);
+                gsl_matrix_view Y2 = gsl_matrix_submatrix (&Y22.matrix, ib, 0, n - ib, ib);
+
+                gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &U.matrix, &Y2.matrix,
+                                1.0, &A33.matrix);
+                gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &X2.matrix, &V.matrix,
+                                1.0, &A33.matrix);
+              }
+
+              /* restore the diagonal and superdiagonal elements */
+              for (j = 0; j < ib; j++)
                 {
-                  gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
-                  gsl_vector_view work = gsl_vector_subvector(tmp, 0, M - j - 1);
-                  gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &work.vector);
+                  gsl_matrix_set (&A22.matrix, j, j, gsl_vector_get (&d22.vector, j));
+                  gsl_matrix_set (&A22.matrix, j, j + 1, gsl_vector_get (&e22.vector, j));
                 }
 
-              gsl_vector_set (tau_V, j, tau_j);
+              i += ib;
             }
+
+          gsl_matrix_free (X);
+          gsl_matrix_free (Y);
+          gsl_vector_free (d);
+          gsl_vector_free (e);
+          gsl_vector_free (work);
         }
 
-      gsl_vector_free(tmp);
+      /* reduce the remaining columns with Level 2 BLAS */
+      if (i == 0)
+        {
+          return bidiag_decomp_L2 (A, tau_U, tau_V);
+        }
+      else
+        {
+          gsl_matrix_view A22 = gsl_matrix_submatrix (A, i, i, M - i, N - i);
+          gsl_vector_view tauU = gsl_vector_subvector (tau_U, i, N - i);
+          gsl_vector_view tauV = gsl_vector_subvector (tau_V, i, N - i - 1);
 
-      return GSL_SUCCESS;
+          return bidiag_decomp_L2 (&A22.matrix, &tauU.vector, &tauV.vector);
+        }
+    }
+}
+
+/*
+bidiag_decomp_L2()
+  Reduce a M-by-N matrix, M >= N, to bidiagonal form with Level 2
+BLAS, one pair of Householder reflectors at a time
+
+Inputs: A     - M-by-N matrix
+        tau_U - (output) left Householder coefficients, length N
+        tau_V - (output) right Householder coefficients, length N - 1
+*/
+
+static int
+bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  gsl_vector * tmp = gsl_vector_alloc(M);
+  size_t j;
+  
+  if (tmp == NULL)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  for (j = 0 ; j < N; j++)
+    {
+      /* apply Householder transformation to current column */
+      gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
+      double tau_j = gsl_linalg_householder_transform (&v.vector);
+
+      /* apply the transformation to the remaining columns */
+      if (j + 1 < N)
+        {
+          gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
+          gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
+          double * ptr = gsl_vector_ptr(&v.vector, 0);
+          double tmp = *ptr;
+
+          *ptr = 1.0;
+          gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
+          *ptr = tmp;
+        }
+
+      gsl_vector_set (tau_U, j, tau_j);            
+
+      /* apply Householder transformation to current row */
+      if (j + 1 < N)
+        {
+          v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
+          tau_j = gsl_linalg_householder_transform (&v.vector);
+          
+          /* apply the transformation to the remaining rows */
+          if (j + 1 < M)
+            {
+              gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
+              gsl_vector_view work = gsl_vector_subvector(tmp, 0, M - j - 1);
+              gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &work.vector);
+            }
+
+          gsl_vector_set (tau_V, j, tau_j);
+        }
+    }
+
+  gsl_vector_free(tmp);
+
+  return GSL_SUCCESS;
+}
+
+/*
+bidiag_decomp_panel()
+  Reduce the first nb rows and columns of a M-by-N matrix, M >= N > nb,
+without updating the trailing matrix A(nb:M-1,nb:N-1). This is
+LAPACK's dlabrd.f for M >= N.
+
+Inputs: A     - M-by-N matrix; on output the first nb rows and columns
+                hold the Householder vectors, with unit elements in
+                place of the diagonal and superdiagonal
+        tau_U - (output) left Householder coefficients, length nb
+        tau_V - (output) right Householder coefficients, length nb
+        d     - (output) diagonal elements, length nb
+        e     - (output) superdiagonal elements, length nb
+        X     - (output) M-by-nb matrix
+        Y     - (output) N-by-nb matrix, such that the trailing matrix
+                is updated by A = A - U Y' - X V', where U = A(:,0:nb-1)
+                and V = A(0:nb-1,:)
+        work  - workspace, length 2*M + N
+
+The columns of A, X and Y are strided, so the products with the
+trailing matrix are done on contiguous copies of u, x and y.
+*/
+
+static void
+bidiag_decomp_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                     gsl_vector * d, gsl_vector * e,
+                     gsl_matrix * X, gsl_matrix * Y, gsl_vector * work)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nb = X->size2;
+  size_t i;
+
+  for (i = 0; i < nb; i++)
+    {
+      gsl_vector_view u = gsl_matrix_subcolumn (A, i, i, M - i);
+      gsl_vector_view v = gsl_matrix_subrow (A, i, i + 1, N - i - 1);
+      gsl_vector_view y = gsl_matrix_subcolumn (Y, i, i + 1, N - i - 1);
+      gsl_vector_view x = gsl_matrix_subcolumn (X, i, i + 1, M - i - 1);
+      gsl_vector_view uc = gsl_vector_subvector (work, 0, M - i);
+      gsl_vector_view yc = gsl_vector_subvector (work, M, N - i - 1);
+      gsl_vector_view xc = gsl_vector_subvector (work, M + N, M - i - 1);
+      gsl_matrix_view A22 = gsl_matrix_submatrix (A, i + 1, i + 1, M - i - 1, N - i - 1);
+      double tau_i;
+
+      /* update A(i:M-1,i) with the previous reflectors of the panel */
+      if (i > 0)
+        {
+          gsl_matrix_view Ui = gsl_matrix_submatrix (A, i, 0, M - i, i);
+          gsl_matrix_view Xi = gsl_matrix_submatrix (X, i, 0, M - i, i);
+          gsl_vector_view yrow = gsl_matrix_subrow (Y, i, 0, i);
+          gsl_vector_view vcol = gsl_matrix_subcolumn (A, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Ui.matrix, &yrow.vector, 1.0, &u.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Xi.matrix, &vcol.vector, 1.0, &u.vector);
+        }
+
+      /* generate the reflector to annihilate A(i+1:M-1,i) */
+      tau_i = gsl_linalg_householder_transform (&u.vector);
+      gsl_vector_set (tau_U, i, tau_i);
+      gsl_vector_set (d, i, gsl_vector_get (&u.vector, 0));
+      gsl_vector_set (&u.vector, 0, 1.0);
+      gsl_vector_memcpy (&uc.vector, &u.vector);
+
+      /* y = tau_U A(i:M-1,i+1:N-1)' u, corrected for the previous reflectors */
+      {
+        gsl_matrix_view Ar = gsl_matrix_submatrix (A, i, i + 1, M - i, N - i - 1);
+
+        gsl_blas_dgemv (CblasTrans, 1.0, &Ar.matrix, &uc.vector, 0.0, &yc.vector);
+
+        if (i > 0)
+          {
+            gsl_vector_view ytop = gsl_matrix_subcolumn (Y, i, 0, i);
+            gsl_matrix_view Ui = gsl_matrix_submatrix (A, i, 0, M - i, i);
+            gsl_matrix_view Xi = gsl_matrix_submatrix (X, i, 0, M - i, i);
+            gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, N - i - 1, i);
+            gsl_matrix_view Vi = gsl_matrix_submatrix (A, 0, i + 1, i, N - i - 1);
+
+            gsl_blas_dgemv (CblasTrans, 1.0, &Ui.matrix, &uc.vector, 0.0, &ytop.vector);
+            gsl_blas_dgemv (CblasNoTrans, -1.0, &Yi.matrix, &ytop.vector, 1.0, &yc.vector);
+            gsl_blas_dgemv (CblasTrans, 1.0, &Xi.matrix, &uc.vector, 0.0, &ytop.vector);
+            gsl_blas_dgemv (CblasTrans, -1.0, &Vi.matrix, &ytop.vector, 1.0, &yc.vector);
+          }
+
+        gsl_blas_dscal (tau_i, &yc.vector);
+        gsl_vector_memcpy (&y.vector, &yc.vector);
+      }
+
+      /* update A(i,i+1:N-1) */
+      {
+        gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, N - i - 1, i + 1);
+        gsl_vector_view arow = gsl_matrix_subrow (A, i, 0, i + 1);
+
+        gsl_blas_dgemv (CblasNoTrans, -1.0, &Yi.matrix, &arow.vector, 1.0, &v.vector);
+
+        if (i > 0)
+          {
+            gsl_matrix_view Vi = gsl_matrix_submatrix (A, 0, i + 1, i, N - i - 1);
+            gsl_vector_view xrow = gsl_matrix_subrow (X, i, 0, i);
+
+            gsl_blas_dgemv (CblasTrans, -1.0, &Vi.matrix, &xrow.vector, 1.0, &v.vector);
+          }
+      }
+
+      /* generate the reflector to annihilate A(i,i+2:N-1) */
+      tau_i = gsl_linalg_householder_transform (&v.vector);
+      gsl_vector_set (tau_V, i, tau_i);
+      gsl_vector_set (e, i, gsl_vector_get (&v.vector, 0));
+      gsl_vector_set (&v.vector, 0, 1.0);
+
+      /* x = tau_V A(i+1:M-1,i+1:N-1) v, corrected for the previous reflectors */
+      {
+        gsl_matrix_view Ui = gsl_matrix_submatrix (A, i + 1, 0, M - i - 1, i + 1);
+        gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, N - i - 1, i + 1);
+        gsl_vector_view xtop = gsl_matrix_subcolumn (X, i, 0, i + 1);
+
+        gsl_blas_dgemv (CblasNoTrans, 1.0, &A22.matrix, &v.vector, 0.0, &xc.vector);
+        gsl_blas_dgemv (CblasTrans, 1.0, &Yi.matrix, &v.vector, 0.0, &xtop.vector);
+        gsl_blas_dgemv (CblasNoTrans, -1.0, &Ui.matrix, &xtop.vector, 1.0, &xc.vector);
+
+        if (i > 0)
+          {
+            gsl_matrix_view Vi = gsl_matrix_submatrix (A, 0, i + 1, i, N - i - 1);
+            gsl_matrix_view Xi = gsl_matrix_submatrix (X, i + 1, 0, M - i - 1, i);
+            gsl_vector_view xtop2 = gsl_matrix_subcolumn (X, i, 0, i);
+
+            gsl_blas_dgemv (CblasNoTrans, 1.0, &Vi.matrix, &v.vector, 0.0, &xtop2.vector);
+            gsl_blas_dgemv (CblasNoTrans, -1.0, &Xi.matrix, &xtop2.vector, 1.0, &xc.vector);
+          }
+
+        gsl_blas_dscal (tau_i, &xc.vector);
+        gsl_vector_memcpy (&x.vector, &xc.vector);
+      }
     }
 }
 
@@ -32,6 +32,7 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
@@ -41,11 +42,15 @@
 #include <gsl/gsl_linalg.h>
 
 #include "recurse.h"
+#include "thread.h"
 
 static double cholesky_norm1(const gsl_matrix * LLT, gsl_vector * work);
 static int cholesky_Ainv(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
 static int cholesky_decomp_L2 (gsl_matrix * A);
 static int cholesky_decomp_L3 (gsl_matrix * A);
+#ifdef _OPENMP
+static int cholesky_decomp_task (gsl_matrix * A, const int nthreads);
+#endif
 
 /*
 In GSL 2.2, we decided to modify the behavior of the Cholesky decomposition
@@ -82,6 +87,9 @@ Return: success/error
 
 Notes:
 1) original matrix is saved in upper triangle on output
+
+2) large matrices are factored with tasks on several threads
+when gsl_linalg_set_num_threads() or GSL_NUM_THREADS allow it
 */
 
 int
@@ -98,6 +106,15 @@ gsl_linalg_cholesky_decomp1 (gsl_matrix * A)
       /* save original matrix in upper triangle for later rcond calculation */
       gsl_matrix_transpose_tricpy(CblasLower, CblasUnit, A, A);
 
+#ifdef _OPENMP
+      {
+        const int nthreads = linalg_thread_count(N);
+
+        if (nthreads > 1)
+          return cholesky_decomp_task(A, nthreads);
+      }
+#endif
+
       return cholesky_decomp_L3(A);
     }
 }
@@ -722,3 +739,121 @@ cholesky_decomp_L3 (gsl_matrix * A)
     }
 }
 
+#ifdef _OPENMP
+
+/*
+cholesky_decomp_task()
+  Perform Cholesky decomposition of a symmetric positive
+definite matrix with OpenMP tasks
+
+Inputs: A        - (input) symmetric, positive definite matrix in lower triangle
+                   (output) lower triangle contains Cholesky factor
+        nthreads - number of threads
+
+Return: success/error
+
+Notes:
+1) The matrix is split into column blocks of width LINALG_THREAD_BLOCK.
+Block k is factored by one task, using the recursive algorithm on the
+diagonal block followed by a triangular solve for the part below it.
+Each trailing block j > k is then updated by its own task with dsyrk and
+dgemm. The tasks wait only for their data, so the factorization of block
+k + 1 starts as soon as its own update is done, while the other updates
+of step k are still running.
+
+2) If a diagonal block is not positive definite, the remaining tasks
+are skipped and the error is returned.
+*/
+
+static int
+cholesky_decomp_task (gsl_matrix * A, const int nthreads)
+{
+  const size_t N = A->size1;
+  const size_t nb = LINALG_THREAD_BLOCK;
+  const size_t nblocks = (N + nb - 1) / nb;
+  char *dep = malloc(nblocks); /* dependency tokens for the column blocks */
+  int status = GSL_SUCCESS;
+
+  if (dep == NULL)
+    {
+      GSL_ERROR("failed to allocate space for dependencies", GSL_ENOMEM);
+    }
+
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+  {
+    size_t k, j;
+
+    for (k = 0; k < nblocks; ++k)
+      {
+        const size_t k0 = k * nb;
+        const size_t nk = GSL_MIN(nb, N - k0);
+
+#pragma omp task shared(status) depend(inout: dep[k])
+        {
+          int s;
+
+#pragma omp atomic read
+          s = status;
+
+          if (s == GSL_SUCCESS)
+            {
+              gsl_matrix_view A11 = gsl_matrix_submatrix(A, k0, k0, nk, nk);
+
+              s = cholesky_decomp_L3(&A11.matrix);
+              if (s)
+                {
+#pragma omp atomic write
+                  status = s;
+                }
+              else if (k0 + nk < N)
+                {
+                  gsl_matrix_view A21 = gsl_matrix_submatrix(A, k0 + nk, k0, N - k0 - nk, nk);
+
+                  /* A21 = A21 * L11^{-T} */
+                  gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0, &A11.matrix, &A21.matrix);
+                }
+            }
+        }
+
+        for (j = k + 1; j < nblocks; ++j)
+          {
+            const size_t j0 = j * nb;
+            const size_t nj = GSL_MIN(nb, N - j0);
+
+#pragma omp task shared(status) depend(in: dep[k]) depend(inout: dep[j])
+            {
+              int s;
+
+#pragma omp atomic read
+              s = status;
+
+              if (s == GSL_SUCCESS)
+                {
+                  gsl_matrix_view Ljk = gsl_matrix_submatrix(A, j0, k0, nj, nk);
+                  gsl_matrix_view Ajj = gsl_matrix_submatrix(A, j0, j0, nj, nj);
+
+                  /* A(j,j) -= L(j,k) L(j,k)^T */
+                  gsl_blas_dsyrk(CblasLower, CblasNoTrans, -1.0, &Ljk.matrix, 1.0, &Ajj.matrix);
+
+                  if (j0 + nj < N)
+                    {
+                      const size_t M2 = N - j0 - nj;
+                      gsl_matrix_view Lik = gsl_matrix_submatrix(A, j0 + nj, k0, M2, nk);
+                      gsl_matrix_view Aij = gsl_matrix_submatrix(A, j0 + nj, j0, M2, nj);
+
+                      /* A(i,j) -= L(i,k) L(j,k)^T for i > j */
+                      gsl_blas_dgemm(CblasNoTrans, CblasTrans, -1.0, &Lik.matrix, &Ljk.matrix, 1.0, &Aij.matrix);
+                    }
+                }
+            }
+          }
+      }
+  }
+
+  free(dep);
+
+  return status;
+}
+
+#endif /* _OPENMP */
@@ -175,6 +175,10 @@ int gsl_linalg_SV_decomp_jacobi (gsl_matrix * A,
                                  gsl_matrix * Q,
                                  gsl_vector * S);
 
+int gsl_linalg_SV_decomp_dc (gsl_matrix * A,
+                             gsl_matrix * V,
+                             gsl_vector * S);
+
 int
 gsl_linalg_SV_solve (const gsl_matrix * U,
                      const gsl_matrix * Q,
@@ -184,6 +188,18 @@ gsl_linalg_SV_solve (const gsl_matrix * U,
 
 int gsl_linalg_SV_leverage(const gsl_matrix *U, gsl_vector *h);
 
+/* linear operator for matrix-free algorithms, which computes
+ * Y = op(A) X with op(A) = A or A^T for a block of vectors X;
+ * see gsl_linalg_rsvd.h for the randomized SVD */
+typedef struct
+{
+  size_t size1;                 /* number of rows of A */
+  size_t size2;                 /* number of columns of A */
+  int (* mult) (CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                gsl_matrix * Y, void * params);
+  void * params;
+} gsl_linalg_operator;
+
 
 /* LU Decomposition, Gaussian elimination with partial pivoting
  */
@@ -215,6 +231,49 @@ double gsl_linalg_LU_det (gsl_matrix * LU, int signum);
 double gsl_linalg_LU_lndet (gsl_matrix * LU);
 int gsl_linalg_LU_sgndet (gsl_matrix * lu, int signum);
 
+/* Batched LU and Cholesky decompositions of many small matrices,
+ * stored interleaved: element (i,j) of matrix b is A[(i*N + j)*nbatch + b]
+ */
+
+int gsl_linalg_LU_decomp_batch (const size_t N, const size_t nbatch,
+                                double * A, size_t * ipiv);
+int gsl_linalg_LU_svx_batch (const size_t N, const size_t nbatch,
+                             const double * LU, const size_t * ipiv,
+                             double * x);
+int gsl_linalg_cholesky_decomp_batch (const size_t N, const size_t nbatch,
+                                      double * A, int * info);
+int gsl_linalg_cholesky_svx_batch (const size_t N, const size_t nbatch,
+                                   const double * LLT, double * x);
+
+/* Mixed precision LU and Cholesky solvers: factorization in single
+ * precision, iterative refinement in double precision
+ */
+
+typedef struct
+{
+  size_t N;
+  gsl_matrix_float * Af;        /* single precision factors */
+  gsl_vector_uint * ipiv;       /* row interchanges of single precision LU */
+  gsl_vector_float * rf;        /* single precision correction */
+  gsl_vector * r;               /* double precision residual */
+  gsl_matrix * A;               /* double precision factors, after a fallback */
+  gsl_permutation * p;          /* permutation of double precision LU */
+  double anorm;                 /* ||A||_inf */
+  size_t maxiter;               /* maximum refinement iterations */
+  int fallback;                 /* set when the double precision factors are used */
+} gsl_linalg_mixed_workspace;
+
+gsl_linalg_mixed_workspace * gsl_linalg_mixed_alloc (const size_t N);
+void gsl_linalg_mixed_free (gsl_linalg_mixed_workspace * w);
+int gsl_linalg_LU_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w);
+int gsl_linalg_LU_mixed_solve (const gsl_matrix * A, const gsl_vector * b,
+                               gsl_vector * x, size_t * niter, double * berr,
+                               gsl_linalg_mixed_workspace * w);
+int gsl_linalg_cholesky_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w);
+int gsl_linalg_cholesky_mixed_solve (const gsl_matrix * A, const gsl_vector * b,
+                                     gsl_vector * x, size_t * niter, double * berr,
+                                     gsl_linalg_mixed_workspace * w);
+
 /* Banded LU decomposition */
 
 int gsl_linalg_LU_band_decomp (const size_t M, const size_t lb, const size_t ub, gsl_matrix * AB, gsl_vector_uint * piv);
@@ -906,6 +965,11 @@ int gsl_linalg_tri_UL(gsl_matrix * LU);
 int gsl_linalg_complex_tri_LHL(gsl_matrix_complex * L);
 int gsl_linalg_complex_tri_UL(gsl_matrix_complex * LU);
 
+/* threads used by the task-parallel factorizations */
+
+int gsl_linalg_set_num_threads (const int n);
+int gsl_linalg_get_num_threads (void);
+
 INLINE_DECL void gsl_linalg_givens (const double a, const double b,
                                     double *c, double *s);
 INLINE_DECL void gsl_linalg_givens_gv (gsl_vector * v, const size_t i,
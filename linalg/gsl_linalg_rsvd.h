@@ -0,0 +1,71 @@
+/* linalg/gsl_linalg_rsvd.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_LINALG_RSVD_H__
+#define __GSL_LINALG_RSVD_H__
+
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_linalg.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+#define __BEGIN_DECLS extern "C" {
+#define __END_DECLS }
+#else
+#define __BEGIN_DECLS           /* empty */
+#define __END_DECLS             /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Randomized low-rank SVD */
+
+typedef struct
+{
+  size_t M;                     /* number of rows of A */
+  size_t N;                     /* number of columns of A */
+  size_t k;                     /* number of singular triplets */
+  size_t l;                     /* number of samples, k plus oversampling */
+  gsl_matrix * Y;               /* M-by-l samples of the range of A */
+  gsl_matrix * Q;               /* M-by-l orthonormal basis of the range */
+  gsl_matrix * Z;               /* N-by-l samples of the range of A^T */
+  gsl_matrix * Zq;              /* N-by-l orthonormal basis of Z */
+  gsl_matrix * T;               /* l-by-l triangular factor of QR */
+  gsl_matrix * Vb;              /* l-by-l singular vectors of Q^T A */
+  gsl_vector * S;               /* l singular values of Q^T A */
+} gsl_linalg_rsvd_workspace;
+
+gsl_linalg_rsvd_workspace * gsl_linalg_rsvd_alloc (const size_t M, const size_t N,
+                                                   const size_t k, const size_t p);
+void gsl_linalg_rsvd_free (gsl_linalg_rsvd_workspace * w);
+int gsl_linalg_rsvd_range (const gsl_linalg_operator * A, const size_t q,
+                           gsl_rng * r, gsl_linalg_rsvd_workspace * w);
+int gsl_linalg_rsvd_decomp (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                            gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                            gsl_linalg_rsvd_workspace * w);
+int gsl_linalg_rsvd_decomp_op (const gsl_linalg_operator * A, const size_t q,
+                               gsl_rng * r, gsl_matrix * U, gsl_vector * S,
+                               gsl_matrix * V, gsl_linalg_rsvd_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_LINALG_RSVD_H__ */
@@ -45,6 +45,12 @@
  * This storage scheme is the same as in LAPACK.  See LAPACK's
  * chetd2.f for details.
  *
+ * For N > CROSSOVER_HERMTD the leading columns are reduced in panels
+ * of HERMTD_BLOCK columns, with a rank-2k update A = A - V W' - W V'
+ * of the trailing matrix once per panel, as in LAPACK's zhetrd.f and
+ * zlatrd.f.  The last CROSSOVER_HERMTD columns are reduced with the
+ * Level 2 algorithm.
+ *
  * See Golub & Van Loan, "Matrix Computations" (3rd ed), Section 8.3 */
 
 #include <config.h>
@@ -57,6 +63,15 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "recurse.h"
+
+static void hermtd_decomp_L2 (gsl_matrix_complex * A, gsl_vector_complex * tau);
+static void hermtd_decomp_panel (gsl_matrix_complex * A, gsl_vector_complex * tau,
+                                 gsl_vector_complex * e, gsl_matrix_complex * W,
+                                 gsl_vector_complex * work);
+static void hermtd_update (const gsl_matrix_complex * V, const gsl_matrix_complex * W,
+                           gsl_matrix_complex * A);
+
 int 
 gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, gsl_vector_complex * tau)  
 {
@@ -72,55 +87,276 @@ gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, gsl_vector_complex * tau)
   else
     {
       const size_t N = A->size1;
-      size_t i;
-  
-      const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
-      const gsl_complex one = gsl_complex_rect (1.0, 0.0);
-      const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+      size_t i = 0;
 
-      for (i = 0 ; i < N - 1; i++)
+      if (N > CROSSOVER_HERMTD)
         {
-          gsl_vector_complex_view c = gsl_matrix_complex_column (A, i);
-          gsl_vector_complex_view v = gsl_vector_complex_subvector (&c.vector, i + 1, N - (i + 1));
-          gsl_complex tau_i = gsl_linalg_complex_householder_transform (&v.vector);
-          
-          /* Apply the transformation H^T A H to the remaining columns */
+          const size_t nb = HERMTD_BLOCK;
+          gsl_matrix_complex *W = gsl_matrix_complex_alloc (N, nb);
+          gsl_vector_complex *e = gsl_vector_complex_alloc (nb);
+          gsl_vector_complex *work = gsl_vector_complex_alloc (2 * N);
 
-          if ((i + 1) < (N - 1) 
-              && !(GSL_REAL(tau_i) == 0.0 && GSL_IMAG(tau_i) == 0.0)) 
+          if (W == NULL || e == NULL || work == NULL)
             {
-              gsl_matrix_complex_view m = 
-                gsl_matrix_complex_submatrix (A, i + 1, i + 1, 
-                                              N - (i+1), N - (i+1));
-              gsl_complex ei = gsl_vector_complex_get(&v.vector, 0);
-              gsl_vector_complex_view x = gsl_vector_complex_subvector (tau, i, N-(i+1));
-              gsl_vector_complex_set (&v.vector, 0, one);
-              
-              /* x = tau * A * v */
-              gsl_blas_zhemv (CblasLower, tau_i, &m.matrix, &v.vector, zero, &x.vector);
-
-              /* w = x - (1/2) tau * (x' * v) * v  */
+              if (W)
+                gsl_matrix_complex_free (W);
+              if (e)
+                gsl_vector_complex_free (e);
+              if (work)
+                gsl_vector_complex_free (work);
+
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
+
+          while (i + CROSSOVER_HERMTD < N)
+            {
+              const size_t n = N - i;
+              const size_t ib = GSL_MIN (nb, N - CROSSOVER_HERMTD - i);
+              gsl_matrix_complex_view A22 = gsl_matrix_complex_submatrix (A, i, i, n, n);
+              gsl_vector_complex_view tau22 = gsl_vector_complex_subvector (tau, i, ib);
+              gsl_vector_complex_view e22 = gsl_vector_complex_subvector (e, 0, ib);
+              gsl_matrix_complex_view W22 = gsl_matrix_complex_submatrix (W, 0, 0, n, ib);
+              size_t j;
+
+              hermtd_decomp_panel (&A22.matrix, &tau22.vector, &e22.vector,
+                                   &W22.matrix, work);
+
+              /* update the trailing matrix, A = A - V W' - W V' */
               {
-                gsl_complex xv, txv, alpha;
-                gsl_blas_zdotc(&x.vector, &v.vector, &xv);
-                txv = gsl_complex_mul(tau_i, xv);
-                alpha = gsl_complex_mul_real(txv, -0.5);
-                gsl_blas_zaxpy(alpha, &v.vector, &x.vector);
+                gsl_matrix_complex_view V = gsl_matrix_complex_submatrix (&A22.matrix, ib, 0, n - ib, ib);
+                gsl_matrix_complex_view W2 = gsl_matrix_complex_submatrix (&W22.matrix, ib, 0, n - ib, ib);
+                gsl_matrix_complex_view A33 = gsl_matrix_complex_submatrix (&A22.matrix, ib, ib, n - ib, n - ib);
+
+                hermtd_update (&V.matrix, &W2.matrix, &A33.matrix);
               }
-              
-              /* apply the transformation A = A - v w' - w v' */
-              gsl_blas_zher2(CblasLower, neg_one, &v.vector, &x.vector, &m.matrix);
 
-              gsl_vector_complex_set (&v.vector, 0, ei);
+              /* restore the subdiagonal elements */
+              for (j = 0; j < ib; j++)
+                gsl_matrix_complex_set (&A22.matrix, j + 1, j, gsl_vector_complex_get (&e22.vector, j));
+
+              i += ib;
             }
+
+          gsl_matrix_complex_free (W);
+          gsl_vector_complex_free (e);
+          gsl_vector_complex_free (work);
+        }
+
+      /* reduce the remaining columns with Level 2 BLAS */
+      if (N - i > 1)
+        {
+          gsl_matrix_complex_view A22 = gsl_matrix_complex_submatrix (A, i, i, N - i, N - i);
+          gsl_vector_complex_view tau22 = gsl_vector_complex_subvector (tau, i, N - i - 1);
+
+          hermtd_decomp_L2 (&A22.matrix, &tau22.vector);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+hermtd_decomp_L2()
+  Reduce a hermitian matrix to tridiagonal form with Level 2 BLAS,
+one Householder reflector at a time
+
+Inputs: A   - N-by-N matrix, N > 1
+        tau - (output) Householder coefficients, length N - 1; also
+              used as workspace
+*/
+
+static void
+hermtd_decomp_L2 (gsl_matrix_complex * A, gsl_vector_complex * tau)
+{
+  const size_t N = A->size1;
+  size_t i;
+
+  const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
+  const gsl_complex one = gsl_complex_rect (1.0, 0.0);
+  const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+
+  for (i = 0 ; i < N - 1; i++)
+    {
+      gsl_vector_complex_view c = gsl_matrix_complex_column (A, i);
+      gsl_vector_complex_view v = gsl_vector_complex_subvector (&c.vector, i + 1, N - (i + 1));
+      gsl_complex tau_i = gsl_linalg_complex_householder_transform (&v.vector);
+      
+      /* Apply the transformation H^T A H to the remaining columns */
+
+      if ((i + 1) < (N - 1) 
+          && !(GSL_REAL(tau_i) == 0.0 && GSL_IMAG(tau_i) == 0.0)) 
+        {
+          gsl_matrix_complex_view m = 
+            gsl_matrix_complex_submatrix (A, i + 1, i + 1, 
+                                          N - (i+1), N - (i+1));
+          gsl_complex ei = gsl_vector_complex_get(&v.vector, 0);
+          gsl_vector_complex_view x = gsl_vector_complex_subvector (tau, i, N-(i+1));
+          gsl_vector_complex_set (&v.vector, 0, one);
+          
+          /* x = tau * A * v */
+          gsl_blas_zhemv (CblasLower, tau_i, &m.matrix, &v.vector, zero, &x.vector);
+
+          /* w = x - (1/2) tau * (x' * v) * v  */
+          {
+            gsl_complex xv, txv, alpha;
+            gsl_blas_zdotc(&x.vector, &v.vector, &xv);
+            txv = gsl_complex_mul(tau_i, xv);
+            alpha = gsl_complex_mul_real(txv, -0.5);
+            gsl_blas_zaxpy(alpha, &v.vector, &x.vector);
+          }
           
-          gsl_vector_complex_set (tau, i, tau_i);
+          /* apply the transformation A = A - v w' - w v' */
+          gsl_blas_zher2(CblasLower, neg_one, &v.vector, &x.vector, &m.matrix);
+
+          gsl_vector_complex_set (&v.vector, 0, ei);
         }
       
-      return GSL_SUCCESS;
+      gsl_vector_complex_set (tau, i, tau_i);
+    }
+}
+
+/*
+hermtd_decomp_panel()
+  Reduce the first nb columns of a hermitian matrix, without updating
+the trailing matrix A(nb:N-1,nb:N-1). This is LAPACK's zlatrd.f for
+the lower triangle.
+
+Inputs: A   - N-by-N matrix, N > nb + 1; on output the first nb
+              columns hold the reduced matrix and the Householder
+              vectors, with unit elements in place of the subdiagonal
+        tau - (output) Householder coefficients, length nb
+        e   - (output) subdiagonal elements, length nb
+        W   - (output) N-by-nb matrix such that the trailing matrix is
+              updated by A = A - V W' - W V', where V = A(:,0:nb-1)
+        work - workspace, length 2*N
+
+As in symmtd.c, the matrix-vector products with the trailing matrix
+are done on contiguous copies of the columns.
+*/
+
+static void
+hermtd_decomp_panel (gsl_matrix_complex * A, gsl_vector_complex * tau,
+                     gsl_vector_complex * e, gsl_matrix_complex * W,
+                     gsl_vector_complex * work)
+{
+  const size_t N = A->size1;
+  const size_t nb = W->size2;
+  const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
+  const gsl_complex one = gsl_complex_rect (1.0, 0.0);
+  const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+  size_t i;
+
+  for (i = 0; i < nb; i++)
+    {
+      gsl_vector_complex_view ai = gsl_matrix_complex_subcolumn (A, i, i, N - i);
+
+      /* update A(i:N-1,i) with the previous reflectors of the panel,
+         using the conjugates of the rows V(i,:) and W(i,:) */
+      if (i > 0)
+        {
+          gsl_matrix_complex_view Ai = gsl_matrix_complex_submatrix (A, i, 0, N - i, i);
+          gsl_matrix_complex_view Wi = gsl_matrix_complex_submatrix (W, i, 0, N - i, i);
+          gsl_vector_complex_view wrow = gsl_matrix_complex_subrow (W, i, 0, i);
+          gsl_vector_complex_view arow = gsl_matrix_complex_subrow (A, i, 0, i);
+          gsl_vector_complex_view c = gsl_vector_complex_subvector (work, 0, i);
+          gsl_complex aii;
+
+          gsl_vector_complex_conj_memcpy (&c.vector, &wrow.vector);
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Ai.matrix, &c.vector, one, &ai.vector);
+          gsl_vector_complex_conj_memcpy (&c.vector, &arow.vector);
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Wi.matrix, &c.vector, one, &ai.vector);
+
+          /* the diagonal element is real */
+          aii = gsl_vector_complex_get (&ai.vector, 0);
+          gsl_vector_complex_set (&ai.vector, 0, gsl_complex_rect (GSL_REAL (aii), 0.0));
+        }
+
+      /* generate the reflector to annihilate A(i+2:N-1,i) */
+      {
+        gsl_vector_complex_view v = gsl_matrix_complex_subcolumn (A, i, i + 1, N - i - 1);
+        gsl_vector_complex_view wi = gsl_matrix_complex_subcolumn (W, i, i + 1, N - i - 1);
+        gsl_vector_complex_view vc = gsl_vector_complex_subvector (work, 0, N - i - 1);
+        gsl_vector_complex_view wc = gsl_vector_complex_subvector (work, N, N - i - 1);
+        gsl_matrix_complex_view A22 = gsl_matrix_complex_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
+        gsl_complex tau_i = gsl_linalg_complex_householder_transform (&v.vector);
+        gsl_complex xv, alpha;
+
+        gsl_vector_complex_set (e, i, gsl_vector_complex_get (&v.vector, 0));
+        gsl_vector_complex_set (&v.vector, 0, one);
+        gsl_vector_complex_memcpy (&vc.vector, &v.vector);
+
+        /* w = tau (A - V W' - W V') v */
+        gsl_blas_zhemv (CblasLower, one, &A22.matrix, &vc.vector, zero, &wc.vector);
+
+        if (i > 0)
+          {
+            gsl_matrix_complex_view Vi = gsl_matrix_complex_submatrix (A, i + 1, 0, N - i - 1, i);
+            gsl_matrix_complex_view Wi = gsl_matrix_complex_submatrix (W, i + 1, 0, N - i - 1, i);
+            gsl_vector_complex_view wtop = gsl_matrix_complex_subcolumn (W, i, 0, i);
+
+            gsl_blas_zgemv (CblasConjTrans, one, &Wi.matrix, &vc.vector, zero, &wtop.vector);
+            gsl_blas_zgemv (CblasNoTrans, neg_one, &Vi.matrix, &wtop.vector, one, &wc.vector);
+            gsl_blas_zgemv (CblasConjTrans, one, &Vi.matrix, &vc.vector, zero, &wtop.vector);
+            gsl_blas_zgemv (CblasNoTrans, neg_one, &Wi.matrix, &wtop.vector, one, &wc.vector);
+          }
+
+        gsl_blas_zscal (tau_i, &wc.vector);
+
+        /* w = w - (1/2) tau (w' v) v */
+        gsl_blas_zdotc (&wc.vector, &vc.vector, &xv);
+        alpha = gsl_complex_mul_real (gsl_complex_mul (tau_i, xv), -0.5);
+        gsl_blas_zaxpy (alpha, &vc.vector, &wc.vector);
+
+        gsl_vector_complex_memcpy (&wi.vector, &wc.vector);
+        gsl_vector_complex_set (tau, i, tau_i);
+      }
     }
-}  
+}
+
+/*
+hermtd_update()
+  Rank-2k update of the lower triangle, A = A - V W' - W V', with
+zher2k on the diagonal blocks and zgemm below them
+
+Inputs: V - N-by-k matrix
+        W - N-by-k matrix
+        A - N-by-N matrix; only the lower triangle is updated
+*/
+
+static void
+hermtd_update (const gsl_matrix_complex * V, const gsl_matrix_complex * W,
+               gsl_matrix_complex * A)
+{
+  const size_t N = A->size1;
+  const size_t k = V->size2;
+  const size_t nb = 4 * HERMTD_BLOCK;
+  const gsl_complex one = gsl_complex_rect (1.0, 0.0);
+  const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+  size_t j;
+
+  for (j = 0; j < N; j += nb)
+    {
+      const size_t jb = GSL_MIN (nb, N - j);
+      gsl_matrix_complex_const_view V1 = gsl_matrix_complex_const_submatrix (V, j, 0, jb, k);
+      gsl_matrix_complex_const_view W1 = gsl_matrix_complex_const_submatrix (W, j, 0, jb, k);
+      gsl_matrix_complex_view A11 = gsl_matrix_complex_submatrix (A, j, j, jb, jb);
 
+      gsl_blas_zher2k (CblasLower, CblasNoTrans, neg_one, &V1.matrix, &W1.matrix,
+                       1.0, &A11.matrix);
+
+      if (j + jb < N)
+        {
+          gsl_matrix_complex_const_view V2 = gsl_matrix_complex_const_submatrix (V, j + jb, 0, N - j - jb, k);
+          gsl_matrix_complex_const_view W2 = gsl_matrix_complex_const_submatrix (W, j + jb, 0, N - j - jb, k);
+          gsl_matrix_complex_view A21 = gsl_matrix_complex_submatrix (A, j + jb, j, N - j - jb, jb);
+
+          gsl_blas_zgemm (CblasNoTrans, CblasConjTrans, neg_one, &V2.matrix, &W1.matrix,
+                          one, &A21.matrix);
+          gsl_blas_zgemm (CblasNoTrans, CblasConjTrans, neg_one, &W2.matrix, &V1.matrix,
+                          one, &A21.matrix);
+        }
+    }
+}
 
 /*  Form the orthogonal matrix U from the packed QR matrix */
 
@@ -18,9 +18,19 @@
  */
 
 #include <config.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
+#include <gsl/gsl_blas.h>
+
+#include "recurse.h"
+
+static void hessenberg_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k);
+static void hessenberg_decomp_panel (gsl_matrix * A, const size_t k, gsl_vector * tau,
+                                     gsl_matrix * T, gsl_matrix * Y, gsl_vector * work);
+static void hessenberg_apply_left (const gsl_matrix * V, const gsl_matrix * T,
+                                   gsl_matrix * C, gsl_matrix * W);
 
 /*
 gsl_linalg_hessenberg_decomp()
@@ -61,6 +71,13 @@ row i + 3, column i, and so on.
 Also note that for the purposes of computing U(i),
 v(1:i) = 0, v(i + 1) = 1, and v(i+2:n) is what is stored in
 column i of A beneath the subdiagonal.
+
+For N > CROSSOVER_HESSENBERG, the columns are reduced in panels of
+HESSENBERG_BLOCK. The reflectors of a panel are accumulated as
+I - V T V^t together with Y = A V T, and the rest of the matrix is
+updated once per panel with Level 3 BLAS, as in LAPACK's dgehrd.f
+and dlahr2.f. The last CROSSOVER_HESSENBERG columns are reduced with
+the Level 2 algorithm.
 */
 
 int
@@ -84,51 +101,318 @@ gsl_linalg_hessenberg_decomp(gsl_matrix *A, gsl_vector *tau)
     }
   else
     {
-      size_t i;           /* looping */
-      gsl_vector_view c,  /* matrix column */
-                      hv; /* householder vector */
-      gsl_matrix_view m;
-      double tau_i;       /* beta in algorithm 7.4.2 */
+      size_t i = 0;
 
-      for (i = 0; i < N - 2; ++i)
+      if (N > CROSSOVER_HESSENBERG)
         {
-          /*
-           * make a copy of A(i + 1:n, i) and store it in the section
-           * of 'tau' that we haven't stored coefficients in yet
-           */
+          const size_t nb = HESSENBERG_BLOCK;
+          gsl_matrix *T = gsl_matrix_alloc (nb, nb);
+          gsl_matrix *Y = gsl_matrix_alloc (N, nb);
+          gsl_matrix *W = gsl_matrix_alloc (nb, N);
+          gsl_vector *work = gsl_vector_alloc (2 * N);
+
+          if (T == NULL || Y == NULL || W == NULL || work == NULL)
+            {
+              if (T)
+                gsl_matrix_free (T);
+              if (Y)
+                gsl_matrix_free (Y);
+              if (W)
+                gsl_matrix_free (W);
+              if (work)
+                gsl_vector_free (work);
+
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
+
+          while (i + CROSSOVER_HESSENBERG < N)
+            {
+              const size_t ib = GSL_MIN (nb, N - CROSSOVER_HESSENBERG - i);
+              gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+              gsl_matrix_view Yb = gsl_matrix_submatrix (Y, 0, 0, N, ib);
+              gsl_matrix_view V = gsl_matrix_submatrix (A, i + 1, i, N - i - 1, ib);
+              double *ptr = gsl_matrix_ptr (A, i + ib, i + ib - 1);
+              double ei;
+              size_t j;
+
+              hessenberg_decomp_panel (A, i, tau, &Tb.matrix, &Yb.matrix, work);
+
+              /* right update of the trailing columns, A = A - Y V2' */
+              ei = *ptr;
+              *ptr = 1.0;
+
+              {
+                gsl_matrix_view V2 = gsl_matrix_submatrix (A, i + ib, i, N - i - ib, ib);
+                gsl_matrix_view A2 = gsl_matrix_submatrix (A, 0, i + ib, N, N - i - ib);
+
+                gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &Yb.matrix, &V2.matrix,
+                                1.0, &A2.matrix);
+              }
+
+              *ptr = ei;
+
+              /* right update of rows 0:i of the panel columns */
+              if (ib > 1)
+                {
+                  gsl_matrix_view V1 = gsl_matrix_submatrix (A, i + 1, i, ib - 1, ib - 1);
+                  gsl_matrix_view Y1 = gsl_matrix_submatrix (Y, 0, 0, i + 1, ib - 1);
+
+                  gsl_blas_dtrmm (CblasRight, CblasLower, CblasTrans, CblasUnit, 1.0,
+                                  &V1.matrix, &Y1.matrix);
+
+                  for (j = 0; j < ib - 1; ++j)
+                    {
+                      gsl_vector_view a = gsl_matrix_subcolumn (A, i + j + 1, 0, i + 1);
+                      gsl_vector_view y = gsl_matrix_column (&Y1.matrix, j);
+                      gsl_vector_sub (&a.vector, &y.vector);
+                    }
+                }
+
+              /* left update of the trailing columns, A = (I - V T V')' A */
+              {
+                gsl_matrix_view C = gsl_matrix_submatrix (A, i + 1, i + ib, N - i - 1, N - i - ib);
+                gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, N - i - ib);
+
+                hessenberg_apply_left (&V.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+              }
+
+              i += ib;
+            }
+
+          gsl_matrix_free (T);
+          gsl_matrix_free (Y);
+          gsl_matrix_free (W);
+          gsl_vector_free (work);
+        }
 
-          c = gsl_matrix_subcolumn(A, i, i + 1, N - i - 1);
+      /* reduce the remaining columns with Level 2 BLAS */
+      hessenberg_decomp_L2 (A, tau, i);
 
-          hv = gsl_vector_subvector(tau, i + 1, N - (i + 1));
-          gsl_vector_memcpy(&hv.vector, &c.vector);
+      return GSL_SUCCESS;
+    }
+} /* gsl_linalg_hessenberg_decomp() */
 
-          /* compute householder transformation of A(i+1:n,i) */
-          tau_i = gsl_linalg_householder_transform(&hv.vector);
+/*
+hessenberg_decomp_L2()
+  Reduce columns k:N-3 of A to Hessenberg form with Level 2 BLAS,
+one Householder reflector at a time (algorithm 7.4.2 of Golub &
+Van Loan)
+
+Inputs: A   - N-by-N matrix, with columns 0:k-1 already reduced
+        tau - Householder coefficients, length N
+        k   - first column to reduce
+*/
 
-          /* apply left householder matrix (I - tau_i v v') to A */
-          m = gsl_matrix_submatrix(A, i + 1, i, N - (i + 1), N - i);
-          gsl_linalg_householder_hm(tau_i, &hv.vector, &m.matrix);
+static void
+hessenberg_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k)
+{
+  const size_t N = A->size1;
+  size_t i;           /* looping */
+  gsl_vector_view c,  /* matrix column */
+                  hv; /* householder vector */
+  gsl_matrix_view m;
+  double tau_i;       /* beta in algorithm 7.4.2 */
 
-          /* apply right householder matrix (I - tau_i v v') to A */
-          m = gsl_matrix_submatrix(A, 0, i + 1, N, N - (i + 1));
-          gsl_linalg_householder_mh(tau_i, &hv.vector, &m.matrix);
+  for (i = k; i < N - 2; ++i)
+    {
+      /*
+       * make a copy of A(i + 1:n, i) and store it in the section
+       * of 'tau' that we haven't stored coefficients in yet
+       */
+
+      c = gsl_matrix_subcolumn(A, i, i + 1, N - i - 1);
+
+      hv = gsl_vector_subvector(tau, i + 1, N - (i + 1));
+      gsl_vector_memcpy(&hv.vector, &c.vector);
+
+      /* compute householder transformation of A(i+1:n,i) */
+      tau_i = gsl_linalg_householder_transform(&hv.vector);
+
+      /* apply left householder matrix (I - tau_i v v') to A */
+      m = gsl_matrix_submatrix(A, i + 1, i, N - (i + 1), N - i);
+      gsl_linalg_householder_hm(tau_i, &hv.vector, &m.matrix);
+
+      /* apply right householder matrix (I - tau_i v v') to A */
+      m = gsl_matrix_submatrix(A, 0, i + 1, N, N - (i + 1));
+      gsl_linalg_householder_mh(tau_i, &hv.vector, &m.matrix);
+
+      /* save Householder coefficient */
+      gsl_vector_set(tau, i, tau_i);
+
+      /*
+       * store Householder vector below the subdiagonal in column
+       * i of the matrix. hv(1) does not need to be stored since
+       * it is always 1.
+       */
+      c = gsl_vector_subvector(&c.vector, 1, c.vector.size - 1);
+      hv = gsl_vector_subvector(&hv.vector, 1, hv.vector.size - 1);
+      gsl_vector_memcpy(&c.vector, &hv.vector);
+    }
+}
 
-          /* save Householder coefficient */
-          gsl_vector_set(tau, i, tau_i);
+/*
+hessenberg_decomp_panel()
+  Reduce columns k:k+nb-1 of A to Hessenberg form without updating
+the rest of the matrix. This is LAPACK's dlahr2.f.
+
+Inputs: A    - N-by-N matrix, with columns 0:k-1 already reduced; on
+               output the panel holds the Householder vectors V
+               below the subdiagonal
+        k    - first column of the panel
+        tau  - (output) Householder coefficients tau(k:k+nb-1)
+        T    - (output) nb-by-nb upper triangular matrix such that
+               U(k) ... U(k+nb-1) = I - V T V'
+        Y    - (output) N-by-nb matrix Y = A V T
+        work - workspace, length 2*N
+
+Only rows k+1:N-1 of the panel columns are updated here; the caller
+updates rows 0:k and the trailing columns with Y, V and T.
+*/
 
-          /*
-           * store Householder vector below the subdiagonal in column
-           * i of the matrix. hv(1) does not need to be stored since
-           * it is always 1.
-           */
-          c = gsl_vector_subvector(&c.vector, 1, c.vector.size - 1);
-          hv = gsl_vector_subvector(&hv.vector, 1, hv.vector.size - 1);
-          gsl_vector_memcpy(&c.vector, &hv.vector);
+static void
+hessenberg_decomp_panel (gsl_matrix * A, const size_t k, gsl_vector * tau,
+                         gsl_matrix * T, gsl_matrix * Y, gsl_vector * work)
+{
+  const size_t N = A->size1;
+  const size_t nb = T->size1;
+  const size_t m = N - k - 1;
+  double ei = 0.0;
+  size_t j;
+
+  for (j = 0; j < nb; ++j)
+    {
+      const size_t c = k + j;
+      gsl_vector_view b = gsl_matrix_subcolumn (A, c, k + 1, m);
+      gsl_vector_view v = gsl_matrix_subcolumn (A, c, c + 1, N - c - 1);
+      gsl_vector_view vc = gsl_vector_subvector (work, 0, N - c - 1);
+      gsl_vector_view yc = gsl_vector_subvector (work, N, m);
+      gsl_vector_view y = gsl_matrix_subcolumn (Y, j, k + 1, m);
+      double tau_j;
+
+      if (j > 0)
+        {
+          gsl_matrix_view Yj = gsl_matrix_submatrix (Y, k + 1, 0, m, j);
+          gsl_vector_view vrow = gsl_matrix_subrow (A, c, k, j);
+          gsl_matrix_view V1 = gsl_matrix_submatrix (A, k + 1, k, j, j);
+          gsl_matrix_view V2 = gsl_matrix_submatrix (A, c + 1, k, N - c - 1, j);
+          gsl_matrix_view Tj = gsl_matrix_submatrix (T, 0, 0, j, j);
+          gsl_vector_view t = gsl_matrix_subcolumn (T, j, 0, j);
+          gsl_vector_view b1 = gsl_vector_subvector (&b.vector, 0, j);
+          gsl_vector_view b2 = gsl_vector_subvector (&b.vector, j, m - j);
+
+          /* right update of A(k+1:N-1,c), b = b - Y V(c,:)' */
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yj.matrix, &vrow.vector, 1.0, &b.vector);
+
+          /* left update, b = (I - V T' V') b, using T(0:j-1,j) as workspace */
+          gsl_vector_memcpy (&t.vector, &b1.vector);
+          gsl_blas_dtrmv (CblasLower, CblasTrans, CblasUnit, &V1.matrix, &t.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &V2.matrix, &b2.vector, 1.0, &t.vector);
+          gsl_blas_dtrmv (CblasUpper, CblasTrans, CblasNonUnit, &Tj.matrix, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &V2.matrix, &t.vector, 1.0, &b2.vector);
+          gsl_blas_dtrmv (CblasLower, CblasNoTrans, CblasUnit, &V1.matrix, &t.vector);
+          gsl_blas_daxpy (-1.0, &t.vector, &b1.vector);
+
+          gsl_matrix_set (A, c, c - 1, ei);
         }
 
-      return GSL_SUCCESS;
+      /* generate the reflector to annihilate A(c+2:N-1,c) */
+      tau_j = gsl_linalg_householder_transform (&v.vector);
+      ei = gsl_vector_get (&v.vector, 0);
+      gsl_vector_set (&v.vector, 0, 1.0);
+      gsl_vector_set (tau, c, tau_j);
+
+      /* Y(k+1:N-1,j) = tau (A(k+1:N-1,c+1:N-1) v - Y T(0:j-1,j)), on contiguous copies */
+      gsl_vector_memcpy (&vc.vector, &v.vector);
+
+      {
+        gsl_matrix_view Ar = gsl_matrix_submatrix (A, k + 1, c + 1, m, N - c - 1);
+        gsl_blas_dgemv (CblasNoTrans, 1.0, &Ar.matrix, &vc.vector, 0.0, &yc.vector);
+      }
+
+      if (j > 0)
+        {
+          gsl_matrix_view Yj = gsl_matrix_submatrix (Y, k + 1, 0, m, j);
+          gsl_matrix_view V2 = gsl_matrix_submatrix (A, c + 1, k, N - c - 1, j);
+          gsl_matrix_view Tj = gsl_matrix_submatrix (T, 0, 0, j, j);
+          gsl_vector_view t = gsl_matrix_subcolumn (T, j, 0, j);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &V2.matrix, &vc.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yj.matrix, &t.vector, 1.0, &yc.vector);
+
+          /* T(0:j-1,j) = -tau T(0:j-1,0:j-1) T(0:j-1,j) */
+          gsl_blas_dscal (-tau_j, &t.vector);
+          gsl_blas_dtrmv (CblasUpper, CblasNoTrans, CblasNonUnit, &Tj.matrix, &t.vector);
+        }
+
+      gsl_blas_dscal (tau_j, &yc.vector);
+      gsl_vector_memcpy (&y.vector, &yc.vector);
+      gsl_matrix_set (T, j, j, tau_j);
     }
-} /* gsl_linalg_hessenberg_decomp() */
+
+  gsl_matrix_set (A, k + nb, k + nb - 1, ei);
+
+  /* Y(0:k,:) = A(0:k,k+1:N-1) V T */
+  {
+    gsl_matrix_view Y1 = gsl_matrix_submatrix (Y, 0, 0, k + 1, nb);
+    gsl_matrix_view A1 = gsl_matrix_submatrix (A, 0, k + 1, k + 1, nb);
+    gsl_matrix_view V1 = gsl_matrix_submatrix (A, k + 1, k, nb, nb);
+
+    gsl_matrix_memcpy (&Y1.matrix, &A1.matrix);
+    gsl_blas_dtrmm (CblasRight, CblasLower, CblasNoTrans, CblasUnit, 1.0,
+                    &V1.matrix, &Y1.matrix);
+
+    if (N > k + nb + 1)
+      {
+        gsl_matrix_view A2 = gsl_matrix_submatrix (A, 0, k + nb + 1, k + 1, N - k - nb - 1);
+        gsl_matrix_view V2 = gsl_matrix_submatrix (A, k + nb + 1, k, N - k - nb - 1, nb);
+
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &A2.matrix, &V2.matrix,
+                        1.0, &Y1.matrix);
+      }
+
+    gsl_blas_dtrmm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0,
+                    T, &Y1.matrix);
+  }
+}
+
+/*
+hessenberg_apply_left()
+  Apply a block reflector from the left, C = (I - V T V')' C, with
+Level 3 BLAS. This is LAPACK's dlarfb.f for forward, columnwise
+storage.
+
+Inputs: V - m-by-nb matrix of Householder vectors, unit lower
+            trapezoidal; the diagonal and upper triangle are not
+            referenced
+        T - nb-by-nb upper triangular factor
+        C - m-by-n matrix
+        W - nb-by-n workspace
+*/
+
+static void
+hessenberg_apply_left (const gsl_matrix * V, const gsl_matrix * T,
+                       gsl_matrix * C, gsl_matrix * W)
+{
+  const size_t m = V->size1;
+  const size_t nb = V->size2;
+  gsl_matrix_const_view V1 = gsl_matrix_const_submatrix (V, 0, 0, nb, nb);
+  gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (V, nb, 0, m - nb, nb);
+  gsl_matrix_view C1 = gsl_matrix_submatrix (C, 0, 0, nb, C->size2);
+  gsl_matrix_view C2 = gsl_matrix_submatrix (C, nb, 0, m - nb, C->size2);
+
+  /* W = T' V' C */
+  gsl_matrix_memcpy (W, &C1.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasTrans, CblasUnit, 1.0,
+                  &V1.matrix, W);
+  gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &V2.matrix, &C2.matrix, 1.0, W);
+  gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasTrans, CblasNonUnit, 1.0, T, W);
+
+  /* C = C - V W */
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &V2.matrix, W, 1.0, &C2.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0,
+                  &V1.matrix, W);
+  gsl_matrix_sub (&C1.matrix, W);
+}
 
 /*
 gsl_linalg_hessenberg_unpack()
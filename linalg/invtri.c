@@ -29,10 +29,14 @@
 #include <gsl/gsl_linalg.h>
 
 #include "recurse.h"
+#include "thread.h"
 
 static int triangular_inverse_L2(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T);
 static int triangular_inverse_L3(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T);
 static int triangular_singular(const gsl_matrix * T);
+#ifdef _OPENMP
+static int triangular_inverse_task(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T);
+#endif
 
 int
 gsl_linalg_tri_invert(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T)
@@ -51,6 +55,21 @@ gsl_linalg_tri_invert(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T)
       if (status)
         return status;
 
+#ifdef _OPENMP
+      {
+        const int nthreads = linalg_thread_count(N);
+
+        if (nthreads > 1)
+          {
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+            status = triangular_inverse_task(Uplo, Diag, T);
+
+            return status;
+          }
+      }
+#endif
+
       return triangular_inverse_L3(Uplo, Diag, T);
     }
 }
@@ -228,6 +247,123 @@ triangular_inverse_L3(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T)
     }
 }
 
+#ifdef _OPENMP
+
+/*
+triangular_trmm_task()
+  Compute B = alpha op(T) B or B = alpha B op(T) with tasks on
+independent blocks of B, for a nonsingular triangular T
+
+Inputs: Side  - CblasLeft or CblasRight
+        Uplo  - CblasUpper or CblasLower
+        Diag  - unit triangular?
+        alpha - scale factor
+        T     - triangular matrix
+        B     - matrix to be multiplied
+*/
+
+static void
+triangular_trmm_task(CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag,
+                     const double alpha, const gsl_matrix * T, gsl_matrix * B)
+{
+  const size_t nb = LINALG_THREAD_BLOCK;
+  const size_t n = (Side == CblasLeft) ? B->size2 : B->size1;
+  size_t i;
+
+  /* the columns of B are independent for Side = Left, its rows for Side = Right */
+  for (i = 0; i < n; i += nb)
+    {
+#pragma omp task
+      {
+        const size_t ni = GSL_MIN(nb, n - i);
+        gsl_matrix_view Bi = (Side == CblasLeft) ?
+                             gsl_matrix_submatrix(B, 0, i, B->size1, ni) :
+                             gsl_matrix_submatrix(B, i, 0, ni, B->size2);
+
+        gsl_blas_dtrmm(Side, Uplo, CblasNoTrans, Diag, alpha, T, &Bi.matrix);
+      }
+    }
+
+#pragma omp taskwait
+}
+
+/*
+triangular_inverse_task()
+  Invert a triangular matrix T using OpenMP tasks; must be called
+from a single thread of a parallel region
+
+Inputs: Uplo - CblasUpper or CblasLower
+        Diag - unit triangular?
+        T    - on output the upper (or lower) part of T
+               is replaced by its inverse
+
+Return: success/error
+
+Notes:
+1) Unlike triangular_inverse_L3, the diagonal blocks T11 and T22 are
+inverted first, concurrently, and the off-diagonal block is then formed
+with two triangular multiplications, e.g.
+
+T21 := -T22^{-1} T21 T11^{-1}
+
+whose columns (or rows) are computed by independent tasks.
+*/
+
+static int
+triangular_inverse_task(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_matrix * T)
+{
+  const size_t N = T->size1;
+
+  if (N <= LINALG_THREAD_BLOCK)
+    {
+      return triangular_inverse_L3(Uplo, Diag, T);
+    }
+  else
+    {
+      int status1, status2;
+      const size_t N1 = GSL_LINALG_SPLIT(N);
+      const size_t N2 = N - N1;
+      gsl_matrix_view T11 = gsl_matrix_submatrix(T, 0, 0, N1, N1);
+      gsl_matrix_view T12 = gsl_matrix_submatrix(T, 0, N1, N1, N2);
+      gsl_matrix_view T21 = gsl_matrix_submatrix(T, N1, 0, N2, N1);
+      gsl_matrix_view T22 = gsl_matrix_submatrix(T, N1, N1, N2, N2);
+
+#pragma omp task shared(status1, T11)
+      status1 = triangular_inverse_task(Uplo, Diag, &T11.matrix);
+
+#pragma omp task shared(status2, T22)
+      status2 = triangular_inverse_task(Uplo, Diag, &T22.matrix);
+
+#pragma omp taskwait
+
+      if (status1)
+        return status1;
+      else if (status2)
+        return status2;
+
+      if (Uplo == CblasLower)
+        {
+          /* T21 = - T21 * T11^{-1} */
+          triangular_trmm_task(CblasRight, Uplo, Diag, -1.0, &T11.matrix, &T21.matrix);
+
+          /* T21 = T22^{-1} * T21 */
+          triangular_trmm_task(CblasLeft, Uplo, Diag, 1.0, &T22.matrix, &T21.matrix);
+        }
+      else
+        {
+          /* T12 = - T11^{-1} * T12 */
+          triangular_trmm_task(CblasLeft, Uplo, Diag, -1.0, &T11.matrix, &T12.matrix);
+
+          /* T12 = T12 * T22^{-1} */
+          triangular_trmm_task(CblasRight, Uplo, Diag, 1.0, &T22.matrix, &T12.matrix);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+#endif /* _OPENMP */
+
 static int
 triangular_singular(const gsl_matrix * T)
 {
@@ -29,11 +29,15 @@
 #include <gsl/gsl_linalg.h>
 
 #include "recurse.h"
+#include "thread.h"
 
 static int LU_decomp_L2 (gsl_matrix * A, gsl_vector_uint * ipiv);
 static int LU_decomp_L3 (gsl_matrix * A, gsl_vector_uint * ipiv);
 static int singular (const gsl_matrix * LU);
 static int apply_pivots(gsl_matrix * A, const gsl_vector_uint * ipiv);
+#ifdef _OPENMP
+static int LU_decomp_task (gsl_matrix * A, gsl_vector_uint * ipiv, const int nthreads);
+#endif
 
 /* Factorise a general N x N matrix A into,
  *
@@ -75,19 +79,30 @@ gsl_linalg_LU_decomp (gsl_matrix * A, gsl_permutation * p, int *signum)
       gsl_vector_uint * ipiv = gsl_vector_uint_alloc(minMN);
       gsl_matrix_view AL = gsl_matrix_submatrix(A, 0, 0, M, minMN);
       size_t i;
+#ifdef _OPENMP
+      const int nthreads = linalg_thread_count(minMN);
 
-      status = LU_decomp_L3 (&AL.matrix, ipiv);
-
-      /* process remaining right matrix */
-      if (M < N)
+      if (nthreads > 1)
+        {
+          /* factor the whole matrix, including AR, with tasks */
+          status = LU_decomp_task (A, ipiv, nthreads);
+        }
+      else
+#endif
         {
-          gsl_matrix_view AR = gsl_matrix_submatrix(A, 0, M, M, N - M);
+          status = LU_decomp_L3 (&AL.matrix, ipiv);
+
+          /* process remaining right matrix */
+          if (M < N)
+            {
+              gsl_matrix_view AR = gsl_matrix_submatrix(A, 0, M, M, N - M);
 
-          /* apply pivots to AR */
-          apply_pivots(&AR.matrix, ipiv);
+              /* apply pivots to AR */
+              apply_pivots(&AR.matrix, ipiv);
 
-          /* AR = AL^{-1} AR */
-          gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &AL.matrix, &AR.matrix);
+              /* AR = AL^{-1} AR */
+              gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &AL.matrix, &AR.matrix);
+            }
         }
 
       /* convert ipiv array to permutation */
@@ -300,6 +315,157 @@ LU_decomp_L3 (gsl_matrix * A, gsl_vector_uint * ipiv)
     }
 }
 
+#ifdef _OPENMP
+
+/*
+LU_update_block()
+  Apply the pivots and the L factor of the panel in columns [k0,k1) of A
+to the columns [j0,j1) to the right of it
+
+Inputs: A    - matrix being factored
+        k0   - first row and column of the panel
+        k1   - one past the last column of the panel
+        ipiv - pivots of the panel, relative to row k0
+        j0   - first column to update
+        j1   - one past the last column to update
+*/
+
+static void
+LU_update_block (gsl_matrix * A, const size_t k0, const size_t k1,
+                 const gsl_vector_uint * ipiv, const size_t j0, const size_t j1)
+{
+  const size_t M = A->size1;
+  gsl_matrix_view A11 = gsl_matrix_submatrix(A, k0, k0, k1 - k0, k1 - k0);
+  gsl_matrix_view AR = gsl_matrix_submatrix(A, k0, j0, M - k0, j1 - j0);
+  gsl_matrix_view A12 = gsl_matrix_submatrix(A, k0, j0, k1 - k0, j1 - j0);
+
+  apply_pivots(&AR.matrix, ipiv);
+
+  /* A12 = A11^{-1} A12 */
+  gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &A11.matrix, &A12.matrix);
+
+  if (k1 < M)
+    {
+      gsl_matrix_view A21 = gsl_matrix_submatrix(A, k1, k0, M - k1, k1 - k0);
+      gsl_matrix_view A22 = gsl_matrix_submatrix(A, k1, j0, M - k1, j1 - j0);
+
+      /* A22 = A22 - A21 * A12 */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, -1.0, &A21.matrix, &A12.matrix, 1.0, &A22.matrix);
+    }
+}
+
+/*
+LU_decomp_task
+  LU decomposition with partial pivoting using OpenMP tasks
+
+Inputs: A        - on input, M-by-N matrix to be factored; on output, L and U factors
+        ipiv     - (output) array containing row swaps, length MIN(M,N)
+        nthreads - number of threads
+
+Return: GSL_SUCCESS if successful; otherwise a positive integer k
+indicating that U(k,k) is zero and therefore singular; in this case,
+the LU factorization is still completed
+
+Notes:
+1) The matrix is split into column blocks of width LINALG_THREAD_BLOCK.
+The panel of block k is factored by one task with the recursive algorithm,
+using pivots relative to its first row. Each block j > k is then updated
+by its own task, and the row swaps of the panel are applied to each block
+j < k by another. The tasks wait only for their data, so the panel of
+block k + 1 is factored while the other updates of step k are running.
+
+2) Unlike the recursive algorithm, which stops at the first singular
+diagonal block, the whole matrix is always factored.
+*/
+
+static int
+LU_decomp_task (gsl_matrix * A, gsl_vector_uint * ipiv, const int nthreads)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t minMN = GSL_MIN(M, N);
+  const size_t nb = LINALG_THREAD_BLOCK;
+  const size_t npanels = (minMN + nb - 1) / nb;
+  const size_t nblocks = (N + nb - 1) / nb;
+  char *dep = malloc(nblocks); /* dependency tokens for the column blocks */
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  if (dep == NULL)
+    {
+      GSL_ERROR("failed to allocate space for dependencies", GSL_ENOMEM);
+    }
+
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+  {
+    size_t k, j;
+
+    for (k = 0; k < npanels; ++k)
+      {
+        const size_t k0 = k * nb;
+        const size_t k1 = GSL_MIN(k0 + nb, minMN);
+        const size_t kend = GSL_MIN(k0 + nb, N);
+
+#pragma omp task shared(status) depend(inout: dep[k])
+        {
+          gsl_matrix_view AP = gsl_matrix_submatrix(A, k0, k0, M - k0, k1 - k0);
+          gsl_vector_uint_view ipivk = gsl_vector_uint_subvector(ipiv, k0, k1 - k0);
+          int s = LU_decomp_L3(&AP.matrix, &ipivk.vector);
+
+          if (s)
+            {
+#pragma omp critical (LU_decomp_task)
+              if (status == GSL_SUCCESS || (int) k0 + s < status)
+                status = (int) k0 + s;
+            }
+
+          /* for M < N, the last panel may not fill its column block */
+          if (kend > k1)
+            LU_update_block(A, k0, k1, &ipivk.vector, k1, kend);
+        }
+
+        for (j = 0; j < nblocks; ++j)
+          {
+            const size_t j0 = j * nb;
+            const size_t j1 = GSL_MIN(j0 + nb, N);
+
+            if (j == k)
+              continue;
+
+#pragma omp task depend(in: dep[k]) depend(inout: dep[j])
+            {
+              gsl_vector_uint_view ipivk = gsl_vector_uint_subvector(ipiv, k0, k1 - k0);
+
+              if (j > k)
+                {
+                  LU_update_block(A, k0, k1, &ipivk.vector, j0, j1);
+                }
+              else
+                {
+                  /* apply the row swaps of the panel to the L factor on its left */
+                  gsl_matrix_view AL = gsl_matrix_submatrix(A, k0, j0, M - k0, j1 - j0);
+                  apply_pivots(&AL.matrix, &ipivk.vector);
+                }
+            }
+          }
+      }
+  }
+
+  free(dep);
+
+  /* shift pivots */
+  for (i = 0; i < minMN; ++i)
+    {
+      unsigned int * ptr = gsl_vector_uint_ptr(ipiv, i);
+      *ptr += (i / nb) * nb;
+    }
+
+  return status;
+}
+
+#endif /* _OPENMP */
+
 int
 gsl_linalg_LU_solve (const gsl_matrix * LU, const gsl_permutation * p, const gsl_vector * b, gsl_vector * x)
 {
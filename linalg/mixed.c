@@ -0,0 +1,661 @@
+/* linalg/mixed.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+#include "recurse.h"
+
+/* Mixed precision solution of A x = b.
+
+   The matrix is rounded to single precision and factorized, either by
+   LU with partial pivoting or by Cholesky, which costs about half as
+   much as in double precision in memory traffic and, with an optimized
+   BLAS, in time.  The solution is then refined with residuals computed
+   in double precision,
+
+     r = b - A x,  solve A d = r with the single precision factors,  x = x + d
+
+   until the backward error is at the level of double precision, which
+   happens when cond(A) is well below 1/FLT_EPSILON.  When the
+   matrix cannot be rounded or factorized in single precision, or the
+   refinement stalls, the matrix is factorized in double precision and
+   the system solved with those factors instead.
+
+   See J. Langou et al, "Exploiting the performance of 32 bit floating
+   point arithmetic in obtaining 64 bit accuracy", Proceedings of the
+   2006 ACM/IEEE Conference on Supercomputing, and LAPACK DSGESV and
+   DSPOSV. */
+
+#define MIXED_MAXITER 30
+
+static int mixed_round (const int lower, const gsl_matrix * A, gsl_matrix_float * Af);
+static double mixed_norm_inf (const int lower, const gsl_matrix * A);
+static int mixed_solve (const int lower, const gsl_matrix * A, const gsl_vector * b,
+                        gsl_vector * x, size_t * niter, double * berr,
+                        gsl_linalg_mixed_workspace * w);
+static int mixed_decomp_double (const int lower, const gsl_matrix * A,
+                                gsl_linalg_mixed_workspace * w);
+static int LU_float_decomp_L2 (gsl_matrix_float * A, gsl_vector_uint * ipiv);
+static int LU_float_decomp_L3 (gsl_matrix_float * A, gsl_vector_uint * ipiv);
+static int LU_float_apply_pivots (gsl_matrix_float * A, const gsl_vector_uint * ipiv);
+static int cholesky_float_decomp_L2 (gsl_matrix_float * A);
+static int cholesky_float_decomp_L3 (gsl_matrix_float * A);
+
+gsl_linalg_mixed_workspace *
+gsl_linalg_mixed_alloc (const size_t N)
+{
+  gsl_linalg_mixed_workspace * w;
+
+  if (N == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_mixed_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->N = N;
+  w->maxiter = MIXED_MAXITER;
+
+  w->Af = gsl_matrix_float_alloc (N, N);
+  w->ipiv = gsl_vector_uint_alloc (N);
+  w->rf = gsl_vector_float_alloc (N);
+  w->r = gsl_vector_alloc (N);
+
+  if (w->Af == 0 || w->ipiv == 0 || w->rf == 0 || w->r == 0)
+    {
+      gsl_linalg_mixed_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for factors", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_linalg_mixed_free (gsl_linalg_mixed_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->Af)
+    gsl_matrix_float_free (w->Af);
+
+  if (w->ipiv)
+    gsl_vector_uint_free (w->ipiv);
+
+  if (w->rf)
+    gsl_vector_float_free (w->rf);
+
+  if (w->r)
+    gsl_vector_free (w->r);
+
+  if (w->A)
+    gsl_matrix_free (w->A);
+
+  if (w->p)
+    gsl_permutation_free (w->p);
+
+  free (w);
+}
+
+/*
+gsl_linalg_LU_mixed_decomp()
+  LU decomposition in single precision with partial pivoting, falling
+back to double precision when A cannot be rounded to single precision
+or is singular in single precision
+
+Inputs: A - N-by-N matrix, not modified
+        w - workspace
+
+Return: success/error; a positive value k indicates that U(k,k)
+of the double precision factorization is zero, as for gsl_linalg_LU_decomp
+*/
+
+int
+gsl_linalg_LU_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->N)
+    {
+      GSL_ERROR ("matrix size must match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      w->anorm = mixed_norm_inf (0, A);
+      w->fallback = 0;
+
+      if (mixed_round (0, A, w->Af) == GSL_SUCCESS &&
+          LU_float_decomp_L3 (w->Af, w->ipiv) == GSL_SUCCESS)
+        return GSL_SUCCESS;
+
+      return mixed_decomp_double (0, A, w);
+    }
+}
+
+int
+gsl_linalg_LU_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                           size_t * niter, double * berr, gsl_linalg_mixed_workspace * w)
+{
+  return mixed_solve (0, A, b, x, niter, berr, w);
+}
+
+/*
+gsl_linalg_cholesky_mixed_decomp()
+  Cholesky decomposition in single precision, falling back to
+double precision when A cannot be rounded to single precision or is
+not positive definite in single precision
+
+Inputs: A - N-by-N symmetric positive definite matrix, only the
+            lower triangle is referenced; not modified
+        w - workspace
+*/
+
+int
+gsl_linalg_cholesky_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("Cholesky decomposition requires square matrix", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->N)
+    {
+      GSL_ERROR ("matrix size must match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      w->anorm = mixed_norm_inf (1, A);
+      w->fallback = 0;
+
+      if (mixed_round (1, A, w->Af) == GSL_SUCCESS &&
+          cholesky_float_decomp_L3 (w->Af) == GSL_SUCCESS)
+        return GSL_SUCCESS;
+
+      return mixed_decomp_double (1, A, w);
+    }
+}
+
+int
+gsl_linalg_cholesky_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                                 size_t * niter, double * berr, gsl_linalg_mixed_workspace * w)
+{
+  return mixed_solve (1, A, b, x, niter, berr, w);
+}
+
+/* round A, or its lower triangle, to single precision; returns
+   GSL_EOVRFLW if an element is out of range */
+static int
+mixed_round (const int lower, const gsl_matrix * A, gsl_matrix_float * Af)
+{
+  const size_t N = A->size1;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    {
+      const size_t jmax = lower ? i + 1 : N;
+      const double * a = gsl_matrix_const_ptr (A, i, 0);
+      float * af = gsl_matrix_float_ptr (Af, i, 0);
+
+      for (j = 0; j < jmax; ++j)
+        {
+          if (fabs (a[j]) > GSL_FLT_MAX)
+            return GSL_EOVRFLW;
+
+          af[j] = (float) a[j];
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* ||A||_inf, of the symmetric matrix stored in the lower triangle of A
+   if lower is set */
+static double
+mixed_norm_inf (const int lower, const gsl_matrix * A)
+{
+  const size_t N = A->size1;
+  double norm = 0.0;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    {
+      double sum = 0.0;
+
+      if (lower)
+        {
+          for (j = 0; j <= i; ++j)
+            sum += fabs (gsl_matrix_get (A, i, j));
+
+          for (j = i + 1; j < N; ++j)
+            sum += fabs (gsl_matrix_get (A, j, i));
+        }
+      else
+        {
+          for (j = 0; j < N; ++j)
+            sum += fabs (gsl_matrix_get (A, i, j));
+        }
+
+      norm = GSL_MAX (norm, sum);
+    }
+
+  return norm;
+}
+
+/* factorize A in double precision, keeping the factors in the workspace */
+static int
+mixed_decomp_double (const int lower, const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  int status, signum;
+
+  if (w->A == NULL)
+    {
+      w->A = gsl_matrix_alloc (w->N, w->N);
+      if (w->A == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for double precision factors", GSL_ENOMEM);
+        }
+    }
+
+  if (!lower && w->p == NULL)
+    {
+      w->p = gsl_permutation_alloc (w->N);
+      if (w->p == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for permutation", GSL_ENOMEM);
+        }
+    }
+
+  gsl_matrix_memcpy (w->A, A);
+  w->fallback = 1;
+
+  if (lower)
+    status = gsl_linalg_cholesky_decomp1 (w->A);
+  else
+    status = gsl_linalg_LU_decomp (w->A, w->p, &signum);
+
+  return status;
+}
+
+/* solve with the single precision factors in place: rf := A^{-1} rf */
+static void
+mixed_svx_float (const int lower, gsl_linalg_mixed_workspace * w)
+{
+  if (lower)
+    {
+      gsl_blas_strsv (CblasLower, CblasNoTrans, CblasNonUnit, w->Af, w->rf);
+      gsl_blas_strsv (CblasLower, CblasTrans, CblasNonUnit, w->Af, w->rf);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < w->N; ++i)
+        {
+          size_t pi = gsl_vector_uint_get (w->ipiv, i);
+
+          if (pi != i)
+            gsl_vector_float_swap_elements (w->rf, i, pi);
+        }
+
+      gsl_blas_strsv (CblasLower, CblasNoTrans, CblasUnit, w->Af, w->rf);
+      gsl_blas_strsv (CblasUpper, CblasNoTrans, CblasNonUnit, w->Af, w->rf);
+    }
+}
+
+/* r := b - A x */
+static void
+mixed_residual (const int lower, const gsl_matrix * A, const gsl_vector * b,
+                const gsl_vector * x, gsl_vector * r)
+{
+  gsl_vector_memcpy (r, b);
+
+  if (lower)
+    gsl_blas_dsymv (CblasLower, -1.0, A, x, 1.0, r);
+  else
+    gsl_blas_dgemv (CblasNoTrans, -1.0, A, x, 1.0, r);
+}
+
+/* solve with the single precision factors, refining in double
+   precision, or with the double precision factors after a fallback */
+static int
+mixed_solve (const int lower, const gsl_matrix * A, const gsl_vector * b,
+             gsl_vector * x, size_t * niter, double * berr,
+             gsl_linalg_mixed_workspace * w)
+{
+  const size_t N = w->N;
+
+  if (A->size1 != N || A->size2 != N)
+    {
+      GSL_ERROR ("matrix size must match workspace", GSL_EBADLEN);
+    }
+  else if (b->size != N)
+    {
+      GSL_ERROR ("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != N)
+    {
+      GSL_ERROR ("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const double tol = sqrt ((double) N) * GSL_DBL_EPSILON * w->anorm;
+      const double bnorm = fabs (gsl_vector_get (b, gsl_blas_idamax (b)));
+      double rnorm = 0.0, xnorm = 0.0, rprev = GSL_POSINF;
+      size_t iter = 0;
+      int status;
+
+      if (!w->fallback)
+        {
+          gsl_vector_set_zero (x);
+          gsl_vector_memcpy (w->r, b);
+          rnorm = bnorm;
+
+          while (1)
+            {
+              size_t i;
+
+              /* x := x + A^{-1} r, with r scaled to avoid underflow in
+                 single precision */
+              if (rnorm > 0.0)
+                {
+                  for (i = 0; i < N; ++i)
+                    gsl_vector_float_set (w->rf, i, (float) (gsl_vector_get (w->r, i) / rnorm));
+
+                  mixed_svx_float (lower, w);
+
+                  for (i = 0; i < N; ++i)
+                    *gsl_vector_ptr (x, i) += rnorm * gsl_vector_float_get (w->rf, i);
+                }
+
+              mixed_residual (lower, A, b, x, w->r);
+              rnorm = fabs (gsl_vector_get (w->r, gsl_blas_idamax (w->r)));
+              xnorm = fabs (gsl_vector_get (x, gsl_blas_idamax (x)));
+
+              if (!gsl_finite (rnorm) || !gsl_finite (xnorm))
+                break;
+
+              if (rnorm <= xnorm * tol)
+                {
+                  *niter = iter;
+                  *berr = (rnorm > 0.0) ? rnorm / (w->anorm * xnorm + bnorm) : 0.0;
+                  return GSL_SUCCESS;
+                }
+
+              /* stop when the residual is not reduced by half */
+              if (++iter >= w->maxiter || rnorm > 0.5 * rprev)
+                break;
+
+              rprev = rnorm;
+            }
+
+          /* refinement did not converge */
+          status = mixed_decomp_double (lower, A, w);
+          if (status == GSL_EDOM)
+            {
+              if (lower)
+                {
+                  GSL_ERROR ("matrix is not positive definite", GSL_EDOM);
+                }
+              else
+                {
+                  GSL_ERROR ("matrix is singular", GSL_EDOM);
+                }
+            }
+          else if (status)
+            {
+              return status;
+            }
+        }
+
+      if (lower)
+        status = gsl_linalg_cholesky_solve (w->A, b, x);
+      else
+        status = gsl_linalg_LU_solve (w->A, w->p, b, x);
+
+      if (status)
+        return status;
+
+      mixed_residual (lower, A, b, x, w->r);
+      rnorm = fabs (gsl_vector_get (w->r, gsl_blas_idamax (w->r)));
+      xnorm = fabs (gsl_vector_get (x, gsl_blas_idamax (x)));
+
+      *niter = iter;
+      *berr = (rnorm > 0.0) ? rnorm / (w->anorm * xnorm + bnorm) : 0.0;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+LU_float_decomp_L2
+  single precision version of LU_decomp_L2 in lu.c; returns a positive
+value if a zero pivot is found, without calling the error handler
+*/
+
+static int
+LU_float_decomp_L2 (gsl_matrix_float * A, gsl_vector_uint * ipiv)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t minMN = GSL_MIN (M, N);
+  size_t j;
+
+  for (j = 0; j < minMN; ++j)
+    {
+      gsl_vector_float_view v = gsl_matrix_float_subcolumn (A, j, j, M - j);
+      size_t j_pivot = j + gsl_blas_isamax (&v.vector);
+      float Ajpj = gsl_matrix_float_get (A, j_pivot, j);
+      gsl_vector_float_view v1, v2;
+
+      gsl_vector_uint_set (ipiv, j, j_pivot);
+
+      if (Ajpj == 0.0f)
+        return (int) j + 1;
+
+      if (j_pivot != j)
+        {
+          v1 = gsl_matrix_float_row (A, j);
+          v2 = gsl_matrix_float_row (A, j_pivot);
+          gsl_blas_sswap (&v1.vector, &v2.vector);
+        }
+
+      if (j < M - 1)
+        {
+          v1 = gsl_matrix_float_subcolumn (A, j, j + 1, M - j - 1);
+          gsl_blas_sscal (1.0f / Ajpj, &v1.vector);
+        }
+
+      if (j < minMN - 1)
+        {
+          gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
+          v1 = gsl_matrix_float_subcolumn (A, j, j + 1, M - j - 1);
+          v2 = gsl_matrix_float_subrow (A, j, j + 1, N - j - 1);
+
+          gsl_blas_sger (-1.0f, &v1.vector, &v2.vector, &A22.matrix);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+LU_float_decomp_L3
+  single precision version of the recursive LU_decomp_L3 in lu.c
+*/
+
+static int
+LU_float_decomp_L3 (gsl_matrix_float * A, gsl_vector_uint * ipiv)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (N <= CROSSOVER_LU)
+    {
+      return LU_float_decomp_L2 (A, ipiv);
+    }
+  else
+    {
+      int status;
+      const size_t N1 = GSL_LINALG_SPLIT (N);
+      const size_t N2 = N - N1;
+      const size_t M2 = M - N1;
+      gsl_matrix_float_view A11 = gsl_matrix_float_submatrix (A, 0, 0, N1, N1);
+      gsl_matrix_float_view A12 = gsl_matrix_float_submatrix (A, 0, N1, N1, N2);
+      gsl_matrix_float_view A21 = gsl_matrix_float_submatrix (A, N1, 0, M2, N1);
+      gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, N1, N1, M2, N2);
+      gsl_matrix_float_view AL = gsl_matrix_float_submatrix (A, 0, 0, M, N1);
+      gsl_matrix_float_view AR = gsl_matrix_float_submatrix (A, 0, N1, M, N2);
+      gsl_vector_uint_view ipiv1 = gsl_vector_uint_subvector (ipiv, 0, N1);
+      gsl_vector_uint_view ipiv2 = gsl_vector_uint_subvector (ipiv, N1, N2);
+      size_t i;
+
+      status = LU_float_decomp_L3 (&AL.matrix, &ipiv1.vector);
+      if (status)
+        return status;
+
+      LU_float_apply_pivots (&AR.matrix, &ipiv1.vector);
+
+      /* A12 = A11^{-1} A12 */
+      gsl_blas_strsm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0f, &A11.matrix, &A12.matrix);
+
+      /* A22 = A22 - A21 * A12 */
+      gsl_blas_sgemm (CblasNoTrans, CblasNoTrans, -1.0f, &A21.matrix, &A12.matrix, 1.0f, &A22.matrix);
+
+      status = LU_float_decomp_L3 (&A22.matrix, &ipiv2.vector);
+      if (status)
+        return (int) N1 + status;
+
+      LU_float_apply_pivots (&A21.matrix, &ipiv2.vector);
+
+      for (i = 0; i < N2; ++i)
+        {
+          unsigned int * ptr = gsl_vector_uint_ptr (&ipiv2.vector, i);
+          *ptr += N1;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+static int
+LU_float_apply_pivots (gsl_matrix_float * A, const gsl_vector_uint * ipiv)
+{
+  size_t i;
+
+  for (i = 0; i < ipiv->size; ++i)
+    {
+      size_t pi = gsl_vector_uint_get (ipiv, i);
+
+      if (i != pi)
+        {
+          gsl_vector_float_view v1 = gsl_matrix_float_row (A, i);
+          gsl_vector_float_view v2 = gsl_matrix_float_row (A, pi);
+          gsl_blas_sswap (&v1.vector, &v2.vector);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+cholesky_float_decomp_L2
+  single precision version of cholesky_decomp_L2 in cholesky.c; returns
+GSL_EDOM if A is not positive definite, without calling the error
+handler
+*/
+
+static int
+cholesky_float_decomp_L2 (gsl_matrix_float * A)
+{
+  const size_t N = A->size1;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      float ajj;
+      gsl_vector_float_view v = gsl_matrix_float_subcolumn (A, j, j, N - j);
+
+      if (j > 0)
+        {
+          gsl_vector_float_view w = gsl_matrix_float_subrow (A, j, 0, j);
+          gsl_matrix_float_view m = gsl_matrix_float_submatrix (A, j, 0, N - j, j);
+
+          gsl_blas_sgemv (CblasNoTrans, -1.0f, &m.matrix, &w.vector, 1.0f, &v.vector);
+        }
+
+      ajj = gsl_matrix_float_get (A, j, j);
+
+      if (!(ajj > 0.0f))
+        return GSL_EDOM;
+
+      ajj = sqrtf (ajj);
+      gsl_blas_sscal (1.0f / ajj, &v.vector);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+cholesky_float_decomp_L3
+  single precision version of the recursive cholesky_decomp_L3 in
+cholesky.c
+*/
+
+static int
+cholesky_float_decomp_L3 (gsl_matrix_float * A)
+{
+  const size_t N = A->size1;
+
+  if (N <= CROSSOVER_CHOLESKY)
+    {
+      return cholesky_float_decomp_L2 (A);
+    }
+  else
+    {
+      int status;
+      const size_t N1 = GSL_LINALG_SPLIT (N);
+      const size_t N2 = N - N1;
+      gsl_matrix_float_view A11 = gsl_matrix_float_submatrix (A, 0, 0, N1, N1);
+      gsl_matrix_float_view A21 = gsl_matrix_float_submatrix (A, N1, 0, N2, N1);
+      gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, N1, N1, N2, N2);
+
+      status = cholesky_float_decomp_L3 (&A11.matrix);
+      if (status)
+        return status;
+
+      /* A21 = A21 * L11^{-T} */
+      gsl_blas_strsm (CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0f, &A11.matrix, &A21.matrix);
+
+      /* A22 -= L21 L21^T */
+      gsl_blas_ssyrk (CblasLower, CblasNoTrans, -1.0f, &A21.matrix, 1.0f, &A22.matrix);
+
+      return cholesky_float_decomp_L3 (&A22.matrix);
+    }
+}
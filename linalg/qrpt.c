@@ -29,6 +29,14 @@
 #include <gsl/gsl_linalg.h>
 
 #include "apply_givens.c"
+#include "recurse.h"
+
+static void QRPT_decomp_L2 (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p,
+                            int *signum, gsl_vector * norm, const size_t j0);
+static size_t QRPT_decomp_panel (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p,
+                                 int *signum, gsl_vector * norm1, gsl_vector * norm2,
+                                 gsl_matrix * F, gsl_vector * work, const size_t j0,
+                                 const size_t nb);
 
 /* Factorise a general M x N matrix A into
  *
@@ -61,7 +69,11 @@
  *
  * This storage scheme is the same as in LAPACK.  See LAPACK's
  * dgeqpf.f for details.
- * 
+ *
+ * For MIN(M,N) > CROSSOVER_QRPT the leading columns are factored in
+ * panels of QRPT_BLOCK columns with deferred Level 3 updates of the
+ * trailing matrix, as in LAPACK's dgeqp3.f, and the last
+ * CROSSOVER_QRPT columns with the Level 2 algorithm.
  */
 
 int
@@ -84,7 +96,8 @@ gsl_linalg_QRPT_decomp (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p, i
     }
   else
     {
-      size_t i;
+      const size_t minMN = GSL_MIN (M, N);
+      size_t i, j = 0;
 
       *signum = 1;
 
@@ -99,91 +112,341 @@ gsl_linalg_QRPT_decomp (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p, i
           gsl_vector_set (norm, i, x);
         }
 
-      for (i = 0; i < GSL_MIN (M, N); i++)
+      if (minMN > CROSSOVER_QRPT)
         {
-          /* Bring the column of largest norm into the pivot position */
+          const size_t nb = QRPT_BLOCK;
+          gsl_vector *norm2 = gsl_vector_alloc (N);
+          gsl_matrix *F = gsl_matrix_alloc (N, nb);
+          gsl_vector *work = gsl_vector_alloc (nb);
+
+          if (norm2 == NULL || F == NULL || work == NULL)
+            {
+              if (norm2)
+                gsl_vector_free (norm2);
+              if (F)
+                gsl_matrix_free (F);
+              if (work)
+                gsl_vector_free (work);
+
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
+
+          /* norm2 holds the norms at the last recomputation */
+          gsl_vector_memcpy (norm2, norm);
+
+          while (j < minMN - CROSSOVER_QRPT)
+            {
+              const size_t jb = GSL_MIN (nb, minMN - CROSSOVER_QRPT - j);
+              j += QRPT_decomp_panel (A, tau, p, signum, norm, norm2, F, work, j, jb);
+            }
+
+          gsl_vector_free (norm2);
+          gsl_matrix_free (F);
+          gsl_vector_free (work);
+        }
+
+      QRPT_decomp_L2 (A, tau, p, signum, norm, j);
 
-          double max_norm = gsl_vector_get(norm, i);
-          size_t j, kmax = i;
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+QRPT_decomp_L2()
+  Factor columns j0 to MIN(M,N)-1 of A with Level 2 BLAS,
+assuming the first j0 columns have already been factored
+
+Inputs: A      - matrix being factored
+        tau    - Householder coefficients
+        p      - column permutation
+        signum - sign of the permutation
+        norm   - partial norms of the columns in rows j0 to M-1
+        j0     - first column to factor
+*/
+
+static void
+QRPT_decomp_L2 (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p,
+                int *signum, gsl_vector * norm, const size_t j0)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  size_t i;
+
+  for (i = j0; i < GSL_MIN (M, N); i++)
+    {
+      /* Bring the column of largest norm into the pivot position */
 
+      double max_norm = gsl_vector_get(norm, i);
+      size_t j, kmax = i;
+
+      for (j = i + 1; j < N; j++)
+        {
+          double x = gsl_vector_get (norm, j);
+
+          if (x > max_norm)
+            {
+              max_norm = x;
+              kmax = j;
+            }
+        }
+
+      if (kmax != i)
+        {
+          gsl_matrix_swap_columns (A, i, kmax);
+          gsl_permutation_swap (p, i, kmax);
+          gsl_vector_swap_elements(norm,i,kmax);
+
+          (*signum) = -(*signum);
+        }
+
+      /* Compute the Householder transformation to reduce the j-th
+         column of the matrix to a multiple of the j-th unit vector */
+
+      {
+        gsl_vector_view c_full = gsl_matrix_column (A, i);
+        gsl_vector_view c = gsl_vector_subvector (&c_full.vector, 
+                                                  i, M - i);
+        double tau_i = gsl_linalg_householder_transform (&c.vector);
+
+        gsl_vector_set (tau, i, tau_i);
+
+        /* Apply the transformation to the remaining columns */
+
+        if (i + 1 < N)
+          {
+            gsl_matrix_view m = gsl_matrix_submatrix (A, i, i + 1, M - i, N - (i+1));
+
+            gsl_linalg_householder_hm (tau_i, &c.vector, &m.matrix);
+          }
+      }
+
+      /* Update the norms of the remaining columns too */
+
+      if (i + 1 < M) 
+        {
           for (j = i + 1; j < N; j++)
             {
               double x = gsl_vector_get (norm, j);
 
-              if (x > max_norm)
+              if (x > 0.0)
                 {
-                  max_norm = x;
-                  kmax = j;
+                  double y = 0;
+                  double temp= gsl_matrix_get (A, i, j) / x;
+              
+                  if (fabs (temp) >= 1)
+                    y = 0.0;
+                  else
+                    y = x * sqrt (1 - temp * temp);
+                  
+                  /* recompute norm to prevent loss of accuracy */
+
+                  if (fabs (y / x) < sqrt (20.0) * GSL_SQRT_DBL_EPSILON)
+                    {
+                      gsl_vector_view c_full = gsl_matrix_column (A, j);
+                      gsl_vector_view c = 
+                        gsl_vector_subvector(&c_full.vector,
+                                             i+1, M - (i+1));
+                      y = gsl_blas_dnrm2 (&c.vector);
+                    }
+              
+                  gsl_vector_set (norm, j, y);
                 }
             }
+        }
+    }
+}
 
-          if (kmax != i)
-            {
-              gsl_matrix_swap_columns (A, i, kmax);
-              gsl_permutation_swap (p, i, kmax);
-              gsl_vector_swap_elements(norm,i,kmax);
+/*
+QRPT_decomp_panel()
+  Factor a panel of up to nb columns of A starting at column j0,
+assuming the first j0 columns have already been factored. The
+updates of the trailing columns are accumulated in F and applied
+at the end of the panel with a single dgemm,
+
+A(j0+k:M,j0+k:N) -= V F(k:,0:k)^T
+
+where V holds the k Householder vectors of the panel. Only the
+pivot row of the trailing matrix is updated as each column is
+factored, which is enough to downdate the column norms.
+
+Inputs: A      - matrix being factored
+        tau    - Householder coefficients
+        p      - column permutation
+        signum - sign of the permutation
+        norm1  - partial norms of the columns in rows j0 to M-1
+        norm2  - norms of the columns when last computed exactly
+        F      - workspace, N-by-nb
+        work   - workspace, length nb
+        j0     - first column to factor
+        nb     - maximum number of columns to factor
+
+Return: number of columns factored
+
+Notes:
+1) Based on LAPACK DLAQPS. If the downdated norm of a column has lost
+too much accuracy, the panel is stopped early, and the norm is recomputed
+from the updated trailing matrix.
+*/
+
+static size_t
+QRPT_decomp_panel (gsl_matrix * A, gsl_vector * tau, gsl_permutation * p,
+                   int *signum, gsl_vector * norm1, gsl_vector * norm2,
+                   gsl_matrix * F, gsl_vector * work, const size_t j0,
+                   const size_t nb)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t minMN = GSL_MIN (M, N);
+  const double tol3z = GSL_SQRT_DBL_EPSILON;
+  size_t lsticc = 0; /* 1 + first column whose norm must be recomputed, or 0 */
+  size_t k = 0;      /* columns factored so far; row k of F is column j0 + k of A */
+  size_t rk, j;
+
+  while (k < nb && lsticc == 0)
+    {
+      gsl_vector_view n1 = gsl_vector_subvector (norm1, j0 + k, N - j0 - k);
+      size_t pvt = j0 + k + gsl_blas_idamax (&n1.vector);
+      gsl_vector_view c;
+      double tau_k, akk;
+
+      rk = j0 + k;
+
+      if (pvt != rk)
+        {
+          gsl_matrix_swap_columns (A, rk, pvt);
+          gsl_permutation_swap (p, rk, pvt);
+          gsl_vector_swap_elements (norm1, rk, pvt);
+          gsl_vector_swap_elements (norm2, rk, pvt);
 
-              (*signum) = -(*signum);
+          for (j = 0; j < k; j++)
+            {
+              double tmp = gsl_matrix_get (F, rk - j0, j);
+              gsl_matrix_set (F, rk - j0, j, gsl_matrix_get (F, pvt - j0, j));
+              gsl_matrix_set (F, pvt - j0, j, tmp);
             }
 
-          /* Compute the Householder transformation to reduce the j-th
-             column of the matrix to a multiple of the j-th unit vector */
+          (*signum) = -(*signum);
+        }
 
-          {
-            gsl_vector_view c_full = gsl_matrix_column (A, i);
-            gsl_vector_view c = gsl_vector_subvector (&c_full.vector, 
-                                                      i, M - i);
-            double tau_i = gsl_linalg_householder_transform (&c.vector);
+      c = gsl_matrix_subcolumn (A, rk, rk, M - rk);
 
-            gsl_vector_set (tau, i, tau_i);
+      /* apply the previous reflectors of the panel to column rk:
+       * A(rk:M,rk) -= A(rk:M,j0:rk) F(k,0:k)^T */
+      if (k > 0)
+        {
+          gsl_matrix_view V = gsl_matrix_submatrix (A, rk, j0, M - rk, k);
+          gsl_vector_view f = gsl_matrix_subrow (F, k, 0, k);
 
-            /* Apply the transformation to the remaining columns */
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &V.matrix, &f.vector, 1.0, &c.vector);
+        }
 
-            if (i + 1 < N)
-              {
-                gsl_matrix_view m = gsl_matrix_submatrix (A, i, i + 1, M - i, N - (i+1));
+      tau_k = gsl_linalg_householder_transform (&c.vector);
+      gsl_vector_set (tau, rk, tau_k);
 
-                gsl_linalg_householder_hm (tau_i, &c.vector, &m.matrix);
-              }
-          }
+      akk = gsl_matrix_get (A, rk, rk);
+      gsl_matrix_set (A, rk, rk, 1.0);
 
-          /* Update the norms of the remaining columns too */
+      /* F(k+1:,k) = tau A(rk:M,rk+1:N)^T v */
+      if (rk + 1 < N)
+        {
+          gsl_matrix_view B = gsl_matrix_submatrix (A, rk, rk + 1, M - rk, N - rk - 1);
+          gsl_vector_view f = gsl_matrix_subcolumn (F, k, k + 1, N - rk - 1);
 
-          if (i + 1 < M) 
+          gsl_blas_dgemv (CblasTrans, tau_k, &B.matrix, &c.vector, 0.0, &f.vector);
+        }
+
+      for (j = 0; j <= k; j++)
+        gsl_matrix_set (F, j, k, 0.0);
+
+      /* F(:,k) -= tau F(:,0:k) A(rk:M,j0:rk)^T v */
+      if (k > 0)
+        {
+          gsl_matrix_view V = gsl_matrix_submatrix (A, rk, j0, M - rk, k);
+          gsl_matrix_view Fk = gsl_matrix_submatrix (F, 0, 0, N - j0, k);
+          gsl_vector_view f = gsl_matrix_subcolumn (F, k, 0, N - j0);
+          gsl_vector_view w = gsl_vector_subvector (work, 0, k);
+
+          gsl_blas_dgemv (CblasTrans, -tau_k, &V.matrix, &c.vector, 0.0, &w.vector);
+          gsl_blas_dgemv (CblasNoTrans, 1.0, &Fk.matrix, &w.vector, 1.0, &f.vector);
+        }
+
+      /* update the pivot row: A(rk,rk+1:N) -= A(rk,j0:rk+1) F(k+1:,0:k+1)^T */
+      if (rk + 1 < N)
+        {
+          gsl_matrix_view Fk = gsl_matrix_submatrix (F, k + 1, 0, N - rk - 1, k + 1);
+          gsl_vector_view a = gsl_matrix_subrow (A, rk, j0, k + 1);
+          gsl_vector_view r = gsl_matrix_subrow (A, rk, rk + 1, N - rk - 1);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Fk.matrix, &a.vector, 1.0, &r.vector);
+        }
+
+      /* downdate the partial column norms */
+      if (rk + 1 < minMN)
+        {
+          for (j = rk + 1; j < N; j++)
             {
-              for (j = i + 1; j < N; j++)
+              double x = gsl_vector_get (norm1, j);
+
+              if (x != 0.0)
                 {
-                  double x = gsl_vector_get (norm, j);
+                  double temp = fabs (gsl_matrix_get (A, rk, j)) / x;
+                  double temp2, ratio;
 
-                  if (x > 0.0)
+                  temp = GSL_MAX ((1.0 + temp) * (1.0 - temp), 0.0);
+                  ratio = x / gsl_vector_get (norm2, j);
+                  temp2 = temp * ratio * ratio;
+
+                  if (temp2 <= tol3z)
                     {
-                      double y = 0;
-                      double temp= gsl_matrix_get (A, i, j) / x;
-                  
-                      if (fabs (temp) >= 1)
-                        y = 0.0;
-                      else
-                        y = x * sqrt (1 - temp * temp);
-                      
-                      /* recompute norm to prevent loss of accuracy */
-
-                      if (fabs (y / x) < sqrt (20.0) * GSL_SQRT_DBL_EPSILON)
-                        {
-                          gsl_vector_view c_full = gsl_matrix_column (A, j);
-                          gsl_vector_view c = 
-                            gsl_vector_subvector(&c_full.vector,
-                                                 i+1, M - (i+1));
-                          y = gsl_blas_dnrm2 (&c.vector);
-                        }
-                  
-                      gsl_vector_set (norm, j, y);
+                      /* add column j to the list of norms to recompute,
+                       * using norm2 for the links */
+                      gsl_vector_set (norm2, j, (double) lsticc);
+                      lsticc = j + 1;
+                    }
+                  else
+                    {
+                      gsl_vector_set (norm1, j, x * sqrt (temp));
                     }
                 }
             }
         }
 
-      return GSL_SUCCESS;
+      gsl_matrix_set (A, rk, rk, akk);
+      ++k;
     }
+
+  rk = j0 + k;
+
+  /* apply the block reflector to the trailing matrix:
+   * A(rk:M,rk:N) -= A(rk:M,j0:rk) F(k:,0:k)^T */
+  if (rk < minMN)
+    {
+      gsl_matrix_view V = gsl_matrix_submatrix (A, rk, j0, M - rk, k);
+      gsl_matrix_view Fk = gsl_matrix_submatrix (F, k, 0, N - rk, k);
+      gsl_matrix_view B = gsl_matrix_submatrix (A, rk, rk, M - rk, N - rk);
+
+      gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &V.matrix, &Fk.matrix, 1.0, &B.matrix);
+    }
+
+  /* recompute the norms of the columns in the list */
+  while (lsticc > 0)
+    {
+      const size_t jc = lsticc - 1;
+      size_t next = (size_t) gsl_vector_get (norm2, jc);
+      double x = 0.0;
+
+      if (rk < M)
+        {
+          gsl_vector_view c = gsl_matrix_subcolumn (A, jc, rk, M - rk);
+          x = gsl_blas_dnrm2 (&c.vector);
+        }
+
+      gsl_vector_set (norm1, jc, x);
+      gsl_vector_set (norm2, jc, x);
+      lsticc = next;
+    }
+
+  return k;
 }
 
 int
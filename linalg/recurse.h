@@ -8,3 +8,21 @@
 #define CROSSOVER_CHOLESKY     CROSSOVER
 #define CROSSOVER_INVTRI       CROSSOVER
 #define CROSSOVER_TRIMULT      CROSSOVER
+
+/* block size and crossover to Level 2 for QR with column pivoting */
+#define QRPT_BLOCK             32
+#define CROSSOVER_QRPT         128
+
+/* block size and crossover to Level 2 for the reductions to
+   tridiagonal and bidiagonal form */
+#define SYMMTD_BLOCK           32
+#define CROSSOVER_SYMMTD       128
+#define HERMTD_BLOCK           32
+#define CROSSOVER_HERMTD       128
+#define BIDIAG_BLOCK           32
+#define CROSSOVER_BIDIAG       128
+
+/* block size and crossover to Level 2 for the reduction to
+   Hessenberg form */
+#define HESSENBERG_BLOCK       32
+#define CROSSOVER_HESSENBERG   128
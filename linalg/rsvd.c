@@ -0,0 +1,315 @@
+/* linalg/rsvd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_linalg_rsvd.h>
+
+/* Randomized low-rank singular value decomposition.
+
+   An orthonormal basis Q of the dominant l-dimensional range of A is
+   found by sampling, Y = A Omega with an N-by-l Gaussian matrix Omega,
+   where l = k + p and p is the oversampling.  For matrices whose
+   singular values decay slowly the basis is improved by q steps of
+   subspace iteration, Y = (A A^T)^q A Omega, orthonormalizing the
+   samples after each product with A or A^T.  Then
+
+     B^T = A^T Q = U_B S V_B^T
+
+   is an N-by-l matrix whose small SVD gives A ~ Q Q^T A = (Q V_B) S U_B^T,
+   and the k largest triplets are returned.  A is accessed only
+   through products with blocks of vectors, so it may be given as an
+   operator.
+
+   See N. Halko, P. G. Martinsson and J. A. Tropp, "Finding structure
+   with randomness: probabilistic algorithms for constructing
+   approximate matrix decompositions", SIAM Review 53 (2011), 217-288,
+   Algorithms 4.4 and 5.1. */
+
+#include "svdblock.c"
+
+static int rsvd_orth (gsl_matrix * Y, gsl_matrix * Q, gsl_matrix * T);
+static int rsvd_matrix_mult (CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                             gsl_matrix * Y, void * params);
+
+gsl_linalg_rsvd_workspace *
+gsl_linalg_rsvd_alloc (const size_t M, const size_t N, const size_t k,
+                       const size_t p)
+{
+  gsl_linalg_rsvd_workspace * w;
+  size_t l;
+
+  if (k == 0)
+    {
+      GSL_ERROR_NULL ("number of singular values must be positive", GSL_EINVAL);
+    }
+  else if (k > GSL_MIN (M, N))
+    {
+      GSL_ERROR_NULL ("number of singular values exceeds matrix dimensions",
+                      GSL_EBADLEN);
+    }
+
+  l = GSL_MIN (k + p, GSL_MIN (M, N));
+
+  w = calloc (1, sizeof (gsl_linalg_rsvd_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->M = M;
+  w->N = N;
+  w->k = k;
+  w->l = l;
+
+  w->Y = gsl_matrix_alloc (M, l);
+  w->Q = gsl_matrix_alloc (M, l);
+  w->Z = gsl_matrix_alloc (N, l);
+  w->Zq = gsl_matrix_alloc (N, l);
+  w->T = gsl_matrix_alloc (l, l);
+  w->Vb = gsl_matrix_alloc (l, l);
+  w->S = gsl_vector_alloc (l);
+
+  if (w->Y == 0 || w->Q == 0 || w->Z == 0 || w->Zq == 0 ||
+      w->T == 0 || w->Vb == 0 || w->S == 0)
+    {
+      gsl_linalg_rsvd_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for samples", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_linalg_rsvd_free (gsl_linalg_rsvd_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->Y)
+    gsl_matrix_free (w->Y);
+
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  if (w->Z)
+    gsl_matrix_free (w->Z);
+
+  if (w->Zq)
+    gsl_matrix_free (w->Zq);
+
+  if (w->T)
+    gsl_matrix_free (w->T);
+
+  if (w->Vb)
+    gsl_matrix_free (w->Vb);
+
+  if (w->S)
+    gsl_vector_free (w->S);
+
+  free (w);
+}
+
+/*
+gsl_linalg_rsvd_range()
+  Compute an orthonormal basis of the dominant range of A, with
+q steps of subspace iteration
+
+Inputs: A - M-by-N linear operator
+        q - number of subspace iterations
+        r - random number generator for the Gaussian test matrix
+        w - workspace
+
+Notes:
+1) on output, the basis is stored in w->Q
+*/
+
+int
+gsl_linalg_rsvd_range (const gsl_linalg_operator * A, const size_t q,
+                       gsl_rng * r, gsl_linalg_rsvd_workspace * w)
+{
+  if (A->size1 != w->M || A->size2 != w->N)
+    {
+      GSL_ERROR ("operator size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      double *omega = w->Zq->data;
+      size_t i, j;
+      int status;
+
+      /* Gaussian test matrix Omega, stored in Zq */
+      for (i = 0; i < w->N; ++i)
+        {
+          for (j = 0; j < w->l; ++j)
+            omega[i * w->Zq->tda + j] = gsl_ran_gaussian_ziggurat (r, 1.0);
+        }
+
+      /* Y = A Omega */
+      status = (A->mult) (CblasNoTrans, w->Zq, w->Y, A->params);
+      if (status)
+        return status;
+
+      status = rsvd_orth (w->Y, w->Q, w->T);
+      if (status)
+        return status;
+
+      for (i = 0; i < q; ++i)
+        {
+          /* Y = A A^T Q, orthonormalizing the intermediate Z = A^T Q */
+
+          status = (A->mult) (CblasTrans, w->Q, w->Z, A->params);
+          if (status)
+            return status;
+
+          status = rsvd_orth (w->Z, w->Zq, w->T);
+          if (status)
+            return status;
+
+          status = (A->mult) (CblasNoTrans, w->Zq, w->Y, A->params);
+          if (status)
+            return status;
+
+          status = rsvd_orth (w->Y, w->Q, w->T);
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_rsvd_decomp_op()
+  Compute the k largest singular values and vectors of a linear
+operator
+
+Inputs: A - M-by-N linear operator
+        q - number of subspace iterations
+        r - random number generator for the Gaussian test matrix
+        U - (output) M-by-k left singular vectors
+        S - (output) k singular values, in decreasing order
+        V - (output) N-by-k right singular vectors
+        w - workspace
+*/
+
+int
+gsl_linalg_rsvd_decomp_op (const gsl_linalg_operator * A, const size_t q,
+                           gsl_rng * r, gsl_matrix * U, gsl_vector * S,
+                           gsl_matrix * V, gsl_linalg_rsvd_workspace * w)
+{
+  const size_t k = w->k;
+
+  if (U->size1 != w->M || U->size2 != k)
+    {
+      GSL_ERROR ("U matrix must be M-by-k", GSL_EBADLEN);
+    }
+  else if (V->size1 != w->N || V->size2 != k)
+    {
+      GSL_ERROR ("V matrix must be N-by-k", GSL_EBADLEN);
+    }
+  else if (S->size != k)
+    {
+      GSL_ERROR ("S vector must have length k", GSL_EBADLEN);
+    }
+  else
+    {
+      int status = gsl_linalg_rsvd_range (A, q, r, w);
+      gsl_matrix_view Vk = gsl_matrix_submatrix (w->Vb, 0, 0, w->l, k);
+      gsl_matrix_view Zk = gsl_matrix_submatrix (w->Z, 0, 0, w->N, k);
+      gsl_vector_view Sk = gsl_vector_subvector (w->S, 0, k);
+
+      if (status)
+        return status;
+
+      /* B^T = A^T Q = U_B S V_B^T */
+
+      status = (A->mult) (CblasTrans, w->Q, w->Z, A->params);
+      if (status)
+        return status;
+
+      status = gsl_linalg_SV_decomp_dc (w->Z, w->Vb, w->S);
+      if (status)
+        return status;
+
+      /* U = Q V_B, V = U_B */
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, w->Q, &Vk.matrix, 0.0, U);
+      gsl_matrix_memcpy (V, &Zk.matrix);
+      gsl_vector_memcpy (S, &Sk.vector);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_rsvd_decomp()
+  Compute the k largest singular values and vectors of a matrix, as
+for gsl_linalg_rsvd_decomp_op()
+*/
+
+int
+gsl_linalg_rsvd_decomp (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                        gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                        gsl_linalg_rsvd_workspace * w)
+{
+  gsl_linalg_operator op;
+
+  op.size1 = A->size1;
+  op.size2 = A->size2;
+  op.mult = &rsvd_matrix_mult;
+  op.params = (void *) A;
+
+  return gsl_linalg_rsvd_decomp_op (&op, q, r, U, S, V, w);
+}
+
+/* orthonormalize the columns of Y, storing the result in Q.  On
+   output Y contains the QR decomposition of its input. */
+
+static int
+rsvd_orth (gsl_matrix * Y, gsl_matrix * Q, gsl_matrix * T)
+{
+  gsl_vector_view tau = gsl_matrix_diagonal (T);
+  gsl_matrix_view Q1 = gsl_matrix_submatrix (Q, 0, 0, Q->size2, Q->size2);
+  int status;
+
+  status = gsl_linalg_QR_decomp_r (Y, T);
+  if (status)
+    return status;
+
+  /* Q = H_0 ... H_{l-1} [I; 0] */
+  gsl_matrix_set_zero (Q);
+  gsl_matrix_set_identity (&Q1.matrix);
+
+  return svd_householder_apply (CblasNoTrans, Y, &tau.vector, Q);
+}
+
+static int
+rsvd_matrix_mult (CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                  gsl_matrix * Y, void * params)
+{
+  const gsl_matrix * A = (const gsl_matrix *) params;
+  return gsl_blas_dgemm (TransA, CblasNoTrans, 1.0, A, X, 0.0, Y);
+}
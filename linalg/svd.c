@@ -26,8 +26,41 @@
 #include <gsl/gsl_blas.h>
 
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_permutation.h>
 
 #include "svdstep.c"
+#include "svdblock.c"
+#include "thread.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* the blocked Jacobi method is used for N >= SVD_JACOBI_MIN, with
+   column blocks of width SVD_JACOBI_BLOCK */
+#define SVD_JACOBI_MIN 128
+#define SVD_JACOBI_BLOCK 32
+
+/* maximum number of sweeps of the blocked Jacobi method */
+#define SVD_JACOBI_SWEEPMAX 30
+
+typedef struct
+{
+  gsl_matrix *C;    /* columns of the current pair of blocks */
+  gsl_matrix *C2;
+  gsl_matrix *G;    /* Gram matrix C^T C */
+  gsl_matrix *Wl;   /* accumulated rotations of the pair, transposed */
+  gsl_matrix *Wc;   /* matching columns of W */
+  gsl_matrix *Wc2;
+} svd_jacobi_work;
+
+static int svd_jacobi_blocked (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S);
+static int svd_jacobi_sweeps (gsl_matrix * X, gsl_matrix * W, const double tol);
+static size_t svd_jacobi_pair (gsl_matrix * X, gsl_matrix * W,
+                               const size_t j0, const size_t n0,
+                               const size_t j1, const size_t n1,
+                               const double tol, const double noise,
+                               svd_jacobi_work * work);
 
 /* Factorise a general M x N matrix A into,
  *
@@ -530,6 +563,18 @@ gsl_linalg_SV_leverage(const gsl_matrix *U, gsl_vector *h)
  * vector computer", SIAM Journal of Scientific and Statistical
  * Computing, Vol 10, No 2, pp 359-371, March 1989.
  * 
+ * For N >= SVD_JACOBI_MIN the matrix is first preconditioned with a
+ * column-pivoted QR decomposition A P = Q R, and the one-sided method
+ * is applied to the N x N matrix R^T, whose columns are much closer
+ * to orthogonal than those of A.  The columns are grouped in blocks,
+ * and each sweep pairs all the blocks in a round-robin ordering, so
+ * that the pairs of one round are disjoint and are processed on
+ * separate threads.  For each pair the rotation angles are taken from
+ * the Gram matrix of its columns, and the accumulated rotations are
+ * applied to the columns with a single matrix-matrix product.  See
+ *
+ * Z. Drmac, K. Veselic, "New fast and accurate Jacobi SVD algorithm",
+ * SIAM J. Matrix Anal. Appl., Vol 29, No 4, pp 1322-1362, 2008.
  */
 
 int
@@ -555,6 +600,10 @@ gsl_linalg_SV_decomp_jacobi (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
       GSL_ERROR ("length of vector S must match second dimension of matrix A",
                  GSL_EBADLEN);
     }
+  else if (A->size2 >= SVD_JACOBI_MIN)
+    {
+      return svd_jacobi_blocked (A, Q, S);
+    }
   else
     {
       const size_t M = A->size1;
@@ -715,3 +764,447 @@ gsl_linalg_SV_decomp_jacobi (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
       return GSL_SUCCESS;
     }
 }
+
+/* Blocked one-sided Jacobi method for N >= SVD_JACOBI_MIN, on the
+   transposed triangular factor of A P = Q R.  If R^T W = X with the
+   columns of X orthogonal, then A = (Q W) D (P X D^{-1})^T, so U = Q W
+   and V = P X D^{-1}, completed to an orthogonal matrix when some of
+   the singular values are zero. */
+
+static int
+svd_jacobi_blocked (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  gsl_vector *tau = gsl_vector_alloc (N);
+  gsl_vector *norm = gsl_vector_alloc (N);
+  gsl_permutation *perm = gsl_permutation_alloc (N);
+  gsl_matrix *X = gsl_matrix_alloc (N, N);
+  gsl_matrix *U = gsl_matrix_calloc (M, N);
+  int status = GSL_SUCCESS;
+
+  if (tau == NULL || norm == NULL || perm == NULL || X == NULL || U == NULL)
+    {
+      status = GSL_ENOMEM;
+    }
+  else
+    {
+      const double tolerance = sqrt ((double) N) * GSL_DBL_EPSILON;
+      gsl_matrix_view R = gsl_matrix_submatrix (A, 0, 0, N, N);
+      gsl_matrix_view W = gsl_matrix_submatrix (U, 0, 0, N, N);
+      double prev_norm = -1.0;
+      size_t i, j, k, r = N;
+      int signum;
+
+      gsl_linalg_QRPT_decomp (A, tau, perm, &signum, norm);
+
+      /* X = R^T, W = I */
+      gsl_matrix_set_zero (X);
+      gsl_matrix_transpose_tricpy (CblasUpper, CblasNonUnit, X, &R.matrix);
+      gsl_matrix_set_identity (&W.matrix);
+
+      status = svd_jacobi_sweeps (X, &W.matrix, tolerance);
+
+      for (j = 0; j < N; j++)
+        {
+          gsl_vector_view column = gsl_matrix_column (X, j);
+          gsl_vector_set (S, j, gsl_blas_dnrm2 (&column.vector));
+        }
+
+      /* sort the columns into decreasing order of their norms */
+
+      for (j = 0; j + 1 < N; j++)
+        {
+          size_t jmax = j;
+
+          for (k = j + 1; k < N; k++)
+            {
+              if (gsl_vector_get (S, k) > gsl_vector_get (S, jmax))
+                jmax = k;
+            }
+
+          if (jmax != j)
+            {
+              gsl_vector_swap_elements (S, j, jmax);
+              gsl_matrix_swap_columns (X, j, jmax);
+              gsl_matrix_swap_columns (&W.matrix, j, jmax);
+            }
+        }
+
+      /* determine the zero singular values with the same criterion as
+         the unblocked method, and normalize the other columns */
+
+      for (j = 0; j < N; j++)
+        {
+          gsl_vector_view column = gsl_matrix_column (X, j);
+          double sj = gsl_vector_get (S, j);
+
+          if (sj == 0.0 || prev_norm == 0.0
+              || (j > 0 && sj <= tolerance * prev_norm)
+              || sj <= GSL_DBL_EPSILON * gsl_vector_get (S, 0))
+            {
+              gsl_vector_set (S, j, 0.0);
+              prev_norm = 0.0;
+
+              if (r == N)
+                r = j;
+            }
+          else
+            {
+              gsl_vector_scale (&column.vector, 1.0 / sj);
+              prev_norm = sj;
+            }
+        }
+
+      /* complete the columns of X to an orthogonal basis, from the QR
+         decomposition of its first r columns */
+
+      if (r == 0)
+        {
+          gsl_matrix_set_identity (X);
+        }
+      else if (r < N)
+        {
+          gsl_matrix *Y = gsl_matrix_alloc (N, r);
+          gsl_matrix *Qy = gsl_matrix_alloc (N, N);
+          gsl_matrix *Ry = gsl_matrix_alloc (N, r);
+          gsl_vector *tauy = gsl_vector_alloc (r);
+
+          if (Y == NULL || Qy == NULL || Ry == NULL || tauy == NULL)
+            {
+              status = GSL_ENOMEM;
+            }
+          else
+            {
+              gsl_matrix_view Xr = gsl_matrix_submatrix (X, 0, 0, N, r);
+              gsl_matrix_view Xn = gsl_matrix_submatrix (X, 0, r, N, N - r);
+              gsl_matrix_view Qn = gsl_matrix_submatrix (Qy, 0, r, N, N - r);
+
+              gsl_matrix_memcpy (Y, &Xr.matrix);
+              gsl_linalg_QR_decomp (Y, tauy);
+              gsl_linalg_QR_unpack (Y, tauy, Qy, Ry);
+              gsl_matrix_memcpy (&Xn.matrix, &Qn.matrix);
+            }
+
+          gsl_matrix_free (Y);
+          gsl_matrix_free (Qy);
+          gsl_matrix_free (Ry);
+          gsl_vector_free (tauy);
+        }
+
+      /* V = P X */
+
+      for (i = 0; i < N; i++)
+        {
+          gsl_vector_view xi = gsl_matrix_row (X, i);
+          gsl_vector_view vi = gsl_matrix_row (Q, gsl_permutation_get (perm, i));
+          gsl_vector_memcpy (&vi.vector, &xi.vector);
+        }
+
+      /* U = Q [W; 0] */
+
+      if (status != GSL_ENOMEM)
+        {
+          int s = svd_householder_apply (CblasNoTrans, A, tau, U);
+
+          if (s)
+            status = s;
+          else
+            gsl_matrix_memcpy (A, U);
+        }
+    }
+
+  gsl_vector_free (tau);
+  gsl_vector_free (norm);
+  gsl_permutation_free (perm);
+  gsl_matrix_free (X);
+  gsl_matrix_free (U);
+
+  if (status == GSL_ENOMEM)
+    {
+      GSL_ERROR ("failed to allocate space for Jacobi SVD", GSL_ENOMEM);
+    }
+  else if (status)
+    {
+      GSL_ERROR ("Jacobi iterations did not reach desired tolerance",
+                 GSL_ETOL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Orthogonalize the columns of X by sweeps of the blocked Jacobi
+   method, accumulating the rotations in W.  The blocks are paired in
+   the round-robin ordering of a tournament, with a dummy block when
+   their number is odd, so that the pairs of each round are disjoint.
+   Returns GSL_ETOL if SVD_JACOBI_SWEEPMAX sweeps are not enough. */
+
+static int
+svd_jacobi_sweeps (gsl_matrix * X, gsl_matrix * W, const double tol)
+{
+  const size_t R = X->size1;
+  const size_t N = X->size2;
+  const size_t nb = (N + SVD_JACOBI_BLOCK - 1) / SVD_JACOBI_BLOCK;
+  const size_t np = nb + (nb % 2);
+  const size_t n2 = GSL_MIN (2 * SVD_JACOBI_BLOCK, N);
+  const int nthreads = linalg_thread_count (N);
+  size_t *pos = malloc (np * sizeof (size_t));
+  svd_jacobi_work *work = calloc (nthreads, sizeof (svd_jacobi_work));
+  int status = GSL_ETOL;
+  double noise = 0.0;
+  size_t i, j;
+  int t, sweep;
+
+  if (pos != NULL && work != NULL)
+    {
+      for (t = 0; t < nthreads; t++)
+        {
+          work[t].C = gsl_matrix_alloc (R, n2);
+          work[t].C2 = gsl_matrix_alloc (R, n2);
+          work[t].G = gsl_matrix_alloc (n2, n2);
+          work[t].Wl = gsl_matrix_alloc (n2, n2);
+          work[t].Wc = gsl_matrix_alloc (W->size1, n2);
+          work[t].Wc2 = gsl_matrix_alloc (W->size1, n2);
+
+          if (work[t].C == NULL || work[t].C2 == NULL || work[t].G == NULL ||
+              work[t].Wl == NULL || work[t].Wc == NULL || work[t].Wc2 == NULL)
+            status = GSL_ENOMEM;
+        }
+    }
+  else
+    {
+      status = GSL_ENOMEM;
+    }
+
+  /* columns below the rounding level of the largest column are not
+     rotated */
+
+  for (j = 0; j < N; j++)
+    {
+      gsl_vector_view column = gsl_matrix_column (X, j);
+      double xj = gsl_blas_dnrm2 (&column.vector);
+      noise = GSL_MAX (noise, xj);
+    }
+
+  noise = (GSL_DBL_EPSILON * noise) * (GSL_DBL_EPSILON * noise);
+
+  for (sweep = 0; status == GSL_ETOL && sweep < SVD_JACOBI_SWEEPMAX; sweep++)
+    {
+      size_t count = 0;
+      size_t round;
+
+      for (i = 0; i < np; i++)
+        pos[i] = i;
+
+      for (round = 0; round + 1 < np; round++)
+        {
+          const long npairs = (long) (np / 2);
+          size_t last;
+          long ip;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) reduction(+:count)
+#endif
+          for (ip = 0; ip < npairs; ip++)
+            {
+              size_t b0 = GSL_MIN (pos[ip], pos[np - 1 - ip]);
+              size_t b1 = GSL_MAX (pos[ip], pos[np - 1 - ip]);
+              size_t j0 = b0 * SVD_JACOBI_BLOCK;
+              size_t n0 = GSL_MIN (SVD_JACOBI_BLOCK, N - j0);
+              size_t j1 = 0, n1 = 0;
+              int tid = 0;
+
+#ifdef _OPENMP
+              tid = omp_get_thread_num ();
+#endif
+
+              if (b1 < nb)
+                {
+                  j1 = b1 * SVD_JACOBI_BLOCK;
+                  n1 = GSL_MIN (SVD_JACOBI_BLOCK, N - j1);
+                }
+
+              count += svd_jacobi_pair (X, W, j0, n0, j1, n1, tol, noise,
+                                        &work[tid]);
+            }
+
+          /* move the blocks to their next positions, keeping the
+             first one fixed */
+
+          last = pos[np - 1];
+
+          for (i = np - 1; i > 1; i--)
+            pos[i] = pos[i - 1];
+
+          pos[1] = last;
+        }
+
+      if (count == 0)
+        status = GSL_SUCCESS;
+    }
+
+  if (work != NULL)
+    {
+      for (t = 0; t < nthreads; t++)
+        {
+          gsl_matrix_free (work[t].C);
+          gsl_matrix_free (work[t].C2);
+          gsl_matrix_free (work[t].G);
+          gsl_matrix_free (work[t].Wl);
+          gsl_matrix_free (work[t].Wc);
+          gsl_matrix_free (work[t].Wc2);
+        }
+
+      free (work);
+    }
+
+  free (pos);
+
+  if (status == GSL_ENOMEM)
+    {
+      GSL_ERROR ("failed to allocate space for Jacobi sweeps", GSL_ENOMEM);
+    }
+
+  return status;
+}
+
+/* Orthogonalize the n0 columns of X starting at j0 and the n1 columns
+   starting at j1 against each other, with one cyclic pass of
+   rotations computed from their Gram matrix.  The rotations are
+   accumulated and then applied to the columns of X and W with
+   matrix-matrix products.  Returns the number of rotations. */
+
+static size_t
+svd_jacobi_pair (gsl_matrix * X, gsl_matrix * W,
+                 const size_t j0, const size_t n0,
+                 const size_t j1, const size_t n1,
+                 const double tol, const double noise,
+                 svd_jacobi_work * work)
+{
+  const size_t R = X->size1;
+  const size_t NW = W->size1;
+  const size_t n = n0 + n1;
+  gsl_matrix_view C = gsl_matrix_submatrix (work->C, 0, 0, R, n);
+  gsl_matrix_view G = gsl_matrix_submatrix (work->G, 0, 0, n, n);
+  gsl_matrix_view Wl = gsl_matrix_submatrix (work->Wl, 0, 0, n, n);
+  gsl_matrix_view X0 = gsl_matrix_submatrix (X, 0, j0, R, n0);
+  gsl_matrix_view C0 = gsl_matrix_submatrix (&C.matrix, 0, 0, R, n0);
+  double *g = G.matrix.data;
+  double *wl = Wl.matrix.data;
+  const size_t tg = G.matrix.tda;
+  const size_t twl = Wl.matrix.tda;
+  size_t count = 0;
+  size_t j, k, l;
+
+  gsl_matrix_memcpy (&C0.matrix, &X0.matrix);
+
+  if (n1 > 0)
+    {
+      gsl_matrix_view X1 = gsl_matrix_submatrix (X, 0, j1, R, n1);
+      gsl_matrix_view C1 = gsl_matrix_submatrix (&C.matrix, 0, n0, R, n1);
+      gsl_matrix_memcpy (&C1.matrix, &X1.matrix);
+    }
+
+  /* G = C^T C */
+  gsl_blas_dsyrk (CblasLower, CblasTrans, 1.0, &C.matrix, 0.0, &G.matrix);
+  gsl_matrix_transpose_tricpy (CblasLower, CblasUnit, &G.matrix, &G.matrix);
+
+  gsl_matrix_set_identity (&Wl.matrix);
+
+  for (j = 0; j + 1 < n; j++)
+    {
+      double *gj = g + j * tg;
+      double *wj = wl + j * twl;
+
+      for (k = j + 1; k < n; k++)
+        {
+          double *gk = g + k * tg;
+          double *wk = wl + k * twl;
+          const double gjj = gj[j];
+          const double gkk = gk[k];
+          const double gjk = gj[k];
+          double zeta, t, c, s;
+
+          if (gjj <= noise || gkk <= noise
+              || fabs (gjk) <= tol * sqrt (gjj) * sqrt (gkk))
+            continue;
+
+          /* the rotation (x, y) -> (c x - s y, s x + c y) of columns
+             j and k which makes them orthogonal, applied to rows j
+             and k of G and Wl^T, and then by symmetry to columns j
+             and k of G */
+
+          zeta = (gkk - gjj) / (2.0 * gjk);
+          t = GSL_SIGN (zeta) / (fabs (zeta) + hypot (1.0, zeta));
+          c = 1.0 / sqrt (1.0 + t * t);
+          s = c * t;
+
+          for (l = 0; l < n; l++)
+            {
+              const double gjl = gj[l], gkl = gk[l];
+              const double wjl = wj[l], wkl = wk[l];
+
+              gj[l] = c * gjl - s * gkl;
+              gk[l] = s * gjl + c * gkl;
+              wj[l] = c * wjl - s * wkl;
+              wk[l] = s * wjl + c * wkl;
+            }
+
+          for (l = 0; l < n; l++)
+            {
+              g[l * tg + j] = gj[l];
+              g[l * tg + k] = gk[l];
+            }
+
+          gj[j] = gjj - t * gjk;
+          gk[k] = gkk + t * gjk;
+          gj[k] = 0.0;
+          gk[j] = 0.0;
+
+          count++;
+        }
+    }
+
+
+  if (count > 0)
+    {
+      gsl_matrix_view C2 = gsl_matrix_submatrix (work->C2, 0, 0, R, n);
+      gsl_matrix_view Wc = gsl_matrix_submatrix (work->Wc, 0, 0, NW, n);
+      gsl_matrix_view Wc2 = gsl_matrix_submatrix (work->Wc2, 0, 0, NW, n);
+      gsl_matrix_view W0 = gsl_matrix_submatrix (W, 0, j0, NW, n0);
+      gsl_matrix_view Wc0 = gsl_matrix_submatrix (&Wc.matrix, 0, 0, NW, n0);
+      gsl_matrix_view C20 = gsl_matrix_submatrix (&C2.matrix, 0, 0, R, n0);
+      gsl_matrix_view Wc20 = gsl_matrix_submatrix (&Wc2.matrix, 0, 0, NW, n0);
+
+      gsl_matrix_memcpy (&Wc0.matrix, &W0.matrix);
+
+      if (n1 > 0)
+        {
+          gsl_matrix_view W1 = gsl_matrix_submatrix (W, 0, j1, NW, n1);
+          gsl_matrix_view Wc1 = gsl_matrix_submatrix (&Wc.matrix, 0, n0, NW, n1);
+          gsl_matrix_memcpy (&Wc1.matrix, &W1.matrix);
+        }
+
+      /* [X0 X1] = C Wl, [W0 W1] = [W0 W1] Wl */
+      gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, &C.matrix, &Wl.matrix,
+                      0.0, &C2.matrix);
+      gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, &Wc.matrix, &Wl.matrix,
+                      0.0, &Wc2.matrix);
+
+      gsl_matrix_memcpy (&X0.matrix, &C20.matrix);
+      gsl_matrix_memcpy (&W0.matrix, &Wc20.matrix);
+
+      if (n1 > 0)
+        {
+          gsl_matrix_view X1 = gsl_matrix_submatrix (X, 0, j1, R, n1);
+          gsl_matrix_view W1 = gsl_matrix_submatrix (W, 0, j1, NW, n1);
+          gsl_matrix_view C21 = gsl_matrix_submatrix (&C2.matrix, 0, n0, R, n1);
+          gsl_matrix_view Wc21 = gsl_matrix_submatrix (&Wc2.matrix, 0, n0, NW, n1);
+
+          gsl_matrix_memcpy (&X1.matrix, &C21.matrix);
+          gsl_matrix_memcpy (&W1.matrix, &Wc21.matrix);
+        }
+    }
+
+  return count;
+}
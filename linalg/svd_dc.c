@@ -0,0 +1,868 @@
+/* linalg/svd_dc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_linalg.h>
+
+/* Singular value decomposition by the divide and conquer method.
+
+   The matrix is reduced to upper bidiagonal form B, or for tall
+   matrices first to triangular form with a QR decomposition.  The
+   bidiagonal matrix is split at a middle row,
+
+     B = [ B1   0 ]
+         [ a e' b f' ]
+         [ 0   B2 ]
+
+   where B1 has one more column than rows, the halves are solved
+   recursively, and the rows and columns are then rotated so that the
+   matrix becomes
+
+     M = [ z_0 z_1 ... z_{n-1} ]
+         [      d_1            ]
+         [           ...       ]
+         [             d_{n-1} ]
+
+   The singular values of M are the roots of the secular equation
+
+     f(sigma) = 1 + sum_i z_i^2 / (d_i^2 - sigma^2) = 0
+
+   with d_0 = 0.  Negligible components of z and pairs of close d_i
+   are deflated first, the singular vectors are computed from a z
+   recomputed from the roots so that they are numerically orthogonal,
+   and they are combined with those of the halves by matrix-matrix
+   products.  Blocks of up to SVD_DC_LEAF rows use the implicit QR
+   method of svdstep.c.
+
+   See M. Gu and S. C. Eisenstat, "A divide-and-conquer algorithm for
+   the bidiagonal SVD", SIAM J. Matrix Anal. Appl. 16 (1995), 79-92.
+   The splitting and deflation follow the LAPACK routines DLASD1 and
+   DLASD2. */
+
+#include "svdstep.c"
+#include "svdblock.c"
+
+#define SVD_DC_LEAF 25
+
+typedef struct
+{
+  double *work;         /* 5n */
+  size_t *iwork;        /* 3n */
+  gsl_matrix *Ug;       /* n-by-n gathered left vectors */
+  gsl_matrix *Vg;       /* (n+1)-by-n gathered right vectors */
+  gsl_matrix *Uc;       /* n-by-n left vectors of the merged problem */
+  gsl_matrix *Vc;       /* n-by-n right vectors of the merged problem */
+} svd_dc_workspace;
+
+static int svd_dc_decomp (gsl_matrix * A, gsl_matrix * V, gsl_vector * S);
+static void svd_dc (double * d, double * e, const size_t n, const int sqre,
+                    gsl_matrix * U, gsl_matrix * V, svd_dc_workspace * w);
+static void svd_dc_leaf (double * d, double * e, const size_t n, const int sqre,
+                         gsl_matrix * U, gsl_matrix * V);
+static void svd_dc_merge (double * d, const size_t nl, const size_t nr, const int sqre,
+                          const double alpha, const double beta,
+                          gsl_matrix * U, gsl_matrix * V, svd_dc_workspace * w);
+static double svd_dc_secular (const size_t k, const size_t j, const double dl[],
+                              const double zl[], double delta[]);
+
+/*
+gsl_linalg_SV_decomp_dc()
+  Singular value decomposition A = U S V^T by the divide and conquer
+method
+
+Inputs: A - (input) M-by-N matrix, M >= N
+            (output) M-by-N matrix U with orthonormal columns
+        V - (output) N-by-N orthogonal matrix
+        S - (output) singular values in decreasing order
+
+Return: success/error
+
+Notes:
+1) For M >= 11 N / 6 the matrix is first factored as A = Q R, and the
+SVD of the N-by-N triangular matrix R is computed, so that most of the
+work is done on a matrix of size N.
+*/
+
+int
+gsl_linalg_SV_decomp_dc (gsl_matrix * A, gsl_matrix * V, gsl_vector * S)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M < N)
+    {
+      GSL_ERROR ("svd of MxN matrix, M<N, is not implemented", GSL_EUNIMPL);
+    }
+  else if (V->size1 != N)
+    {
+      GSL_ERROR ("square matrix V must match second dimension of matrix A",
+                 GSL_EBADLEN);
+    }
+  else if (V->size1 != V->size2)
+    {
+      GSL_ERROR ("matrix V must be square", GSL_ENOTSQR);
+    }
+  else if (S->size != N)
+    {
+      GSL_ERROR ("length of vector S must match second dimension of matrix A",
+                 GSL_EBADLEN);
+    }
+  else if (N == 1)
+    {
+      gsl_vector_view column = gsl_matrix_column (A, 0);
+      double norm = gsl_blas_dnrm2 (&column.vector);
+
+      gsl_vector_set (S, 0, norm);
+      gsl_matrix_set (V, 0, 0, 1.0);
+
+      if (norm != 0.0)
+        {
+          gsl_blas_dscal (1.0 / norm, &column.vector);
+        }
+
+      return GSL_SUCCESS;
+    }
+  else if (6 * M >= 11 * N)
+    {
+      gsl_matrix *T = gsl_matrix_alloc (N, N);
+      gsl_matrix *R = gsl_matrix_calloc (M, N);
+      gsl_matrix_view R1;
+      gsl_matrix_view A1 = gsl_matrix_submatrix (A, 0, 0, N, N);
+      int status;
+
+      if (T == NULL || R == NULL)
+        {
+          if (T)
+            gsl_matrix_free (T);
+          if (R)
+            gsl_matrix_free (R);
+
+          GSL_ERROR ("failed to allocate space for QR factor", GSL_ENOMEM);
+        }
+
+      /* A = Q R, then R = U_R S V^T and U = Q [U_R; 0] */
+
+      gsl_linalg_QR_decomp_r (A, T);
+
+      R1 = gsl_matrix_submatrix (R, 0, 0, N, N);
+      gsl_matrix_tricpy (CblasUpper, CblasNonUnit, &R1.matrix, &A1.matrix);
+
+      status = svd_dc_decomp (&R1.matrix, V, S);
+
+      if (status == GSL_SUCCESS)
+        {
+          gsl_vector_view tau = gsl_matrix_diagonal (T);
+
+          status = svd_householder_apply (CblasNoTrans, A, &tau.vector, R);
+
+          if (status == GSL_SUCCESS)
+            gsl_matrix_memcpy (A, R);
+        }
+
+      gsl_matrix_free (T);
+      gsl_matrix_free (R);
+
+      return status;
+    }
+  else
+    {
+      return svd_dc_decomp (A, V, S);
+    }
+}
+
+/* Compute A = U S V^T for M >= N >= 2 through the bidiagonal form */
+
+static int
+svd_dc_decomp (gsl_matrix * A, gsl_matrix * V, gsl_vector * S)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  svd_dc_workspace w;
+  gsl_vector *tau_U = gsl_vector_alloc (N);
+  gsl_vector *tau_V = gsl_vector_alloc (N - 1);
+  gsl_vector *dv = gsl_vector_alloc (N);
+  gsl_vector *e = gsl_vector_alloc (N);
+  gsl_matrix *U = gsl_matrix_calloc (M, N);
+  double scale = 0.0;
+  int status;
+  size_t i;
+
+  w.work = malloc (5 * N * sizeof (double));
+  w.iwork = malloc (3 * N * sizeof (size_t));
+  w.Ug = gsl_matrix_alloc (N, N);
+  w.Vg = gsl_matrix_alloc (N + 1, N);
+  w.Uc = gsl_matrix_alloc (N, N);
+  w.Vc = gsl_matrix_alloc (N, N);
+
+  if (tau_U == NULL || tau_V == NULL || dv == NULL || e == NULL || U == NULL ||
+      w.work == NULL || w.iwork == NULL || w.Ug == NULL || w.Vg == NULL ||
+      w.Uc == NULL || w.Vc == NULL)
+    {
+      status = GSL_ENOMEM;
+    }
+  else
+    {
+      gsl_matrix_view UB = gsl_matrix_submatrix (U, 0, 0, N, N);
+
+      /* A = U_B B V_B^T */
+
+      gsl_linalg_bidiag_decomp (A, tau_U, tau_V);
+
+      for (i = 0; i < N; ++i)
+        {
+          gsl_vector_set (dv, i, gsl_matrix_get (A, i, i));
+          gsl_vector_set (e, i, (i < N - 1) ? gsl_matrix_get (A, i, i + 1) : 0.0);
+          scale = GSL_MAX (scale, fabs (gsl_vector_get (dv, i)));
+          scale = GSL_MAX (scale, fabs (gsl_vector_get (e, i)));
+        }
+
+      gsl_matrix_set_identity (&UB.matrix);
+      gsl_matrix_set_identity (V);
+
+      if (scale > 0.0)
+        {
+          /* scale B to unit max norm, so that the tolerances of the merges
+             are absolute, and compute B = U_B' S V_B'^T */
+
+          gsl_vector_scale (dv, 1.0 / scale);
+          gsl_vector_scale (e, 1.0 / scale);
+
+          svd_dc (dv->data, e->data, N, 0, &UB.matrix, V, &w);
+          gsl_vector_scale (dv, scale);
+        }
+
+      gsl_vector_memcpy (S, dv);
+
+      /* back-transform the singular vectors, U = U_B U_B' and V = V_B V_B' */
+
+      status = svd_householder_apply (CblasNoTrans, A, tau_U, U);
+
+      if (status == GSL_SUCCESS)
+        {
+          gsl_matrix_const_view AV = gsl_matrix_const_submatrix (A, 0, 1, N - 1, N - 1);
+          gsl_matrix_view V1 = gsl_matrix_submatrix (V, 1, 0, N - 1, N);
+
+          status = svd_householder_apply (CblasTrans, &AV.matrix, tau_V, &V1.matrix);
+        }
+
+      if (status == GSL_SUCCESS)
+        {
+          gsl_matrix_memcpy (A, U);
+
+          /* reverse into decreasing order */
+
+          for (i = 0; i < N / 2; ++i)
+            {
+              gsl_vector_swap_elements (S, i, N - 1 - i);
+              gsl_matrix_swap_columns (A, i, N - 1 - i);
+              gsl_matrix_swap_columns (V, i, N - 1 - i);
+            }
+        }
+    }
+
+  if (tau_U)
+    gsl_vector_free (tau_U);
+  if (tau_V)
+    gsl_vector_free (tau_V);
+  if (dv)
+    gsl_vector_free (dv);
+  if (e)
+    gsl_vector_free (e);
+  if (U)
+    gsl_matrix_free (U);
+  if (w.Ug)
+    gsl_matrix_free (w.Ug);
+  if (w.Vg)
+    gsl_matrix_free (w.Vg);
+  if (w.Uc)
+    gsl_matrix_free (w.Uc);
+  if (w.Vc)
+    gsl_matrix_free (w.Vc);
+  free (w.work);
+  free (w.iwork);
+
+  if (status == GSL_ENOMEM)
+    {
+      GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  return status;
+}
+
+/* Compute the SVD of the n-by-(n + sqre) upper bidiagonal matrix with
+   diagonal d and superdiagonal e (of length n - 1 + sqre) in place,
+   with the singular values in increasing order in d.  U (n-by-n) and
+   V (n + sqre square) are the identity on entry; on output the first n
+   columns of V are the right singular vectors, and if sqre = 1 the last
+   column of V spans the null space. */
+
+static void
+svd_dc (double * d, double * e, const size_t n, const int sqre,
+        gsl_matrix * U, gsl_matrix * V, svd_dc_workspace * w)
+{
+  if (n <= SVD_DC_LEAF)
+    {
+      svd_dc_leaf (d, e, n, sqre, U, V);
+    }
+  else
+    {
+      /* split at row nl into an nl-by-(nl + 1) upper block, the row
+         (alpha, beta) and an nr-by-(nr + sqre) lower block */
+
+      const size_t nl = n / 2;
+      const size_t nr = n - nl - 1;
+      const double alpha = d[nl];
+      const double beta = e[nl];
+      gsl_matrix_view U1 = gsl_matrix_submatrix (U, 0, 0, nl, nl);
+      gsl_matrix_view V1 = gsl_matrix_submatrix (V, 0, 0, nl + 1, nl + 1);
+      gsl_matrix_view U2 = gsl_matrix_submatrix (U, nl + 1, nl + 1, nr, nr);
+      gsl_matrix_view V2 = gsl_matrix_submatrix (V, nl + 1, nl + 1, nr + sqre, nr + sqre);
+
+      svd_dc (d, e, nl, 1, &U1.matrix, &V1.matrix, w);
+      svd_dc (d + nl + 1, e + nl + 1, nr, sqre, &U2.matrix, &V2.matrix, w);
+
+      svd_dc_merge (d, nl, nr, sqre, alpha, beta, U, V, w);
+    }
+}
+
+static void
+svd_dc_leaf (double * d, double * e, const size_t n, const int sqre,
+             gsl_matrix * U, gsl_matrix * V)
+{
+  gsl_matrix_view Vn = gsl_matrix_submatrix (V, 0, 0, V->size1, n);
+  size_t a, b, i, j;
+
+  if (sqre)
+    {
+      /* rotate the extra column into the others from the right, which
+         moves the element e[n-1] up the column until it vanishes */
+
+      double x = e[n - 1];
+
+      for (j = n; j-- > 0 && x != 0.0;)
+        {
+          const double r = hypot (d[j], x);
+          const double c = d[j] / r;
+          const double s = x / r;
+          gsl_vector_view vj = gsl_matrix_column (V, j);
+          gsl_vector_view vn = gsl_matrix_column (V, n);
+
+          d[j] = r;
+          gsl_blas_drot (&vj.vector, &vn.vector, c, s);
+
+          if (j > 0)
+            {
+              x = -s * e[j - 1];
+              e[j - 1] *= c;
+            }
+        }
+
+      e[n - 1] = 0.0;
+    }
+
+  if (n > 1)
+    {
+      gsl_vector_view dv = gsl_vector_view_array (d, n);
+      gsl_vector_view ev = gsl_vector_view_array (e, n - 1);
+      size_t iter = 0;
+
+      chop_small_elements (&dv.vector, &ev.vector);
+
+      b = n - 1;
+
+      while (b > 0 && iter++ < 100 * n)
+        {
+          if (e[b - 1] == 0.0 || gsl_isnan (e[b - 1]))
+            {
+              b--;
+              continue;
+            }
+
+          a = b - 1;
+
+          while (a > 0 && e[a - 1] != 0.0 && !gsl_isnan (e[a - 1]))
+            a--;
+
+          {
+            const size_t n_block = b - a + 1;
+            gsl_vector_view d_block = gsl_vector_view_array (d + a, n_block);
+            gsl_vector_view e_block = gsl_vector_view_array (e + a, n_block - 1);
+            gsl_matrix_view U_block = gsl_matrix_submatrix (U, 0, a, n, n_block);
+            gsl_matrix_view V_block = gsl_matrix_submatrix (&Vn.matrix, 0, a, V->size1, n_block);
+
+            qrstep (&d_block.vector, &e_block.vector, &U_block.matrix, &V_block.matrix);
+            chop_small_elements (&d_block.vector, &e_block.vector);
+          }
+        }
+    }
+
+  /* make the singular values positive */
+
+  for (j = 0; j < n; j++)
+    {
+      if (d[j] < 0.0)
+        {
+          gsl_vector_view v = gsl_matrix_column (V, j);
+          gsl_vector_scale (&v.vector, -1.0);
+          d[j] = -d[j];
+        }
+    }
+
+  /* selection sort into increasing order */
+
+  for (i = 0; i + 1 < n; i++)
+    {
+      size_t k = i;
+      double dk = d[i];
+
+      for (j = i + 1; j < n; j++)
+        {
+          if (d[j] < dk)
+            {
+              k = j;
+              dk = d[j];
+            }
+        }
+
+      if (k != i)
+        {
+          d[k] = d[i];
+          d[i] = dk;
+          gsl_matrix_swap_columns (U, i, k);
+          gsl_matrix_swap_columns (V, i, k);
+        }
+    }
+}
+
+/* Merge the two solved halves of sizes nl and nr, coupled by the row
+   (alpha, beta) */
+
+static void
+svd_dc_merge (double * d, const size_t nl, const size_t nr, const int sqre,
+              const double alpha, const double beta,
+              gsl_matrix * U, gsl_matrix * V, svd_dc_workspace * w)
+{
+  const size_t n = nl + nr + 1;
+  const size_t m = n + sqre;
+  double *z = w->work;            /* first row of M */
+  double *dl = w->work + n;       /* nondeflated d_i in increasing order */
+  double *zl = w->work + 2 * n;   /* and their components of z */
+  double *sigma = w->work + 3 * n;        /* new singular values */
+  double *tmp = w->work + 4 * n;
+  size_t *perm = w->iwork;        /* columns in increasing order of d_i */
+  size_t *col = w->iwork + n;     /* nondeflated columns, then deflated */
+  size_t *order = w->iwork + 2 * n;
+  gsl_matrix_view Ug = gsl_matrix_submatrix (w->Ug, 0, 0, n, n);
+  gsl_matrix_view Vg = gsl_matrix_submatrix (w->Vg, 0, 0, m, n);
+  double dmax = GSL_MAX (fabs (alpha), fabs (beta)), tol;
+  size_t i, j, k, ndefl = 0;
+
+  /* the coupling row in the bases of the halves; column nl of V holds
+     the null vector of the upper block, whose d_i is taken as zero */
+
+  for (j = 0; j <= nl; j++)
+    z[j] = alpha * gsl_matrix_get (V, nl, j);
+
+  for (j = nl + 1; j < m; j++)
+    z[j] = beta * gsl_matrix_get (V, nl + 1, j);
+
+  d[nl] = 0.0;
+
+  if (sqre)
+    {
+      /* combine the null vectors of the two halves */
+
+      const double r = hypot (z[nl], z[m - 1]);
+
+      if (r != 0.0)
+        {
+          gsl_vector_view x = gsl_matrix_column (V, nl);
+          gsl_vector_view y = gsl_matrix_column (V, m - 1);
+          const double c = z[nl] / r, s = z[m - 1] / r;
+
+          gsl_blas_drot (&x.vector, &y.vector, c, s);
+          z[nl] = r;
+          z[m - 1] = 0.0;
+        }
+    }
+
+  /* merge the two sorted halves, after the zero d_nl */
+
+  perm[0] = nl;
+
+  for (i = 0, j = nl + 1, k = 1; k < n; k++)
+    {
+      if (j >= n || (i < nl && d[i] <= d[j]))
+        perm[k] = i++;
+      else
+        perm[k] = j++;
+    }
+
+  for (i = 0; i < n; i++)
+    dmax = GSL_MAX (dmax, fabs (d[i]));
+
+  tol = 8.0 * GSL_DBL_EPSILON * dmax;
+
+  if (fabs (z[nl]) <= tol)
+    z[nl] = (z[nl] < 0.0) ? -tol : tol;
+
+  /* deflation: drop negligible components of z, and rotate away one
+     component of z for each pair of d_i which are close together */
+
+  {
+    size_t p = nl;             /* previous nondeflated column */
+
+    k = 0;
+
+    for (i = 1; i < n; i++)
+      {
+        const size_t jj = perm[i];
+
+        if (fabs (z[jj]) <= tol)
+          {
+            col[n - 1 - ndefl++] = jj;
+          }
+        else if (d[jj] - d[p] <= tol)
+          {
+            const double t = hypot (z[p], z[jj]);
+            gsl_vector_view vp = gsl_matrix_column (V, p);
+            gsl_vector_view vj = gsl_matrix_column (V, jj);
+
+            if (p == nl)
+              {
+                /* d_jj is negligible: fold z_jj into z_nl, leaving
+                   c d_jj in column jj */
+
+                const double c = z[nl] / t, s = z[jj] / t;
+                gsl_vector_view uj = gsl_matrix_column (U, jj);
+
+                gsl_blas_drot (&vp.vector, &vj.vector, c, s);
+                z[nl] = t;
+                z[jj] = 0.0;
+                d[jj] *= c;
+
+                if (d[jj] < 0.0)
+                  {
+                    d[jj] = -d[jj];
+                    gsl_vector_scale (&uj.vector, -1.0);
+                  }
+
+                col[n - 1 - ndefl++] = jj;
+              }
+            else
+              {
+                /* x' = c x + s y, y' = c y - s x on the rows and
+                   columns p and jj */
+
+                const double c = z[jj] / t, s = -z[p] / t;
+                const double dp = d[p], dj = d[jj];
+                gsl_vector_view up = gsl_matrix_column (U, p);
+                gsl_vector_view uj = gsl_matrix_column (U, jj);
+
+                gsl_blas_drot (&vp.vector, &vj.vector, c, s);
+                gsl_blas_drot (&up.vector, &uj.vector, c, s);
+                z[jj] = t;
+                z[p] = 0.0;
+                d[p] = dp * c * c + dj * s * s;
+                d[jj] = dp * s * s + dj * c * c;
+
+                col[n - 1 - ndefl++] = p;
+                p = jj;
+              }
+          }
+        else
+          {
+            col[k++] = p;
+            p = jj;
+          }
+      }
+
+    col[k++] = p;
+  }
+
+  /* the deflated columns were stored from the end backwards */
+
+  for (i = 0; i < ndefl / 2; i++)
+    {
+      const size_t t = col[k + i];
+      col[k + i] = col[n - 1 - i];
+      col[n - 1 - i] = t;
+    }
+
+  /* gather the columns of U and V */
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_vector_view su = gsl_matrix_column (U, col[i]);
+      gsl_vector_view du = gsl_matrix_column (&Ug.matrix, i);
+      gsl_vector_view sv = gsl_matrix_subcolumn (V, col[i], 0, m);
+      gsl_vector_view dv = gsl_matrix_column (&Vg.matrix, i);
+
+      gsl_vector_memcpy (&du.vector, &su.vector);
+      gsl_vector_memcpy (&dv.vector, &sv.vector);
+    }
+
+  /* solve the secular equation for the nondeflated part and compute
+     its singular vectors,
+
+     v_j = (zhat_i / (dl_i^2 - sigma_j^2))_i
+     u_j = (-1, (dl_i zhat_i / (dl_i^2 - sigma_j^2))_{i>0})
+
+     normalized, where zhat is the vector for which the computed
+     sigma_j are the exact singular values (Gu and Eisenstat) */
+
+  {
+    gsl_matrix_view Uc = gsl_matrix_submatrix (w->Uc, 0, 0, k, k);
+    gsl_matrix_view Vc = gsl_matrix_submatrix (w->Vc, 0, 0, k, k);
+    gsl_matrix_view Ug1 = gsl_matrix_submatrix (&Ug.matrix, 0, 0, n, k);
+    gsl_matrix_view Vg1 = gsl_matrix_submatrix (&Vg.matrix, 0, 0, m, k);
+    gsl_matrix_view U1 = gsl_matrix_submatrix (U, 0, 0, n, k);
+    gsl_matrix_view V1 = gsl_matrix_submatrix (V, 0, 0, m, k);
+
+    for (i = 0; i < k; i++)
+      {
+        dl[i] = d[col[i]];
+        zl[i] = z[col[i]];
+      }
+
+    for (j = 0; j < k; j++)
+      {
+        sigma[j] = svd_dc_secular (k, j, dl, zl, tmp);
+
+        for (i = 0; i < k; i++)
+          gsl_matrix_set (&Vc.matrix, i, j, tmp[i]);
+      }
+
+    /* zhat_i^2 = (sigma_i^2 - dl_i^2)
+                    prod_{j != i} (sigma_j^2 - dl_i^2) / (dl_j^2 - dl_i^2) */
+
+    for (i = 0; i < k; i++)
+      {
+        double prod = -gsl_matrix_get (&Vc.matrix, i, i);
+
+        for (j = 0; j < k; j++)
+          {
+            if (j != i)
+              prod *= gsl_matrix_get (&Vc.matrix, i, j) /
+                      ((dl[i] - dl[j]) * (dl[i] + dl[j]));
+          }
+
+        tmp[i] = (zl[i] < 0.0) ? -sqrt (fabs (prod)) : sqrt (fabs (prod));
+      }
+
+    for (j = 0; j < k; j++)
+      {
+        gsl_vector_view v = gsl_matrix_column (&Vc.matrix, j);
+        gsl_vector_view u = gsl_matrix_column (&Uc.matrix, j);
+
+        for (i = 0; i < k; i++)
+          {
+            const double vij = tmp[i] / gsl_vector_get (&v.vector, i);
+
+            gsl_vector_set (&v.vector, i, vij);
+            gsl_vector_set (&u.vector, i, (i == 0) ? -1.0 : dl[i] * vij);
+          }
+
+        gsl_vector_scale (&v.vector, 1.0 / gsl_blas_dnrm2 (&v.vector));
+        gsl_vector_scale (&u.vector, 1.0 / gsl_blas_dnrm2 (&u.vector));
+      }
+
+    gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Ug1.matrix, &Uc.matrix,
+                    0.0, &U1.matrix);
+    gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Vg1.matrix, &Vc.matrix,
+                    0.0, &V1.matrix);
+  }
+
+  for (i = k; i < n; i++)
+    {
+      gsl_vector_view su = gsl_matrix_column (&Ug.matrix, i);
+      gsl_vector_view du = gsl_matrix_column (U, i);
+      gsl_vector_view sv = gsl_matrix_column (&Vg.matrix, i);
+      gsl_vector_view dv = gsl_matrix_subcolumn (V, i, 0, m);
+
+      gsl_vector_memcpy (&du.vector, &su.vector);
+      gsl_vector_memcpy (&dv.vector, &sv.vector);
+      sigma[i] = d[col[i]];
+    }
+
+  /* sort the singular values and vectors into increasing order */
+
+  gsl_sort_index (order, sigma, 1, n);
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_vector_view su = gsl_matrix_column (U, order[i]);
+      gsl_vector_view du = gsl_matrix_column (&Ug.matrix, i);
+      gsl_vector_view sv = gsl_matrix_subcolumn (V, order[i], 0, m);
+      gsl_vector_view dv = gsl_matrix_column (&Vg.matrix, i);
+
+      gsl_vector_memcpy (&du.vector, &su.vector);
+      gsl_vector_memcpy (&dv.vector, &sv.vector);
+      d[i] = sigma[order[i]];
+    }
+
+  {
+    gsl_matrix_view Vn = gsl_matrix_submatrix (V, 0, 0, m, n);
+
+    gsl_matrix_memcpy (U, &Ug.matrix);
+    gsl_matrix_memcpy (&Vn.matrix, &Vg.matrix);
+  }
+}
+
+/* Find the j-th singular value sigma_j of the merged problem, the
+   root of
+
+     f(sigma) = 1 + sum_i zl_i^2 / (dl_i^2 - sigma^2) = 0
+
+   in (dl_j, dl_j+1), with distinct dl in increasing order and
+   dl_0 = 0, and return it together with delta_i = dl_i^2 - sigma_j^2.
+   The iteration is that of symmvd.c for the eigenvalues sigma^2 of
+   diag(dl^2) + z z^T, with the squared poles taken relative to the
+   nearest one as (dl_i - dl_o)(dl_i + dl_o) to avoid cancellation. */
+
+static double
+svd_dc_secular (const size_t k, const size_t j, const double dl[],
+                const double zl[], double delta[])
+{
+  const size_t ip = (j < k - 1) ? j : k - 2;
+  double origin, lo, hi, tau;
+  size_t i, iter;
+
+  if (k == 1)
+    {
+      delta[0] = -zl[0] * zl[0];
+      return fabs (zl[0]);
+    }
+
+  if (j < k - 1)
+    {
+      /* the root lies in (dl_j^2, dl_j+1^2); take as origin the pole
+         on the same side of the midpoint */
+
+      const double mid = 0.5 * (dl[j + 1] - dl[j]) * (dl[j + 1] + dl[j]);
+      double f = 1.0;
+
+      for (i = 0; i < k; i++)
+        f += zl[i] * zl[i] / ((dl[i] - dl[j]) * (dl[i] + dl[j]) - mid);
+
+      if (f >= 0.0)
+        {
+          origin = dl[j];
+          lo = 0.0;
+          hi = mid;
+        }
+      else
+        {
+          origin = dl[j + 1];
+          lo = -mid;
+          hi = 0.0;
+        }
+    }
+  else
+    {
+      /* the largest root lies in (dl_k-1^2, dl_k-1^2 + |z|^2] */
+
+      double zz = 0.0;
+
+      for (i = 0; i < k; i++)
+        zz += zl[i] * zl[i];
+
+      origin = dl[k - 1];
+      lo = 0.0;
+      hi = zz;
+    }
+
+  tau = 0.5 * (lo + hi);
+
+  for (iter = 0; iter < 100; iter++)
+    {
+      double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+      double f, a, b, c, eta, di, di1;
+
+      for (i = 0; i < k; i++)
+        {
+          const double del = (dl[i] - origin) * (dl[i] + origin) - tau;
+          const double t = zl[i] / del;
+
+          delta[i] = del;
+
+          if (i <= ip)
+            {
+              psi += zl[i] * t;
+              dpsi += t * t;
+            }
+          else
+            {
+              phi += zl[i] * t;
+              dphi += t * t;
+            }
+        }
+
+      f = 1.0 + psi + phi;
+
+      if (fabs (f) <= 8.0 * GSL_DBL_EPSILON * (1.0 + fabs (psi) + fabs (phi)))
+        break;
+
+      /* f is increasing in sigma^2 */
+
+      if (f < 0.0)
+        lo = tau;
+      else
+        hi = tau;
+
+      if (hi - lo <= 2.0 * GSL_DBL_EPSILON * GSL_MAX (fabs (lo), fabs (hi)))
+        break;
+
+      di = delta[ip];
+      di1 = delta[ip + 1];
+      a = (di + di1) * f - di * di1 * (dpsi + dphi);
+      b = di * di1 * f;
+      c = f - di * dpsi - di1 * dphi;
+
+      if (c == 0.0)
+        eta = (a != 0.0) ? b / a : 0.0;
+      else if (a <= 0.0)
+        eta = (a - sqrt (fabs (a * a - 4.0 * b * c))) / (2.0 * c);
+      else
+        eta = 2.0 * b / (a + sqrt (fabs (a * a - 4.0 * b * c)));
+
+      /* take a Newton step if eta has the wrong sign */
+
+      if (f * eta >= 0.0)
+        eta = -f / (dpsi + dphi);
+
+      eta += tau;
+
+      if (!(eta > lo && eta < hi))
+        eta = 0.5 * (lo + hi);
+
+      tau = eta;
+    }
+
+  for (i = 0; i < k; i++)
+    delta[i] = (dl[i] - origin) * (dl[i] + origin) - tau;
+
+  return sqrt (origin * origin + tau);
+}
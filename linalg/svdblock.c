@@ -0,0 +1,136 @@
+/* linalg/svdblock.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Blocked application of a sequence of Householder reflectors, used
+   to back-transform the singular vectors of the reduced matrix in
+   svd.c and svd_dc.c.  The reflectors are grouped in blocks of
+   SVD_BLOCK, and each block is applied as I - Y T Y^T with Level 3
+   BLAS, as in the LAPACK routines DLARFT and DLARFB. */
+
+#define SVD_BLOCK 32
+
+/* Compute C = H_0 H_1 ... H_{K-1} C, where H_i = I - tau_i v_i v_i^T
+   and v_i has zeros in rows 0..i-1 and a unit element in row i.  If
+   trans == CblasNoTrans, the rest of v_i is stored below the diagonal
+   in column i of A, as returned by the QR decompositions; otherwise
+   it is stored to the right of the diagonal in row i of A.  K is the
+   length of tau. */
+
+static int
+svd_householder_apply (const CBLAS_TRANSPOSE_t trans, const gsl_matrix * A,
+                       const gsl_vector * tau, gsl_matrix * C)
+{
+  const size_t R = C->size1;
+  const size_t K = tau->size;
+  const size_t nb = GSL_MIN (SVD_BLOCK, K);
+  gsl_matrix *Y, *T, *W;
+  size_t j0;
+
+  if (K == 0)
+    return GSL_SUCCESS;
+
+  Y = gsl_matrix_alloc (R, nb);
+  T = gsl_matrix_alloc (nb, nb);
+  W = gsl_matrix_alloc (nb, C->size2);
+
+  if (Y == NULL || T == NULL || W == NULL)
+    {
+      if (Y)
+        gsl_matrix_free (Y);
+      if (T)
+        gsl_matrix_free (T);
+      if (W)
+        gsl_matrix_free (W);
+
+      GSL_ERROR ("failed to allocate space for block reflector", GSL_ENOMEM);
+    }
+
+  /* the reflectors are applied to C in reverse order, one block at a time */
+
+  for (j0 = ((K - 1) / nb) * nb; ; j0 -= nb)
+    {
+      const size_t ib = GSL_MIN (nb, K - j0);
+      const size_t r = R - j0;
+      gsl_matrix_view Yb = gsl_matrix_submatrix (Y, 0, 0, r, ib);
+      gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+      gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, C->size2);
+      gsl_matrix_view Cb = gsl_matrix_submatrix (C, j0, 0, r, C->size2);
+      size_t i, j;
+
+      /* copy the block of vectors into Y, with the implicit unit
+         diagonal and zeros above it */
+
+      for (j = 0; j < ib; ++j)
+        {
+          for (i = 0; i < r; ++i)
+            {
+              double y;
+
+              if (i < j)
+                y = 0.0;
+              else if (i == j)
+                y = 1.0;
+              else if (trans == CblasNoTrans)
+                y = gsl_matrix_get (A, j0 + i, j0 + j);
+              else
+                y = gsl_matrix_get (A, j0 + j, j0 + i);
+
+              gsl_matrix_set (&Yb.matrix, i, j, y);
+            }
+        }
+
+      /* form the triangular factor T, column by column */
+
+      gsl_matrix_set_zero (&Tb.matrix);
+
+      for (j = 0; j < ib; ++j)
+        {
+          const double tau_j = gsl_vector_get (tau, j0 + j);
+
+          gsl_matrix_set (&Tb.matrix, j, j, tau_j);
+
+          if (j > 0)
+            {
+              gsl_matrix_view Yp = gsl_matrix_submatrix (&Yb.matrix, j, 0, r - j, j);
+              gsl_vector_view y = gsl_matrix_subcolumn (&Yb.matrix, j, j, r - j);
+              gsl_vector_view t = gsl_matrix_subcolumn (&Tb.matrix, j, 0, j);
+              gsl_matrix_view Tp = gsl_matrix_submatrix (&Tb.matrix, 0, 0, j, j);
+
+              /* T(0:j-1,j) = -tau_j T(0:j-1,0:j-1) Y(:,0:j-1)^T y_j */
+              gsl_blas_dgemv (CblasTrans, -tau_j, &Yp.matrix, &y.vector, 0.0, &t.vector);
+              gsl_blas_dtrmv (CblasUpper, CblasNoTrans, CblasNonUnit, &Tp.matrix, &t.vector);
+            }
+        }
+
+      /* C = (I - Y T Y^T) C */
+
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Yb.matrix, &Cb.matrix, 0.0, &Wb.matrix);
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tb.matrix, &Wb.matrix);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &Yb.matrix, &Wb.matrix, 1.0, &Cb.matrix);
+
+      if (j0 == 0)
+        break;
+    }
+
+  gsl_matrix_free (Y);
+  gsl_matrix_free (T);
+  gsl_matrix_free (W);
+
+  return GSL_SUCCESS;
+}
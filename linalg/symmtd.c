@@ -46,6 +46,13 @@
  * This storage scheme is the same as in LAPACK.  See LAPACK's
  * ssytd2.f for details.
  *
+ * For N > CROSSOVER_SYMMTD the leading columns are reduced in panels
+ * of SYMMTD_BLOCK columns.  The reflectors of a panel are accumulated
+ * together with a matrix W, so that the trailing matrix is updated
+ * once per panel with the rank-2k update A = A - V W' - W V', as in
+ * LAPACK's dsytrd.f and dlatrd.f.  The last CROSSOVER_SYMMTD columns
+ * are reduced with the Level 2 algorithm.
+ *
  * See Golub & Van Loan, "Matrix Computations" (3rd ed), Section 8.3 
  *
  * Note: this description uses 1-based indices. The code below uses
@@ -61,6 +68,13 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "recurse.h"
+
+static void symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau);
+static void symmtd_decomp_panel (gsl_matrix * A, gsl_vector * tau, gsl_vector * e,
+                                 gsl_matrix * W, gsl_vector * work);
+static void symmtd_update (const gsl_matrix * V, const gsl_matrix * W, gsl_matrix * A);
+
 int 
 gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)  
 {
@@ -76,47 +90,252 @@ gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)
   else
     {
       const size_t N = A->size1;
-      size_t i;
-  
-      for (i = 0 ; i < N - 2; i++)
+      size_t i = 0;
+
+      if (N > CROSSOVER_SYMMTD)
         {
-          gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, N - i - 1);
-          double tau_i = gsl_linalg_householder_transform (&v.vector);
-          
-          /* Apply the transformation H^T A H to the remaining columns */
+          const size_t nb = SYMMTD_BLOCK;
+          gsl_matrix *W = gsl_matrix_alloc (N, nb);
+          gsl_vector *e = gsl_vector_alloc (nb);
+          gsl_vector *work = gsl_vector_alloc (2 * N);
+
+          if (W == NULL || e == NULL || work == NULL)
+            {
+              if (W)
+                gsl_matrix_free (W);
+              if (e)
+                gsl_vector_free (e);
+              if (work)
+                gsl_vector_free (work);
 
-          if (tau_i != 0.0) 
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
+
+          while (i + CROSSOVER_SYMMTD < N)
             {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
-              double ei = gsl_vector_get(&v.vector, 0);
-              gsl_vector_view x = gsl_vector_subvector (tau, i, N - i - 1);
+              const size_t n = N - i;
+              const size_t ib = GSL_MIN (nb, N - CROSSOVER_SYMMTD - i);
+              gsl_matrix_view A22 = gsl_matrix_submatrix (A, i, i, n, n);
+              gsl_vector_view tau22 = gsl_vector_subvector (tau, i, ib);
+              gsl_vector_view e22 = gsl_vector_subvector (e, 0, ib);
+              gsl_matrix_view W22 = gsl_matrix_submatrix (W, 0, 0, n, ib);
+              size_t j;
 
-              gsl_vector_set (&v.vector, 0, 1.0);
-              
-              /* x = tau * A * v */
-              gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
+              symmtd_decomp_panel (&A22.matrix, &tau22.vector, &e22.vector,
+                                   &W22.matrix, work);
 
-              /* w = x - (1/2) tau * (x' * v) * v  */
+              /* update the trailing matrix, A = A - V W' - W V' */
               {
-                double xv, alpha;
-                gsl_blas_ddot(&x.vector, &v.vector, &xv);
-                alpha = -0.5 * tau_i * xv;
-                gsl_blas_daxpy(alpha, &v.vector, &x.vector);
+                gsl_matrix_view V = gsl_matrix_submatrix (&A22.matrix, ib, 0, n - ib, ib);
+                gsl_matrix_view W2 = gsl_matrix_submatrix (&W22.matrix, ib, 0, n - ib, ib);
+                gsl_matrix_view A33 = gsl_matrix_submatrix (&A22.matrix, ib, ib, n - ib, n - ib);
+
+                symmtd_update (&V.matrix, &W2.matrix, &A33.matrix);
               }
-              
-              /* apply the transformation A = A - v w' - w v' */
-              gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
 
-              gsl_vector_set (&v.vector, 0, ei);
+              /* restore the subdiagonal elements */
+              for (j = 0; j < ib; j++)
+                gsl_matrix_set (&A22.matrix, j + 1, j, gsl_vector_get (&e22.vector, j));
+
+              i += ib;
             }
+
+          gsl_matrix_free (W);
+          gsl_vector_free (e);
+          gsl_vector_free (work);
+        }
+
+      /* reduce the remaining columns with Level 2 BLAS */
+      if (N - i > 2)
+        {
+          gsl_matrix_view A22 = gsl_matrix_submatrix (A, i, i, N - i, N - i);
+          gsl_vector_view tau22 = gsl_vector_subvector (tau, i, N - i - 1);
+
+          symmtd_decomp_L2 (&A22.matrix, &tau22.vector);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+symmtd_decomp_L2()
+  Reduce a symmetric matrix to tridiagonal form with Level 2 BLAS,
+one Householder reflector at a time
+
+Inputs: A   - N-by-N matrix, N > 2
+        tau - (output) Householder coefficients, length N - 1; also
+              used as workspace
+*/
+
+static void
+symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau)
+{
+  const size_t N = A->size1;
+  size_t i;
+  
+  for (i = 0 ; i < N - 2; i++)
+    {
+      gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, N - i - 1);
+      double tau_i = gsl_linalg_householder_transform (&v.vector);
+      
+      /* Apply the transformation H^T A H to the remaining columns */
+
+      if (tau_i != 0.0) 
+        {
+          gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
+          double ei = gsl_vector_get(&v.vector, 0);
+          gsl_vector_view x = gsl_vector_subvector (tau, i, N - i - 1);
+
+          gsl_vector_set (&v.vector, 0, 1.0);
+          
+          /* x = tau * A * v */
+          gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
+
+          /* w = x - (1/2) tau * (x' * v) * v  */
+          {
+            double xv, alpha;
+            gsl_blas_ddot(&x.vector, &v.vector, &xv);
+            alpha = -0.5 * tau_i * xv;
+            gsl_blas_daxpy(alpha, &v.vector, &x.vector);
+          }
           
-          gsl_vector_set (tau, i, tau_i);
+          /* apply the transformation A = A - v w' - w v' */
+          gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
+
+          gsl_vector_set (&v.vector, 0, ei);
         }
       
-      return GSL_SUCCESS;
+      gsl_vector_set (tau, i, tau_i);
     }
-}  
+}
+
+/*
+symmtd_decomp_panel()
+  Reduce the first nb columns of a symmetric matrix, without updating
+the trailing matrix A(nb:N-1,nb:N-1). This is LAPACK's dlatrd.f for
+the lower triangle.
+
+Inputs: A   - N-by-N matrix, N > nb; on output the first nb columns
+              hold the reduced matrix and the Householder vectors,
+              with unit elements in place of the subdiagonal
+        tau - (output) Householder coefficients, length nb
+        e   - (output) subdiagonal elements, length nb
+        W   - (output) N-by-nb matrix such that the trailing matrix is
+              updated by A = A - V W' - W V', where V = A(:,0:nb-1)
+        work - workspace, length 2*N
+
+The columns of W and A are strided, so the matrix-vector products
+with the trailing matrix are done on contiguous copies.
+*/
+
+static void
+symmtd_decomp_panel (gsl_matrix * A, gsl_vector * tau, gsl_vector * e,
+                     gsl_matrix * W, gsl_vector * work)
+{
+  const size_t N = A->size1;
+  const size_t nb = W->size2;
+  size_t i;
+
+  for (i = 0; i < nb; i++)
+    {
+      gsl_vector_view ai = gsl_matrix_subcolumn (A, i, i, N - i);
+
+      /* update A(i:N-1,i) with the previous reflectors of the panel */
+      if (i > 0)
+        {
+          gsl_matrix_view Ai = gsl_matrix_submatrix (A, i, 0, N - i, i);
+          gsl_matrix_view Wi = gsl_matrix_submatrix (W, i, 0, N - i, i);
+          gsl_vector_view wrow = gsl_matrix_subrow (W, i, 0, i);
+          gsl_vector_view arow = gsl_matrix_subrow (A, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Ai.matrix, &wrow.vector, 1.0, &ai.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Wi.matrix, &arow.vector, 1.0, &ai.vector);
+        }
+
+      /* generate the reflector to annihilate A(i+2:N-1,i) */
+      {
+        gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, N - i - 1);
+        gsl_vector_view wi = gsl_matrix_subcolumn (W, i, i + 1, N - i - 1);
+        gsl_vector_view vc = gsl_vector_subvector (work, 0, N - i - 1);
+        gsl_vector_view wc = gsl_vector_subvector (work, N, N - i - 1);
+        gsl_matrix_view A22 = gsl_matrix_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
+        double tau_i = gsl_linalg_householder_transform (&v.vector);
+        double xv;
+
+        gsl_vector_set (e, i, gsl_vector_get (&v.vector, 0));
+        gsl_vector_set (&v.vector, 0, 1.0);
+        gsl_vector_memcpy (&vc.vector, &v.vector);
+
+        /* w = tau (A - V W' - W V') v */
+        gsl_blas_dsymv (CblasLower, 1.0, &A22.matrix, &vc.vector, 0.0, &wc.vector);
+
+        if (i > 0)
+          {
+            gsl_matrix_view Vi = gsl_matrix_submatrix (A, i + 1, 0, N - i - 1, i);
+            gsl_matrix_view Wi = gsl_matrix_submatrix (W, i + 1, 0, N - i - 1, i);
+            gsl_vector_view wtop = gsl_matrix_subcolumn (W, i, 0, i);
+
+            gsl_blas_dgemv (CblasTrans, 1.0, &Wi.matrix, &vc.vector, 0.0, &wtop.vector);
+            gsl_blas_dgemv (CblasNoTrans, -1.0, &Vi.matrix, &wtop.vector, 1.0, &wc.vector);
+            gsl_blas_dgemv (CblasTrans, 1.0, &Vi.matrix, &vc.vector, 0.0, &wtop.vector);
+            gsl_blas_dgemv (CblasNoTrans, -1.0, &Wi.matrix, &wtop.vector, 1.0, &wc.vector);
+          }
 
+        gsl_blas_dscal (tau_i, &wc.vector);
+
+        /* w = w - (1/2) tau (w' v) v */
+        gsl_blas_ddot (&wc.vector, &vc.vector, &xv);
+        gsl_blas_daxpy (-0.5 * tau_i * xv, &vc.vector, &wc.vector);
+
+        gsl_vector_memcpy (&wi.vector, &wc.vector);
+        gsl_vector_set (tau, i, tau_i);
+      }
+    }
+}
+
+/*
+symmtd_update()
+  Rank-2k update of the lower triangle, A = A - V W' - W V', with
+matrix-matrix products on blocks of columns below the diagonal
+blocks, which are updated with dsyr2k
+
+Inputs: V - N-by-k matrix
+        W - N-by-k matrix
+        A - N-by-N matrix; only the lower triangle is updated
+*/
+
+static void
+symmtd_update (const gsl_matrix * V, const gsl_matrix * W, gsl_matrix * A)
+{
+  const size_t N = A->size1;
+  const size_t k = V->size2;
+  const size_t nb = 4 * SYMMTD_BLOCK;
+  size_t j;
+
+  for (j = 0; j < N; j += nb)
+    {
+      const size_t jb = GSL_MIN (nb, N - j);
+      gsl_matrix_const_view V1 = gsl_matrix_const_submatrix (V, j, 0, jb, k);
+      gsl_matrix_const_view W1 = gsl_matrix_const_submatrix (W, j, 0, jb, k);
+      gsl_matrix_view A11 = gsl_matrix_submatrix (A, j, j, jb, jb);
+
+      gsl_blas_dsyr2k (CblasLower, CblasNoTrans, -1.0, &V1.matrix, &W1.matrix,
+                       1.0, &A11.matrix);
+
+      if (j + jb < N)
+        {
+          gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (V, j + jb, 0, N - j - jb, k);
+          gsl_matrix_const_view W2 = gsl_matrix_const_submatrix (W, j + jb, 0, N - j - jb, k);
+          gsl_matrix_view A21 = gsl_matrix_submatrix (A, j + jb, j, N - j - jb, jb);
+
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &V2.matrix, &W1.matrix,
+                          1.0, &A21.matrix);
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &W2.matrix, &V1.matrix,
+                          1.0, &A21.matrix);
+        }
+    }
+}
 
 /*  Form the orthogonal matrix Q from the packed QR matrix */
 
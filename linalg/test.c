@@ -30,6 +30,7 @@
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_complex_math.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_linalg_rsvd.h>
 #include <gsl/gsl_rng.h>
 
 #define TEST_SVD_4X4 1
@@ -58,6 +59,7 @@ int test_QRPT_QRsolve_dim(const gsl_matrix * m, const double * actual, double ep
 int test_QRPT_QRsolve(void);
 int test_QRPT_decomp_dim(const gsl_matrix * m, const double expected_rcond, double eps);
 int test_QRPT_decomp(void);
+int test_QRPT_decomp_rank(void);
 int test_QRPT_lssolve_dim(const gsl_matrix * m, const double * actual, double eps);
 int test_QRPT_lssolve(void);
 int test_QRPT_lssolve2_dim(const gsl_matrix * m, const double * actual, double eps);
@@ -75,6 +77,11 @@ int test_SV_decomp_mod_dim(const gsl_matrix * m, double eps);
 int test_SV_decomp_mod(void);
 int test_SV_decomp_jacobi_dim(const gsl_matrix * m, double eps);
 int test_SV_decomp_jacobi(void);
+int test_SV_decomp_dc_dim(const gsl_matrix * m, double eps);
+int test_SV_decomp_dc(void);
+int test_SV_decomp_rank(int (*svd)(gsl_matrix *, gsl_matrix *, gsl_vector *),
+                        const char * desc);
+int test_rsvd(void);
 int test_cholesky_solve_dim(const gsl_matrix * m, const double * actual, double eps);
 int test_cholesky_solve(void);
 int test_HH_solve_dim(const gsl_matrix * m, const double * actual, double eps);
@@ -90,6 +97,8 @@ int test_TDN_cyc_solve_dim(unsigned long dim, double d, double a, double b, cons
 int test_TDN_cyc_solve(void);
 int test_bidiag_decomp_dim(const gsl_matrix * m, double eps);
 int test_bidiag_decomp(void);
+int test_bidiag_decomp_blocked(void);
+int test_hessenberg_decomp(void);
 
 int 
 check (double x, double actual, double eps)
@@ -1159,6 +1168,76 @@ int test_QRPT_decomp(void)
   return s;
 }
 
+/* test the blocked algorithm on larger matrices of a given rank */
+int
+test_QRPT_decomp_rank(void)
+{
+  const size_t dims[][3] = { { 300, 200, 200 }, { 200, 300, 200 },
+                             { 400, 300, 170 }, { 300, 400, 250 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t i, k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0], N = dims[k][1], rank = dims[k][2];
+      gsl_matrix * m = gsl_matrix_alloc(M, N);
+      gsl_matrix * QR = gsl_matrix_alloc(M, N);
+      gsl_matrix * Q = gsl_matrix_alloc(M, M);
+      gsl_matrix * R = gsl_matrix_alloc(M, N);
+      gsl_matrix * A = gsl_matrix_alloc(M, N);
+      gsl_vector * tau = gsl_vector_alloc(GSL_MIN(M, N));
+      gsl_vector * norm = gsl_vector_alloc(N);
+      gsl_permutation * perm = gsl_permutation_alloc(N);
+      double err, mnorm;
+      int f, signum;
+
+      if (rank == GSL_MIN(M, N))
+        create_random_matrix(m, r);
+      else
+        create_rank_matrix(rank, m, r);
+
+      gsl_matrix_memcpy(QR, m);
+      s += gsl_linalg_QRPT_decomp(QR, tau, perm, &signum, norm);
+      s += gsl_linalg_QR_unpack(QR, tau, Q, R);
+
+      /* compute A = Q R P^T and compare with m in norm, since
+       * random matrices have entries close to zero */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Q, R, 0.0, A);
+
+      for (i = 0; i < M; i++)
+        {
+          gsl_vector_view row = gsl_matrix_row(A, i);
+          gsl_permute_vector_inverse(perm, &row.vector);
+        }
+
+      mnorm = gsl_matrix_norm1(m);
+      gsl_matrix_sub(A, m);
+      err = gsl_matrix_norm1(A) / mnorm;
+
+      f = (err > 1.0e2 * GSL_MAX(M, N) * GSL_DBL_EPSILON);
+      gsl_test(f, "  QRPT_decomp random(%zu,%zu) error %g", M, N, err);
+      s += f;
+
+      f = (gsl_linalg_QRPT_rank(QR, -1.0) != rank);
+      gsl_test(f, "  QRPT_rank random(%zu,%zu) rank %zu", M, N, rank);
+      s += f;
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(QR);
+      gsl_matrix_free(Q);
+      gsl_matrix_free(R);
+      gsl_matrix_free(A);
+      gsl_vector_free(tau);
+      gsl_vector_free(norm);
+      gsl_permutation_free(perm);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 
 int
 test_QR_update_dim(const gsl_matrix * m, double eps)
@@ -2336,6 +2415,402 @@ int test_SV_decomp_jacobi(void)
   return s;
 }
 
+int
+test_SV_decomp_dc_dim(const gsl_matrix * m, double eps)
+{
+  int s = 0;
+  double di1;
+  unsigned long i,j, M = m->size1, N = m->size2;
+
+  gsl_matrix * v  = gsl_matrix_alloc(M,N);
+  gsl_matrix * a  = gsl_matrix_alloc(M,N);
+  gsl_matrix * q  = gsl_matrix_alloc(N,N);
+  gsl_matrix * dqt  = gsl_matrix_alloc(N,N);
+  gsl_vector * d  = gsl_vector_alloc(N);
+
+  gsl_matrix_memcpy(v,m);
+
+  s += gsl_linalg_SV_decomp_dc(v, q, d);
+  if (s)
+    printf("call returned status = %d\n", s);
+
+  /* Check that singular values are non-negative and in non-decreasing
+     order */
+  
+  di1 = 0.0;
+
+  for (i = 0; i < N; i++)
+    {
+      double di = gsl_vector_get (d, i);
+
+      if (gsl_isnan (di))
+        {
+          continue;  /* skip NaNs */
+        }
+
+      if (di < 0) {
+        s++;
+        printf("singular value %lu = %22.18g < 0\n", i, di);
+      }
+
+      if(i > 0 && di > di1) {
+        s++;
+        printf("singular value %lu = %22.18g vs previous %22.18g\n", i, di, di1);
+      }
+
+      di1 = di;
+    }      
+  
+  /* Scale dqt = D Q^T */
+  
+  for (i = 0; i < N ; i++)
+    {
+      double di = gsl_vector_get (d, i);
+
+      for (j = 0; j < N; j++)
+        {
+          double qji = gsl_matrix_get(q, j, i);
+          gsl_matrix_set (dqt, i, j, qji * di);
+        }
+    }
+            
+  /* compute a = v dqt */
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, v, dqt, 0.0, a);
+
+  for(i=0; i<M; i++) {
+    for(j=0; j<N; j++) {
+      double aij = gsl_matrix_get(a, i, j);
+      double mij = gsl_matrix_get(m, i, j);
+      int foo = check(aij, mij, eps);
+      if(foo) {
+        printf("(%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n", M, N, i,j, aij, mij);
+      }
+      s += foo;
+    }
+  }
+  gsl_vector_free(d);
+  gsl_matrix_free(v);
+  gsl_matrix_free(a);
+  gsl_matrix_free(q);
+  gsl_matrix_free(dqt);
+
+  return s;
+}
+
+int test_SV_decomp_dc(void)
+{
+  int f;
+  int s = 0;
+
+  f = test_SV_decomp_dc_dim(m11, 2 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc m(1,1)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(m51, 2 * 64.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc m(5,1)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(m53, 2 * 64.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc m(5,3)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(moler10, 2 * 64.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc moler(10)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(hilb2, 2 * 8.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc hilbert(2)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(hilb3, 2 * 64.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc hilbert(3)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(hilb4, 2 * 1024.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc hilbert(4)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(hilb12, 2 * 1024.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc hilbert(12)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(vander2, 8.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc vander(2)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(vander3, 64.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc vander(3)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(vander4, 1024.0 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc vander(4)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(vander12, 1e-4);
+  gsl_test(f, "  SV_decomp_dc vander(12)");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(row3, 10 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc row3");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(row5, 128 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc row5");
+  s += f;
+
+  f = test_SV_decomp_dc_dim(row12, 1024 * GSL_DBL_EPSILON);
+  gsl_test(f, "  SV_decomp_dc row12");
+  s += f;
+
+  {
+    double i1, i2, i3, i4;
+    double lower = -2, upper = 2;
+
+    for (i1 = lower; i1 <= upper; i1++)
+      {
+        for (i2 = lower; i2 <= upper; i2++)
+          {
+            for (i3 = lower; i3 <= upper; i3++)
+              {
+                for (i4 = lower; i4 <= upper; i4++)
+                  {
+                    gsl_matrix_set (A22, 0,0, i1);
+                    gsl_matrix_set (A22, 0,1, i2);
+                    gsl_matrix_set (A22, 1,0, i3);
+                    gsl_matrix_set (A22, 1,1, i4);
+                    
+                    f = test_SV_decomp_dc_dim(A22, 16 * GSL_DBL_EPSILON);
+                    gsl_test(f, "  SV_decomp_dc (2x2) A=[%g, %g; %g, %g]", i1,i2,i3,i4);
+                    s += f;
+                  }
+              }
+          }
+      }
+  }
+
+  return s;
+}
+
+/* test an SVD algorithm on larger matrices of a given rank, which
+ * exercise the divide and conquer merges and the blocked Jacobi
+ * method */
+int
+test_SV_decomp_rank(int (*svd)(gsl_matrix *, gsl_matrix *, gsl_vector *),
+                    const char * desc)
+{
+  const size_t dims[][3] = { { 60, 60, 60 }, { 200, 200, 200 },
+                             { 300, 150, 150 }, { 250, 200, 130 },
+                             { 400, 130, 50 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t i, k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0], N = dims[k][1], rank = dims[k][2];
+      gsl_matrix * m = gsl_matrix_alloc(M, N);
+      gsl_matrix * U = gsl_matrix_alloc(M, N);
+      gsl_matrix * V = gsl_matrix_alloc(N, N);
+      gsl_matrix * I = gsl_matrix_alloc(N, N);
+      gsl_vector * S = gsl_vector_alloc(N);
+      double err, mnorm, tol;
+      int f;
+
+      if (rank == N)
+        create_random_matrix(m, r);
+      else
+        create_rank_matrix(rank, m, r);
+
+      gsl_matrix_memcpy(U, m);
+      s += svd(U, V, S);
+
+      /* check singular values are non-negative and non-increasing,
+       * and that there are rank of them above the rounding level */
+      tol = 1.0e3 * M * GSL_DBL_EPSILON * gsl_vector_get(S, 0);
+      f = 0;
+
+      for (i = 0; i < N; i++)
+        {
+          double si = gsl_vector_get(S, i);
+
+          if (si < 0.0 || (i > 0 && si > gsl_vector_get(S, i - 1)))
+            f = 1;
+
+          if ((i < rank && si <= tol) || (i >= rank && si > tol))
+            f = 1;
+        }
+
+      gsl_test(f, "  %s random(%zu,%zu) rank %zu singular values", desc, M, N, rank);
+      s += f;
+
+      /* check V^T V = I */
+      gsl_matrix_set_identity(I);
+      gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, V, V, -1.0, I);
+      err = gsl_matrix_norm1(I);
+
+      f = (err > 1.0e2 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  %s random(%zu,%zu) orthogonality %g", desc, M, N, err);
+      s += f;
+
+      /* compute A = U S V^T and compare with m in norm */
+      for (i = 0; i < N; i++)
+        {
+          gsl_vector_view c = gsl_matrix_column(U, i);
+          gsl_vector_scale(&c.vector, gsl_vector_get(S, i));
+        }
+
+      mnorm = gsl_matrix_norm1(m);
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, U, V, -1.0, m);
+      err = gsl_matrix_norm1(m) / mnorm;
+
+      f = (err > 1.0e2 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  %s random(%zu,%zu) error %g", desc, M, N, err);
+      s += f;
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(U);
+      gsl_matrix_free(V);
+      gsl_matrix_free(I);
+      gsl_vector_free(S);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* operator for test_rsvd, Y = op(A) X for a dense matrix A */
+static int
+test_rsvd_mult(CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+               gsl_matrix * Y, void * params)
+{
+  const gsl_matrix * A = (const gsl_matrix *) params;
+  return gsl_blas_dgemm(TransA, CblasNoTrans, 1.0, A, X, 0.0, Y);
+}
+
+/* test the randomized SVD on matrices A = U0 diag(s) V0^T with
+ * singular values s_i = 2^{-i} */
+int
+test_rsvd(void)
+{
+  const size_t dims[][2] = { { 300, 200 }, { 150, 250 }, { 40, 40 } };
+  const size_t k = 10, p = 10, q = 2;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t i, n;
+
+  for (n = 0; n < sizeof(dims) / sizeof(dims[0]); ++n)
+    {
+      const size_t M = dims[n][0], N = dims[n][1], K = GSL_MIN(M, N);
+      gsl_matrix * A = gsl_matrix_alloc(M, N);
+      gsl_matrix * QR = gsl_matrix_alloc(M, M);
+      gsl_matrix * U0 = gsl_matrix_alloc(M, M);
+      gsl_matrix * V0 = gsl_matrix_alloc(N, N);
+      gsl_matrix * R = gsl_matrix_alloc(M, M);
+      gsl_matrix * QRV = gsl_matrix_alloc(N, N);
+      gsl_matrix * RV = gsl_matrix_alloc(N, N);
+      gsl_matrix * U = gsl_matrix_alloc(M, k);
+      gsl_matrix * V = gsl_matrix_alloc(N, k);
+      gsl_matrix * U2 = gsl_matrix_alloc(M, k);
+      gsl_matrix * V2 = gsl_matrix_alloc(N, k);
+      gsl_vector * S = gsl_vector_alloc(k);
+      gsl_vector * S2 = gsl_vector_alloc(k);
+      gsl_vector * tau = gsl_vector_alloc(M);
+      gsl_vector * tauV = gsl_vector_alloc(N);
+      gsl_linalg_rsvd_workspace * w = gsl_linalg_rsvd_alloc(M, N, k, p);
+      gsl_linalg_operator op;
+      double err, anorm;
+      int f;
+
+      /* random orthogonal U0 and V0 */
+      create_random_matrix(QR, r);
+      gsl_linalg_QR_decomp(QR, tau);
+      gsl_linalg_QR_unpack(QR, tau, U0, R);
+
+      create_random_matrix(QRV, r);
+      gsl_linalg_QR_decomp(QRV, tauV);
+      gsl_linalg_QR_unpack(QRV, tauV, V0, RV);
+
+      /* A = sum_i s_i u_i v_i^T */
+      gsl_matrix_set_zero(A);
+      for (i = 0; i < K; i++)
+        {
+          gsl_vector_view ui = gsl_matrix_column(U0, i);
+          gsl_vector_view vi = gsl_matrix_column(V0, i);
+          gsl_blas_dger(pow(2.0, -(double) i), &ui.vector, &vi.vector, A);
+        }
+
+      anorm = gsl_matrix_norm1(A);
+
+      s += gsl_linalg_rsvd_decomp(A, q, r, U, S, V, w);
+
+      /* singular values */
+      err = 0.0;
+      for (i = 0; i < k; i++)
+        {
+          double si = pow(2.0, -(double) i);
+          err = GSL_MAX(err, fabs(gsl_vector_get(S, i) - si) / si);
+        }
+
+      f = (err > 1.0e3 * GSL_DBL_EPSILON);
+      gsl_test(f, "  rsvd_decomp random(%zu,%zu) singular values error %g", M, N, err);
+      s += f;
+
+      /* || A - U S V^T || is of the order of s_k */
+      gsl_matrix_memcpy(U2, U);
+      for (i = 0; i < k; i++)
+        {
+          gsl_vector_view c = gsl_matrix_column(U2, i);
+          gsl_vector_scale(&c.vector, gsl_vector_get(S, i));
+        }
+
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, -1.0, U2, V, 1.0, A);
+      err = gsl_matrix_norm1(A) / anorm;
+
+      f = (err > 10.0 * sqrt((double) GSL_MAX(M, N)) * pow(2.0, -(double) k));
+      gsl_test(f, "  rsvd_decomp random(%zu,%zu) error %g", M, N, err);
+      s += f;
+
+      /* the operator interface gives the same results from the same
+       * random numbers */
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, U2, V, 1.0, A);
+      op.size1 = M;
+      op.size2 = N;
+      op.mult = &test_rsvd_mult;
+      op.params = A;
+
+      gsl_rng_set(r, 1);
+      s += gsl_linalg_rsvd_decomp(A, q, r, U, S, V, w);
+      gsl_rng_set(r, 1);
+      s += gsl_linalg_rsvd_decomp_op(&op, q, r, U2, S2, V2, w);
+
+      f = !gsl_vector_equal(S, S2) || !gsl_matrix_equal(U, U2) || !gsl_matrix_equal(V, V2);
+      gsl_test(f, "  rsvd_decomp_op random(%zu,%zu)", M, N);
+      s += f;
+
+      gsl_matrix_free(A);
+      gsl_matrix_free(QR);
+      gsl_matrix_free(U0);
+      gsl_matrix_free(V0);
+      gsl_matrix_free(R);
+      gsl_matrix_free(QRV);
+      gsl_matrix_free(RV);
+      gsl_matrix_free(U);
+      gsl_matrix_free(V);
+      gsl_matrix_free(U2);
+      gsl_matrix_free(V2);
+      gsl_vector_free(S);
+      gsl_vector_free(S2);
+      gsl_vector_free(tau);
+      gsl_vector_free(tauV);
+      gsl_linalg_rsvd_free(w);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 
 int
 test_cholesky_solve_dim(const gsl_matrix * m, const double * actual, double eps)
@@ -3028,14 +3503,152 @@ int test_bidiag_decomp(void)
   return s;
 }
 
+/* test the blocked algorithm on larger matrices */
 int
-test_tri_invert2(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_rng * r, const double tol)
+test_bidiag_decomp_blocked(void)
+{
+  const size_t dims[][2] = { { 129, 129 }, { 200, 200 }, { 300, 200 }, { 400, 257 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t i, k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0], N = dims[k][1];
+      gsl_matrix * m = gsl_matrix_alloc(M, N);
+      gsl_matrix * A = gsl_matrix_alloc(M, N);
+      gsl_matrix * U = gsl_matrix_alloc(M, N);
+      gsl_matrix * V = gsl_matrix_alloc(N, N);
+      gsl_matrix * B = gsl_matrix_calloc(N, N);
+      gsl_matrix * UB = gsl_matrix_alloc(M, N);
+      gsl_vector * tau_U = gsl_vector_alloc(N);
+      gsl_vector * tau_V = gsl_vector_alloc(N - 1);
+      gsl_vector_view d = gsl_matrix_diagonal(B);
+      gsl_vector_view sd = gsl_matrix_superdiagonal(B, 1);
+      double err, mnorm;
+      int f;
+
+      create_random_matrix(m, r);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_bidiag_decomp(A, tau_U, tau_V);
+      s += gsl_linalg_bidiag_unpack(A, tau_U, U, tau_V, V, &d.vector, &sd.vector);
+
+      /* compute A = U B V^T and compare with m in norm */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, U, B, 0.0, UB);
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, UB, V, 0.0, A);
+
+      mnorm = gsl_matrix_norm1(m);
+      gsl_matrix_sub(A, m);
+      err = gsl_matrix_norm1(A) / mnorm;
+
+      f = (err > 1.0e2 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  bidiag_decomp random(%zu,%zu) error %g", M, N, err);
+      s += f;
+
+      /* check U^T U = I */
+      gsl_matrix_set_identity(V);
+      gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, U, U, -1.0, V);
+
+      err = 0.0;
+      for (i = 0; i < N; i++)
+        {
+          gsl_vector_view c = gsl_matrix_column(V, i);
+          err = GSL_MAX(err, gsl_blas_dasum(&c.vector));
+        }
+
+      f = (err > 1.0e2 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  bidiag_decomp random(%zu,%zu) orthogonality %g", M, N, err);
+      s += f;
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(U);
+      gsl_matrix_free(V);
+      gsl_matrix_free(B);
+      gsl_matrix_free(UB);
+      gsl_vector_free(tau_U);
+      gsl_vector_free(tau_V);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+int
+test_hessenberg_decomp(void)
+{
+  const size_t dims[] = { 20, 129, 200, 301 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t i, j, k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t N = dims[k];
+      gsl_matrix * m = gsl_matrix_alloc(N, N);
+      gsl_matrix * A = gsl_matrix_alloc(N, N);
+      gsl_matrix * U = gsl_matrix_alloc(N, N);
+      gsl_matrix * UH = gsl_matrix_alloc(N, N);
+      gsl_vector * tau = gsl_vector_alloc(N);
+      double err, mnorm;
+      int f;
+
+      create_random_matrix(m, r);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_hessenberg_decomp(A, tau);
+      s += gsl_linalg_hessenberg_unpack(A, tau, U);
+      s += gsl_linalg_hessenberg_set_zero(A);
+
+      /* compute A = U H U^T and compare with m in norm */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, U, A, 0.0, UH);
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, UH, U, 0.0, A);
+
+      mnorm = gsl_matrix_norm1(m);
+      gsl_matrix_sub(A, m);
+      err = gsl_matrix_norm1(A) / mnorm;
+
+      f = (err > 1.0e2 * N * GSL_DBL_EPSILON);
+      gsl_test(f, "  hessenberg_decomp random(%zu) error %g", N, err);
+      s += f;
+
+      /* check U^T U = I */
+      gsl_matrix_set_identity(UH);
+      gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, U, U, -1.0, UH);
+
+      err = 0.0;
+      for (i = 0; i < N; i++)
+        {
+          for (j = 0; j < N; j++)
+            err = GSL_MAX(err, fabs(gsl_matrix_get(UH, i, j)));
+        }
+
+      f = (err > 1.0e2 * N * GSL_DBL_EPSILON);
+      gsl_test(f, "  hessenberg_decomp random(%zu) orthogonality %g", N, err);
+      s += f;
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(U);
+      gsl_matrix_free(UH);
+      gsl_vector_free(tau);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+int
+test_tri_invert2(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, const size_t N_min,
+                 const size_t N_max, gsl_rng * r, const double tol)
 {
-  const size_t N_max = 200;
   int s = 0;
   size_t n, i, j;
 
-  for (n = 1; n <= N_max; ++n)
+  for (n = N_min; n <= N_max; ++n)
     {
       gsl_matrix *T = gsl_matrix_alloc(n, n);
       gsl_matrix *B = gsl_matrix_alloc(n, n);
@@ -3104,11 +3717,29 @@ test_tri_invert(gsl_rng * r)
 {
   int s = 0;
 
-  s += test_tri_invert2(CblasLower, CblasNonUnit, r, 1.0e-10);
-  s += test_tri_invert2(CblasLower, CblasUnit, r, 1.0e-10);
+  s += test_tri_invert2(CblasLower, CblasNonUnit, 1, 200, r, 1.0e-10);
+  s += test_tri_invert2(CblasLower, CblasUnit, 1, 200, r, 1.0e-10);
+
+  s += test_tri_invert2(CblasUpper, CblasNonUnit, 1, 200, r, 1.0e-10);
+  s += test_tri_invert2(CblasUpper, CblasUnit, 1, 200, r, 1.0e-10);
+
+  return s;
+}
+
+int
+test_tri_invert_threads(gsl_rng * r)
+{
+  int s = 0;
+  int nthreads = gsl_linalg_set_num_threads(4);
+
+  /* large enough to use the task-parallel code */
+  s += test_tri_invert2(CblasLower, CblasNonUnit, 517, 517, r, 1.0e-10);
+  s += test_tri_invert2(CblasLower, CblasUnit, 300, 300, r, 1.0e-10);
 
-  s += test_tri_invert2(CblasUpper, CblasNonUnit, r, 1.0e-10);
-  s += test_tri_invert2(CblasUpper, CblasUnit, r, 1.0e-10);
+  s += test_tri_invert2(CblasUpper, CblasNonUnit, 517, 517, r, 1.0e-10);
+  s += test_tri_invert2(CblasUpper, CblasUnit, 300, 300, r, 1.0e-10);
+
+  gsl_linalg_set_num_threads(nthreads);
 
   return s;
 }
@@ -3187,6 +3818,8 @@ main(void)
   gsl_test(test_tri_invert(r),           "Triangular Inverse");
 
   gsl_test(test_bidiag_decomp(),         "Bidiagonal Decomposition");
+  gsl_test(test_bidiag_decomp_blocked(), "Bidiagonal Decomposition (blocked)");
+  gsl_test(test_hessenberg_decomp(), "Hessenberg Decomposition");
   gsl_test(test_LU_decomp(r),            "LU Decomposition");
   gsl_test(test_LU_solve(r),             "LU Solve");
   gsl_test(test_LU_invert(r),            "LU Inverse");
@@ -3240,6 +3873,7 @@ main(void)
   gsl_test(test_QR_lssolve(),            "QR LS Solve");
   gsl_test(test_QR_update(),             "QR Rank-1 Update");
   gsl_test(test_QRPT_decomp(),           "QRPT Decomposition");
+  gsl_test(test_QRPT_decomp_rank(),      "QRPT Decomposition (blocked)");
   gsl_test(test_QRPT_lssolve(),          "QRPT LS Solve");
   gsl_test(test_QRPT_lssolve2(),         "QRPT LS Solve 2");
   gsl_test(test_QRPT_solve(),            "QRPT Solve");
@@ -3252,6 +3886,12 @@ main(void)
 
   gsl_test(test_SV_decomp(),             "Singular Value Decomposition");
   gsl_test(test_SV_decomp_jacobi(),      "Singular Value Decomposition (Jacobi)");
+  gsl_test(test_SV_decomp_rank(gsl_linalg_SV_decomp_jacobi, "SV_decomp_jacobi"),
+           "Singular Value Decomposition (Jacobi, blocked)");
+  gsl_test(test_SV_decomp_dc(),          "Singular Value Decomposition (Divide and Conquer)");
+  gsl_test(test_SV_decomp_rank(gsl_linalg_SV_decomp_dc, "SV_decomp_dc"),
+           "Singular Value Decomposition (Divide and Conquer, random)");
+  gsl_test(test_rsvd(),                  "Randomized Singular Value Decomposition");
   gsl_test(test_SV_decomp_mod(),         "Singular Value Decomposition (Mod)");
   gsl_test(test_SV_solve(),              "SVD Solve");
 
@@ -3283,7 +3923,9 @@ main(void)
   gsl_test(test_ldlt_band_solve(r),      "Banded LDLT Solve");
 
   gsl_test(test_symmtd_decomp(r),        "Symmetric Tridiagonal Decomposition");
+  gsl_test(test_symmtd_decomp_blocked(), "Symmetric Tridiagonal Decomposition (blocked)");
   gsl_test(test_hermtd_decomp(r),        "Hermitian Tridiagonal Decomposition");
+  gsl_test(test_hermtd_decomp_blocked(), "Hermitian Tridiagonal Decomposition (blocked)");
 
   gsl_test(test_HH_solve(),              "Householder solve");
   gsl_test(test_TDS_solve(),             "Tridiagonal symmetric solve");
@@ -3291,6 +3933,20 @@ main(void)
   gsl_test(test_TDN_solve(),             "Tridiagonal nonsymmetric solve");
   gsl_test(test_TDN_cyc_solve(),         "Tridiagonal nonsymmetric cyclic solve");
 
+  /* task-parallel versions; these come last so that the random
+     matrices of the tests above are unchanged */
+  gsl_test(test_tri_invert_threads(r),   "Triangular Inverse (threads)");
+  gsl_test(test_LU_decomp_threads(r),    "LU Decomposition (threads)");
+  gsl_test(test_cholesky_decomp_threads(r), "Cholesky Decomposition (threads)");
+
+  /* batched factorizations of small matrices */
+  gsl_test(test_LU_batch(r),             "LU Decomposition (batched)");
+  gsl_test(test_cholesky_batch(r),       "Cholesky Decomposition (batched)");
+
+  /* mixed precision solvers */
+  gsl_test(test_LU_mixed(r),             "LU Solve (mixed precision)");
+  gsl_test(test_cholesky_mixed(r),       "Cholesky Solve (mixed precision)");
+
   gsl_matrix_free(m11);
   gsl_matrix_free(m35);
   gsl_matrix_free(m51);
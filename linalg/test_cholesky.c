@@ -183,6 +183,248 @@ test_cholesky_decomp(gsl_rng * r)
   return s;
 }
 
+static size_t batch_handler_calls = 0;
+
+static void
+batch_error_handler(const char * reason, const char * file, int line, int err)
+{
+  (void) reason;
+  (void) file;
+  (void) line;
+  (void) err;
+  ++batch_handler_calls;
+}
+
+static int
+test_cholesky_batch_eps(const size_t N, const size_t nbatch, const double eps,
+                        const char * desc, gsl_rng * r)
+{
+  int s = 0;
+  double * A = malloc(N * N * nbatch * sizeof(double));
+  double * x = malloc(N * nbatch * sizeof(double));
+  int * info = malloc(nbatch * sizeof(int));
+  gsl_matrix * m = gsl_matrix_alloc(N, N);
+  gsl_vector * b = gsl_vector_alloc(N);
+  gsl_vector * y = gsl_vector_alloc(N);
+  gsl_error_handler_t * old_handler;
+  int status;
+  size_t i, j, k;
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      create_posdef_matrix(m, r);
+
+      /* make the last matrix indefinite */
+      if (k == nbatch - 1)
+        gsl_matrix_set(m, N - 1, N - 1, -1.0);
+
+      for (i = 0; i < N; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            A[(i * N + j) * nbatch + k] = gsl_matrix_get(m, i, j);
+
+          x[i * nbatch + k] = gsl_rng_uniform(r) - 0.5;
+        }
+    }
+
+  /* reference factors and solutions, computed one at a time */
+  {
+    double * LLT = malloc(N * N * nbatch * sizeof(double));
+    double * z = malloc(N * nbatch * sizeof(double));
+
+    for (k = 0; k + 1 < nbatch; ++k)
+      {
+        for (i = 0; i < N; ++i)
+          {
+            for (j = 0; j < N; ++j)
+              gsl_matrix_set(m, i, j, A[(i * N + j) * nbatch + k]);
+
+            gsl_vector_set(b, i, x[i * nbatch + k]);
+          }
+
+        gsl_linalg_cholesky_decomp1(m);
+        gsl_linalg_cholesky_solve(m, b, y);
+
+        for (i = 0; i < N; ++i)
+          {
+            for (j = 0; j <= i; ++j)
+              LLT[(i * N + j) * nbatch + k] = gsl_matrix_get(m, i, j);
+
+            z[i * nbatch + k] = gsl_vector_get(y, i);
+          }
+      }
+
+    /* the failure is reported in info[] without calling the handler */
+    batch_handler_calls = 0;
+    old_handler = gsl_set_error_handler(&batch_error_handler);
+    status = gsl_linalg_cholesky_decomp_batch(N, nbatch, A, info);
+    gsl_set_error_handler(old_handler);
+
+    gsl_test(status != GSL_EDOM, "%s (%lu,%lu) status %d", desc, N, nbatch, status);
+    gsl_test(batch_handler_calls != 0, "%s (%lu,%lu) error handler called",
+             desc, N, nbatch);
+    gsl_test(info[nbatch - 1] != GSL_EDOM, "%s (%lu,%lu) indefinite info %d",
+             desc, N, nbatch, info[nbatch - 1]);
+
+    gsl_linalg_cholesky_svx_batch(N, nbatch, A, x);
+
+    for (k = 0; k + 1 < nbatch; ++k)
+      {
+        gsl_test(info[k] != GSL_SUCCESS, "%s (%lu,%lu)[%lu] info %d", desc, N, nbatch, k, info[k]);
+
+        for (i = 0; i < N; ++i)
+          {
+            for (j = 0; j <= i; ++j)
+              {
+                const size_t idx = (i * N + j) * nbatch + k;
+
+                gsl_test_rel(A[idx], LLT[idx], eps, "%s L (%lu,%lu)[%lu] (%lu,%lu)",
+                             desc, N, nbatch, k, i, j);
+              }
+
+            gsl_test_rel(x[i * nbatch + k], z[i * nbatch + k], eps, "%s x (%lu,%lu)[%lu] %lu",
+                         desc, N, nbatch, k, i);
+          }
+      }
+
+    free(LLT);
+    free(z);
+  }
+
+  free(A);
+  free(x);
+  free(info);
+  gsl_matrix_free(m);
+  gsl_vector_free(b);
+  gsl_vector_free(y);
+
+  return s;
+}
+
+static int
+test_cholesky_batch(gsl_rng * r)
+{
+  int s = 0;
+  size_t N;
+
+  /* orders with and without specialized kernels, and a partial
+     group of matrices at the end of the batch */
+  for (N = 1; N <= 20; ++N)
+    test_cholesky_batch_eps(N, 19, 1.0e3 * N * GSL_DBL_EPSILON, "cholesky_batch random", r);
+
+  {
+    int nthreads = gsl_linalg_set_num_threads(4);
+    test_cholesky_batch_eps(5, 300, 1.0e4 * GSL_DBL_EPSILON, "cholesky_batch threads", r);
+    gsl_linalg_set_num_threads(nthreads);
+  }
+
+  return s;
+}
+
+static int
+test_cholesky_mixed_eps(const gsl_matrix * m, const int fallback, const double eps,
+                        const char * desc, gsl_rng * r)
+{
+  int s = 0;
+  const size_t N = m->size1;
+  gsl_linalg_mixed_workspace * w = gsl_linalg_mixed_alloc(N);
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_vector * b = gsl_vector_alloc(N);
+  gsl_vector * x = gsl_vector_alloc(N);
+  gsl_vector * res = gsl_vector_alloc(N);
+  double berr, rnorm, xnorm, bnorm, anorm;
+  size_t niter, i, j;
+
+  create_random_vector(b, r);
+
+  /* only the lower triangle should be referenced */
+  gsl_matrix_memcpy(A, m);
+  for (i = 0; i < N; ++i)
+    for (j = i + 1; j < N; ++j)
+      gsl_matrix_set(A, i, j, GSL_NAN);
+
+  gsl_linalg_cholesky_mixed_decomp(A, w);
+  gsl_linalg_cholesky_mixed_solve(A, b, x, &niter, &berr, w);
+
+  gsl_test(w->fallback != fallback, "%s (%lu) fallback %d niter %lu",
+           desc, N, w->fallback, niter);
+
+  gsl_vector_memcpy(res, b);
+  gsl_blas_dgemv(CblasNoTrans, -1.0, m, x, 1.0, res);
+
+  anorm = gsl_matrix_norm1(m);
+  rnorm = fabs(gsl_vector_get(res, gsl_blas_idamax(res)));
+  xnorm = fabs(gsl_vector_get(x, gsl_blas_idamax(x)));
+  bnorm = fabs(gsl_vector_get(b, gsl_blas_idamax(b)));
+
+  gsl_test_abs(berr, rnorm / (anorm * xnorm + bnorm), GSL_DBL_EPSILON,
+               "%s (%lu) reported backward error", desc, N);
+  gsl_test(berr > eps, "%s (%lu) backward error %g", desc, N, berr);
+
+  gsl_linalg_mixed_free(w);
+  gsl_matrix_free(A);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(res);
+
+  return s;
+}
+
+static int
+test_cholesky_mixed(gsl_rng * r)
+{
+  int s = 0;
+  const size_t dims[] = { 1, 2, 5, 10, 50, 150 };
+  size_t k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t N = dims[k];
+      gsl_matrix * m = gsl_matrix_alloc(N, N);
+
+      create_posdef_matrix(m, r);
+      test_cholesky_mixed_eps(m, 0, 10.0 * N * GSL_DBL_EPSILON, "cholesky_mixed random", r);
+
+      gsl_matrix_free(m);
+    }
+
+  /* not positive definite after rounding to single precision */
+  {
+    gsl_matrix * m = gsl_matrix_alloc(12, 12);
+
+    create_hilbert_matrix2(m);
+    test_cholesky_mixed_eps(m, 1, 120.0 * GSL_DBL_EPSILON, "cholesky_mixed hilbert", r);
+
+    gsl_matrix_free(m);
+  }
+
+  return s;
+}
+
+static int
+test_cholesky_decomp_threads(gsl_rng * r)
+{
+  int s = 0;
+  int nthreads = gsl_linalg_set_num_threads(4);
+  const size_t dims[] = { 300, 517 };
+  size_t k;
+
+  /* large enough to use the task-parallel code */
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t N = dims[k];
+      gsl_matrix * m = gsl_matrix_alloc(N, N);
+
+      create_posdef_matrix(m, r);
+      test_cholesky_decomp_eps(0, m, -1.0, 1.0e3 * N * GSL_DBL_EPSILON, "cholesky_decomp threads");
+      gsl_matrix_free(m);
+    }
+
+  gsl_linalg_set_num_threads(nthreads);
+
+  return s;
+}
+
 int
 test_cholesky_invert_eps(const gsl_matrix * m, const double eps, const char *desc)
 {
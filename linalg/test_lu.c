@@ -19,6 +19,7 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -177,6 +178,211 @@ test_LU_decomp(gsl_rng * r)
   return s;
 }
 
+static int
+test_LU_batch_eps(const size_t N, const size_t nbatch, const double eps,
+                  const char * desc, gsl_rng * r)
+{
+  int s = 0;
+  double * A = malloc(N * N * nbatch * sizeof(double));
+  double * A0 = malloc(N * N * nbatch * sizeof(double));
+  double * x = malloc(N * nbatch * sizeof(double));
+  double * b = malloc(N * nbatch * sizeof(double));
+  size_t * ipiv = malloc(N * nbatch * sizeof(size_t));
+  gsl_matrix * m = gsl_matrix_alloc(N, N);
+  size_t i, j, k;
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      create_random_matrix(m, r);
+
+      for (i = 0; i < N; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            A[(i * N + j) * nbatch + k] = gsl_matrix_get(m, i, j);
+
+          x[i * nbatch + k] = gsl_rng_uniform(r) - 0.5;
+        }
+    }
+
+  memcpy(A0, A, N * N * nbatch * sizeof(double));
+  memcpy(b, x, N * nbatch * sizeof(double));
+
+  gsl_linalg_LU_decomp_batch(N, nbatch, A, ipiv);
+  gsl_linalg_LU_svx_batch(N, nbatch, A, ipiv, x);
+
+  /* test A x = b */
+  for (k = 0; k < nbatch; ++k)
+    {
+      for (i = 0; i < N; ++i)
+        {
+          double bi = 0.0;
+
+          for (j = 0; j < N; ++j)
+            bi += A0[(i * N + j) * nbatch + k] * x[j * nbatch + k];
+
+          gsl_test_abs(bi, b[i * nbatch + k], eps, "%s (%lu,%lu)[%lu] %lu",
+                       desc, N, nbatch, k, i);
+        }
+    }
+
+  free(A);
+  free(A0);
+  free(x);
+  free(b);
+  free(ipiv);
+  gsl_matrix_free(m);
+
+  return s;
+}
+
+static int
+test_LU_batch(gsl_rng * r)
+{
+  int s = 0;
+  size_t N;
+
+  /* orders with and without specialized kernels, and a partial
+     group of matrices at the end of the batch */
+  for (N = 1; N <= 20; ++N)
+    test_LU_batch_eps(N, 19, 1.0e5 * N * GSL_DBL_EPSILON, "LU_batch random", r);
+
+  {
+    int nthreads = gsl_linalg_set_num_threads(4);
+    test_LU_batch_eps(5, 300, 1.0e6 * GSL_DBL_EPSILON, "LU_batch threads", r);
+    gsl_linalg_set_num_threads(nthreads);
+  }
+
+  return s;
+}
+
+static int
+test_LU_mixed_eps(const gsl_matrix * m, const int fallback, const double eps,
+                  const char * desc, gsl_rng * r)
+{
+  int s = 0;
+  const size_t N = m->size1;
+  gsl_linalg_mixed_workspace * w = gsl_linalg_mixed_alloc(N);
+  gsl_vector * b = gsl_vector_alloc(N);
+  gsl_vector * x = gsl_vector_alloc(N);
+  gsl_vector * res = gsl_vector_alloc(N);
+  double berr, rnorm, xnorm, bnorm, anorm = 0.0;
+  size_t niter, i, j;
+
+  create_random_vector(b, r);
+
+  gsl_linalg_LU_mixed_decomp(m, w);
+  gsl_linalg_LU_mixed_solve(m, b, x, &niter, &berr, w);
+
+  gsl_test(w->fallback != fallback, "%s (%lu) fallback %d niter %lu",
+           desc, N, w->fallback, niter);
+
+  /* normwise backward error |b - A x| / (|A| |x| + |b|) */
+  gsl_vector_memcpy(res, b);
+  gsl_blas_dgemv(CblasNoTrans, -1.0, m, x, 1.0, res);
+
+  for (i = 0; i < N; ++i)
+    {
+      double sum = 0.0;
+      for (j = 0; j < N; ++j)
+        sum += fabs(gsl_matrix_get(m, i, j));
+      anorm = GSL_MAX(anorm, sum);
+    }
+
+  rnorm = fabs(gsl_vector_get(res, gsl_blas_idamax(res)));
+  xnorm = fabs(gsl_vector_get(x, gsl_blas_idamax(x)));
+  bnorm = fabs(gsl_vector_get(b, gsl_blas_idamax(b)));
+
+  gsl_test_abs(berr, rnorm / (anorm * xnorm + bnorm), GSL_DBL_EPSILON,
+               "%s (%lu) reported backward error", desc, N);
+  gsl_test(berr > eps, "%s (%lu) backward error %g", desc, N, berr);
+
+  gsl_linalg_mixed_free(w);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(res);
+
+  return s;
+}
+
+static int
+test_LU_mixed(gsl_rng * r)
+{
+  int s = 0;
+  const size_t dims[] = { 1, 2, 5, 10, 50, 150 };
+  size_t k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t N = dims[k];
+      gsl_matrix * m = gsl_matrix_alloc(N, N);
+
+      create_random_matrix(m, r);
+      test_LU_mixed_eps(m, 0, 10.0 * N * GSL_DBL_EPSILON, "LU_mixed random", r);
+
+      gsl_matrix_free(m);
+    }
+
+  /* too ill-conditioned to refine from single precision factors */
+  {
+    gsl_matrix * m = gsl_matrix_alloc(12, 12);
+
+    create_hilbert_matrix2(m);
+    test_LU_mixed_eps(m, 1, 120.0 * GSL_DBL_EPSILON, "LU_mixed hilbert", r);
+
+    gsl_matrix_free(m);
+  }
+
+  /* zero right hand side */
+  {
+    const size_t N = 10;
+    gsl_matrix * m = gsl_matrix_alloc(N, N);
+    gsl_linalg_mixed_workspace * w = gsl_linalg_mixed_alloc(N);
+    gsl_vector * b = gsl_vector_calloc(N);
+    gsl_vector * x = gsl_vector_alloc(N);
+    double berr;
+    size_t niter;
+
+    create_random_matrix(m, r);
+    gsl_linalg_LU_mixed_decomp(m, w);
+    s += gsl_linalg_LU_mixed_solve(m, b, x, &niter, &berr, w);
+
+    gsl_test(!gsl_vector_isnull(x), "LU_mixed zero rhs solution");
+    gsl_test(berr != 0.0, "LU_mixed zero rhs backward error %g", berr);
+
+    gsl_linalg_mixed_free(w);
+    gsl_matrix_free(m);
+    gsl_vector_free(b);
+    gsl_vector_free(x);
+  }
+
+  return s;
+}
+
+static int
+test_LU_decomp_threads(gsl_rng * r)
+{
+  int s = 0;
+  int nthreads = gsl_linalg_set_num_threads(4);
+  const size_t dims[][2] = { { 300, 300 }, { 517, 517 }, { 600, 300 }, { 300, 450 } };
+  size_t k;
+
+  /* large enough to use the task-parallel code */
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0];
+      const size_t N = dims[k][1];
+      gsl_matrix * m = gsl_matrix_alloc(M, N);
+
+      create_random_matrix(m, r);
+      test_LU_decomp_eps(m, 1.0e5 * GSL_MAX(M, N) * GSL_DBL_EPSILON, "LU_decomp threads");
+      gsl_matrix_free(m);
+    }
+
+  gsl_linalg_set_num_threads(nthreads);
+
+  return s;
+}
+
 static int
 test_LU_solve_eps(const gsl_matrix * m, const gsl_vector * rhs, const gsl_vector * sol, const double eps, const char * desc)
 {
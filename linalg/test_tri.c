@@ -91,6 +91,62 @@ test_symmtd_decomp(gsl_rng * r)
   return s;
 }
 
+/* test the blocked algorithm on larger matrices */
+static int
+test_symmtd_decomp_blocked(void)
+{
+  const size_t sizes[] = { 129, 160, 200, 300 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t k;
+
+  for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+    {
+      const size_t N = sizes[k];
+      gsl_matrix * m = gsl_matrix_alloc(N, N);
+      gsl_matrix * A = gsl_matrix_alloc(N, N);
+      gsl_matrix * Q = gsl_matrix_alloc(N, N);
+      gsl_matrix * T = gsl_matrix_calloc(N, N);
+      gsl_matrix * QT = gsl_matrix_alloc(N, N);
+      gsl_vector * tau = gsl_vector_alloc(N - 1);
+      gsl_vector_view diag = gsl_matrix_diagonal(T);
+      gsl_vector_view subdiag = gsl_matrix_subdiagonal(T, 1);
+      gsl_vector_view superdiag = gsl_matrix_superdiagonal(T, 1);
+      double err, mnorm;
+      int f;
+
+      create_symm_matrix(m, r);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_symmtd_decomp(A, tau);
+      s += gsl_linalg_symmtd_unpack(A, tau, Q, &diag.vector, &subdiag.vector);
+      gsl_vector_memcpy(&superdiag.vector, &subdiag.vector);
+
+      /* compute A = Q T Q^T and compare with m in norm */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Q, T, 0.0, QT);
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, QT, Q, 0.0, A);
+
+      mnorm = gsl_matrix_norm1(m);
+      gsl_matrix_sub(A, m);
+      err = gsl_matrix_norm1(A) / mnorm;
+
+      f = (err > 1.0e2 * N * GSL_DBL_EPSILON);
+      gsl_test(f, "  symmtd_decomp random(%zu) error %g", N, err);
+      s += f;
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(Q);
+      gsl_matrix_free(T);
+      gsl_matrix_free(QT);
+      gsl_vector_free(tau);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 static int
 test_hermtd_decomp_eps(const gsl_matrix_complex * m, const double eps, const char * desc)
 {
@@ -165,3 +221,84 @@ test_hermtd_decomp(gsl_rng * r)
 
   return s;
 }
+
+/* test the blocked algorithm on larger matrices */
+static int
+test_hermtd_decomp_blocked(void)
+{
+  const size_t sizes[] = { 129, 160, 200, 300 };
+  const gsl_complex one = gsl_complex_rect(1.0, 0.0);
+  const gsl_complex zero = gsl_complex_rect(0.0, 0.0);
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int s = 0;
+  size_t k;
+
+  for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+    {
+      const size_t N = sizes[k];
+      gsl_matrix_complex * m = gsl_matrix_complex_alloc(N, N);
+      gsl_matrix_complex * A = gsl_matrix_complex_alloc(N, N);
+      gsl_matrix_complex * Q = gsl_matrix_complex_alloc(N, N);
+      gsl_matrix_complex * T = gsl_matrix_complex_calloc(N, N);
+      gsl_matrix_complex * QT = gsl_matrix_complex_alloc(N, N);
+      gsl_vector_complex * tau = gsl_vector_complex_alloc(N - 1);
+      gsl_vector * diag = gsl_vector_alloc(N);
+      gsl_vector * subdiag = gsl_vector_alloc(N - 1);
+      double err = 0.0, mnorm = 0.0;
+      size_t i, j;
+      int f;
+
+      create_herm_matrix(m, r);
+
+      gsl_matrix_complex_memcpy(A, m);
+      s += gsl_linalg_hermtd_decomp(A, tau);
+      s += gsl_linalg_hermtd_unpack(A, tau, Q, diag, subdiag);
+
+      for (i = 0; i < N; ++i)
+        {
+          gsl_matrix_complex_set(T, i, i, gsl_complex_rect(gsl_vector_get(diag, i), 0.0));
+
+          if (i + 1 < N)
+            {
+              gsl_complex ei = gsl_complex_rect(gsl_vector_get(subdiag, i), 0.0);
+              gsl_matrix_complex_set(T, i + 1, i, ei);
+              gsl_matrix_complex_set(T, i, i + 1, ei);
+            }
+        }
+
+      /* compute A = Q T Q^H and compare with m elementwise */
+      gsl_blas_zgemm(CblasNoTrans, CblasNoTrans, one, Q, T, zero, QT);
+      gsl_blas_zgemm(CblasNoTrans, CblasConjTrans, one, QT, Q, zero, A);
+
+      for (i = 0; i < N; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              gsl_complex mij = gsl_matrix_complex_get(m, i, j);
+              gsl_complex aij = gsl_matrix_complex_get(A, i, j);
+
+              mnorm = GSL_MAX(mnorm, gsl_complex_abs(mij));
+              err = GSL_MAX(err, gsl_complex_abs(gsl_complex_sub(aij, mij)));
+            }
+        }
+
+      err /= mnorm;
+
+      f = (err > 1.0e2 * N * GSL_DBL_EPSILON);
+      gsl_test(f, "  hermtd_decomp random(%zu) error %g", N, err);
+      s += f;
+
+      gsl_matrix_complex_free(m);
+      gsl_matrix_complex_free(A);
+      gsl_matrix_complex_free(Q);
+      gsl_matrix_complex_free(T);
+      gsl_matrix_complex_free(QT);
+      gsl_vector_complex_free(tau);
+      gsl_vector_free(diag);
+      gsl_vector_free(subdiag);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
@@ -0,0 +1,43 @@
+/* linalg/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_linalg.h>
+#include "thread.h"
+#include "thread_internal.h"
+
+/* the number of threads is shared with the sparse matrix modules */
+
+int
+gsl_linalg_set_num_threads (const int n)
+{
+  return sys_thread_set_num (n);
+}
+
+int
+gsl_linalg_get_num_threads (void)
+{
+  return sys_thread_get_num ();
+}
+
+int
+linalg_thread_count (const size_t N)
+{
+  return sys_thread_count (N, LINALG_THREAD_MIN);
+}
@@ -0,0 +1,40 @@
+/* linalg/thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __LINALG_THREAD_H__
+#define __LINALG_THREAD_H__
+
+#include <stddef.h>
+
+/* Task-parallel factorizations.  A matrix of order N >=
+   LINALG_THREAD_MIN is split into column blocks of width
+   LINALG_THREAD_BLOCK, and the factorization of each block and the
+   updates of the trailing blocks are run as OpenMP tasks ordered only
+   by their data dependencies, so that the updates of one step overlap
+   with the factorization of the next.  The tasks are scheduled
+   dynamically over the team, and the BLAS calls made within them are
+   single-threaded. */
+
+#define LINALG_THREAD_MIN 256
+#define LINALG_THREAD_BLOCK 128
+
+/* number of threads to use for a problem of order N */
+int linalg_thread_count (const size_t N);
+
+#endif /* __LINALG_THREAD_H__ */
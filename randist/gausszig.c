@@ -163,12 +163,47 @@ static const double wtab[128] = {
 };
 
 
+/* Accept or reject the point j in step i of the ziggurat, returning
+   its value in x.  The point is accepted at once if it lies inside the
+   rectangle of the step, which is the case for about 99% of points. */
+
+static int
+gaussian_ziggurat_accept (const gsl_rng * r, const unsigned long int i,
+                          const unsigned long int j, double *x)
+{
+  double y;
+
+  *x = j * wtab[i];
+
+  if (j < ktab[i])
+    return 1;
+
+  if (i < 127)
+    {
+      double y0, y1, U1;
+      y0 = ytab[i];
+      y1 = ytab[i + 1];
+      U1 = gsl_rng_uniform (r);
+      y = y1 + (y0 - y1) * U1;
+    }
+  else
+    {
+      double U1, U2;
+      U1 = 1.0 - gsl_rng_uniform (r);
+      U2 = gsl_rng_uniform (r);
+      *x = PARAM_R - log (U1) / PARAM_R;
+      y = exp (-PARAM_R * (*x - 0.5 * PARAM_R)) * U2;
+    }
+
+  return (y < exp (-0.5 * *x * *x));
+}
+
 double
 gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
 {
   unsigned long int i, j;
   int sign;
-  double x, y;
+  double x;
 
   const unsigned long int range = r->type->max - r->type->min;
   const unsigned long int offset = r->type->min;
@@ -197,31 +232,53 @@ gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
       sign = (i & 0x80) ? +1 : -1;
       i &= 0x7f;
 
-      x = j * wtab[i];
-
-      if (j < ktab[i])
+      if (gaussian_ziggurat_accept (r, i, j, &x))
         break;
+    }
 
-      if (i < 127)
-        {
-          double y0, y1, U1;
-          y0 = ytab[i];
-          y1 = ytab[i + 1];
-          U1 = gsl_rng_uniform (r);
-          y = y1 + (y0 - y1) * U1;
-        }
-      else
-        {
-          double U1, U2;
-          U1 = 1.0 - gsl_rng_uniform (r);
-          U2 = gsl_rng_uniform (r);
-          x = PARAM_R - log (U1) / PARAM_R;
-          y = exp (-PARAM_R * (x - 0.5 * PARAM_R)) * U2;
-        }
+  return sign * sigma * x;
+}
 
-      if (y < exp (-0.5 * x * x))
-        break;
+/* Fill x[0..n-1] with gaussian variates.  For 32-bit generators the
+   steps and points are taken from blocks of values drawn with
+   gsl_rng_get_array, and a rejected point is replaced by a call to
+   gsl_ran_gaussian_ziggurat. */
+
+void
+gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma,
+                                 double x[], const size_t n)
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  const unsigned long int offset = r->type->min;
+  size_t l;
+
+  if (range < 0xFFFFFFFF)
+    {
+      for (l = 0; l < n; l++)
+        x[l] = gsl_ran_gaussian_ziggurat (r, sigma);
+
+      return;
     }
 
-  return sign * sigma * x;
+  for (l = 0; l < n; )
+    {
+      unsigned long int k[256];
+      const size_t m = GSL_MIN (n - l, 256);
+      size_t t;
+
+      gsl_rng_get_array (r, k, m);
+
+      for (t = 0; t < m; t++, l++)
+        {
+          const unsigned long int i = (k[t] - offset) & 0xFF;
+          const unsigned long int j = ((k[t] - offset) >> 8) & 0xFFFFFF;
+          const int sign = (i & 0x80) ? +1 : -1;
+          double z;
+
+          if (gaussian_ziggurat_accept (r, i & 0x7f, j, &z))
+            x[l] = sign * sigma * z;
+          else
+            x[l] = gsl_ran_gaussian_ziggurat (r, sigma);
+        }
+    }
 }
@@ -47,6 +47,7 @@ unsigned int gsl_ran_binomial_tpe (const gsl_rng * r, double p, unsigned int n);
 double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigned int n);
 
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
+void gsl_ran_exponential_array (const gsl_rng * r, const double mu, double x[], const size_t n);
 double gsl_ran_exponential_pdf (const double x, const double mu);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
@@ -80,6 +81,7 @@ double gsl_ran_gamma_knuth (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gaussian (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ratio_method (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma);
+void gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma, double x[], const size_t n);
 double gsl_ran_gaussian_pdf (const double x, const double sigma);
 
 double gsl_ran_ugaussian (const gsl_rng * r);
@@ -96,6 +96,8 @@ double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
 double test_exponential_pdf (double x);
+double test_exponential_array (void);
+double test_exponential_array_pdf (double x);
 double test_exppow0 (void);
 double test_exppow0_pdf (double x);
 double test_exppow1 (void);
@@ -144,6 +146,8 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_ziggurat_array (void);
+double test_gaussian_ziggurat_array_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -307,6 +311,7 @@ main (void)
   testPDF (FUNC2 (dirichlet_small));
   testPDF (FUNC2 (erlang));
   testPDF (FUNC2 (exponential));
+  testPDF (FUNC2 (exponential_array));
 
   testPDF (FUNC2 (exppow0));
   testPDF (FUNC2 (exppow1));
@@ -333,6 +338,7 @@ main (void)
   testPDF (FUNC2 (gaussian));
   testPDF (FUNC2 (gaussian_ratio_method));
   testPDF (FUNC2 (gaussian_ziggurat));
+  testPDF (FUNC2 (gaussian_ziggurat_array));
   testPDF (FUNC2 (ugaussian));
   testPDF (FUNC2 (ugaussian_ratio_method));
   testPDF (FUNC2 (gaussian_tail));
@@ -1242,6 +1248,31 @@ test_exponential_pdf (double x)
   return gsl_ran_exponential_pdf (x, 2.0);
 }
 
+/* draw the array variants in blocks of uneven length */
+
+#define ARRAY_BLOCK 97
+
+double
+test_exponential_array (void)
+{
+  static double x[ARRAY_BLOCK];
+  static size_t i = ARRAY_BLOCK;
+
+  if (i == ARRAY_BLOCK)
+    {
+      gsl_ran_exponential_array (r_global, 2.0, x, ARRAY_BLOCK);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_exponential_array_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
 double
 test_exppow0 (void)
 {
@@ -1553,6 +1584,27 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+double
+test_gaussian_ziggurat_array (void)
+{
+  static double x[ARRAY_BLOCK];
+  static size_t i = ARRAY_BLOCK;
+
+  if (i == ARRAY_BLOCK)
+    {
+      gsl_ran_gaussian_ziggurat_array (r_global, 3.12, x, ARRAY_BLOCK);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gaussian_ziggurat_array_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
 double
 test_gaussian_tail (void)
 {
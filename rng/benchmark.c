@@ -26,8 +26,11 @@
 void benchmark (const gsl_rng_type * T);
 
 #define N  1000000
+#define NBLOCK 1024
 int isum;
 double dsum;
+unsigned long int iblock[NBLOCK];
+double dblock[NBLOCK];
 
 int
 main (void)
@@ -46,6 +49,7 @@ main (void)
   benchmark(gsl_rng_minstd);
   benchmark(gsl_rng_mrg);
   benchmark(gsl_rng_mt19937);
+  benchmark(gsl_rng_philox4x32);
   benchmark(gsl_rng_r250);
   benchmark(gsl_rng_ran0);
   benchmark(gsl_rng_ran1);
@@ -84,6 +88,7 @@ main (void)
   benchmark(gsl_rng_slatec);
   benchmark(gsl_rng_taus);
   benchmark(gsl_rng_taus113);
+  benchmark(gsl_rng_threefry4x32);
   benchmark(gsl_rng_transputer);
   benchmark(gsl_rng_tt800);
   benchmark(gsl_rng_uni);
@@ -99,8 +104,8 @@ void
 benchmark (const gsl_rng_type * T)
 {
   int start, end;
-  int i = 0, d = 0 ;
-  double t1, t2;
+  int i = 0, d = 0, ia = 0, da = 0 ;
+  double t1, t2, t3, t4;
 
   gsl_rng *r = gsl_rng_alloc (T);
 
@@ -132,9 +137,46 @@ benchmark (const gsl_rng_type * T)
 
   t2 = (end - start) / (double) CLOCKS_PER_SEC;
 
+  /* block generation */
 
-  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %s\n",
-          i / t1 / 1000.0, d / t2 / 1000.0, gsl_rng_name (r));
+  start = clock ();
+  do
+    {
+      int j;
+      for (j = 0; j < N; j += NBLOCK)
+        {
+          gsl_rng_get_array (r, iblock, NBLOCK);
+          isum += iblock[NBLOCK - 1];
+        }
+
+      ia += j;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t3 = (end - start) / (double) CLOCKS_PER_SEC;
+
+  start = clock ();
+  do
+    {
+      int j;
+      for (j = 0; j < N; j += NBLOCK)
+        {
+          gsl_rng_uniform_array (r, dblock, NBLOCK);
+          dsum += dblock[NBLOCK - 1];
+        }
+
+      da += j;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t4 = (end - start) / (double) CLOCKS_PER_SEC;
+
+  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, "
+          "%6.0f k ints/sec (array), %6.0f k doubles/sec (array), %s\n",
+          i / t1 / 1000.0, d / t2 / 1000.0,
+          ia / t3 / 1000.0, da / t4 / 1000.0, gsl_rng_name (r));
 
   gsl_rng_free (r);
 }
@@ -20,6 +20,8 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
 
 /* This is a combined multiple recursive generator. The sequence is,
 
@@ -63,6 +65,9 @@
 
    The period of this generator is about 2^205.
 
+   The generator can skip ahead by n values in O(log n) operations,
+   by raising the 3x3 matrices of the two recurrences to the power n.
+
    From: P. L'Ecuyer, "Combined Multiple Recursive Random Number
    Generators," Operations Research, 44, 5 (1996), 816--822.
 
@@ -74,6 +79,7 @@
 static inline unsigned long int cmrg_get (void *vstate);
 static double cmrg_get_double (void *vstate);
 static void cmrg_set (void *state, unsigned long int s);
+static int cmrg_jump (void *vstate, unsigned long int n, unsigned int e);
 
 static const long int m1 = 2147483647, m2 = 2145483479;
 
@@ -185,6 +191,49 @@ cmrg_set (void *vstate, unsigned long int s)
   cmrg_get (state);
 }
 
+static int
+cmrg_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  cmrg_state_t *state = (cmrg_state_t *) vstate;
+
+  /* the recurrences with the negative coefficients taken mod m1, m2 */
+
+  const unsigned long int a[9] = {
+    0, 63308, 2147483647 - 183326,
+    1, 0, 0,
+    0, 1, 0
+  };
+
+  const unsigned long int b[9] = {
+    86098, 0, 2145483479 - 539608,
+    1, 0, 0,
+    0, 1, 0
+  };
+
+  unsigned long int x[3], y[3];
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+
+  y[0] = state->y1;
+  y[1] = state->y2;
+  y[2] = state->y3;
+
+  skip_mod (x, a, 3, m1, 46341, n, e);
+  skip_mod (y, b, 3, m2, 46320, n, e);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+
+  state->y1 = y[0];
+  state->y2 = y[1];
+  state->y3 = y[2];
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type cmrg_type =
 {"cmrg",                        /* name */
  2147483646,                    /* RAND_MAX */
@@ -195,3 +244,9 @@ static const gsl_rng_type cmrg_type =
  &cmrg_get_double};
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
+
+const gsl_rng_methods gsl_rng_cmrg_methods =
+{&cmrg_type,
+ &cmrg_jump,
+ 0,                             /* no block methods */
+ 0};
@@ -75,6 +75,7 @@ GSL_VAR const gsl_rng_type *gsl_rng_mrg;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1999;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1998;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_r250;
 GSL_VAR const gsl_rng_type *gsl_rng_ran0;
 GSL_VAR const gsl_rng_type *gsl_rng_ran1;
@@ -114,6 +115,7 @@ GSL_VAR const gsl_rng_type *gsl_rng_slatec;
 GSL_VAR const gsl_rng_type *gsl_rng_taus;
 GSL_VAR const gsl_rng_type *gsl_rng_taus2;
 GSL_VAR const gsl_rng_type *gsl_rng_taus113;
+GSL_VAR const gsl_rng_type *gsl_rng_threefry4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_transputer;
 GSL_VAR const gsl_rng_type *gsl_rng_tt800;
 GSL_VAR const gsl_rng_type *gsl_rng_uni;
@@ -134,6 +136,8 @@ gsl_rng *gsl_rng_clone (const gsl_rng * r);
 void gsl_rng_free (gsl_rng * r);
 
 void gsl_rng_set (const gsl_rng * r, unsigned long int seed);
+int gsl_rng_jump (const gsl_rng * r, unsigned long int n);
+int gsl_rng_substream (const gsl_rng * r, unsigned long int k);
 unsigned long int gsl_rng_max (const gsl_rng * r);
 unsigned long int gsl_rng_min (const gsl_rng * r);
 const char *gsl_rng_name (const gsl_rng * r);
@@ -148,6 +152,9 @@ void gsl_rng_print_state (const gsl_rng * r);
 
 const gsl_rng_type * gsl_rng_env_setup (void);
 
+void gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n);
+void gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n);
+
 INLINE_DECL unsigned long int gsl_rng_get (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform_pos (const gsl_rng * r);
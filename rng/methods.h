@@ -0,0 +1,50 @@
+/* rng/methods.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_RNG_METHODS_H__
+#define __GSL_RNG_METHODS_H__
+
+/* Optional methods of the generators in the library.  They are kept
+   out of gsl_rng_type so that its layout, which user-defined
+   generators depend on, does not change.  A generator with optional
+   methods defines a table for its type, and rng.c looks the table up
+   by the type pointer; types without a table use the generic
+   fallbacks. */
+
+typedef struct
+  {
+    const gsl_rng_type *type;
+    int (*jump) (void *state, unsigned long int n, unsigned int e); /* skip n 2^e values, or NULL */
+    void (*get_array) (void *state, unsigned long int x[], size_t n); /* or NULL */
+    void (*get_double_array) (void *state, double x[], size_t n); /* or NULL */
+  }
+gsl_rng_methods;
+
+extern const gsl_rng_methods gsl_rng_cmrg_methods;
+extern const gsl_rng_methods gsl_rng_mrg_methods;
+extern const gsl_rng_methods gsl_rng_mt19937_methods;
+extern const gsl_rng_methods gsl_rng_mt19937_1999_methods;
+extern const gsl_rng_methods gsl_rng_mt19937_1998_methods;
+extern const gsl_rng_methods gsl_rng_philox4x32_methods;
+extern const gsl_rng_methods gsl_rng_taus_methods;
+extern const gsl_rng_methods gsl_rng_taus2_methods;
+extern const gsl_rng_methods gsl_rng_taus113_methods;
+extern const gsl_rng_methods gsl_rng_threefry4x32_methods;
+
+#endif /* __GSL_RNG_METHODS_H__ */
@@ -20,6 +20,8 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
 
 /* This is a fifth-order multiple recursive generator. The sequence is,
 
@@ -46,6 +48,9 @@
 
    The period of this generator is about 2^155.
 
+   The generator can skip ahead by n values in O(log n) operations,
+   by raising the 5x5 matrix of the recurrence to the power n mod m.
+
    From: P. L'Ecuyer, F. Blouin, and R. Coutre, "A search for good
    multiple recursive random number generators", ACM Transactions on
    Modeling and Computer Simulation 3, 87-98 (1993). */
@@ -53,6 +58,7 @@
 static inline unsigned long int mrg_get (void *vstate);
 static double mrg_get_double (void *vstate);
 static void mrg_set (void *state, unsigned long int s);
+static int mrg_jump (void *vstate, unsigned long int n, unsigned int e);
 
 static const long int m = 2147483647;
 static const long int a1 = 107374182, q1 = 20, r1 = 7;
@@ -137,6 +143,38 @@ mrg_set (void *vstate, unsigned long int s)
   return;
 }
 
+static int
+mrg_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  mrg_state_t *state = (mrg_state_t *) vstate;
+
+  const unsigned long int a[25] = {
+    107374182, 0, 0, 0, 104480,
+    1, 0, 0, 0, 0,
+    0, 1, 0, 0, 0,
+    0, 0, 1, 0, 0,
+    0, 0, 0, 1, 0
+  };
+
+  unsigned long int x[5];
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+  x[3] = state->x4;
+  x[4] = state->x5;
+
+  skip_mod (x, a, 5, m, 46341, n, e);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+  state->x4 = x[3];
+  state->x5 = x[4];
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type mrg_type =
 {"mrg",                         /* name */
  2147483646,                    /* RAND_MAX */
@@ -147,3 +185,9 @@ static const gsl_rng_type mrg_type =
  &mrg_get_double};
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
+
+const gsl_rng_methods gsl_rng_mrg_methods =
+{&mrg_type,
+ &mrg_jump,
+ 0,                             /* no block methods */
+ 0};
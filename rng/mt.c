@@ -54,10 +54,13 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
 
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
 static void mt_set (void *state, unsigned long int s);
+static void mt_get_array (void *vstate, unsigned long int x[], size_t n);
+static void mt_get_double_array (void *vstate, double x[], size_t n);
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,50 +78,128 @@ typedef struct
   }
 mt_state_t;
 
+/* generate N words at one time.  The tempering of the output and the
+   recurrence below have no data-dependent branches, so that both can
+   be vectorized over the block by the compiler. */
+
+#define MAGIC(y) ((0UL - ((y) & 0x1)) & 0x9908b0dfUL)
+#define TEMPER(k) ((k) ^= ((k) >> 11), \
+                   (k) ^= ((k) << 7) & 0x9d2c5680UL, \
+                   (k) ^= ((k) << 15) & 0xefc60000UL, \
+                   (k) ^= ((k) >> 18))
+
+static void
+mt_generate (unsigned long int mt[])
+{
+  int kk;
+
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+}
+
 static inline unsigned long
 mt_get (void *vstate)
 {
   mt_state_t *state = (mt_state_t *) vstate;
 
   unsigned long k ;
-  unsigned long int *const mt = state->mt;
-
-#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
 
   if (state->mti >= N)
-    {   /* generate N words at one time */
-      int kk;
+    {
+      mt_generate (state->mt);
+      state->mti = 0;
+    }
+
+  k = state->mt[state->mti];
+  TEMPER (k);
+
+  state->mti++;
+
+  return k;
+}
+
+/* Block versions, which temper the output directly from the state
+   array a block at a time */
+
+static void
+mt_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
 
-      for (kk = 0; kk < N - M; kk++)
+  while (n > 0)
+    {
+      size_t i, m;
+
+      if (state->mti >= N)
         {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+          mt_generate (mt);
+          state->mti = 0;
         }
-      for (; kk < N - 1; kk++)
+
+      m = N - state->mti;
+
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
         {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+          unsigned long k = mt[state->mti + i];
+          TEMPER (k);
+          x[i] = k;
         }
 
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
-
-      state->mti = 0;
+      state->mti += m;
+      x += m;
+      n -= m;
     }
+}
+
+static void
+mt_get_double_array (void *vstate, double x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
 
-  /* Tempering */
-  
-  k = mt[state->mti];
-  k ^= (k >> 11);
-  k ^= (k << 7) & 0x9d2c5680UL;
-  k ^= (k << 15) & 0xefc60000UL;
-  k ^= (k >> 18);
+  while (n > 0)
+    {
+      size_t i, m;
 
-  state->mti++;
+      if (state->mti >= N)
+        {
+          mt_generate (mt);
+          state->mti = 0;
+        }
 
-  return k;
+      m = N - state->mti;
+
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
+        {
+          unsigned long k = mt[state->mti + i];
+          TEMPER (k);
+          x[i] = k / 4294967296.0;
+        }
+
+      state->mti += m;
+      x += m;
+      n -= m;
+    }
 }
 
 static double
@@ -235,6 +316,24 @@ const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
 const gsl_rng_type *gsl_rng_mt19937_1998 = &mt_1998_type;
 
+const gsl_rng_methods gsl_rng_mt19937_methods =
+{&mt_type,
+ 0,                             /* no skip-ahead */
+ &mt_get_array,
+ &mt_get_double_array};
+
+const gsl_rng_methods gsl_rng_mt19937_1999_methods =
+{&mt_1999_type,
+ 0,                             /* no skip-ahead */
+ &mt_get_array,
+ &mt_get_double_array};
+
+const gsl_rng_methods gsl_rng_mt19937_1998_methods =
+{&mt_1998_type,
+ 0,                             /* no skip-ahead */
+ &mt_get_array,
+ &mt_get_double_array};
+
 /* MT19937 is the default generator, so define that here too */
 
 const gsl_rng_type *gsl_rng_default = &mt_type;
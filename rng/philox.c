@@ -0,0 +1,255 @@
+/* rng/philox.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the counter-based generator Philox4x32-10.  The n-th block
+   of four 32-bit outputs is a keyed bijection of the 128-bit counter
+   n, computed with 10 rounds of
+
+     (x0, x1, x2, x3) -> (hi(M1 x2) ^ x1 ^ k0, lo(M1 x2),
+                          hi(M0 x0) ^ x3 ^ k1, lo(M0 x0))
+
+   where hi and lo are the upper and lower halves of the 64-bit
+   products, M0 = 0xD2511F53, M1 = 0xCD9E8D57, and the 64-bit key
+   (k0, k1) is incremented by the Weyl sequence (0x9E3779B9, 0xBB67AE85)
+   after each round.
+
+   The key is taken from the seed and the counter starts at zero.
+   Since each block is computed independently, skipping ahead by any
+   number of values takes O(1) operations.  The period is 2^130.
+
+   From: J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw, "Parallel
+   Random Numbers: As Easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011.
+
+   The test values are the known-answer tests of the Random123
+   library. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
+
+#define MASK 0xffffffffUL
+
+static inline unsigned long int philox_get (void *vstate);
+static double philox_get_double (void *vstate);
+static void philox_set (void *state, unsigned long int s);
+static int philox_jump (void *vstate, unsigned long int n, unsigned int e);
+static void philox_get_array (void *vstate, unsigned long int x[], size_t n);
+static void philox_get_double_array (void *vstate, double x[], size_t n);
+
+typedef struct
+  {
+    unsigned long int ctr[4];   /* counter of the current block */
+    unsigned long int key[2];
+    unsigned long int x[4];     /* current block of outputs */
+    unsigned int i;             /* index of the next output in x */
+  }
+philox_state_t;
+
+/* the upper and lower 32 bits of the product a b */
+
+static inline void
+philox_mulhilo (const unsigned long int a, const unsigned long int b,
+                unsigned long int *hi, unsigned long int *lo)
+{
+#if ULONG_MAX > 0xffffffffUL
+  const unsigned long int p = a * b;
+  *hi = p >> 32;
+  *lo = p & MASK;
+#else
+  const unsigned long int a0 = a & 0xffffUL, a1 = a >> 16;
+  const unsigned long int b0 = b & 0xffffUL, b1 = b >> 16;
+  const unsigned long int p00 = a0 * b0, p01 = a0 * b1;
+  const unsigned long int p10 = a1 * b0, p11 = a1 * b1;
+  const unsigned long int mid = (p00 >> 16) + (p01 & 0xffffUL) + (p10 & 0xffffUL);
+  *hi = p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16);
+  *lo = (mid << 16) | (p00 & 0xffffUL);
+#endif
+}
+
+static void
+philox_block (const unsigned long int ctr[], const unsigned long int key[],
+              unsigned long int x[])
+{
+  unsigned long int x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+  unsigned long int k0 = key[0], k1 = key[1];
+  int r;
+
+  for (r = 0; r < 10; r++)
+    {
+      unsigned long int hi0, lo0, hi1, lo1;
+
+      philox_mulhilo (0xD2511F53UL, x0, &hi0, &lo0);
+      philox_mulhilo (0xCD9E8D57UL, x2, &hi1, &lo1);
+
+      x0 = hi1 ^ x1 ^ k0;
+      x1 = lo1;
+      x2 = hi0 ^ x3 ^ k1;
+      x3 = lo0;
+
+      k0 = (k0 + 0x9E3779B9UL) & MASK;
+      k1 = (k1 + 0xBB67AE85UL) & MASK;
+    }
+
+  x[0] = x0;
+  x[1] = x1;
+  x[2] = x2;
+  x[3] = x3;
+}
+
+static inline unsigned long int
+philox_get (void *vstate)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+  const unsigned long int x = state->x[state->i];
+
+  if (++state->i == 4)
+    {
+      skip_counter (state->ctr, 4, 1, 0);
+      philox_block (state->ctr, state->key, state->x);
+      state->i = 0;
+    }
+
+  return x;
+}
+
+static double
+philox_get_double (void *vstate)
+{
+  return philox_get (vstate) / 4294967296.0;
+}
+
+/* Block version, which computes whole blocks of four directly into
+   the output */
+
+static void
+philox_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+  size_t j = 0;
+
+  while (j < n && state->i != 0)
+    x[j++] = philox_get (state);
+
+  if (n - j >= 4)
+    {
+      x[j++] = state->x[0];
+      x[j++] = state->x[1];
+      x[j++] = state->x[2];
+      x[j++] = state->x[3];
+
+      for (; n - j >= 4; j += 4)
+        {
+          skip_counter (state->ctr, 4, 1, 0);
+          philox_block (state->ctr, state->key, x + j);
+        }
+
+      skip_counter (state->ctr, 4, 1, 0);
+      philox_block (state->ctr, state->key, state->x);
+    }
+
+  while (j < n)
+    x[j++] = philox_get (state);
+}
+
+static void
+philox_get_double_array (void *vstate, double x[], size_t n)
+{
+  unsigned long int k[64];
+
+  while (n > 0)
+    {
+      const size_t m = (n < 64) ? n : 64;
+      size_t j;
+
+      philox_get_array (vstate, k, m);
+
+      for (j = 0; j < m; j++)
+        x[j] = k[j] / 4294967296.0;
+
+      x += m;
+      n -= m;
+    }
+}
+
+static void
+philox_set (void *vstate, unsigned long int s)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+
+  state->key[0] = s & MASK;
+  state->key[1] = (s >> 16) >> 16;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = 0;
+  state->ctr[3] = 0;
+
+  philox_block (state->ctr, state->key, state->x);
+  state->i = 0;
+}
+
+static int
+philox_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+
+  /* split n 2^e into whole blocks and a remainder of 0..3 values */
+
+  if (e < 2)
+    {
+      state->i += (unsigned int) ((n << e) & 3);
+      skip_counter (state->ctr, 4, n >> (2 - e), 0);
+    }
+  else
+    {
+      skip_counter (state->ctr, 4, n, e - 2);
+    }
+
+  if (state->i >= 4)
+    {
+      state->i -= 4;
+      skip_counter (state->ctr, 4, 1, 0);
+    }
+
+  philox_block (state->ctr, state->key, state->x);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type philox_type =
+{"philox4x32",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (philox_state_t),
+ &philox_set,
+ &philox_get,
+ &philox_get_double};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox_type;
+
+const gsl_rng_methods gsl_rng_philox4x32_methods =
+{&philox_type,
+ &philox_jump,
+ &philox_get_array,
+ &philox_get_double_array};
@@ -23,6 +23,7 @@
 #include <string.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
 
 gsl_rng *
 gsl_rng_alloc (const gsl_rng_type * T)
@@ -100,6 +101,123 @@ gsl_rng_set (const gsl_rng * r, unsigned long int seed)
   (r->type->set) (r->state, seed);
 }
 
+/* optional methods of the generators in the library, see methods.h */
+
+static const gsl_rng_methods *const rng_methods[] = {
+  &gsl_rng_cmrg_methods,
+  &gsl_rng_mrg_methods,
+  &gsl_rng_mt19937_methods,
+  &gsl_rng_mt19937_1999_methods,
+  &gsl_rng_mt19937_1998_methods,
+  &gsl_rng_philox4x32_methods,
+  &gsl_rng_taus_methods,
+  &gsl_rng_taus2_methods,
+  &gsl_rng_taus113_methods,
+  &gsl_rng_threefry4x32_methods,
+  0
+};
+
+static const gsl_rng_methods *
+find_methods (const gsl_rng_type * T)
+{
+  const gsl_rng_methods *const *m;
+
+  for (m = rng_methods; *m != 0; m++)
+    {
+      if ((*m)->type == T)
+        return *m;
+    }
+
+  return 0;
+}
+
+/* Advance the generator by n values.  Generators without a skip-ahead
+   method discard the values one at a time. */
+
+int
+gsl_rng_jump (const gsl_rng * r, unsigned long int n)
+{
+  const gsl_rng_methods *m = find_methods (r->type);
+
+  if (m != 0 && m->jump != 0)
+    {
+      return (m->jump) (r->state, n, 0);
+    }
+  else
+    {
+      unsigned long int i;
+
+      for (i = 0; i < n; i++)
+        {
+          (r->type->get) (r->state);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Advance the generator to the start of the k-th following substream
+   of length 2^SUBSTREAM_LOG2, which requires a skip-ahead
+   method. */
+
+#define SUBSTREAM_LOG2 64
+
+int
+gsl_rng_substream (const gsl_rng * r, unsigned long int k)
+{
+  const gsl_rng_methods *m = find_methods (r->type);
+
+  if (m == 0 || m->jump == 0)
+    {
+      GSL_ERROR ("generator does not support skip-ahead", GSL_EUNSUP);
+    }
+
+  return (m->jump) (r->state, k, SUBSTREAM_LOG2);
+}
+
+/* Fill an array with the next n values of the generator, using the
+   block method of the generator if it has one */
+
+void
+gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n)
+{
+  const gsl_rng_methods *m = find_methods (r->type);
+
+  if (m != 0 && m->get_array != 0)
+    {
+      (m->get_array) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = (r->type->get) (r->state);
+        }
+    }
+}
+
+void
+gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n)
+{
+  const gsl_rng_methods *m = find_methods (r->type);
+
+  if (m != 0 && m->get_double_array != 0)
+    {
+      (m->get_double_array) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = (r->type->get_double) (r->state);
+        }
+    }
+}
+
 unsigned long int
 gsl_rng_max (const gsl_rng * r)
 {
@@ -0,0 +1,211 @@
+/* rng/skip.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Skip-ahead for linear generators.  A step of the generator is a
+   linear map x -> A x of its state, so n 2^e steps are computed by
+   squaring A e times and then raising it to the power n by binary
+   exponentiation, in O(e + log n) matrix products. */
+
+#include "schrage.c"
+
+#define SKIP_MAX_ORDER 5
+
+/* c = a b mod m for k-by-k matrices in row-major order, with entries
+   in [0, m) and m < 2^31.  The result may overwrite a or b. */
+
+static inline void
+skip_matmul_mod (unsigned long int c[], const unsigned long int a[],
+                 const unsigned long int b[], const size_t k,
+                 const unsigned long int m, const unsigned long int sqrtm)
+{
+  unsigned long int t[SKIP_MAX_ORDER * SKIP_MAX_ORDER];
+  size_t i, j, l;
+
+  for (i = 0; i < k; i++)
+    {
+      for (j = 0; j < k; j++)
+        {
+          unsigned long int s = 0;
+
+          for (l = 0; l < k; l++)
+            {
+              s += schrage_mult (a[i * k + l], b[l * k + j], m, sqrtm);
+
+              if (s >= m)
+                s -= m;
+            }
+
+          t[i * k + j] = s;
+        }
+    }
+
+  for (i = 0; i < k * k; i++)
+    c[i] = t[i];
+}
+
+/* x = A^(n 2^e) x mod m, for a state vector x of length k <=
+   SKIP_MAX_ORDER */
+
+static inline void
+skip_mod (unsigned long int x[], const unsigned long int a[], const size_t k,
+          const unsigned long int m, const unsigned long int sqrtm,
+          unsigned long int n, unsigned int e)
+{
+  unsigned long int p[SKIP_MAX_ORDER * SKIP_MAX_ORDER];
+  unsigned long int r[SKIP_MAX_ORDER * SKIP_MAX_ORDER];
+  unsigned long int y[SKIP_MAX_ORDER];
+  size_t i, j;
+
+  for (i = 0; i < k * k; i++)
+    {
+      p[i] = a[i];
+      r[i] = (i % (k + 1) == 0);
+    }
+
+  for (; e > 0; e--)
+    skip_matmul_mod (p, p, p, k, m, sqrtm);
+
+  while (n > 0)
+    {
+      if (n & 1)
+        skip_matmul_mod (r, r, p, k, m, sqrtm);
+
+      n >>= 1;
+
+      if (n > 0)
+        skip_matmul_mod (p, p, p, k, m, sqrtm);
+    }
+
+  for (i = 0; i < k; i++)
+    {
+      unsigned long int s = 0;
+
+      for (j = 0; j < k; j++)
+        {
+          s += schrage_mult (r[i * k + j], x[j], m, sqrtm);
+
+          if (s >= m)
+            s -= m;
+        }
+
+      y[i] = s;
+    }
+
+  for (i = 0; i < k; i++)
+    x[i] = y[i];
+}
+
+/* Linear maps of 32-bit words over GF(2), stored as the images of the
+   32 unit vectors */
+
+static inline unsigned long int
+skip_gf2_apply (const unsigned long int a[], unsigned long int x)
+{
+  unsigned long int y = 0;
+  size_t j;
+
+  for (j = 0; j < 32; j++, x >>= 1)
+    {
+      if (x & 1)
+        y ^= a[j];
+    }
+
+  return y;
+}
+
+static inline void
+skip_gf2_mul (unsigned long int c[], const unsigned long int a[],
+              const unsigned long int b[])
+{
+  unsigned long int t[32];
+  size_t j;
+
+  for (j = 0; j < 32; j++)
+    t[j] = skip_gf2_apply (a, b[j]);
+
+  for (j = 0; j < 32; j++)
+    c[j] = t[j];
+}
+
+/* return A^(n 2^e) x over GF(2) */
+
+static inline unsigned long int
+skip_gf2 (const unsigned long int a[], unsigned long int x,
+          unsigned long int n, unsigned int e)
+{
+  unsigned long int p[32];
+  size_t j;
+
+  for (j = 0; j < 32; j++)
+    p[j] = a[j];
+
+  for (; e > 0; e--)
+    skip_gf2_mul (p, p, p);
+
+  while (n > 0)
+    {
+      if (n & 1)
+        x = skip_gf2_apply (p, x);
+
+      n >>= 1;
+
+      if (n > 0)
+        skip_gf2_mul (p, p, p);
+    }
+
+  return x;
+}
+
+/* c = c + n 2^e mod 2^(32 len), for a counter stored as len 32-bit
+   words with the least significant word first */
+
+static inline void
+skip_counter (unsigned long int c[], const size_t len,
+              const unsigned long int n, const unsigned int e)
+{
+  const unsigned long int mask = 0xffffffffUL;
+  const unsigned long int n0 = n & mask;
+  const unsigned long int n1 = (n >> 16) >> 16;
+  const unsigned int b = e % 32;
+  unsigned long int v[3], carry = 0;
+  size_t i, w = e / 32;
+
+  if (b == 0)
+    {
+      v[0] = n0;
+      v[1] = n1;
+      v[2] = 0;
+    }
+  else
+    {
+      v[0] = (n0 << b) & mask;
+      v[1] = ((n0 >> (32 - b)) | (n1 << b)) & mask;
+      v[2] = n1 >> (32 - b);
+    }
+
+  for (i = 0; w + i < len; i++)
+    {
+      const unsigned long int x = c[w + i];
+      const unsigned long int s = (x + (i < 3 ? v[i] : 0)) & mask;
+      const unsigned long int t = (s + carry) & mask;
+
+      carry = (s < x) + (t < s);
+      c[w + i] = t;
+    }
+}
@@ -20,6 +20,8 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
 
 /* This is a maximally equidistributed combined Tausworthe
    generator. The sequence is,
@@ -46,6 +48,10 @@
 
    The period of this generator is about 2^88.
 
+   Each component is a linear map of its 32-bit state over GF(2), so
+   the generator can skip ahead by n values in O(log n) products of
+   32x32 bit matrices.
+
    From: P. L'Ecuyer, "Maximally Equidistributed Combined Tausworthe
    Generators", Mathematics of Computation, 65, 213 (1996), 203--213.
 
@@ -83,6 +89,7 @@
 static inline unsigned long int taus_get (void *vstate);
 static double taus_get_double (void *vstate);
 static void taus_set (void *state, unsigned long int s);
+static int taus_jump (void *vstate, unsigned long int n, unsigned int e);
 
 typedef struct
   {
@@ -160,6 +167,33 @@ taus2_set (void *vstate, unsigned long int s)
   return;
 }
 
+static int
+taus_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  taus_state_t *state = (taus_state_t *) vstate;
+  unsigned long int a1[32], a2[32], a3[32];
+  size_t j;
+
+  /* the step maps the unit vectors to the columns of its matrices */
+
+  for (j = 0; j < 32; j++)
+    {
+      taus_state_t t;
+
+      t.s1 = t.s2 = t.s3 = 1UL << j;
+      taus_get (&t);
+
+      a1[j] = t.s1;
+      a2[j] = t.s2;
+      a3[j] = t.s3;
+    }
+
+  state->s1 = skip_gf2 (a1, state->s1, n, e);
+  state->s2 = skip_gf2 (a2, state->s2, n, e);
+  state->s3 = skip_gf2 (a3, state->s3, n, e);
+
+  return GSL_SUCCESS;
+}
 
 static const gsl_rng_type taus_type =
 {"taus",                        /* name */
@@ -172,6 +206,12 @@ static const gsl_rng_type taus_type =
 
 const gsl_rng_type *gsl_rng_taus = &taus_type;
 
+const gsl_rng_methods gsl_rng_taus_methods =
+{&taus_type,
+ &taus_jump,
+ 0,                             /* no block methods */
+ 0};
+
 static const gsl_rng_type taus2_type =
 {"taus2",                       /* name */
  0xffffffffUL,                  /* RAND_MAX */
@@ -182,3 +222,9 @@ static const gsl_rng_type taus2_type =
  &taus_get_double};
 
 const gsl_rng_type *gsl_rng_taus2 = &taus2_type;
+
+const gsl_rng_methods gsl_rng_taus2_methods =
+{&taus2_type,
+ &taus_jump,
+ 0,                             /* no block methods */
+ 0};
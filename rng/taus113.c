@@ -45,6 +45,10 @@
    After this, the state is passed through the RNG 10 times to ensure the
    state satisfies a recurrence relation.
 
+   Each component is a linear map of its 32-bit state over GF(2), so
+   the generator can skip ahead by n values in O(log n) products of
+   32x32 bit matrices.
+
    References:
    P. L'Ecuyer, "Tables of Maximally-Equidistributed Combined LFSR Generators",
    Mathematics of Computation, 68, 225 (1999), 261--269.
@@ -58,6 +62,8 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
 
 #define LCG(n) ((69069UL * n) & 0xffffffffUL)
 #define MASK 0xffffffffUL
@@ -65,6 +71,7 @@
 static inline unsigned long int taus113_get (void *vstate);
 static double taus113_get_double (void *vstate);
 static void taus113_set (void *state, unsigned long int s);
+static int taus113_jump (void *vstate, unsigned long int n, unsigned int e);
 
 typedef struct
 {
@@ -136,6 +143,36 @@ taus113_set (void *vstate, unsigned long int s)
   return;
 }
 
+static int
+taus113_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long int a1[32], a2[32], a3[32], a4[32];
+  size_t j;
+
+  /* the step maps the unit vectors to the columns of its matrices */
+
+  for (j = 0; j < 32; j++)
+    {
+      taus113_state_t t;
+
+      t.z1 = t.z2 = t.z3 = t.z4 = 1UL << j;
+      taus113_get (&t);
+
+      a1[j] = t.z1;
+      a2[j] = t.z2;
+      a3[j] = t.z3;
+      a4[j] = t.z4;
+    }
+
+  state->z1 = skip_gf2 (a1, state->z1, n, e);
+  state->z2 = skip_gf2 (a2, state->z2, n, e);
+  state->z3 = skip_gf2 (a3, state->z3, n, e);
+  state->z4 = skip_gf2 (a4, state->z4, n, e);
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type taus113_type = {
   "taus113",                    /* name */
   0xffffffffUL,                 /* RAND_MAX */
@@ -148,6 +185,12 @@ static const gsl_rng_type taus113_type = {
 
 const gsl_rng_type *gsl_rng_taus113 = &taus113_type;
 
+const gsl_rng_methods gsl_rng_taus113_methods =
+{&taus113_type,
+ &taus113_jump,
+ 0,                             /* no block methods */
+ 0};
+
 
 /*  Rules for analytic calculations using GNU Emacs Calc:
     (used to find the values for the test program)
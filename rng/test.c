@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -37,6 +39,9 @@ int rng_min_test (gsl_rng * r, unsigned long int *kmin, unsigned long int ran_mi
 int rng_sum_test (gsl_rng * r, double *sigma);
 int rng_bin_test (gsl_rng * r, double *sigma);
 void rng_seed_test (const gsl_rng_type * T);
+void rng_skip_test (const gsl_rng_type * T);
+void rng_user_type_test (void);
+void rng_array_test (const gsl_rng_type * T);
 
 #define N  10000
 #define N2 200000
@@ -181,6 +186,13 @@ main (void)
   rng_test (gsl_rng_ranf, 0, 10000, 2152890433UL);
   rng_test (gsl_rng_ranf, 2, 10000, 339327233);
 
+  /* Random123 known-answer tests for a zero key and counter */
+
+  rng_test (gsl_rng_philox4x32, 0, 1, 0x6627e8d5UL);
+  rng_test (gsl_rng_philox4x32, 0, 4, 0x9b00dbd8UL);
+  rng_test (gsl_rng_threefry4x32, 0, 1, 0x9c6ca96aUL);
+  rng_test (gsl_rng_threefry4x32, 0, 4, 0x5256a7d8UL);
+
   /* Test constant relationship between int and double functions */
 
   for (r = rngs ; *r != 0; r++)
@@ -197,6 +209,18 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
+  /* Test skip-ahead against stepping the generator */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_skip_test (*r);
+
+  rng_user_type_test ();
+
+  /* Test block generation against single values */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_array_test (*r);
+
   /* generic statistical tests (these are just to make sure that we
      don't get any crazy results back from the generator, i.e. they
      aren't a test of the algorithm, just the implementation) */
@@ -431,6 +455,170 @@ rng_read_write_test (const gsl_rng_type * T)
   gsl_rng_free (r);
 }
 
+void
+rng_skip_test (const gsl_rng_type * T)
+{
+  const unsigned long int skip[] = { 0, 1, 2, 3, 5, 1000, 10007 };
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *r_skip = gsl_rng_alloc (T);
+  unsigned long int i, j;
+  int status = 0, has_substream;
+
+  for (i = 0; i < 7; i++)
+    {
+      gsl_rng_memcpy (r_skip, r);
+      gsl_rng_jump (r_skip, skip[i]);
+
+      for (j = 0; j < skip[i]; j++)
+        gsl_rng_get (r);
+
+      status |= (gsl_rng_get (r) != gsl_rng_get (r_skip));
+    }
+
+  gsl_test (status, "%s, skip-ahead consistency", gsl_rng_name (r));
+
+  /* substream 0 is the current position; generators without a
+     skip-ahead method return GSL_EUNSUP */
+  {
+    gsl_error_handler_t *handler = gsl_set_error_handler_off ();
+    has_substream = (gsl_rng_substream (r, 0) == GSL_SUCCESS);
+    gsl_set_error_handler (handler);
+  }
+
+  if (has_substream)
+    {
+      /* substreams 1 + 2 = 3, and distinct from substream 0 */
+
+      int same = 0;
+
+      gsl_rng_memcpy (r_skip, r);
+      gsl_rng_substream (r, 1);
+      gsl_rng_substream (r, 2);
+      gsl_rng_substream (r_skip, 3);
+
+      status = 0;
+
+      for (j = 0; j < N; j++)
+        status |= (gsl_rng_get (r) != gsl_rng_get (r_skip));
+
+      gsl_test (status, "%s, substream consistency", gsl_rng_name (r));
+
+      gsl_rng_set (r, 1);
+      gsl_rng_memcpy (r_skip, r);
+      gsl_rng_substream (r_skip, 1);
+
+      for (j = 0; j < 4; j++)
+        same += (gsl_rng_get (r) == gsl_rng_get (r_skip));
+
+      gsl_test (same == 4, "%s, substreams are distinct", gsl_rng_name (r));
+    }
+
+  gsl_rng_free (r);
+  gsl_rng_free (r_skip);
+}
+
+/* A generator type defined outside the library has no optional
+   methods and must use the generic fallbacks, which give the same
+   values */
+
+void
+rng_user_type_test (void)
+{
+  gsl_rng_type T = *gsl_rng_taus113;
+  gsl_rng *r, *u;
+  gsl_error_handler_t *handler;
+  int status;
+
+  T.name = "user taus113";
+
+  r = gsl_rng_alloc (gsl_rng_taus113);
+  u = gsl_rng_alloc (&T);
+
+  gsl_rng_jump (r, 10007);
+  gsl_rng_jump (u, 10007);
+
+  gsl_test (gsl_rng_get (r) != gsl_rng_get (u),
+            "%s, skip-ahead by discarding values", gsl_rng_name (u));
+
+  handler = gsl_set_error_handler_off ();
+  status = gsl_rng_substream (u, 1);
+  gsl_set_error_handler (handler);
+
+  gsl_test (status != GSL_EUNSUP, "%s, substream returns GSL_EUNSUP",
+            gsl_rng_name (u));
+
+  gsl_rng_free (r);
+  gsl_rng_free (u);
+
+  /* block generation falls back to single values */
+  {
+    static unsigned long int a[N], b[N];
+    static double c[N], d[N];
+    size_t i;
+
+    T = *gsl_rng_mt19937;
+    T.name = "user mt19937";
+
+    r = gsl_rng_alloc (gsl_rng_mt19937);
+    u = gsl_rng_alloc (&T);
+
+    gsl_rng_get_array (r, a, N);
+    gsl_rng_get_array (u, b, N);
+    gsl_rng_uniform_array (r, c, N);
+    gsl_rng_uniform_array (u, d, N);
+
+    status = 0;
+    for (i = 0; i < N; i++)
+      status |= (a[i] != b[i]) || (c[i] != d[i]);
+
+    gsl_test (status, "%s, block generation by single values",
+              gsl_rng_name (u));
+
+    gsl_rng_free (r);
+    gsl_rng_free (u);
+  }
+}
+
+void
+rng_array_test (const gsl_rng_type * T)
+{
+  const size_t chunk[] = { 1, 3, 1000, 2, 7, 4, 650, 5 };
+  static unsigned long int test_a[N], test_b[N];
+  static double test_c[N], test_d[N];
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *r_array = gsl_rng_alloc (T);
+  size_t i, j, k;
+  int status = 0;
+
+  /* blocks of uneven length, crossing the internal blocks of the
+     generator */
+
+  for (i = 0; i < N; i++)
+    test_a[i] = gsl_rng_get (r);
+
+  for (i = 0, j = 0; i < N; i += k, j++)
+    {
+      k = GSL_MIN (chunk[j % 8], N - i);
+      gsl_rng_get_array (r_array, test_b + i, k);
+    }
+
+  for (i = 0; i < N; i++)
+    test_c[i] = gsl_rng_uniform (r);
+
+  gsl_rng_uniform_array (r_array, test_d, N);
+
+  for (i = 0; i < N; i++)
+    {
+      status |= (test_a[i] != test_b[i]);
+      status |= (test_c[i] != test_d[i]);
+    }
+
+  gsl_test (status, "%s, block generation consistency", gsl_rng_name (r));
+
+  gsl_rng_free (r);
+  gsl_rng_free (r_array);
+}
+
 void
 generic_rng_test (const gsl_rng_type * T)
 {
@@ -0,0 +1,259 @@
+/* rng/threefry.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the counter-based generator Threefry4x32-20.  The n-th
+   block of four 32-bit outputs is a keyed bijection of the 128-bit
+   counter n, computed with 20 rounds of the add-rotate-xor mixing of
+   the Threefish block cipher,
+
+     x0 += x1, x1 = rotl(x1, R_r0) ^ x0,
+     x2 += x3, x3 = rotl(x3, R_r1) ^ x2
+
+   with the roles of x1 and x3 exchanged on odd rounds.  A round key
+   formed from the 128-bit key and its parity word is added before the
+   first round and after every fourth round.
+
+   The key is taken from the seed and the counter starts at zero.
+   Since each block is computed independently, skipping ahead by any
+   number of values takes O(1) operations.  The period is 2^130.
+
+   From: J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw, "Parallel
+   Random Numbers: As Easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011.
+
+   The test values are the known-answer tests of the Random123
+   library. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "methods.h"
+#include "skip.c"
+
+#define MASK 0xffffffffUL
+#define ROTL(x,r) ((((x) << (r)) & MASK) | ((x) >> (32 - (r))))
+
+static inline unsigned long int threefry_get (void *vstate);
+static double threefry_get_double (void *vstate);
+static void threefry_set (void *state, unsigned long int s);
+static int threefry_jump (void *vstate, unsigned long int n, unsigned int e);
+static void threefry_get_array (void *vstate, unsigned long int x[], size_t n);
+static void threefry_get_double_array (void *vstate, double x[], size_t n);
+
+typedef struct
+  {
+    unsigned long int ctr[4];   /* counter of the current block */
+    unsigned long int key[4];
+    unsigned long int x[4];     /* current block of outputs */
+    unsigned int i;             /* index of the next output in x */
+  }
+threefry_state_t;
+
+/* one round on even and odd round numbers, and the key injection
+   after four rounds */
+
+#define ROUND_EVEN(r0,r1) \
+  (x0 = (x0 + x1) & MASK, x1 = ROTL (x1, r0) ^ x0, \
+   x2 = (x2 + x3) & MASK, x3 = ROTL (x3, r1) ^ x2)
+#define ROUND_ODD(r0,r1) \
+  (x0 = (x0 + x3) & MASK, x3 = ROTL (x3, r0) ^ x0, \
+   x2 = (x2 + x1) & MASK, x1 = ROTL (x1, r1) ^ x2)
+#define INJECT(s) \
+  (x0 = (x0 + ks[(s) % 5]) & MASK, \
+   x1 = (x1 + ks[((s) + 1) % 5]) & MASK, \
+   x2 = (x2 + ks[((s) + 2) % 5]) & MASK, \
+   x3 = (x3 + ks[((s) + 3) % 5] + (s)) & MASK)
+
+static void
+threefry_block (const unsigned long int ctr[], const unsigned long int key[],
+                unsigned long int x[])
+{
+  unsigned long int ks[5], x0, x1, x2, x3;
+
+  ks[0] = key[0];
+  ks[1] = key[1];
+  ks[2] = key[2];
+  ks[3] = key[3];
+  ks[4] = 0x1BD11BDAUL ^ key[0] ^ key[1] ^ key[2] ^ key[3];
+
+  x0 = (ctr[0] + ks[0]) & MASK;
+  x1 = (ctr[1] + ks[1]) & MASK;
+  x2 = (ctr[2] + ks[2]) & MASK;
+  x3 = (ctr[3] + ks[3]) & MASK;
+
+  ROUND_EVEN (10, 26); ROUND_ODD (11, 21);
+  ROUND_EVEN (13, 27); ROUND_ODD (23, 5);
+  INJECT (1);
+  ROUND_EVEN (6, 20); ROUND_ODD (17, 11);
+  ROUND_EVEN (25, 10); ROUND_ODD (18, 20);
+  INJECT (2);
+  ROUND_EVEN (10, 26); ROUND_ODD (11, 21);
+  ROUND_EVEN (13, 27); ROUND_ODD (23, 5);
+  INJECT (3);
+  ROUND_EVEN (6, 20); ROUND_ODD (17, 11);
+  ROUND_EVEN (25, 10); ROUND_ODD (18, 20);
+  INJECT (4);
+  ROUND_EVEN (10, 26); ROUND_ODD (11, 21);
+  ROUND_EVEN (13, 27); ROUND_ODD (23, 5);
+  INJECT (5);
+
+  x[0] = x0;
+  x[1] = x1;
+  x[2] = x2;
+  x[3] = x3;
+}
+
+static inline unsigned long int
+threefry_get (void *vstate)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+  const unsigned long int x = state->x[state->i];
+
+  if (++state->i == 4)
+    {
+      skip_counter (state->ctr, 4, 1, 0);
+      threefry_block (state->ctr, state->key, state->x);
+      state->i = 0;
+    }
+
+  return x;
+}
+
+static double
+threefry_get_double (void *vstate)
+{
+  return threefry_get (vstate) / 4294967296.0;
+}
+
+/* Block version, which computes whole blocks of four directly into
+   the output */
+
+static void
+threefry_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+  size_t j = 0;
+
+  while (j < n && state->i != 0)
+    x[j++] = threefry_get (state);
+
+  if (n - j >= 4)
+    {
+      x[j++] = state->x[0];
+      x[j++] = state->x[1];
+      x[j++] = state->x[2];
+      x[j++] = state->x[3];
+
+      for (; n - j >= 4; j += 4)
+        {
+          skip_counter (state->ctr, 4, 1, 0);
+          threefry_block (state->ctr, state->key, x + j);
+        }
+
+      skip_counter (state->ctr, 4, 1, 0);
+      threefry_block (state->ctr, state->key, state->x);
+    }
+
+  while (j < n)
+    x[j++] = threefry_get (state);
+}
+
+static void
+threefry_get_double_array (void *vstate, double x[], size_t n)
+{
+  unsigned long int k[64];
+
+  while (n > 0)
+    {
+      const size_t m = (n < 64) ? n : 64;
+      size_t j;
+
+      threefry_get_array (vstate, k, m);
+
+      for (j = 0; j < m; j++)
+        x[j] = k[j] / 4294967296.0;
+
+      x += m;
+      n -= m;
+    }
+}
+
+static void
+threefry_set (void *vstate, unsigned long int s)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+  int j;
+
+  state->key[0] = s & MASK;
+  state->key[1] = (s >> 16) >> 16;
+  state->key[2] = 0;
+  state->key[3] = 0;
+
+  for (j = 0; j < 4; j++)
+    state->ctr[j] = 0;
+
+  threefry_block (state->ctr, state->key, state->x);
+  state->i = 0;
+}
+
+static int
+threefry_jump (void *vstate, unsigned long int n, unsigned int e)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+
+  /* split n 2^e into whole blocks and a remainder of 0..3 values */
+
+  if (e < 2)
+    {
+      state->i += (unsigned int) ((n << e) & 3);
+      skip_counter (state->ctr, 4, n >> (2 - e), 0);
+    }
+  else
+    {
+      skip_counter (state->ctr, 4, n, e - 2);
+    }
+
+  if (state->i >= 4)
+    {
+      state->i -= 4;
+      skip_counter (state->ctr, 4, 1, 0);
+    }
+
+  threefry_block (state->ctr, state->key, state->x);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type threefry_type =
+{"threefry4x32",                /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (threefry_state_t),
+ &threefry_set,
+ &threefry_get,
+ &threefry_get_double};
+
+const gsl_rng_type *gsl_rng_threefry4x32 = &threefry_type;
+
+const gsl_rng_methods gsl_rng_threefry4x32_methods =
+{&threefry_type,
+ &threefry_jump,
+ &threefry_get_array,
+ &threefry_get_double_array};
@@ -40,13 +40,25 @@
 
 __BEGIN_DECLS
 
+/* combination of partial sums in threaded products */
+enum
+{
+  GSL_SPBLAS_REDUCE_FAST = 0,         /* one partial sum per thread */
+  GSL_SPBLAS_REDUCE_DETERMINISTIC = 1 /* independent of number of threads */
+};
+
 /*
  * Prototypes
  */
 
+int gsl_spblas_set_reduction(const int type);
+int gsl_spblas_get_reduction(void);
 int gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
                      const gsl_spmatrix *A, const gsl_vector *x,
                      const double beta, gsl_vector *y);
+int gsl_spblas_dgemv64(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                       const gsl_spmatrix64 *A, const gsl_vector *x,
+                       const double beta, gsl_vector *y);
 int gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                      const gsl_spmatrix *B, gsl_spmatrix *C);
 size_t gsl_spblas_scatter(const gsl_spmatrix *A, const size_t j,
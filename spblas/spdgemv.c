@@ -28,6 +28,103 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_blas.h>
 
+#include "thread_internal.h"
+
+/* minimum number of non-zero elements for a threaded product */
+#define SPBLAS_THREAD_MIN 32768
+
+/* number of partial sums in deterministic mode */
+#define SPBLAS_REDUCE_CHUNKS 8
+
+static int spblas_reduction = GSL_SPBLAS_REDUCE_FAST;
+
+#define INDEX int
+#define MATRIX gsl_spmatrix
+#define FUNCTION(name) name
+#include "spdgemv_source.c"
+#undef INDEX
+#undef MATRIX
+#undef FUNCTION
+
+#define INDEX gsl_spmatrix64_index
+#define MATRIX gsl_spmatrix64
+#define FUNCTION(name) name ## 64
+#include "spdgemv_source.c"
+#undef INDEX
+#undef MATRIX
+#undef FUNCTION
+
+#define BCSR_CONCAT2(a,b) a ## _ ## b
+#define BCSR_CONCAT(a,b) BCSR_CONCAT2(a,b)
+
+#include "spdgemv_bcsr_source.c"
+#define BCSR_B 2
+#include "spdgemv_bcsr_source.c"
+#undef BCSR_B
+#define BCSR_B 3
+#include "spdgemv_bcsr_source.c"
+#undef BCSR_B
+#define BCSR_B 4
+#include "spdgemv_bcsr_source.c"
+#undef BCSR_B
+#define BCSR_B 5
+#include "spdgemv_bcsr_source.c"
+#undef BCSR_B
+#define BCSR_B 6
+#include "spdgemv_bcsr_source.c"
+#undef BCSR_B
+
+static void spdgemv_sell (const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                          const gsl_spmatrix *A, const double *X,
+                          const size_t incX, double *Y, const size_t incY,
+                          const int nthreads);
+static void spdgemv_bcsr (const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                          const gsl_spmatrix *A, const double *X,
+                          const size_t incX, double *Y, const size_t incY,
+                          const int nthreads);
+static int spdgemv_check (const CBLAS_TRANSPOSE_t TransA,
+                          const size_t M, const size_t N,
+                          const gsl_vector *x, const gsl_vector *y);
+static void spdgemv_scale (const double beta, const CBLAS_TRANSPOSE_t TransA,
+                           const size_t M, const size_t N, gsl_vector *y);
+static int spdgemv_nthreads (const size_t nnz);
+static int spdgemv_nchunks (const size_t nnz, const int nthreads);
+
+/*
+gsl_spblas_set_reduction()
+  Select how the partial sums of threaded products y := A x with A in
+CSC format (or A^T x with A in CSR format) are combined:
+
+GSL_SPBLAS_REDUCE_FAST          - one partial sum per thread; results
+                                  depend on the number of threads
+GSL_SPBLAS_REDUCE_DETERMINISTIC - a fixed number of partial sums
+                                  summed in a fixed order; results are
+                                  the same for any number of threads
+
+Return: previous setting
+*/
+
+int
+gsl_spblas_set_reduction (const int type)
+{
+  const int prev = spblas_reduction;
+
+  if (type != GSL_SPBLAS_REDUCE_FAST && type != GSL_SPBLAS_REDUCE_DETERMINISTIC)
+    {
+      GSL_ERROR_VAL ("unknown reduction type", GSL_EINVAL, prev);
+    }
+
+  spblas_reduction = type;
+
+  return prev;
+}
+
+int
+gsl_spblas_get_reduction (void)
+{
+  return spblas_reduction;
+}
+
 /*
 gsl_spblas_dgemv()
   Multiply a sparse matrix and a vector
@@ -39,6 +136,13 @@ Inputs: alpha - scalar factor
         y     - (input/output) dense vector
 
 Return: y = alpha*op(A)*x + beta*y
+
+Notes:
+1) For compressed matrices with many non-zero elements, the product
+is computed with the number of threads set by
+gsl_linalg_set_num_threads()
+
+2) A may also be in SELL or BCSR format
 */
 
 int
@@ -48,96 +152,54 @@ gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
 {
   const size_t M = A->size1;
   const size_t N = A->size2;
+  int status = spdgemv_check(TransA, M, N, x, y);
 
-  if ((TransA == CblasNoTrans && N != x->size) ||
-      (TransA == CblasTrans && M != x->size))
-    {
-      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
-    }
-  else if ((TransA == CblasNoTrans && M != y->size) ||
-           (TransA == CblasTrans && N != y->size))
+  if (status)
     {
-      GSL_ERROR("invalid length of y vector", GSL_EBADLEN);
+      return status;
     }
   else
     {
-      size_t j;
-      size_t incX, incY;
-      size_t lenX, lenY;
-      double *X, *Y;
-      double *Ad;
-      int *Ap, *Ai, *Aj;
+      const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+      const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+      const size_t incX = x->stride;
+      const size_t incY = y->stride;
+      const double *X = x->data;
+      double *Y = y->data;
+      const double *Ad = A->data;
+      const int *Ai, *Aj;
       int p;
 
-      if (TransA == CblasNoTrans)
-        {
-          lenX = N;
-          lenY = M;
-        }
-      else
-        {
-          lenX = M;
-          lenY = N;
-        }
-
       /* form y := beta*y */
-
-      Y = y->data;
-      incY = y->stride;
-
-      if (beta == 0.0)
-        {
-          size_t jy = 0;
-          for (j = 0; j < lenY; ++j)
-            {
-              Y[jy] = 0.0;
-              jy += incY;
-            }
-        }
-      else if (beta != 1.0)
-        {
-          size_t jy = 0;
-          for (j = 0; j < lenY; ++j)
-            {
-              Y[jy] *= beta;
-              jy += incY;
-            }
-        }
+      spdgemv_scale(beta, TransA, M, N, y);
 
       if (alpha == 0.0)
         return GSL_SUCCESS;
 
       /* form y := alpha*op(A)*x + y */
-      Ap = A->p;
-      Ad = A->data;
-      X = x->data;
-      incX = x->stride;
-
       if ((GSL_SPMATRIX_ISCCS(A) && (TransA == CblasNoTrans)) ||
           (GSL_SPMATRIX_ISCRS(A) && (TransA == CblasTrans)))
         {
-          Ai = A->i;
+          const int nthreads = spdgemv_nthreads(A->nz);
 
-          for (j = 0; j < lenX; ++j)
-            {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
-                {
-                  Y[Ai[p] * incY] += alpha * Ad[p] * X[j * incX];
-                }
-            }
+          return spdgemv_scatter(alpha, A, X, incX, Y, incY, lenX, lenY,
+                                 nthreads, spdgemv_nchunks(A->nz, nthreads));
         }
       else if ((GSL_SPMATRIX_ISCCS(A) && (TransA == CblasTrans)) ||
                (GSL_SPMATRIX_ISCRS(A) && (TransA == CblasNoTrans)))
         {
-          Ai = A->i;
-
-          for (j = 0; j < lenY; ++j)
-            {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
-                {
-                  Y[j * incY] += alpha * Ad[p] * X[Ai[p] * incX];
-                }
-            }
+          spdgemv_gather(alpha, A, X, incX, Y, incY, lenY,
+                         spdgemv_nthreads(A->nz));
+        }
+      else if (GSL_SPMATRIX_ISSELL(A))
+        {
+          spdgemv_sell(TransA, alpha, A, X, incX, Y, incY,
+                       spdgemv_nthreads(A->nz));
+        }
+      else if (GSL_SPMATRIX_ISBCSR(A))
+        {
+          spdgemv_bcsr(TransA, alpha, A, X, incX, Y, incY,
+                       spdgemv_nthreads(A->nz));
         }
       else if (GSL_SPMATRIX_ISTRIPLET(A))
         {
@@ -165,3 +227,267 @@ gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
       return GSL_SUCCESS;
     }
 } /* gsl_spblas_dgemv() */
+
+/*
+gsl_spblas_dgemv64()
+  Multiply a sparse matrix with 64-bit indices and a vector; see
+gsl_spblas_dgemv()
+*/
+
+int
+gsl_spblas_dgemv64(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                   const gsl_spmatrix64 *A, const gsl_vector *x,
+                   const double beta, gsl_vector *y)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  int status = spdgemv_check(TransA, M, N, x, y);
+
+  if (status)
+    {
+      return status;
+    }
+  else
+    {
+      const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+      const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+      const int nthreads = spdgemv_nthreads(A->nz);
+
+      spdgemv_scale(beta, TransA, M, N, y);
+
+      if (alpha == 0.0)
+        return GSL_SUCCESS;
+
+      if ((GSL_SPMATRIX_ISCSC(A) && (TransA == CblasNoTrans)) ||
+          (GSL_SPMATRIX_ISCSR(A) && (TransA == CblasTrans)))
+        {
+          return spdgemv_scatter64(alpha, A, x->data, x->stride, y->data,
+                                   y->stride, lenX, lenY, nthreads,
+                                   spdgemv_nchunks(A->nz, nthreads));
+        }
+      else if ((GSL_SPMATRIX_ISCSC(A) && (TransA == CblasTrans)) ||
+               (GSL_SPMATRIX_ISCSR(A) && (TransA == CblasNoTrans)))
+        {
+          spdgemv_gather64(alpha, A, x->data, x->stride, y->data,
+                           y->stride, lenY, nthreads);
+        }
+      else
+        {
+          GSL_ERROR("unsupported matrix type", GSL_EINVAL);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemv64() */
+
+/*
+spdgemv_sell()
+  Compute y := y + alpha*op(A)*x for A in SELL format. For op(A) = A,
+the C rows of a slice are processed together, with the partial sums
+in a local array of length C, so that the loop over the rows of a
+slice has unit stride and a constant trip count; the slices are split
+among the threads with equal numbers of stored elements
+*/
+
+static void
+spdgemv_sell (const CBLAS_TRANSPOSE_t TransA, const double alpha,
+              const gsl_spmatrix *A, const double *X, const size_t incX,
+              double *Y, const size_t incY, const int nthreads)
+{
+  const size_t C = GSL_SPMATRIX_SELL_C;
+  const size_t M = A->size1;
+  const size_t nslice = (M + C - 1) / C;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  const int *perm = A->p + nslice + 1;
+  const double *Ad = A->data;
+
+  if (TransA == CblasNoTrans)
+    {
+      const size_t nz = (size_t) Ap[nslice];
+      long t;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nthreads > 1) num_threads(nthreads) schedule(static)
+#endif
+      for (t = 0; t < nthreads; ++t)
+        {
+          const size_t s0 = sys_thread_bound (Ap, nslice, sys_thread_split (nz, t, nthreads));
+          const size_t s1 = (t == nthreads - 1) ? nslice :
+            sys_thread_bound (Ap, nslice, sys_thread_split (nz, t + 1, nthreads));
+          double acc[GSL_SPMATRIX_SELL_C];
+          size_t s, r;
+          int q;
+
+          for (s = s0; s < s1; ++s)
+            {
+              for (r = 0; r < GSL_SPMATRIX_SELL_C; ++r)
+                acc[r] = 0.0;
+
+              for (q = Ap[s]; q < Ap[s + 1]; q += GSL_SPMATRIX_SELL_C)
+                {
+                  for (r = 0; r < GSL_SPMATRIX_SELL_C; ++r)
+                    acc[r] += Ad[q + r] * X[Ai[q + r] * incX];
+                }
+
+              for (r = 0; r < GSL_SPMATRIX_SELL_C && s * C + r < M; ++r)
+                Y[perm[s * C + r] * incY] += alpha * acc[r];
+            }
+        }
+    }
+  else
+    {
+      size_t s, r;
+      int q;
+
+      for (s = 0; s < nslice; ++s)
+        {
+          for (r = 0; r < C && s * C + r < M; ++r)
+            {
+              const double xr = alpha * X[perm[s * C + r] * incX];
+
+              for (q = Ap[s] + (int) r; q < Ap[s + 1]; q += (int) C)
+                Y[Ai[q] * incY] += Ad[q] * xr;
+            }
+        }
+    }
+}
+
+/*
+spdgemv_bcsr()
+  Compute y := y + alpha*op(A)*x for A in BCSR format. For op(A) = A,
+kernels with constant block sizes are used for square blocks of
+order 2 to 6, and the block rows are split among the threads with
+equal numbers of blocks
+*/
+
+static void
+spdgemv_bcsr (const CBLAS_TRANSPOSE_t TransA, const double alpha,
+              const gsl_spmatrix *A, const double *X, const size_t incX,
+              double *Y, const size_t incY, const int nthreads)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t R = A->bsize1;
+  const size_t C = A->bsize2;
+  const size_t nbrow = (M + R - 1) / R;
+  const int *Ap = A->p;
+
+  if (TransA == CblasNoTrans)
+    {
+      const size_t nblock = (size_t) Ap[nbrow];
+      long t;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nthreads > 1) num_threads(nthreads) schedule(static)
+#endif
+      for (t = 0; t < nthreads; ++t)
+        {
+          const size_t I0 = sys_thread_bound (Ap, nbrow, sys_thread_split (nblock, t, nthreads));
+          const size_t I1 = (t == nthreads - 1) ? nbrow :
+            sys_thread_bound (Ap, nbrow, sys_thread_split (nblock, t + 1, nthreads));
+
+          if (R == 2 && C == 2)
+            spdgemv_bcsr_2 (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+          else if (R == 3 && C == 3)
+            spdgemv_bcsr_3 (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+          else if (R == 4 && C == 4)
+            spdgemv_bcsr_4 (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+          else if (R == 5 && C == 5)
+            spdgemv_bcsr_5 (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+          else if (R == 6 && C == 6)
+            spdgemv_bcsr_6 (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+          else
+            spdgemv_bcsr_n (R, C, alpha, A, X, incX, Y, incY, I0, I1);
+        }
+    }
+  else
+    {
+      const int *Ai = A->i;
+      const double *Ad = A->data;
+      size_t I, ii, jj;
+      int p;
+
+      for (I = 0; I < nbrow; ++I)
+        {
+          for (p = Ap[I]; p < Ap[I + 1]; ++p)
+            {
+              const double *b = Ad + (size_t) p * R * C;
+              const size_t j0 = (size_t) Ai[p] * C;
+
+              for (ii = 0; ii < R && I * R + ii < M; ++ii)
+                {
+                  const double xi = alpha * X[(I * R + ii) * incX];
+
+                  for (jj = 0; jj < C && j0 + jj < N; ++jj)
+                    Y[(j0 + jj) * incY] += b[ii * C + jj] * xi;
+                }
+            }
+        }
+    }
+}
+
+static int
+spdgemv_check (const CBLAS_TRANSPOSE_t TransA, const size_t M, const size_t N,
+               const gsl_vector *x, const gsl_vector *y)
+{
+  if ((TransA == CblasNoTrans && N != x->size) ||
+      (TransA == CblasTrans && M != x->size))
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if ((TransA == CblasNoTrans && M != y->size) ||
+           (TransA == CblasTrans && N != y->size))
+    {
+      GSL_ERROR("invalid length of y vector", GSL_EBADLEN);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* y := beta*y */
+static void
+spdgemv_scale (const double beta, const CBLAS_TRANSPOSE_t TransA,
+               const size_t M, const size_t N, gsl_vector *y)
+{
+  const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+  const size_t incY = y->stride;
+  double *Y = y->data;
+  size_t j;
+
+  if (beta == 0.0)
+    {
+      size_t jy = 0;
+      for (j = 0; j < lenY; ++j)
+        {
+          Y[jy] = 0.0;
+          jy += incY;
+        }
+    }
+  else if (beta != 1.0)
+    {
+      size_t jy = 0;
+      for (j = 0; j < lenY; ++j)
+        {
+          Y[jy] *= beta;
+          jy += incY;
+        }
+    }
+}
+
+/* number of threads for a product with nnz non-zero elements */
+static int
+spdgemv_nthreads (const size_t nnz)
+{
+  return sys_thread_count (nnz, SPBLAS_THREAD_MIN);
+}
+
+/* number of partial sums for a scattered product */
+static int
+spdgemv_nchunks (const size_t nnz, const int nthreads)
+{
+  if (spblas_reduction == GSL_SPBLAS_REDUCE_DETERMINISTIC)
+    return (nnz < SPBLAS_THREAD_MIN) ? 1 : SPBLAS_REDUCE_CHUNKS;
+
+  return nthreads;
+}
@@ -0,0 +1,101 @@
+/* spblas/spdgemv_bcsr_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Kernel for y := y + alpha*A*x with A in BCSR format, included from
+ * spdgemv.c.  When BCSR_B is defined the blocks are BCSR_B-by-BCSR_B
+ * and all loops over the elements of a block have constant trip
+ * counts, so that they can be unrolled and vectorized by the
+ * compiler; otherwise the block size is given by the arguments R, C.
+ * Block rows I0 <= I < I1 are processed.
+ */
+
+#ifdef BCSR_B
+#define RR BCSR_B
+#define CC BCSR_B
+#define FUNCTION(name) BCSR_CONCAT(name, BCSR_B)
+#else
+#define RR R
+#define CC C
+#define FUNCTION(name) BCSR_CONCAT(name, n)
+#endif
+
+static void
+FUNCTION (spdgemv_bcsr) (const size_t R, const size_t C, const double alpha,
+                         const gsl_spmatrix * A, const double * X,
+                         const size_t incX, double * Y, const size_t incY,
+                         const size_t I0, const size_t I1)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  const double *Ad = A->data;
+  double acc[GSL_SPMATRIX_BCSR_MAX];
+  size_t I, ii, jj;
+  int p;
+
+  (void) R;
+  (void) C;
+
+  for (I = I0; I < I1; ++I)
+    {
+      for (ii = 0; ii < RR; ++ii)
+        acc[ii] = 0.0;
+
+      for (p = Ap[I]; p < Ap[I + 1]; ++p)
+        {
+          const double *b = Ad + (size_t) p * RR * CC;
+          const size_t j0 = (size_t) Ai[p] * CC;
+
+          if (j0 + CC <= N)
+            {
+              double xb[GSL_SPMATRIX_BCSR_MAX];
+
+              for (jj = 0; jj < CC; ++jj)
+                xb[jj] = X[(j0 + jj) * incX];
+
+              for (ii = 0; ii < RR; ++ii)
+                {
+                  double sum = 0.0;
+
+                  for (jj = 0; jj < CC; ++jj)
+                    sum += b[ii * CC + jj] * xb[jj];
+
+                  acc[ii] += sum;
+                }
+            }
+          else
+            {
+              /* last block column, partly outside the matrix */
+              for (ii = 0; ii < RR; ++ii)
+                {
+                  for (jj = 0; j0 + jj < N; ++jj)
+                    acc[ii] += b[ii * CC + jj] * X[(j0 + jj) * incX];
+                }
+            }
+        }
+
+      for (ii = 0; ii < RR && I * RR + ii < M; ++ii)
+        Y[(I * RR + ii) * incY] += alpha * acc[ii];
+    }
+}
+
+#undef RR
+#undef CC
+#undef FUNCTION
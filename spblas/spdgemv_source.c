@@ -0,0 +1,159 @@
+/* spblas/spdgemv_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Kernels for sparse matrix-vector products, instantiated for the
+ * index type INDEX of the matrix type MATRIX
+ */
+
+/*
+FUNCTION(spdgemv_gather)()
+  Compute y := y + alpha*A*x (CSR) or y := y + alpha*A^T*x (CSC), in
+which each y_j is the dot product of compressed vector j of A with x.
+The vectors are split into nthreads ranges with an equal number of
+non-zero elements, so that the result does not depend on the number
+of threads
+*/
+
+static void
+FUNCTION (spdgemv_gather) (const double alpha, const MATRIX *A,
+                           const double *X, const size_t incX,
+                           double *Y, const size_t incY, const size_t lenY,
+                           const int nthreads)
+{
+  const INDEX *Ap = A->p;
+  const INDEX *Ai = A->i;
+  const double *Ad = A->data;
+  const size_t nnz = (size_t) Ap[lenY];
+  long t;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nthreads > 1) num_threads(nthreads) schedule(static)
+#endif
+  for (t = 0; t < nthreads; ++t)
+    {
+      const size_t j0 = FUNCTION (sys_thread_bound) (Ap, lenY, sys_thread_split (nnz, t, nthreads));
+      const size_t j1 = (t == nthreads - 1) ? lenY :
+        FUNCTION (sys_thread_bound) (Ap, lenY, sys_thread_split (nnz, t + 1, nthreads));
+      size_t j;
+
+      for (j = j0; j < j1; ++j)
+        {
+          double sum = 0.0;
+          INDEX p;
+
+          for (p = Ap[j]; p < Ap[j + 1]; ++p)
+            sum += Ad[p] * X[Ai[p] * incX];
+
+          Y[j * incY] += alpha * sum;
+        }
+    }
+}
+
+/*
+FUNCTION(spdgemv_scatter)()
+  Compute y := y + alpha*A*x (CSC) or y := y + alpha*A^T*x (CSR), in
+which compressed vector j of A, scaled by x_j, is added to y.
+
+The vectors of A are split into nchunks ranges with an equal number of
+non-zero elements. When nchunks > 1, each range is accumulated into a
+private copy of y by one thread, and the copies are then summed in
+range order, so that the result depends on nchunks but not on the
+scheduling of the threads.
+*/
+
+static int
+FUNCTION (spdgemv_scatter) (const double alpha, const MATRIX *A,
+                            const double *X, const size_t incX,
+                            double *Y, const size_t incY,
+                            const size_t lenX, const size_t lenY,
+                            const int nthreads, const int nchunks)
+{
+  const INDEX *Ap = A->p;
+  const INDEX *Ai = A->i;
+  const double *Ad = A->data;
+
+#ifndef _OPENMP
+  (void) nthreads;
+#endif
+
+  if (nchunks <= 1)
+    {
+      size_t j;
+
+      for (j = 0; j < lenX; ++j)
+        {
+          const double xj = alpha * X[j * incX];
+          INDEX p;
+
+          for (p = Ap[j]; p < Ap[j + 1]; ++p)
+            Y[Ai[p] * incY] += Ad[p] * xj;
+        }
+    }
+  else
+    {
+      const size_t nnz = (size_t) Ap[lenX];
+      double *work = calloc ((size_t) nchunks * lenY, sizeof (double));
+      long c, i;
+
+      if (work == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for partial sums", GSL_ENOMEM);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+      for (c = 0; c < nchunks; ++c)
+        {
+          const size_t j0 = FUNCTION (sys_thread_bound) (Ap, lenX, sys_thread_split (nnz, c, nchunks));
+          const size_t j1 = (c == nchunks - 1) ? lenX :
+            FUNCTION (sys_thread_bound) (Ap, lenX, sys_thread_split (nnz, c + 1, nchunks));
+          double *w = work + (size_t) c * lenY;
+          size_t j;
+
+          for (j = j0; j < j1; ++j)
+            {
+              const double xj = alpha * X[j * incX];
+              INDEX p;
+
+              for (p = Ap[j]; p < Ap[j + 1]; ++p)
+                w[Ai[p]] += Ad[p] * xj;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+      for (i = 0; i < (long) lenY; ++i)
+        {
+          double sum = 0.0;
+          int k;
+
+          for (k = 0; k < nchunks; ++k)
+            sum += work[(size_t) k * lenY + i];
+
+          Y[i * incY] += sum;
+        }
+
+      free (work);
+    }
+
+  return GSL_SUCCESS;
+}
@@ -18,6 +18,7 @@
  */
 
 #include <config.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
@@ -32,6 +33,8 @@
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_spblas.h>
 
+#include "thread_internal.h"
+
 /*
 create_random_sparse()
   Create a random sparse matrix with approximately
@@ -176,6 +179,161 @@ test_dgemv(const size_t N, const size_t M, const double alpha,
   gsl_vector_free(y_sp);
 } /* test_dgemv() */
 
+/* compare threaded, deterministic and 64-bit index products with the
+   single-threaded product */
+static void
+test_dgemv_threads(const size_t M, const size_t N, const CBLAS_TRANSPOSE_t TransA,
+                   const gsl_rng *r)
+{
+  const int sptypes[] = { GSL_SPMATRIX_CSC, GSL_SPMATRIX_CSR };
+  const int nthreads = 3;
+  const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+  const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+  gsl_spmatrix *A = create_random_sparse(M, N, 0.3, r);
+  gsl_vector *x = gsl_vector_alloc(lenX);
+  gsl_vector *y0 = gsl_vector_alloc(lenY);
+  gsl_vector *y1 = gsl_vector_alloc(lenY);
+  gsl_vector *y2 = gsl_vector_alloc(lenY);
+  const int prev_threads = sys_thread_get_num();
+  const int prev_reduction = gsl_spblas_get_reduction();
+  size_t k;
+
+  create_random_vector(x, r);
+
+  for (k = 0; k < 2; ++k)
+    {
+      gsl_spmatrix *B = gsl_spmatrix_compress(A, sptypes[k]);
+      gsl_spmatrix64 *C = gsl_spmatrix64_alloc_nzmax(M, N, B->nz, sptypes[k]);
+      const char *type = gsl_spmatrix_type(B);
+      int status;
+
+      gsl_spmatrix64_memcpy_spmatrix(C, B);
+
+      /* reference */
+      sys_thread_set_num(1);
+      gsl_spblas_set_reduction(GSL_SPBLAS_REDUCE_FAST);
+      create_random_vector(y0, r);
+      gsl_vector_memcpy(y1, y0);
+      gsl_vector_memcpy(y2, y0);
+      gsl_spblas_dgemv(TransA, 1.5, B, x, -0.5, y0);
+
+      /* threads */
+      sys_thread_set_num(nthreads);
+      gsl_spblas_dgemv(TransA, 1.5, B, x, -0.5, y1);
+      test_vectors(y1, y0, 1.0e-12, "test_dgemv_threads");
+
+      /* 64-bit indices give identical results */
+      gsl_spblas_dgemv64(TransA, 1.5, C, x, -0.5, y2);
+      gsl_vector_sub(y2, y1);
+      status = !gsl_vector_isnull(y2);
+      gsl_test(status, "test_dgemv_threads: dgemv64 M=%zu N=%zu type=%s trans=%d",
+               M, N, type, TransA == CblasTrans);
+
+      /* deterministic reduction is independent of the number of threads */
+      gsl_spblas_set_reduction(GSL_SPBLAS_REDUCE_DETERMINISTIC);
+      gsl_vector_memcpy(y2, y1);
+      gsl_vector_set_zero(y1);
+      gsl_spblas_dgemv(TransA, 1.5, B, x, 0.0, y1);
+      sys_thread_set_num(1);
+      gsl_vector_set_zero(y2);
+      gsl_spblas_dgemv(TransA, 1.5, B, x, 0.0, y2);
+      gsl_vector_sub(y2, y1);
+      status = !gsl_vector_isnull(y2);
+      gsl_test(status, "test_dgemv_threads: deterministic M=%zu N=%zu type=%s trans=%d",
+               M, N, type, TransA == CblasTrans);
+
+      gsl_spmatrix_free(B);
+      gsl_spmatrix64_free(C);
+    }
+
+  sys_thread_set_num(prev_threads);
+  gsl_spblas_set_reduction(prev_reduction);
+
+  gsl_spmatrix_free(A);
+  gsl_vector_free(x);
+  gsl_vector_free(y0);
+  gsl_vector_free(y1);
+  gsl_vector_free(y2);
+} /* test_dgemv_threads() */
+
+/* compare products with SELL and BCSR matrices to the CSR product */
+static void
+test_dgemv_blocked(const size_t M, const size_t N, const double density,
+                   const int nthreads, const gsl_rng *r)
+{
+  const size_t sigma[] = { 1, 16, 1000000 };
+  const size_t bsize[][2] = { { 1, 1 }, { 2, 2 }, { 3, 3 }, { 4, 4 },
+                              { 5, 5 }, { 6, 6 }, { 2, 3 }, { 7, 5 } };
+  const size_t nsigma = sizeof(sigma) / sizeof(sigma[0]);
+  const size_t nbsize = sizeof(bsize) / sizeof(bsize[0]);
+  const int prev_threads = sys_thread_get_num();
+  gsl_spmatrix *A = create_random_sparse(M, N, density, r);
+  gsl_spmatrix *B = gsl_spmatrix_compress(A, GSL_SPMATRIX_CSR);
+  gsl_vector *xn = gsl_vector_alloc(N);
+  gsl_vector *xt = gsl_vector_alloc(M);
+  gsl_vector *y0n = gsl_vector_alloc(M);
+  gsl_vector *y0t = gsl_vector_alloc(N);
+  gsl_vector *yn = gsl_vector_alloc(M);
+  gsl_vector *yt = gsl_vector_alloc(N);
+  size_t k;
+
+  sys_thread_set_num(nthreads);
+
+  create_random_vector(xn, r);
+  create_random_vector(xt, r);
+  create_random_vector(y0n, r);
+  create_random_vector(y0t, r);
+
+  for (k = 0; k < nsigma + nbsize; ++k)
+    {
+      gsl_spmatrix *S;
+      char str[128];
+
+      if (k < nsigma)
+        {
+          S = (k == 0) ? gsl_spmatrix_compress_sell(A, sigma[k])
+                       : gsl_spmatrix_compress_sell(B, sigma[k]);
+          sprintf(str, "test_dgemv_blocked: SELL sigma=%zu", sigma[k]);
+        }
+      else
+        {
+          const size_t *b = bsize[k - nsigma];
+          gsl_spmatrix *T = gsl_spmatrix_compress(A, GSL_SPMATRIX_CSC);
+
+          S = gsl_spmatrix_compress_bcsr(T, b[0], b[1]);
+          sprintf(str, "test_dgemv_blocked: BCSR %zux%zu", b[0], b[1]);
+          gsl_spmatrix_free(T);
+        }
+
+      /* y = 1.5*A*x - 0.5*y */
+      gsl_vector_memcpy(yn, y0n);
+      gsl_spblas_dgemv(CblasNoTrans, 1.5, S, xn, -0.5, yn);
+      gsl_spblas_dgemv(CblasNoTrans, -1.5, B, xn, 1.0, yn);
+      gsl_blas_daxpy(0.5, y0n, yn);
+      gsl_test(gsl_blas_dnrm2(yn) > 1.0e-12 * M, "%s M=%zu N=%zu notrans", str, M, N);
+
+      /* y = 1.5*A^T*x - 0.5*y */
+      gsl_vector_memcpy(yt, y0t);
+      gsl_spblas_dgemv(CblasTrans, 1.5, S, xt, -0.5, yt);
+      gsl_spblas_dgemv(CblasTrans, -1.5, B, xt, 1.0, yt);
+      gsl_blas_daxpy(0.5, y0t, yt);
+      gsl_test(gsl_blas_dnrm2(yt) > 1.0e-12 * N, "%s M=%zu N=%zu trans", str, M, N);
+
+      gsl_spmatrix_free(S);
+    }
+
+  sys_thread_set_num(prev_threads);
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+  gsl_vector_free(xn);
+  gsl_vector_free(xt);
+  gsl_vector_free(y0n);
+  gsl_vector_free(y0t);
+  gsl_vector_free(yn);
+  gsl_vector_free(yt);
+} /* test_dgemv_blocked() */
+
 static void
 test_dgemm(const double alpha, const size_t M, const size_t N,
            const gsl_rng *r)
@@ -251,6 +409,17 @@ main()
         }
     }
 
+  test_dgemv_threads(500, 300, CblasNoTrans, r);
+  test_dgemv_threads(500, 300, CblasTrans, r);
+
+  for (m = 1; m <= 20; ++m)
+    {
+      test_dgemv_blocked(m, 13, 0.3, 1, r);
+      test_dgemv_blocked(17, m, 0.3, 1, r);
+    }
+
+  test_dgemv_blocked(600, 500, 0.15, 3, r);
+
   test_dgemm(1.0, 10, 10, r);
   test_dgemm(2.3, 20, 15, r);
   test_dgemm(1.8, 12, 30, r);
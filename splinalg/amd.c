@@ -0,0 +1,905 @@
+/* amd.c
+ *
+ * Copyright (C) 2006 Timothy A. Davis
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * amd_order(), amd_wclear() and amd_tdfs() are derived from cs_amd(),
+ * cs_wclear() and cs_tdfs() of CSparse, copyright (C) 2006 Timothy A.
+ * Davis, which is distributed under the GNU Lesser General Public
+ * License, version 2.1 or later.  The license on this implementation
+ * was changed from LGPL to GPL, following section 3 of the LGPL,
+ * version 2.1.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Approximate minimum degree ordering.
+ *
+ * The symmetric elimination is simulated on the quotient graph, in
+ * which the eliminated nodes are merged into elements and the degree
+ * of each variable is replaced by an upper bound which is cheap to
+ * update.  Variables with identical adjacency are merged into
+ * supervariables and eliminated together, and dense rows are removed
+ * beforehand and ordered last.  The implementation follows
+ *
+ * [1] P. R. Amestoy, T. A. Davis and I. S. Duff, An approximate
+ *     minimum degree ordering algorithm, SIAM J. Matrix Anal. Appl.
+ *     17(4), 1996.
+ *
+ * [2] T. A. Davis, Direct methods for sparse linear systems, SIAM,
+ *     2006, chapter 7.
+ */
+
+#define AMD_FLIP(i)   (-(i) - 2)
+#define AMD_DENSE_MIN 16
+
+static int amd_order(const int n, int *Cp, int *Ci, const size_t nzmax, int *P);
+static int amd_pattern_sym(const gsl_spmatrix *A, int **Cp, int **Ci, size_t *nzmax);
+static int amd_pattern_ata(const gsl_spmatrix *A, int **Cp, int **Ci, size_t *nzmax);
+static int amd_wclear(int mark, int lemax, int *w, const int n);
+static int amd_tdfs(int j, int k, int *head, const int *next, int *post, int *stack);
+static int amd_run(const int n, int *Cp, int *Ci, const size_t nzmax, gsl_permutation *p);
+
+/*
+gsl_splinalg_amd()
+  Compute an approximate minimum degree ordering of the
+symmetric pattern A + A^T, for use with the Cholesky or LU
+factorization of P A P^T
+
+Inputs: A - square sparse matrix in compressed column format;
+            the diagonal and the values are ignored
+        p - (output) permutation, row and column k of P A P^T
+            are row and column p[k] of A
+*/
+
+int
+gsl_splinalg_amd(const gsl_spmatrix *A, gsl_permutation *p)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("compressed column format required", GSL_EINVAL);
+    }
+  else if (p->size != A->size2)
+    {
+      GSL_ERROR("permutation size must match matrix size", GSL_EBADLEN);
+    }
+  else
+    {
+      int *Cp, *Ci;
+      size_t nzmax;
+      int status = amd_pattern_sym(A, &Cp, &Ci, &nzmax);
+
+      if (status)
+        return status;
+
+      return amd_run((int) A->size2, Cp, Ci, nzmax, p);
+    }
+}
+
+/*
+gsl_splinalg_amd_col()
+  Compute a column ordering for the LU factorization of A Q, as the
+approximate minimum degree ordering of the pattern of A^T A. The
+fill in the LU factors with partial pivoting is contained in the fill
+of the Cholesky factor of Q^T A^T A Q. Rows of A with more than
+MAX(16, 10 sqrt(N)) entries are ignored, so that A^T A is not dense.
+
+Inputs: A - sparse matrix in compressed column format
+        q - (output) column permutation of length A->size2
+*/
+
+int
+gsl_splinalg_amd_col(const gsl_spmatrix *A, gsl_permutation *q)
+{
+  if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("compressed column format required", GSL_EINVAL);
+    }
+  else if (q->size != A->size2)
+    {
+      GSL_ERROR("permutation size must match matrix columns", GSL_EBADLEN);
+    }
+  else
+    {
+      int *Cp, *Ci;
+      size_t nzmax;
+      int status = amd_pattern_ata(A, &Cp, &Ci, &nzmax);
+
+      if (status)
+        return status;
+
+      return amd_run((int) A->size2, Cp, Ci, nzmax, q);
+    }
+}
+
+/* order the pattern (Cp,Ci), which is freed, and store the result in p */
+static int
+amd_run(const int n, int *Cp, int *Ci, const size_t nzmax, gsl_permutation *p)
+{
+  int *P = malloc((n + 1) * sizeof(int));
+  int status;
+  int k;
+
+  if (P == NULL)
+    {
+      free(Cp);
+      free(Ci);
+      GSL_ERROR("failed to allocate space for ordering", GSL_ENOMEM);
+    }
+
+  status = amd_order(n, Cp, Ci, nzmax, P);
+
+  if (status == GSL_SUCCESS)
+    {
+      /* P[n] is the placeholder node for the dense rows */
+      size_t j = 0;
+
+      for (k = 0; k <= n; ++k)
+        {
+          if (P[k] < n)
+            p->data[j++] = (size_t) P[k];
+        }
+    }
+
+  free(P);
+  free(Cp);
+  free(Ci);
+
+  return status;
+}
+
+/*
+amd_pattern_sym()
+  Construct the pattern of A + A^T without the diagonal, with
+room for the quotient graph
+
+Inputs: A     - square matrix in CSC format
+        Cp    - (output) column pointers, length n + 1
+        Ci    - (output) row indices
+        nzmax - (output) allocated length of Ci
+*/
+
+static int
+amd_pattern_sym(const gsl_spmatrix *A, int **Cp, int **Ci, size_t *nzmax)
+{
+  const int n = (int) A->size2;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  int *cnt = calloc(n + 1, sizeof(int));
+  int *mark = malloc((n + 1) * sizeof(int));
+  int *Tp = malloc((n + 1) * sizeof(int));
+  int *Ti = malloc((A->nz + 1) * sizeof(int));
+  int *Sp = NULL, *Si = NULL;
+  size_t cnz, nzalloc;
+  int i, j, p, q;
+
+  if (cnt == NULL || mark == NULL || Tp == NULL || Ti == NULL)
+    {
+      free(cnt); free(mark); free(Tp); free(Ti);
+      GSL_ERROR("failed to allocate space for pattern", GSL_ENOMEM);
+    }
+
+  /* T = A^T (pattern only) */
+  for (p = 0; p < Ap[n]; ++p)
+    cnt[Ai[p]]++;
+
+  Tp[0] = 0;
+  for (i = 0; i < n; ++i)
+    {
+      Tp[i + 1] = Tp[i] + cnt[i];
+      cnt[i] = Tp[i];
+    }
+
+  for (j = 0; j < n; ++j)
+    {
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        Ti[cnt[Ai[p]]++] = j;
+    }
+
+  /* count the entries of each column of A + A^T */
+  for (j = 0; j < n; ++j)
+    mark[j] = -1;
+
+  cnz = 0;
+  for (j = 0; j < n; ++j)
+    {
+      mark[j] = j; /* exclude the diagonal */
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        {
+          if (mark[Ai[p]] != j)
+            {
+              mark[Ai[p]] = j;
+              ++cnz;
+            }
+        }
+
+      for (p = Tp[j]; p < Tp[j + 1]; ++p)
+        {
+          if (mark[Ti[p]] != j)
+            {
+              mark[Ti[p]] = j;
+              ++cnz;
+            }
+        }
+    }
+
+  /* elbow room for the elements of the quotient graph */
+  nzalloc = cnz + cnz / 5 + 2 * (size_t) n + 1;
+
+  Sp = malloc((n + 1) * sizeof(int));
+  Si = malloc(nzalloc * sizeof(int));
+
+  if (Sp == NULL || Si == NULL)
+    {
+      free(cnt); free(mark); free(Tp); free(Ti); free(Sp); free(Si);
+      GSL_ERROR("failed to allocate space for pattern", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < n; ++j)
+    mark[j] = -1;
+
+  q = 0;
+  for (j = 0; j < n; ++j)
+    {
+      Sp[j] = q;
+      mark[j] = j;
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        {
+          if (mark[Ai[p]] != j)
+            {
+              mark[Ai[p]] = j;
+              Si[q++] = Ai[p];
+            }
+        }
+
+      for (p = Tp[j]; p < Tp[j + 1]; ++p)
+        {
+          if (mark[Ti[p]] != j)
+            {
+              mark[Ti[p]] = j;
+              Si[q++] = Ti[p];
+            }
+        }
+    }
+
+  Sp[n] = q;
+
+  free(cnt);
+  free(mark);
+  free(Tp);
+  free(Ti);
+
+  *Cp = Sp;
+  *Ci = Si;
+  *nzmax = nzalloc;
+
+  return GSL_SUCCESS;
+}
+
+/*
+amd_pattern_ata()
+  Construct the pattern of A^T A without the diagonal, ignoring
+dense rows of A, with room for the quotient graph
+*/
+
+static int
+amd_pattern_ata(const gsl_spmatrix *A, int **Cp, int **Ci, size_t *nzmax)
+{
+  const int m = (int) A->size1;
+  const int n = (int) A->size2;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  const int dense = (int) GSL_MAX(AMD_DENSE_MIN, 10.0 * sqrt((double) n));
+  int *cnt = calloc(m + 1, sizeof(int));
+  int *mark = malloc((n + 1) * sizeof(int));
+  int *Tp = malloc((m + 1) * sizeof(int));
+  int *Ti = malloc((A->nz + 1) * sizeof(int));
+  int *Sp = NULL, *Si = NULL;
+  size_t cnz, nzalloc;
+  int i, j, p, p2, q;
+
+  if (cnt == NULL || mark == NULL || Tp == NULL || Ti == NULL)
+    {
+      free(cnt); free(mark); free(Tp); free(Ti);
+      GSL_ERROR("failed to allocate space for pattern", GSL_ENOMEM);
+    }
+
+  /* T = A^T, rows of A by column index */
+  for (p = 0; p < Ap[n]; ++p)
+    cnt[Ai[p]]++;
+
+  Tp[0] = 0;
+  for (i = 0; i < m; ++i)
+    {
+      Tp[i + 1] = Tp[i] + cnt[i];
+      cnt[i] = Tp[i];
+    }
+
+  for (j = 0; j < n; ++j)
+    {
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        Ti[cnt[Ai[p]]++] = j;
+    }
+
+  /* column j of A^T A is the union of the rows of A which have an
+     entry in column j */
+  for (j = 0; j < n; ++j)
+    mark[j] = -1;
+
+  cnz = 0;
+  for (j = 0; j < n; ++j)
+    {
+      mark[j] = j;
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        {
+          i = Ai[p];
+
+          if (Tp[i + 1] - Tp[i] > dense)
+            continue;
+
+          for (p2 = Tp[i]; p2 < Tp[i + 1]; ++p2)
+            {
+              if (mark[Ti[p2]] != j)
+                {
+                  mark[Ti[p2]] = j;
+                  ++cnz;
+                }
+            }
+        }
+    }
+
+  nzalloc = cnz + cnz / 5 + 2 * (size_t) n + 1;
+
+  Sp = malloc((n + 1) * sizeof(int));
+  Si = malloc(nzalloc * sizeof(int));
+
+  if (Sp == NULL || Si == NULL)
+    {
+      free(cnt); free(mark); free(Tp); free(Ti); free(Sp); free(Si);
+      GSL_ERROR("failed to allocate space for pattern", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < n; ++j)
+    mark[j] = -1;
+
+  q = 0;
+  for (j = 0; j < n; ++j)
+    {
+      Sp[j] = q;
+      mark[j] = j;
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        {
+          i = Ai[p];
+
+          if (Tp[i + 1] - Tp[i] > dense)
+            continue;
+
+          for (p2 = Tp[i]; p2 < Tp[i + 1]; ++p2)
+            {
+              if (mark[Ti[p2]] != j)
+                {
+                  mark[Ti[p2]] = j;
+                  Si[q++] = Ti[p2];
+                }
+            }
+        }
+    }
+
+  Sp[n] = q;
+
+  free(cnt);
+  free(mark);
+  free(Tp);
+  free(Ti);
+
+  *Cp = Sp;
+  *Ci = Si;
+  *nzmax = nzalloc;
+
+  return GSL_SUCCESS;
+}
+
+/* clear the marks w[] when the mark counter would overflow */
+static int
+amd_wclear(int mark, int lemax, int *w, const int n)
+{
+  int k;
+
+  if (mark < 2 || (mark + lemax < 0))
+    {
+      for (k = 0; k < n; ++k)
+        {
+          if (w[k] != 0)
+            w[k] = 1;
+        }
+
+      mark = 2;
+    }
+
+  return mark; /* w[i] < mark for all i */
+}
+
+/* depth-first search and postorder of the tree rooted at node j */
+static int
+amd_tdfs(int j, int k, int *head, const int *next, int *post, int *stack)
+{
+  int i, p, top = 0;
+
+  stack[0] = j;
+
+  while (top >= 0)
+    {
+      p = stack[top];
+      i = head[p];
+
+      if (i == -1)
+        {
+          --top;
+          post[k++] = p;
+        }
+      else
+        {
+          head[p] = next[i];
+          stack[++top] = i;
+        }
+    }
+
+  return k;
+}
+
+/*
+amd_order()
+  Approximate minimum degree ordering of a symmetric pattern
+
+Inputs: n     - order of matrix
+        Cp    - column pointers of the pattern of a symmetric matrix
+                without its diagonal, length n + 1; destroyed
+        Ci    - row indices, of allocated length nzmax; destroyed
+        nzmax - allocated length of Ci, which must allow some elbow room
+        P     - (output) ordering, of length n + 1, where P[k] = n is a
+                placeholder for the dense rows which follow it
+*/
+
+static int
+amd_order(const int n, int *Cp, int *Ci, const size_t nzmax, int *P)
+{
+  int *W = malloc(8 * (size_t) (n + 1) * sizeof(int));
+  int *len, *nv, *next, *head, *elen, *degree, *w, *hhead, *last;
+  int d, dk, dext, lemax = 0, e, elenk, eln, i, j, k, k1, k2, k3, jlast, ln;
+  int dense, mindeg = 0, nvi, nvj, nvk, mark, wnvi, ok, nel = 0, p, p1, p2, p3, p4;
+  int pj, pk, pk1, pk2, pn, q, cnz = Cp[n];
+  unsigned long h;
+
+  if (W == NULL)
+    {
+      GSL_ERROR("failed to allocate space for ordering", GSL_ENOMEM);
+    }
+
+  len = W;
+  nv = W + (n + 1);
+  next = W + 2 * (n + 1);
+  head = W + 3 * (n + 1);
+  elen = W + 4 * (n + 1);
+  degree = W + 5 * (n + 1);
+  w = W + 6 * (n + 1);
+  hhead = W + 7 * (n + 1);
+  last = P; /* the linked lists share the output array */
+
+  /* rows with more than dense entries are removed */
+  dense = (int) GSL_MAX(AMD_DENSE_MIN, 10.0 * sqrt((double) n));
+  dense = GSL_MIN(n - 2, dense);
+
+  /* initialize the quotient graph */
+  for (k = 0; k < n; ++k)
+    len[k] = Cp[k + 1] - Cp[k];
+
+  len[n] = 0;
+
+  for (i = 0; i <= n; ++i)
+    {
+      head[i] = -1;
+      last[i] = -1;
+      next[i] = -1;
+      hhead[i] = -1;
+      nv[i] = 1;
+      w[i] = 1;
+      elen[i] = 0;
+      degree[i] = len[i];
+    }
+
+  mark = amd_wclear(0, 0, w, n);
+  elen[n] = -2; /* n is a dead element */
+  Cp[n] = -1;   /* n is a root of the assembly tree */
+  w[n] = 0;
+
+  /* initialize the degree lists */
+  for (i = 0; i < n; ++i)
+    {
+      d = degree[i];
+
+      if (d == 0)
+        {
+          /* empty node: eliminate it now */
+          elen[i] = -2;
+          ++nel;
+          Cp[i] = -1;
+          w[i] = 0;
+        }
+      else if (d > dense)
+        {
+          /* dense node: absorb it into the placeholder n */
+          nv[i] = 0;
+          elen[i] = -1;
+          ++nel;
+          Cp[i] = AMD_FLIP(n);
+          nv[n]++;
+        }
+      else
+        {
+          if (head[d] != -1)
+            last[head[d]] = i;
+
+          next[i] = head[d];
+          head[d] = i;
+        }
+    }
+
+  while (nel < n)
+    {
+      /* select a node of minimum approximate degree */
+      for (k = -1; mindeg < n && (k = head[mindeg]) == -1; ++mindeg)
+        ;
+
+      if (next[k] != -1)
+        last[next[k]] = -1;
+
+      head[mindeg] = next[k];
+      elenk = elen[k];
+      nvk = nv[k];
+      nel += nvk;
+
+      /* garbage collection */
+      if (elenk > 0 && (size_t) (cnz + mindeg) >= nzmax)
+        {
+          for (j = 0; j < n; ++j)
+            {
+              if ((p = Cp[j]) >= 0)
+                {
+                  Cp[j] = Ci[p];       /* save first entry of object */
+                  Ci[p] = AMD_FLIP(j); /* first entry is now AMD_FLIP(j) */
+                }
+            }
+
+          for (q = 0, p = 0; p < cnz; )
+            {
+              if ((j = AMD_FLIP(Ci[p++])) >= 0)
+                {
+                  Ci[q] = Cp[j];
+                  Cp[j] = q++;
+
+                  for (k3 = 0; k3 < len[j] - 1; ++k3)
+                    Ci[q++] = Ci[p++];
+                }
+            }
+
+          cnz = q;
+        }
+
+      /* construct the new element */
+      dk = 0;
+      nv[k] = -nvk;
+      p = Cp[k];
+      pk1 = (elenk == 0) ? p : cnz;
+      pk2 = pk1;
+
+      for (k1 = 1; k1 <= elenk + 1; ++k1)
+        {
+          if (k1 > elenk)
+            {
+              e = k;
+              pj = p;
+              ln = len[k] - elenk;
+            }
+          else
+            {
+              e = Ci[p++];
+              pj = Cp[e];
+              ln = len[e];
+            }
+
+          for (k2 = 1; k2 <= ln; ++k2)
+            {
+              i = Ci[pj++];
+
+              if ((nvi = nv[i]) <= 0)
+                continue;
+
+              dk += nvi;
+              nv[i] = -nvi;     /* negative nv[i] marks i as in Lk */
+              Ci[pk2++] = i;
+
+              /* remove i from its degree list */
+              if (next[i] != -1)
+                last[next[i]] = last[i];
+
+              if (last[i] != -1)
+                next[last[i]] = next[i];
+              else
+                head[degree[i]] = next[i];
+            }
+
+          if (e != k)
+            {
+              /* absorb e into k */
+              Cp[e] = AMD_FLIP(k);
+              w[e] = 0;
+            }
+        }
+
+      if (elenk != 0)
+        cnz = pk2;
+
+      degree[k] = dk;
+      Cp[k] = pk1;
+      len[k] = pk2 - pk1;
+      elen[k] = -2;     /* k is now an element */
+
+      /* compute the set differences |Le \ Lk| for all elements e */
+      mark = amd_wclear(mark, lemax, w, n);
+
+      for (pk = pk1; pk < pk2; ++pk)
+        {
+          i = Ci[pk];
+
+          if ((eln = elen[i]) <= 0)
+            continue;
+
+          nvi = -nv[i];
+          wnvi = mark - nvi;
+
+          for (p = Cp[i]; p <= Cp[i] + eln - 1; ++p)
+            {
+              e = Ci[p];
+
+              if (w[e] >= mark)
+                w[e] -= nvi;
+              else if (w[e] != 0)
+                w[e] = degree[e] + wnvi;
+            }
+        }
+
+      /* update the degrees of the variables of Lk, absorbing elements */
+      for (pk = pk1; pk < pk2; ++pk)
+        {
+          i = Ci[pk];
+          p1 = Cp[i];
+          p2 = p1 + elen[i] - 1;
+          pn = p1;
+
+          for (h = 0, d = 0, p = p1; p <= p2; ++p)
+            {
+              e = Ci[p];
+
+              if (w[e] != 0)
+                {
+                  dext = w[e] - mark;
+
+                  if (dext > 0)
+                    {
+                      d += dext;
+                      Ci[pn++] = e;
+                      h += (unsigned long) e;
+                    }
+                  else
+                    {
+                      /* aggressive absorption of e into k */
+                      Cp[e] = AMD_FLIP(k);
+                      w[e] = 0;
+                    }
+                }
+            }
+
+          elen[i] = pn - p1 + 1;
+          p3 = pn;
+          p4 = p1 + len[i];
+
+          for (p = p2 + 1; p < p4; ++p)
+            {
+              j = Ci[p];
+
+              if ((nvj = nv[j]) <= 0)
+                continue;
+
+              d += nvj;
+              Ci[pn++] = j;
+              h += (unsigned long) j;
+            }
+
+          if (d == 0)
+            {
+              /* mass elimination of i */
+              Cp[i] = AMD_FLIP(k);
+              nvi = -nv[i];
+              dk -= nvi;
+              nvk += nvi;
+              nel += nvi;
+              nv[i] = 0;
+              elen[i] = -1;
+            }
+          else
+            {
+              degree[i] = GSL_MIN(degree[i], d);
+              Ci[pn] = Ci[p3];  /* move first variable to the end */
+              Ci[p3] = Ci[p1];  /* move first element to the end of the elements */
+              Ci[p1] = k;       /* add k as the first element */
+              len[i] = pn - p1 + 1;
+              h %= (unsigned long) n;
+
+              /* place i in the hash bucket h */
+              next[i] = hhead[h];
+              hhead[h] = i;
+              last[i] = (int) h;
+            }
+        }
+
+      degree[k] = dk;
+      lemax = GSL_MAX(lemax, dk);
+      mark = amd_wclear(mark + lemax, lemax, w, n);
+
+      /* supernode detection */
+      for (pk = pk1; pk < pk2; ++pk)
+        {
+          i = Ci[pk];
+
+          if (nv[i] >= 0)
+            continue;
+
+          h = (unsigned long) last[i];
+          i = hhead[h];
+          hhead[h] = -1;
+
+          for (; i != -1 && next[i] != -1; i = next[i], ++mark)
+            {
+              ln = len[i];
+              eln = elen[i];
+
+              for (p = Cp[i] + 1; p <= Cp[i] + ln - 1; ++p)
+                w[Ci[p]] = mark;
+
+              jlast = i;
+
+              for (j = next[i]; j != -1; )
+                {
+                  ok = (len[j] == ln) && (elen[j] == eln);
+
+                  for (p = Cp[j] + 1; ok && p <= Cp[j] + ln - 1; ++p)
+                    {
+                      if (w[Ci[p]] != mark)
+                        ok = 0;
+                    }
+
+                  if (ok)
+                    {
+                      /* j is indistinguishable from i: absorb it */
+                      Cp[j] = AMD_FLIP(i);
+                      nv[i] += nv[j];
+                      nv[j] = 0;
+                      elen[j] = -1;
+                      j = next[j];
+                      next[jlast] = j;
+                    }
+                  else
+                    {
+                      jlast = j;
+                      j = next[j];
+                    }
+                }
+            }
+        }
+
+      /* finalize the new element */
+      for (p = pk1, pk = pk1; pk < pk2; ++pk)
+        {
+          i = Ci[pk];
+
+          if ((nvi = -nv[i]) <= 0)
+            continue;
+
+          nv[i] = nvi;
+          d = degree[i] + dk - nvi;
+          d = GSL_MIN(d, n - nel - nvi);
+
+          if (head[d] != -1)
+            last[head[d]] = i;
+
+          next[i] = head[d];
+          last[i] = -1;
+          head[d] = i;
+          mindeg = GSL_MIN(mindeg, d);
+          degree[i] = d;
+          Ci[p++] = i;
+        }
+
+      nv[k] = nvk;
+
+      if ((len[k] = p - pk1) == 0)
+        {
+          /* k is a root of the tree */
+          Cp[k] = -1;
+          w[k] = 0;
+        }
+
+      if (elenk != 0)
+        cnz = p;
+    }
+
+  /* postorder the assembly tree */
+  for (i = 0; i < n; ++i)
+    Cp[i] = AMD_FLIP(Cp[i]);
+
+  for (j = 0; j <= n; ++j)
+    head[j] = -1;
+
+  /* place unordered nodes in lists */
+  for (j = n; j >= 0; --j)
+    {
+      if (nv[j] > 0)
+        continue;
+
+      next[j] = head[Cp[j]];
+      head[Cp[j]] = j;
+    }
+
+  /* place elements in lists */
+  for (e = n; e >= 0; --e)
+    {
+      if (nv[e] <= 0)
+        continue;
+
+      if (Cp[e] != -1)
+        {
+          next[e] = head[Cp[e]];
+          head[Cp[e]] = e;
+        }
+    }
+
+  for (k = 0, i = 0; i <= n; ++i)
+    {
+      if (Cp[i] == -1)
+        k = amd_tdfs(i, k, head, next, P, w);
+    }
+
+  free(W);
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,337 @@
+/* bicgstab.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "methods.h"
+#include "common.c"
+
+/*
+ * BiCGStab method of van der Vorst for general nonsymmetric systems,
+ * with right preconditioning, so that the residual which is monitored
+ * is the residual b - A*x of the original system.
+ *
+ * [1] H. A. van der Vorst, Bi-CGSTAB: A fast and smoothly converging
+ *     variant of Bi-CG for the solution of nonsymmetric linear systems,
+ *     SIAM J. Sci. Stat. Comput. 13(2), 1992.
+ *
+ * [2] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *rhat; /* shadow residual */
+  gsl_vector *p;   /* search direction */
+  gsl_vector *v;   /* v = A M^{-1} p */
+  gsl_vector *t;   /* t = A M^{-1} s */
+  gsl_vector *y;   /* preconditioned vectors M^{-1} p, M^{-1} s */
+
+  const gsl_splinalg_precond *precond; /* preconditioner, or NULL */
+
+  double normr;    /* residual norm ||r|| */
+} bicgstab_state_t;
+
+static void bicgstab_free(void *vstate);
+
+/*
+bicgstab_alloc()
+  Allocate a BiCGStab workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations for each call to
+            gsl_splinalg_itersolve_iterate(); if this parameter
+            is 0, the value n is used
+
+Return: pointer to workspace
+*/
+
+static void *
+bicgstab_alloc(const size_t n, const size_t m)
+{
+  bicgstab_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(bicgstab_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate bicgstab state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->maxit = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->rhat = gsl_vector_alloc(n);
+  state->p = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->t = gsl_vector_alloc(n);
+  state->y = gsl_vector_alloc(n);
+  if (!state->r || !state->rhat || !state->p || !state->v ||
+      !state->t || !state->y)
+    {
+      bicgstab_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->precond = NULL;
+  state->normr = 0.0;
+
+  return state;
+}
+
+static void
+bicgstab_free(void *vstate)
+{
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->rhat)
+    gsl_vector_free(state->rhat);
+
+  if (state->p)
+    gsl_vector_free(state->p);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->t)
+    gsl_vector_free(state->t);
+
+  if (state->y)
+    gsl_vector_free(state->y);
+
+  free(state);
+}
+
+/*
+bicgstab_iterate_op()
+  Solve A*x = b using the BiCGStab algorithm
+
+Inputs: A    - square linear operator
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||; GSL_CONTINUE if not
+yet converged after maxit iterations or after a breakdown of the
+method, in which case calling this function again restarts the
+iteration from the current x with a new shadow residual
+*/
+
+static int
+bicgstab_iterate_op(const gsl_linalg_operator *A, const gsl_vector *b,
+                    const double tol, gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double reltol = tol * gsl_blas_dnrm2(b); /* tol*||b|| */
+      gsl_vector *r = state->r;
+      gsl_vector *rhat = state->rhat;
+      gsl_vector *p = state->p;
+      gsl_vector *v = state->v;
+      gsl_vector *t = state->t;
+      gsl_vector *y = state->y;
+      double normr;
+      double rho = 1.0, alpha = 1.0, omega = 1.0;
+      size_t k;
+      int status;
+
+      /* r = b - A*x_0 */
+      status = splinalg_residual(A, b, x, r);
+      if (status)
+        return status;
+      normr = gsl_blas_dnrm2(r);
+
+      if (normr > reltol)
+        {
+          gsl_vector_memcpy(rhat, r);
+          gsl_vector_set_zero(p);
+          gsl_vector_set_zero(v);
+
+          for (k = 0; k < state->maxit; ++k)
+            {
+              double rho_new, rv, ts, tt;
+
+              gsl_blas_ddot(rhat, r, &rho_new);
+              if (rho_new == 0.0)
+                break;
+
+              /* p = r + beta*(p - omega*v) */
+              gsl_blas_daxpy(-omega, v, p);
+              gsl_vector_scale(p, (rho_new / rho) * (alpha / omega));
+              gsl_vector_add(p, r);
+
+              /* v = A M^{-1} p */
+              status = splinalg_precond(state->precond, p, y);
+              if (status)
+                return status;
+
+              status = splinalg_matvec(A, y, v);
+              if (status)
+                return status;
+
+              gsl_blas_ddot(rhat, v, &rv);
+              if (rv == 0.0)
+                break;
+
+              alpha = rho_new / rv;
+              rho = rho_new;
+
+              /* x = x + alpha M^{-1} p, s = r - alpha*v (stored in r) */
+              gsl_blas_daxpy(alpha, y, x);
+              gsl_blas_daxpy(-alpha, v, r);
+
+              normr = gsl_blas_dnrm2(r);
+              if (normr <= reltol)
+                break;
+
+              /* t = A M^{-1} s */
+              status = splinalg_precond(state->precond, r, y);
+              if (status)
+                return status;
+
+              status = splinalg_matvec(A, y, t);
+              if (status)
+                return status;
+
+              gsl_blas_ddot(t, r, &ts);
+              gsl_blas_ddot(t, t, &tt);
+              if (tt == 0.0)
+                break;
+
+              omega = ts / tt;
+
+              /* x = x + omega M^{-1} s, r = s - omega*t */
+              gsl_blas_daxpy(omega, y, x);
+              gsl_blas_daxpy(-omega, t, r);
+
+              normr = gsl_blas_dnrm2(r);
+              if (normr <= reltol || omega == 0.0)
+                break;
+            }
+
+          /* compute true residual r = b - A*x */
+          status = splinalg_residual(A, b, x, r);
+          if (status)
+            return status;
+          normr = gsl_blas_dnrm2(r);
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+}
+
+/* solve A*x = b for a sparse matrix A */
+static int
+bicgstab_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                 const double tol, gsl_vector *x, void *vstate)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return bicgstab_iterate_op(&op, b, tol, x, vstate);
+}
+
+static double
+bicgstab_normr(const void *vstate)
+{
+  const bicgstab_state_t *state = (const bicgstab_state_t *) vstate;
+  return state->normr;
+}
+
+static int
+bicgstab_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->precond = P;
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_splinalg_itersolve_type bicgstab_type =
+{
+  "bicgstab",
+  &bicgstab_alloc,
+  &bicgstab_iterate,
+  &bicgstab_normr,
+  &bicgstab_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab =
+  &bicgstab_type;
+
+const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_bicgstab_methods =
+{
+  &bicgstab_type,
+  &bicgstab_set_precond,
+  &bicgstab_iterate_op
+};
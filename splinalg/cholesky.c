@@ -0,0 +1,697 @@
+/* cholesky.c
+ *
+ * Copyright (C) 2006 Timothy A. Davis
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The elimination tree and column counts in
+ * gsl_splinalg_cholesky_symbolic() are derived from cs_etree() and
+ * cs_ereach() of CSparse, copyright (C) 2006 Timothy A. Davis, which
+ * is distributed under the GNU Lesser General Public License, version
+ * 2.1 or later.  The license on this implementation was changed from
+ * LGPL to GPL, following section 3 of the LGPL, version 2.1.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Sparse Cholesky factorization
+ *
+ *   P A P^T = L L^T
+ *
+ * where P is a fill-reducing permutation.  The symbolic analysis
+ * computes the ordering, the elimination tree and the pattern of L,
+ * which depend only on the pattern of A and can be reused for several
+ * numerical factorizations.  The numerical factorization is the
+ * left-looking column algorithm: column k of L is computed from column
+ * k of A and the columns j < k of L with L(k,j) != 0, which are kept in
+ * linked lists indexed by their next row.
+ *
+ * See T. A. Davis, Direct methods for sparse linear systems, SIAM,
+ * 2006, chapter 4, and A. George and J. W. H. Liu, Computer solution
+ * of large sparse positive definite systems, Prentice-Hall, 1981.
+ */
+
+static void cholesky_free_symbolic(gsl_splinalg_cholesky_workspace *w);
+static void cholesky_lsolve(const gsl_spmatrix *L, double *x);
+static void cholesky_ltsolve(const gsl_spmatrix *L, double *x);
+
+gsl_splinalg_cholesky_workspace *
+gsl_splinalg_cholesky_alloc(const size_t n)
+{
+  gsl_splinalg_cholesky_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_cholesky_workspace));
+  if (!w)
+    {
+      GSL_ERROR_NULL("failed to allocate cholesky workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+
+  w->perm = gsl_permutation_alloc(n);
+  w->pinv = malloc(n * sizeof(int));
+  w->parent = malloc(n * sizeof(int));
+  w->Cp = malloc((n + 1) * sizeof(int));
+  w->x = malloc(n * sizeof(double));
+  w->work = malloc(3 * n * sizeof(int));
+
+  if (!w->perm || !w->pinv || !w->parent || !w->Cp || !w->x || !w->work)
+    {
+      gsl_splinalg_cholesky_free(w);
+      GSL_ERROR_NULL("failed to allocate cholesky workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_splinalg_cholesky_free(gsl_splinalg_cholesky_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  cholesky_free_symbolic(w);
+
+  if (w->perm)
+    gsl_permutation_free(w->perm);
+
+  if (w->pinv)
+    free(w->pinv);
+
+  if (w->parent)
+    free(w->parent);
+
+  if (w->Cp)
+    free(w->Cp);
+
+  if (w->x)
+    free(w->x);
+
+  if (w->work)
+    free(w->work);
+
+  free(w);
+}
+
+/*
+gsl_splinalg_cholesky_symbolic()
+  Symbolic analysis of the Cholesky factorization of a symmetric
+matrix
+
+Inputs: A        - symmetric matrix in compressed column format; only
+                   the lower triangle is referenced
+        ordering - fill-reducing ordering, GSL_SPLINALG_ORDER_NATURAL
+                   or GSL_SPLINALG_ORDER_AMD
+        w        - workspace
+
+Notes:
+1) The numerical factorization may be repeated for any matrix with the
+same pattern, that is the same arrays A->p and A->i
+*/
+
+int
+gsl_splinalg_cholesky_symbolic(const gsl_spmatrix *A, const int ordering,
+                               gsl_splinalg_cholesky_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix size must match workspace", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("compressed column format required", GSL_EINVAL);
+    }
+  else
+    {
+      const int N = (int) n;
+      const int *Ap = A->p;
+      const int *Ai = A->i;
+      int *Cp = w->Cp;
+      int *pinv = w->pinv;
+      int *parent = w->parent;
+      int *cnt = w->work;
+      int *ancestor = w->work + n;
+      int *mark = w->work + 2 * n;
+      int *Up, *Ui, *Li;
+      int i, j, k, p, q, cnz, lnz;
+      int status;
+
+      cholesky_free_symbolic(w);
+
+      /* fill-reducing ordering */
+      if (ordering == GSL_SPLINALG_ORDER_AMD)
+        {
+          status = gsl_splinalg_amd(A, w->perm);
+          if (status)
+            return status;
+        }
+      else if (ordering == GSL_SPLINALG_ORDER_NATURAL)
+        {
+          gsl_permutation_init(w->perm);
+        }
+      else
+        {
+          GSL_ERROR("unsupported ordering for Cholesky factorization", GSL_EINVAL);
+        }
+
+      for (k = 0; k < N; ++k)
+        pinv[w->perm->data[k]] = k;
+
+      /* C = lower triangle of P A P^T, with the positions of its
+         entries in A */
+      for (k = 0; k < N; ++k)
+        cnt[k] = 0;
+
+      cnz = 0;
+      for (j = 0; j < N; ++j)
+        {
+          for (p = Ap[j]; p < Ap[j + 1]; ++p)
+            {
+              if (Ai[p] >= j)
+                {
+                  cnt[GSL_MIN(pinv[Ai[p]], pinv[j])]++;
+                  ++cnz;
+                }
+            }
+        }
+
+      w->Ci = malloc((cnz + 1) * sizeof(int));
+      w->Cmap = malloc((cnz + 1) * sizeof(int));
+      Up = malloc((N + 1) * sizeof(int));
+      Ui = malloc((cnz + 1) * sizeof(int));
+
+      if (!w->Ci || !w->Cmap || !Up || !Ui)
+        {
+          free(Up);
+          free(Ui);
+          cholesky_free_symbolic(w);
+          GSL_ERROR("failed to allocate space for pattern", GSL_ENOMEM);
+        }
+
+      Cp[0] = 0;
+      for (k = 0; k < N; ++k)
+        {
+          Cp[k + 1] = Cp[k] + cnt[k];
+          cnt[k] = Cp[k];
+        }
+
+      for (j = 0; j < N; ++j)
+        {
+          for (p = Ap[j]; p < Ap[j + 1]; ++p)
+            {
+              if (Ai[p] >= j)
+                {
+                  const int pi = pinv[Ai[p]];
+                  const int pj = pinv[j];
+
+                  q = cnt[GSL_MIN(pi, pj)]++;
+                  w->Ci[q] = GSL_MAX(pi, pj);
+                  w->Cmap[q] = p;
+                }
+            }
+        }
+
+      /* U = C^T, the upper triangle, whose column k is row k of C */
+      for (k = 0; k < N; ++k)
+        cnt[k] = 0;
+
+      for (p = 0; p < cnz; ++p)
+        cnt[w->Ci[p]]++;
+
+      Up[0] = 0;
+      for (k = 0; k < N; ++k)
+        {
+          Up[k + 1] = Up[k] + cnt[k];
+          cnt[k] = Up[k];
+        }
+
+      for (j = 0; j < N; ++j)
+        {
+          for (p = Cp[j]; p < Cp[j + 1]; ++p)
+            Ui[cnt[w->Ci[p]]++] = j;
+        }
+
+      /* elimination tree, using path compression on the ancestors */
+      for (k = 0; k < N; ++k)
+        {
+          parent[k] = -1;
+          ancestor[k] = -1;
+
+          for (p = Up[k]; p < Up[k + 1]; ++p)
+            {
+              int inext;
+
+              for (i = Ui[p]; i != -1 && i < k; i = inext)
+                {
+                  inext = ancestor[i];
+                  ancestor[i] = k;
+                  if (inext == -1)
+                    parent[i] = k;
+                }
+            }
+        }
+
+      /* column counts of L: the pattern of row k of L is the set of
+         nodes reached from the entries of U(:,k) in the elimination
+         tree */
+      for (k = 0; k < N; ++k)
+        {
+          cnt[k] = 1;
+          mark[k] = -1;
+        }
+
+      for (k = 0; k < N; ++k)
+        {
+          mark[k] = k;
+
+          for (p = Up[k]; p < Up[k + 1]; ++p)
+            {
+              for (i = Ui[p]; mark[i] != k; i = parent[i])
+                {
+                  cnt[i]++;
+                  mark[i] = k;
+                }
+            }
+        }
+
+      lnz = 0;
+      for (k = 0; k < N; ++k)
+        lnz += cnt[k];
+
+      w->L = gsl_spmatrix_alloc_nzmax(n, n, (size_t) lnz, GSL_SPMATRIX_CSC);
+      if (!w->L)
+        {
+          free(Up);
+          free(Ui);
+          cholesky_free_symbolic(w);
+          GSL_ERROR("failed to allocate space for L", GSL_ENOMEM);
+        }
+
+      /* pattern of L, with the diagonal first in each column and the
+         other rows in increasing order */
+      Li = w->L->i;
+      w->L->p[0] = 0;
+      for (k = 0; k < N; ++k)
+        {
+          w->L->p[k + 1] = w->L->p[k] + cnt[k];
+          cnt[k] = w->L->p[k];
+          Li[cnt[k]++] = k;
+          mark[k] = -1;
+        }
+
+      for (k = 0; k < N; ++k)
+        {
+          mark[k] = k;
+
+          for (p = Up[k]; p < Up[k + 1]; ++p)
+            {
+              for (i = Ui[p]; mark[i] != k; i = parent[i])
+                {
+                  Li[cnt[i]++] = k;
+                  mark[i] = k;
+                }
+            }
+        }
+
+      w->L->nz = (size_t) lnz;
+      w->nnzA = A->nz;
+
+      free(Up);
+      free(Ui);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_cholesky_numeric()
+  Numerical Cholesky factorization, after the symbolic analysis of
+a matrix with the same pattern
+
+Inputs: A - symmetric positive definite matrix in compressed column
+            format, with the same pattern as in the symbolic analysis
+        w - workspace
+
+Return: GSL_SUCCESS, or GSL_EDOM if A is not positive definite
+*/
+
+int
+gsl_splinalg_cholesky_numeric(const gsl_spmatrix *A,
+                              gsl_splinalg_cholesky_workspace *w)
+{
+  if (w->L == NULL)
+    {
+      GSL_ERROR("symbolic analysis has not been performed", GSL_EINVAL);
+    }
+  else if (A->size1 != w->n || A->size2 != w->n || !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix does not match symbolic analysis", GSL_EBADLEN);
+    }
+  else if (A->nz != w->nnzA)
+    {
+      GSL_ERROR("matrix pattern does not match symbolic analysis", GSL_EINVAL);
+    }
+  else
+    {
+      const int N = (int) w->n;
+      const int *Cp = w->Cp;
+      const int *Ci = w->Ci;
+      const int *Cmap = w->Cmap;
+      const int *Lp = w->L->p;
+      const int *Li = w->L->i;
+      double *Lx = w->L->data;
+      double *x = w->x;
+      int *head = w->work;      /* head[i]: columns j with next row i */
+      int *link = w->work + w->n;
+      int *next = w->work + 2 * w->n; /* next[j]: position of next row of column j */
+      int j, k, p;
+
+      for (k = 0; k < N; ++k)
+        {
+          head[k] = -1;
+          x[k] = 0.0;
+        }
+
+      for (k = 0; k < N; ++k)
+        {
+          double d;
+
+          /* x = C(k:n,k) */
+          for (p = Cp[k]; p < Cp[k + 1]; ++p)
+            x[Ci[p]] += A->data[Cmap[p]];
+
+          /* x -= L(k:n,j) L(k,j) for the columns j with L(k,j) != 0 */
+          for (j = head[k]; j != -1; )
+            {
+              const int jnext = link[j];
+              const int pk = next[j];
+              const double lkj = Lx[pk];
+
+              for (p = pk; p < Lp[j + 1]; ++p)
+                x[Li[p]] -= Lx[p] * lkj;
+
+              /* move column j to the list of its next row */
+              if (++next[j] < Lp[j + 1])
+                {
+                  const int r = Li[next[j]];
+                  link[j] = head[r];
+                  head[r] = j;
+                }
+
+              j = jnext;
+            }
+
+          d = x[k];
+          x[k] = 0.0;
+
+          if (d <= 0.0)
+            {
+              GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+            }
+
+          d = sqrt(d);
+          Lx[Lp[k]] = d;
+
+          for (p = Lp[k] + 1; p < Lp[k + 1]; ++p)
+            {
+              Lx[p] = x[Li[p]] / d;
+              x[Li[p]] = 0.0;
+            }
+
+          next[k] = Lp[k] + 1;
+          if (next[k] < Lp[k + 1])
+            {
+              const int r = Li[next[k]];
+              link[k] = head[r];
+              head[r] = k;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_cholesky_decomp()
+  Symbolic analysis with the approximate minimum degree ordering,
+followed by the numerical factorization
+*/
+
+int
+gsl_splinalg_cholesky_decomp(const gsl_spmatrix *A,
+                             gsl_splinalg_cholesky_workspace *w)
+{
+  int status = gsl_splinalg_cholesky_symbolic(A, GSL_SPLINALG_ORDER_AMD, w);
+
+  if (status)
+    return status;
+
+  return gsl_splinalg_cholesky_numeric(A, w);
+}
+
+int
+gsl_splinalg_cholesky_solve(const gsl_splinalg_cholesky_workspace *w,
+                            const gsl_vector *b, gsl_vector *x)
+{
+  if (b->size != w->n)
+    {
+      GSL_ERROR("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_vector_memcpy(x, b);
+      return gsl_splinalg_cholesky_svx(w, x);
+    }
+}
+
+int
+gsl_splinalg_cholesky_svx(const gsl_splinalg_cholesky_workspace *w,
+                          gsl_vector *x)
+{
+  if (w->L == NULL)
+    {
+      GSL_ERROR("matrix has not been factorized", GSL_EINVAL);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t *perm = w->perm->data;
+      double *y = w->x;
+      size_t k;
+
+      /* y = P x */
+      for (k = 0; k < n; ++k)
+        y[k] = gsl_vector_get(x, perm[k]);
+
+      cholesky_lsolve(w->L, y);
+      cholesky_ltsolve(w->L, y);
+
+      /* x = P^T y */
+      for (k = 0; k < n; ++k)
+        {
+          gsl_vector_set(x, perm[k], y[k]);
+          y[k] = 0.0;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_cholesky_solve_mat()
+  Solve A X = B for several right hand sides; each sweep over L is
+applied to all the columns of B
+
+Inputs: w - workspace containing the factorization
+        B - right hand sides, n-by-nrhs
+        X - (output) solutions, n-by-nrhs; may be the same as B
+*/
+
+int
+gsl_splinalg_cholesky_solve_mat(const gsl_splinalg_cholesky_workspace *w,
+                                const gsl_matrix *B, gsl_matrix *X)
+{
+  if (w->L == NULL)
+    {
+      GSL_ERROR("matrix has not been factorized", GSL_EINVAL);
+    }
+  else if (B->size1 != w->n || X->size1 != w->n)
+    {
+      GSL_ERROR("matrix size must match right hand side size", GSL_EBADLEN);
+    }
+  else if (B->size2 != X->size2)
+    {
+      GSL_ERROR("B and X must have the same number of columns", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t nrhs = B->size2;
+      const size_t *perm = w->perm->data;
+      const int *Lp = w->L->p;
+      const int *Li = w->L->i;
+      const double *Lx = w->L->data;
+      gsl_matrix *Y = gsl_matrix_alloc(n, nrhs);
+      size_t j, k;
+      int p;
+
+      if (Y == NULL)
+        {
+          GSL_ERROR("failed to allocate space for Y", GSL_ENOMEM);
+        }
+
+      /* Y = P B */
+      for (k = 0; k < n; ++k)
+        {
+          gsl_vector_const_view b = gsl_matrix_const_row(B, perm[k]);
+          gsl_vector_view y = gsl_matrix_row(Y, k);
+          gsl_vector_memcpy(&y.vector, &b.vector);
+        }
+
+      /* Y = L^{-1} Y */
+      for (j = 0; j < n; ++j)
+        {
+          double *yj = gsl_matrix_ptr(Y, j, 0);
+          const double ljj = Lx[Lp[j]];
+
+          for (k = 0; k < nrhs; ++k)
+            yj[k] /= ljj;
+
+          for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+            {
+              double *yi = gsl_matrix_ptr(Y, Li[p], 0);
+
+              for (k = 0; k < nrhs; ++k)
+                yi[k] -= Lx[p] * yj[k];
+            }
+        }
+
+      /* Y = L^{-T} Y */
+      for (j = n; j-- > 0; )
+        {
+          double *yj = gsl_matrix_ptr(Y, j, 0);
+
+          for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+            {
+              const double *yi = gsl_matrix_const_ptr(Y, Li[p], 0);
+
+              for (k = 0; k < nrhs; ++k)
+                yj[k] -= Lx[p] * yi[k];
+            }
+
+          for (k = 0; k < nrhs; ++k)
+            yj[k] /= Lx[Lp[j]];
+        }
+
+      /* X = P^T Y */
+      for (k = 0; k < n; ++k)
+        {
+          gsl_vector_view x = gsl_matrix_row(X, perm[k]);
+          gsl_vector_const_view y = gsl_matrix_const_row(Y, k);
+          gsl_vector_memcpy(&x.vector, &y.vector);
+        }
+
+      gsl_matrix_free(Y);
+
+      return GSL_SUCCESS;
+    }
+}
+
+static void
+cholesky_free_symbolic(gsl_splinalg_cholesky_workspace *w)
+{
+  if (w->Ci)
+    free(w->Ci);
+
+  if (w->Cmap)
+    free(w->Cmap);
+
+  if (w->L)
+    gsl_spmatrix_free(w->L);
+
+  w->Ci = NULL;
+  w->Cmap = NULL;
+  w->L = NULL;
+}
+
+/* x := L^{-1} x, with the diagonal first in each column of L */
+static void
+cholesky_lsolve(const gsl_spmatrix *L, double *x)
+{
+  const size_t n = L->size2;
+  const int *Lp = L->p;
+  const int *Li = L->i;
+  const double *Lx = L->data;
+  size_t j;
+  int p;
+
+  for (j = 0; j < n; ++j)
+    {
+      x[j] /= Lx[Lp[j]];
+
+      for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+        x[Li[p]] -= Lx[p] * x[j];
+    }
+}
+
+/* x := L^{-T} x */
+static void
+cholesky_ltsolve(const gsl_spmatrix *L, double *x)
+{
+  const size_t n = L->size2;
+  const int *Lp = L->p;
+  const int *Li = L->i;
+  const double *Lx = L->data;
+  size_t j;
+  int p;
+
+  for (j = n; j-- > 0; )
+    {
+      for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+        x[j] -= Lx[p] * x[Li[p]];
+
+      x[j] /= Lx[Lp[j]];
+    }
+}
@@ -0,0 +1,66 @@
+/* splinalg/common.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* common routines for the iterative solvers */
+
+static int splinalg_matvec(const gsl_linalg_operator *A, const gsl_vector *x,
+                           gsl_vector *y);
+static int splinalg_residual(const gsl_linalg_operator *A,
+                             const gsl_vector *b, const gsl_vector *x,
+                             gsl_vector *r);
+static int splinalg_precond(const gsl_splinalg_precond *P,
+                            const gsl_vector *r, gsl_vector *z);
+
+/* compute y = A x */
+static int
+splinalg_matvec(const gsl_linalg_operator *A, const gsl_vector *x,
+                gsl_vector *y)
+{
+  /* view x and y as single column matrices, whatever their stride */
+  gsl_matrix_const_view X =
+    gsl_matrix_const_view_array_with_tda(x->data, x->size, 1, x->stride);
+  gsl_matrix_view Y =
+    gsl_matrix_view_array_with_tda(y->data, y->size, 1, y->stride);
+
+  return A->mult(CblasNoTrans, &X.matrix, &Y.matrix, A->params);
+}
+
+/* compute r = b - A x */
+static int
+splinalg_residual(const gsl_linalg_operator *A, const gsl_vector *b,
+                  const gsl_vector *x, gsl_vector *r)
+{
+  int status = splinalg_matvec(A, x, r);
+
+  if (status)
+    return status;
+
+  return gsl_vector_axpby(1.0, b, -1.0, r);
+}
+
+/* compute z = M^{-1} r, or z = r without preconditioner */
+static int
+splinalg_precond(const gsl_splinalg_precond *P, const gsl_vector *r,
+                 gsl_vector *z)
+{
+  if (P)
+    return gsl_splinalg_precond_apply(r, z, P);
+  else
+    return gsl_vector_memcpy(z, r);
+}
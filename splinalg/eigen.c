@@ -0,0 +1,755 @@
+/* eigen.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_complex_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Thick restart Krylov eigensolver for a few extremal eigenpairs
+ * of a large sparse or implicit operator A. An orthonormal basis
+ * V = [v_1,...,v_m] of a Krylov subspace is built, with full
+ * reorthogonalization, so that
+ *
+ *   A V_m = V_m H_m + v_{m+1} h^T
+ *
+ * The Ritz pairs (theta, V_m s) of H_m approximate eigenpairs of A
+ * with residual norm |h^T s|. For symmetric A this is the Lanczos
+ * method and H_m is tridiagonal, apart from the restarted block.
+ * When the wanted Ritz pairs have not converged, the basis is
+ * compressed to an orthonormal basis Q of the invariant subspace
+ * of H_m belonging to the p best Ritz values, V_p <- V_m Q, which
+ * preserves the form of the relation above, and the subspace is
+ * expanded again.
+ *
+ * [1] K. Wu and H. Simon, Thick-restart Lanczos method for large
+ *     symmetric eigenvalue problems, SIAM J. Matrix Anal. Appl.
+ *     22(2), 2000.
+ *
+ * [2] G. W. Stewart, A Krylov-Schur algorithm for large
+ *     eigenproblems, SIAM J. Matrix Anal. Appl. 23(3), 2001.
+ */
+
+/* number of columns of V updated at once in a restart */
+#define EIGEN_BLOCK     256
+
+static int eigen_krylov(const gsl_linalg_operator *A, const int symm,
+                        const int which, gsl_splinalg_eigen_workspace *w);
+
+gsl_splinalg_eigen_workspace *
+gsl_splinalg_eigen_alloc(const size_t n, const size_t k, const size_t m)
+{
+  gsl_splinalg_eigen_workspace *w;
+  size_t mm;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+  else if (k == 0 || k > n)
+    {
+      GSL_ERROR_NULL("number of eigenvalues k must be between 1 and n",
+                     GSL_EINVAL);
+    }
+
+  if (m == 0)
+    mm = GSL_MIN(n, GSL_MAX(2 * k + 1, 20));
+  else
+    mm = GSL_MIN(n, m);
+
+  if (mm < n && mm < k + 2)
+    {
+      GSL_ERROR_NULL("subspace dimension m must be at least k + 2",
+                     GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_eigen_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+  w->k = k;
+  w->m = mm;
+  w->tol = 1.0e-10;
+  w->max_restarts = 1000;
+
+  w->V = gsl_matrix_alloc(mm + 1, n);
+  w->H = gsl_matrix_alloc(mm + 1, mm);
+  w->work = gsl_matrix_alloc(mm, GSL_MIN(n, EIGEN_BLOCK));
+  if (!w->V || !w->H || !w->work)
+    {
+      gsl_splinalg_eigen_free(w);
+      GSL_ERROR_NULL("failed to allocate Krylov basis", GSL_ENOMEM);
+    }
+
+  w->Hm = gsl_matrix_alloc(mm, mm);
+  w->Q = gsl_matrix_alloc(mm, mm);
+  w->S = gsl_matrix_alloc(mm, mm);
+  w->theta = gsl_vector_alloc(mm);
+  w->Sc = gsl_matrix_complex_alloc(mm, mm);
+  w->thetac = gsl_vector_complex_alloc(mm);
+  w->h = gsl_vector_alloc(mm + 1);
+  w->resid = gsl_vector_alloc(mm);
+  w->idx = malloc(mm * sizeof(size_t));
+  if (!w->Hm || !w->Q || !w->S || !w->theta || !w->Sc || !w->thetac ||
+      !w->h || !w->resid || !w->idx)
+    {
+      gsl_splinalg_eigen_free(w);
+      GSL_ERROR_NULL("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->symmv_p = gsl_eigen_symmv_alloc(mm);
+  w->nonsymmv_p = gsl_eigen_nonsymmv_alloc(mm);
+  if (!w->symmv_p || !w->nonsymmv_p)
+    {
+      gsl_splinalg_eigen_free(w);
+      GSL_ERROR_NULL("failed to allocate eigen workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_splinalg_eigen_free(gsl_splinalg_eigen_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->V)
+    gsl_matrix_free(w->V);
+
+  if (w->H)
+    gsl_matrix_free(w->H);
+
+  if (w->work)
+    gsl_matrix_free(w->work);
+
+  if (w->Hm)
+    gsl_matrix_free(w->Hm);
+
+  if (w->Q)
+    gsl_matrix_free(w->Q);
+
+  if (w->S)
+    gsl_matrix_free(w->S);
+
+  if (w->theta)
+    gsl_vector_free(w->theta);
+
+  if (w->Sc)
+    gsl_matrix_complex_free(w->Sc);
+
+  if (w->thetac)
+    gsl_vector_complex_free(w->thetac);
+
+  if (w->h)
+    gsl_vector_free(w->h);
+
+  if (w->resid)
+    gsl_vector_free(w->resid);
+
+  if (w->idx)
+    free(w->idx);
+
+  if (w->symmv_p)
+    gsl_eigen_symmv_free(w->symmv_p);
+
+  if (w->nonsymmv_p)
+    gsl_eigen_nonsymmv_free(w->nonsymmv_p);
+
+  free(w);
+}
+
+/*
+gsl_splinalg_eigen_params()
+  Set the convergence parameters of the eigensolver
+
+Inputs: tol          - a Ritz pair (theta, x) is accepted when
+                       ||A x - theta x|| <= tol * max(|theta|, eps^{2/3});
+                       the default is 1e-10
+        max_restarts - maximum number of restarts, default 1000
+        w            - workspace
+*/
+
+int
+gsl_splinalg_eigen_params(const double tol, const size_t max_restarts,
+                          gsl_splinalg_eigen_workspace *w)
+{
+  if (tol <= 0.0)
+    {
+      GSL_ERROR("tolerance must be positive", GSL_EINVAL);
+    }
+
+  w->tol = tol;
+  w->max_restarts = max_restarts;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_splinalg_eigen_symmv(const gsl_spmatrix *A, const int which,
+                         gsl_vector *eval, gsl_matrix *evec,
+                         gsl_splinalg_eigen_workspace *w)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return gsl_splinalg_eigen_symmv_op(&op, which, eval, evec, w);
+}
+
+/*
+gsl_splinalg_eigen_symmv_op()
+  Compute k eigenvalues and eigenvectors of a symmetric operator
+
+Inputs: A     - symmetric linear operator, n-by-n
+        which - which eigenvalues to compute, GSL_SPLINALG_EIGEN_xxx
+        eval  - (output) eigenvalues, length k
+        evec  - (output) eigenvectors in the columns, n-by-k;
+                may be NULL
+        w     - workspace
+
+Return: GSL_SUCCESS, or GSL_EMAXITER if not all k eigenpairs
+converged within the maximum number of restarts; eval and evec
+then contain the current approximations and w->nconv the number
+of converged pairs
+*/
+
+int
+gsl_splinalg_eigen_symmv_op(const gsl_linalg_operator *A, const int which,
+                            gsl_vector *eval, gsl_matrix *evec,
+                            gsl_splinalg_eigen_workspace *w)
+{
+  if (eval->size != w->k)
+    {
+      GSL_ERROR("eval vector must have length k", GSL_EBADLEN);
+    }
+  else if (evec != NULL && (evec->size1 != w->n || evec->size2 != w->k))
+    {
+      GSL_ERROR("evec matrix must be n-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t m = w->m;
+      gsl_matrix_const_view Vm =
+        gsl_matrix_const_submatrix(w->V, 0, 0, m, w->n);
+      int status = eigen_krylov(A, 1, which, w);
+      size_t i;
+
+      if (status && status != GSL_EMAXITER)
+        return status;
+
+      for (i = 0; i < w->k; ++i)
+        {
+          const size_t j = w->idx[i];
+
+          gsl_vector_set(eval, i, gsl_vector_get(w->theta, j));
+
+          if (evec != NULL)
+            {
+              /* x = V_m s */
+              gsl_vector_const_view s = gsl_matrix_const_column(w->S, j);
+              gsl_vector_view x = gsl_matrix_column(evec, i);
+
+              gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &s.vector,
+                             0.0, &x.vector);
+            }
+        }
+
+      if (status)
+        {
+          GSL_ERROR("not all eigenvalues converged", GSL_EMAXITER);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_splinalg_eigen_nonsymmv(const gsl_spmatrix *A, const int which,
+                            gsl_vector_complex *eval,
+                            gsl_matrix_complex *evec,
+                            gsl_splinalg_eigen_workspace *w)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return gsl_splinalg_eigen_nonsymmv_op(&op, which, eval, evec, w);
+}
+
+/*
+gsl_splinalg_eigen_nonsymmv_op()
+  Compute k eigenvalues and eigenvectors of a general operator
+
+Inputs: A     - linear operator, n-by-n
+        which - which eigenvalues to compute, GSL_SPLINALG_EIGEN_xxx
+        eval  - (output) eigenvalues, length k
+        evec  - (output) eigenvectors in the columns, n-by-k;
+                may be NULL
+        w     - workspace
+
+Return: see gsl_splinalg_eigen_symmv_op()
+*/
+
+int
+gsl_splinalg_eigen_nonsymmv_op(const gsl_linalg_operator *A, const int which,
+                               gsl_vector_complex *eval,
+                               gsl_matrix_complex *evec,
+                               gsl_splinalg_eigen_workspace *w)
+{
+  if (eval->size != w->k)
+    {
+      GSL_ERROR("eval vector must have length k", GSL_EBADLEN);
+    }
+  else if (evec != NULL && (evec->size1 != w->n || evec->size2 != w->k))
+    {
+      GSL_ERROR("evec matrix must be n-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t m = w->m;
+      gsl_matrix_const_view Vm =
+        gsl_matrix_const_submatrix(w->V, 0, 0, m, w->n);
+      int status = eigen_krylov(A, 0, which, w);
+      size_t i;
+
+      if (status && status != GSL_EMAXITER)
+        return status;
+
+      for (i = 0; i < w->k; ++i)
+        {
+          const size_t j = w->idx[i];
+
+          gsl_vector_complex_set(eval, i, gsl_vector_complex_get(w->thetac, j));
+
+          if (evec != NULL)
+            {
+              /* x = V_m s, real and imaginary parts */
+              gsl_vector_complex_view s = gsl_matrix_complex_column(w->Sc, j);
+              gsl_vector_complex_view x = gsl_matrix_complex_column(evec, i);
+              gsl_vector_view sr = gsl_vector_complex_real(&s.vector);
+              gsl_vector_view si = gsl_vector_complex_imag(&s.vector);
+              gsl_vector_view xr = gsl_vector_complex_real(&x.vector);
+              gsl_vector_view xi = gsl_vector_complex_imag(&x.vector);
+
+              gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &sr.vector,
+                             0.0, &xr.vector);
+              gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &si.vector,
+                             0.0, &xi.vector);
+            }
+        }
+
+      if (status)
+        {
+          GSL_ERROR("not all eigenvalues converged", GSL_EMAXITER);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* deterministic starting vector with no special structure */
+static void
+eigen_start(gsl_vector *v, const size_t seed)
+{
+  size_t i;
+
+  for (i = 0; i < v->size; ++i)
+    gsl_vector_set(v, i, sin((i + 1.0) * (seed + 1.0) + seed));
+}
+
+/*
+eigen_orth()
+  Orthogonalize v against the rows 0..j-1 of V with two passes of
+classical Gram-Schmidt; the coefficients are added to c (which may
+be NULL)
+*/
+
+static void
+eigen_orth(const gsl_matrix *V, const size_t j, gsl_vector *v,
+           gsl_vector *c, gsl_vector *work)
+{
+  gsl_matrix_const_view Vj = gsl_matrix_const_submatrix(V, 0, 0, j, V->size2);
+  gsl_vector_view h = gsl_vector_subvector(work, 0, j);
+  size_t pass;
+
+  for (pass = 0; pass < 2; ++pass)
+    {
+      gsl_blas_dgemv(CblasNoTrans, 1.0, &Vj.matrix, v, 0.0, &h.vector);
+      gsl_blas_dgemv(CblasTrans, -1.0, &Vj.matrix, &h.vector, 1.0, v);
+
+      if (c != NULL)
+        gsl_vector_add(c, &h.vector);
+    }
+}
+
+/* return 1 if Ritz value a is preferred to b */
+static int
+eigen_before(const int which, const gsl_complex a, const gsl_complex b)
+{
+  double ka, kb;
+
+  if (which == GSL_SPLINALG_EIGEN_LARGEST_MAG)
+    {
+      ka = -gsl_complex_abs(a);
+      kb = -gsl_complex_abs(b);
+    }
+  else if (which == GSL_SPLINALG_EIGEN_LARGEST_REAL)
+    {
+      ka = -GSL_REAL(a);
+      kb = -GSL_REAL(b);
+    }
+  else
+    {
+      ka = GSL_REAL(a);
+      kb = GSL_REAL(b);
+    }
+
+  /* keep complex conjugate pairs together, positive imaginary first */
+  if (ka != kb)
+    return ka < kb;
+  else
+    return GSL_IMAG(a) > GSL_IMAG(b);
+}
+
+/*
+eigen_ritz()
+  Compute the Ritz pairs of H_m = H(0:m-1,0:m-1), their residual
+norms |H(m,m-1) s(m-1)| and their order of preference in w->idx
+*/
+
+static int
+eigen_ritz(const int symm, const int which, gsl_splinalg_eigen_workspace *w)
+{
+  const size_t m = w->m;
+  const double beta = fabs(gsl_matrix_get(w->H, m, m - 1));
+  gsl_matrix_const_view Hm = gsl_matrix_const_submatrix(w->H, 0, 0, m, m);
+  size_t i, j;
+  int status;
+
+  gsl_matrix_memcpy(w->Hm, &Hm.matrix);
+
+  if (symm)
+    {
+      /* symmetrize to remove rounding errors */
+      for (i = 0; i < m; ++i)
+        {
+          for (j = 0; j < i; ++j)
+            {
+              double hij = 0.5 * (gsl_matrix_get(w->Hm, i, j) +
+                                  gsl_matrix_get(w->Hm, j, i));
+              gsl_matrix_set(w->Hm, i, j, hij);
+              gsl_matrix_set(w->Hm, j, i, hij);
+            }
+        }
+
+      status = gsl_eigen_symmv(w->Hm, w->theta, w->S, w->symmv_p);
+      if (status)
+        return status;
+
+      for (i = 0; i < m; ++i)
+        {
+          double ti = gsl_vector_get(w->theta, i);
+          double si = gsl_matrix_get(w->S, m - 1, i);
+
+          gsl_vector_complex_set(w->thetac, i, gsl_complex_rect(ti, 0.0));
+          gsl_vector_set(w->resid, i, beta * fabs(si));
+        }
+    }
+  else
+    {
+      status = gsl_eigen_nonsymmv(w->Hm, w->thetac, w->Sc, w->nonsymmv_p);
+      if (status)
+        return status;
+
+      for (i = 0; i < m; ++i)
+        {
+          gsl_complex z = gsl_matrix_complex_get(w->Sc, m - 1, i);
+          gsl_vector_set(w->resid, i, beta * gsl_complex_abs(z));
+        }
+    }
+
+  /* insertion sort of the Ritz values */
+  for (i = 0; i < m; ++i)
+    {
+      gsl_complex ti = gsl_vector_complex_get(w->thetac, i);
+
+      for (j = i; j > 0; --j)
+        {
+          gsl_complex tj = gsl_vector_complex_get(w->thetac, w->idx[j - 1]);
+
+          if (!eigen_before(which, ti, tj))
+            break;
+
+          w->idx[j] = w->idx[j - 1];
+        }
+
+      w->idx[j] = i;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+eigen_restart()
+  Compress the Krylov relation to the p preferred Ritz pairs:
+Q is an orthonormal basis of their invariant subspace of H_m,
+
+  V_p <- V_m Q, v_{p+1} <- v_{m+1}
+  H_p <- Q^T H_m Q, H(p,:) <- H(m,m-1) Q(m-1,:)
+*/
+
+static void
+eigen_restart(const int symm, const size_t p, gsl_splinalg_eigen_workspace *w)
+{
+  const size_t n = w->n;
+  const size_t m = w->m;
+  const size_t nb = w->work->size2;
+  const double beta = gsl_matrix_get(w->H, m, m - 1);
+  gsl_matrix_view Q = gsl_matrix_submatrix(w->Q, 0, 0, m, p);
+  gsl_matrix_view Hm = gsl_matrix_submatrix(w->H, 0, 0, m, m);
+  gsl_matrix_view HQ = gsl_matrix_submatrix(w->Hm, 0, 0, m, p);
+  gsl_matrix_view T = gsl_matrix_submatrix(w->S, 0, 0, p, p);
+  gsl_vector_view vm = gsl_matrix_row(w->V, m);
+  gsl_vector_view vp = gsl_matrix_row(w->V, p);
+  size_t c, j;
+
+  for (c = 0; c < p; ++c)
+    {
+      const size_t i = w->idx[c];
+      gsl_vector_view qc = gsl_matrix_column(&Q.matrix, c);
+
+      if (symm)
+        {
+          gsl_vector_const_view s = gsl_matrix_const_column(w->S, i);
+          gsl_vector_memcpy(&qc.vector, &s.vector);
+        }
+      else
+        {
+          /* a conjugate pair contributes the real and imaginary parts
+           * of its eigenvector */
+          gsl_vector_complex_const_view s =
+            gsl_matrix_complex_const_column(w->Sc, i);
+          gsl_vector_const_view part =
+            (GSL_IMAG(gsl_vector_complex_get(w->thetac, i)) >= 0.0) ?
+            gsl_vector_complex_const_real(&s.vector) :
+            gsl_vector_complex_const_imag(&s.vector);
+          size_t pass;
+          double norm;
+
+          gsl_vector_memcpy(&qc.vector, &part.vector);
+
+          /* modified Gram-Schmidt, twice */
+          for (pass = 0; pass < 2; ++pass)
+            {
+              for (j = 0; j < c; ++j)
+                {
+                  gsl_vector_view qj = gsl_matrix_column(&Q.matrix, j);
+                  double d;
+
+                  gsl_blas_ddot(&qj.vector, &qc.vector, &d);
+                  gsl_blas_daxpy(-d, &qj.vector, &qc.vector);
+                }
+            }
+
+          norm = gsl_blas_dnrm2(&qc.vector);
+          gsl_vector_scale(&qc.vector, 1.0 / norm);
+        }
+    }
+
+  /* V_p = V_m Q, by blocks of columns */
+  for (c = 0; c < n; c += nb)
+    {
+      const size_t nc = GSL_MIN(nb, n - c);
+      gsl_matrix_view Vb = gsl_matrix_submatrix(w->V, 0, c, m, nc);
+      gsl_matrix_view Wb = gsl_matrix_submatrix(w->work, 0, 0, p, nc);
+      gsl_matrix_view Vp = gsl_matrix_submatrix(w->V, 0, c, p, nc);
+
+      gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &Q.matrix, &Vb.matrix,
+                     0.0, &Wb.matrix);
+      gsl_matrix_memcpy(&Vp.matrix, &Wb.matrix);
+    }
+
+  gsl_vector_memcpy(&vp.vector, &vm.vector);
+
+  /* T = Q^T H_m Q */
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &Hm.matrix, &Q.matrix,
+                 0.0, &HQ.matrix);
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &Q.matrix, &HQ.matrix,
+                 0.0, &T.matrix);
+
+  gsl_matrix_set_zero(w->H);
+
+  {
+    gsl_matrix_view Hp = gsl_matrix_submatrix(w->H, 0, 0, p, p);
+    gsl_matrix_memcpy(&Hp.matrix, &T.matrix);
+  }
+
+  for (c = 0; c < p; ++c)
+    gsl_matrix_set(w->H, p, c, beta * gsl_matrix_get(&Q.matrix, m - 1, c));
+}
+
+/*
+eigen_krylov()
+  Run the thick restart Krylov method until the k preferred Ritz
+pairs have converged
+
+Return: GSL_SUCCESS, GSL_EMAXITER if the maximum number of restarts
+was reached, or an error code from the operator
+*/
+
+static int
+eigen_krylov(const gsl_linalg_operator *A, const int symm, const int which,
+             gsl_splinalg_eigen_workspace *w)
+{
+  const size_t n = w->n;
+  const size_t m = w->m;
+  const size_t k = w->k;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else if (which != GSL_SPLINALG_EIGEN_LARGEST_MAG &&
+           which != GSL_SPLINALG_EIGEN_LARGEST_REAL &&
+           which != GSL_SPLINALG_EIGEN_SMALLEST_REAL)
+    {
+      GSL_ERROR("invalid eigenvalue selection", GSL_EINVAL);
+    }
+  else
+    {
+      const double eps23 = pow(GSL_DBL_EPSILON, 2.0 / 3.0);
+      size_t j0 = 0;        /* first new column of H in this cycle */
+      size_t nseed = 1;     /* seed of next replacement vector */
+      int status;
+
+      w->nrestarts = 0;
+      w->nmult = 0;
+      w->nconv = 0;
+
+      gsl_matrix_set_zero(w->H);
+
+      {
+        gsl_vector_view v0 = gsl_matrix_row(w->V, 0);
+        eigen_start(&v0.vector, 0);
+        gsl_vector_scale(&v0.vector, 1.0 / gsl_blas_dnrm2(&v0.vector));
+      }
+
+      while (1)
+        {
+          size_t i, j, p;
+
+          /* expand the Krylov subspace to dimension m */
+          for (j = j0; j < m; ++j)
+            {
+              gsl_vector_view vj = gsl_matrix_row(w->V, j);
+              gsl_vector_view v = gsl_matrix_row(w->V, j + 1);
+              gsl_vector_view hj = gsl_matrix_subcolumn(w->H, j, 0, j + 1);
+              gsl_matrix_const_view X =
+                gsl_matrix_const_view_vector(&vj.vector, n, 1);
+              gsl_matrix_view Y = gsl_matrix_view_vector(&v.vector, n, 1);
+              double normv, beta;
+
+              /* v = A v_j */
+              status = A->mult(CblasNoTrans, &X.matrix, &Y.matrix, A->params);
+              if (status)
+                return status;
+
+              ++(w->nmult);
+
+              normv = gsl_blas_dnrm2(&v.vector);
+              eigen_orth(w->V, j + 1, &v.vector, &hj.vector, w->h);
+              beta = gsl_blas_dnrm2(&v.vector);
+
+              if (beta > GSL_DBL_EPSILON * normv)
+                {
+                  gsl_matrix_set(w->H, j + 1, j, beta);
+                  gsl_vector_scale(&v.vector, 1.0 / beta);
+                }
+              else if (j + 1 < n)
+                {
+                  /* invariant subspace found: continue with a new
+                   * vector orthogonal to the current basis */
+                  eigen_start(&v.vector, nseed++);
+                  eigen_orth(w->V, j + 1, &v.vector, NULL, w->h);
+                  gsl_vector_scale(&v.vector, 1.0 / gsl_blas_dnrm2(&v.vector));
+                }
+              else
+                {
+                  gsl_vector_set_zero(&v.vector);
+                }
+            }
+
+          status = eigen_ritz(symm, which, w);
+          if (status)
+            return status;
+
+          /* count converged wanted Ritz pairs */
+          w->nconv = 0;
+          for (i = 0; i < k; ++i)
+            {
+              const size_t ii = w->idx[i];
+              gsl_complex theta = gsl_vector_complex_get(w->thetac, ii);
+              double scale = GSL_MAX(gsl_complex_abs(theta), eps23);
+
+              if (gsl_vector_get(w->resid, ii) <= w->tol * scale)
+                ++(w->nconv);
+            }
+
+          if (w->nconv == k)
+            return GSL_SUCCESS;
+          else if (w->nrestarts >= w->max_restarts)
+            return GSL_EMAXITER;
+
+          /* keep p Ritz pairs, without splitting a conjugate pair */
+          p = GSL_MIN((m + k) / 2, m - 1);
+          if (!symm &&
+              GSL_IMAG(gsl_vector_complex_get(w->thetac, w->idx[p - 1])) > 0.0)
+            {
+              if (p + 1 < m)
+                ++p;
+              else
+                --p;
+            }
+
+          eigen_restart(symm, p, w);
+
+          j0 = p;
+          ++(w->nrestarts);
+        }
+    }
+}
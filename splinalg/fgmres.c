@@ -0,0 +1,379 @@
+/* fgmres.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "methods.h"
+#include "common.c"
+
+/*
+ * Flexible GMRES with right preconditioning (Saad, algorithm 9.6).
+ * The Arnoldi basis is built with modified Gram-Schmidt and the
+ * preconditioned vectors z_j = M^{-1} v_j are stored, so the
+ * preconditioner may change from one step to the next. Each call
+ * to iterate() performs one cycle of at most m steps; calling it
+ * again restarts the method from the current solution.
+ *
+ * [1] Y. Saad, A flexible inner-outer preconditioned GMRES
+ *     algorithm, SIAM J. Sci. Comput. 14(2), 1993.
+ *
+ * [2] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t m;        /* restart length */
+  gsl_matrix *V;   /* Arnoldi basis v_1,...,v_{m+1}, stored by rows */
+  gsl_matrix *Z;   /* preconditioned basis z_1,...,z_m, stored by rows */
+  gsl_matrix *H;   /* Hessenberg matrix (m+1)-by-m, reduced to R_m */
+  gsl_vector *g;   /* least squares rhs and solution vector */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+
+  double *c;       /* Givens rotations */
+  double *s;
+
+  const gsl_splinalg_precond *precond; /* preconditioner, or NULL */
+
+  double normr;    /* residual norm ||r|| */
+} fgmres_state_t;
+
+static void fgmres_free(void *vstate);
+
+/*
+fgmres_alloc()
+  Allocate a FGMRES workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - restart length, ie: the number of steps performed
+            by each call to gsl_splinalg_itersolve_iterate(); if
+            this parameter is 0, the value GSL_MIN(n,10) is used
+
+Return: pointer to workspace
+*/
+
+static void *
+fgmres_alloc(const size_t n, const size_t m)
+{
+  fgmres_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(fgmres_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate fgmres state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  if (m == 0)
+    state->m = GSL_MIN(n, 10);
+  else
+    state->m = GSL_MIN(n, m);
+
+  state->V = gsl_matrix_alloc(state->m + 1, n);
+  state->Z = gsl_matrix_alloc(state->m, n);
+  if (!state->V || !state->Z)
+    {
+      fgmres_free(state);
+      GSL_ERROR_NULL("failed to allocate Krylov basis", GSL_ENOMEM);
+    }
+
+  state->H = gsl_matrix_alloc(state->m + 1, state->m);
+  if (!state->H)
+    {
+      fgmres_free(state);
+      GSL_ERROR_NULL("failed to allocate H matrix", GSL_ENOMEM);
+    }
+
+  state->g = gsl_vector_alloc(state->m + 1);
+  state->r = gsl_vector_alloc(n);
+  if (!state->g || !state->r)
+    {
+      fgmres_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->c = malloc(state->m * sizeof(double));
+  state->s = malloc(state->m * sizeof(double));
+  if (!state->c || !state->s)
+    {
+      fgmres_free(state);
+      GSL_ERROR_NULL("failed to allocate Givens vectors", GSL_ENOMEM);
+    }
+
+  state->precond = NULL;
+  state->normr = 0.0;
+
+  return state;
+}
+
+static void
+fgmres_free(void *vstate)
+{
+  fgmres_state_t *state = (fgmres_state_t *) vstate;
+
+  if (state->V)
+    gsl_matrix_free(state->V);
+
+  if (state->Z)
+    gsl_matrix_free(state->Z);
+
+  if (state->H)
+    gsl_matrix_free(state->H);
+
+  if (state->g)
+    gsl_vector_free(state->g);
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->c)
+    free(state->c);
+
+  if (state->s)
+    free(state->s);
+
+  free(state);
+}
+
+/*
+fgmres_iterate_op()
+  Solve A*x = b using one cycle of the FGMRES algorithm
+
+Inputs: A    - square linear operator
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||; GSL_CONTINUE if not
+yet converged, in which case calling this function again with the
+current x restarts the method
+*/
+
+static int
+fgmres_iterate_op(const gsl_linalg_operator *A, const gsl_vector *b,
+                  const double tol, gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  fgmres_state_t *state = (fgmres_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double reltol = tol * gsl_blas_dnrm2(b); /* tol*||b|| */
+      gsl_matrix *H = state->H;
+      gsl_vector *g = state->g;
+      gsl_vector *r = state->r;
+      double normr;
+      size_t j, k = 0;
+      int status;
+
+      /* r = b - A*x_0 */
+      status = splinalg_residual(A, b, x, r);
+      if (status)
+        return status;
+      normr = gsl_blas_dnrm2(r);
+
+      if (normr > reltol)
+        {
+          gsl_vector_view v0 = gsl_matrix_row(state->V, 0);
+          gsl_matrix_view Rk;
+          gsl_vector_view gk;
+
+          /* v_1 = r / ||r||, g = ||r|| e_1 */
+          gsl_vector_memcpy(&v0.vector, r);
+          gsl_vector_scale(&v0.vector, 1.0 / normr);
+          gsl_vector_set_zero(g);
+          gsl_vector_set(g, 0, normr);
+          gsl_matrix_set_zero(H);
+
+          for (j = 0; j < state->m; ++j)
+            {
+              gsl_vector_view vj = gsl_matrix_row(state->V, j);
+              gsl_vector_view zj = gsl_matrix_row(state->Z, j);
+              gsl_vector_view w = gsl_matrix_row(state->V, j + 1);
+              gsl_vector_view hj = gsl_matrix_column(H, j);
+              double hjj, c, s;
+              size_t i;
+
+              /* z_j = M^{-1} v_j, w = A z_j */
+              status = splinalg_precond(state->precond, &vj.vector,
+                                        &zj.vector);
+              if (status)
+                return status;
+
+              status = splinalg_matvec(A, &zj.vector, &w.vector);
+              if (status)
+                return status;
+
+              /* modified Gram-Schmidt */
+              for (i = 0; i <= j; ++i)
+                {
+                  gsl_vector_view vi = gsl_matrix_row(state->V, i);
+                  double hij;
+
+                  gsl_blas_ddot(&w.vector, &vi.vector, &hij);
+                  gsl_blas_daxpy(-hij, &vi.vector, &w.vector);
+                  gsl_matrix_set(H, i, j, hij);
+                }
+
+              hjj = gsl_blas_dnrm2(&w.vector);
+              gsl_matrix_set(H, j + 1, j, hjj);
+
+              if (hjj != 0.0)
+                gsl_vector_scale(&w.vector, 1.0 / hjj);
+
+              /* apply previous rotations to column j of H */
+              for (i = 0; i < j; ++i)
+                {
+                  gsl_linalg_givens_gv(&hj.vector, i, i + 1,
+                                       state->c[i], state->s[i]);
+                }
+
+              /* rotation to eliminate H(j+1,j) */
+              gsl_linalg_givens(gsl_matrix_get(H, j, j), hjj, &c, &s);
+              state->c[j] = c;
+              state->s[j] = s;
+
+              gsl_linalg_givens_gv(&hj.vector, j, j + 1, c, s);
+              gsl_linalg_givens_gv(g, j, j + 1, c, s);
+
+              k = j + 1;
+
+              /* |g_{j+1}| is the residual norm of the current iterate */
+              normr = fabs(gsl_vector_get(g, j + 1));
+              if (normr <= reltol || hjj == 0.0)
+                break;
+            }
+
+          /* solve R_k y = g(1:k) and set x = x + Z_k y */
+          Rk = gsl_matrix_submatrix(H, 0, 0, k, k);
+          gk = gsl_vector_subvector(g, 0, k);
+          gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit,
+                         &Rk.matrix, &gk.vector);
+
+          for (j = 0; j < k; ++j)
+            {
+              gsl_vector_view zj = gsl_matrix_row(state->Z, j);
+              gsl_blas_daxpy(gsl_vector_get(g, j), &zj.vector, x);
+            }
+
+          /* compute true residual r = b - A*x */
+          status = splinalg_residual(A, b, x, r);
+          if (status)
+            return status;
+          normr = gsl_blas_dnrm2(r);
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+}
+
+/* solve A*x = b for a sparse matrix A */
+static int
+fgmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+               const double tol, gsl_vector *x, void *vstate)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return fgmres_iterate_op(&op, b, tol, x, vstate);
+}
+
+static double
+fgmres_normr(const void *vstate)
+{
+  const fgmres_state_t *state = (const fgmres_state_t *) vstate;
+  return state->normr;
+}
+
+static int
+fgmres_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  fgmres_state_t *state = (fgmres_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->precond = P;
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_splinalg_itersolve_type fgmres_type =
+{
+  "fgmres",
+  &fgmres_alloc,
+  &fgmres_iterate,
+  &fgmres_normr,
+  &fgmres_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_fgmres =
+  &fgmres_type;
+
+const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_fgmres_methods =
+{
+  &fgmres_type,
+  &fgmres_set_precond,
+  &fgmres_iterate_op
+};
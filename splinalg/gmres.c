@@ -28,6 +28,9 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
 
+#include "methods.h"
+#include "common.c"
+
 /*
  * The code in this module is based on the Householder GMRES
  * algorithm described in
@@ -48,10 +51,13 @@ typedef struct
   gsl_matrix *H;   /* Hessenberg matrix n-by-(m+1) */
   gsl_vector *tau; /* householder scalars */
   gsl_vector *y;   /* least squares rhs and solution vector */
+  gsl_vector *z;   /* preconditioned vector M^{-1} v */
 
   double *c;       /* Givens rotations */
   double *s;
 
+  const gsl_splinalg_precond *precond; /* preconditioner, or NULL */
+
   double normr;    /* residual norm ||r|| */
 } gmres_state_t;
 
@@ -124,6 +130,13 @@ gmres_alloc(const size_t n, const size_t m)
       GSL_ERROR_NULL("failed to allocate y vector", GSL_ENOMEM);
     }
 
+  state->z = gsl_vector_alloc(n);
+  if (!state->z)
+    {
+      gmres_free(state);
+      GSL_ERROR_NULL("failed to allocate z vector", GSL_ENOMEM);
+    }
+
   state->c = malloc(state->m * sizeof(double));
   state->s = malloc(state->m * sizeof(double));
   if (!state->c || !state->s)
@@ -132,6 +145,7 @@ gmres_alloc(const size_t n, const size_t m)
       GSL_ERROR_NULL("failed to allocate Givens vectors", GSL_ENOMEM);
     }
 
+  state->precond = NULL;
   state->normr = 0.0;
 
   return state;
@@ -154,6 +168,9 @@ gmres_free(void *vstate)
   if (state->y)
     gsl_vector_free(state->y);
 
+  if (state->z)
+    gsl_vector_free(state->z);
+
   if (state->c)
     free(state->c);
 
@@ -164,10 +181,10 @@ gmres_free(void *vstate)
 } /* gmres_free() */
 
 /*
-gmres_iterate()
+gmres_iterate_op()
   Solve A*x = b using GMRES algorithm
 
-Inputs: A    - sparse square matrix
+Inputs: A    - square linear operator
         b    - right hand side vector
         tol  - stopping tolerance (see below)
         x    - (input/output) on input, initial estimate x_0;
@@ -189,12 +206,14 @@ Notes:
 (Saad, 2003 [2])
 
 2) On output, work->normr contains ||b - A*x||
+
+3) If a preconditioner M has been set, the method is applied to
+the right preconditioned system A M^{-1} u = b, x = M^{-1} u
 */
 
 static int
-gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
-              const double tol, gsl_vector *x,
-              void *vstate)
+gmres_iterate_op(const gsl_linalg_operator *A, const gsl_vector *b,
+                 const double tol, gsl_vector *x, void *vstate)
 {
   const size_t N = A->size1;
   gmres_state_t *state = (gmres_state_t *) vstate;
@@ -246,8 +265,9 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
       gsl_matrix_set_zero(H);
 
       /* Step 1a: compute r = b - A*x_0 */
-      gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      status = splinalg_residual(A, b, x, r);
+      if (status)
+        return status;
 
       /* Step 1b */
       gsl_vector_memcpy(&h0.vector, r);
@@ -292,8 +312,25 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
               gsl_linalg_householder_hv(tau, &uk.vector, &vk.vector);
             }
 
-          /* Step 2a: v_m <- A*v_m */
-          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vm.vector, 0.0, r);
+          /* Step 2a: v_m <- A*v_m, or v_m <- A M^{-1} v_m */
+          if (state->precond)
+            {
+              status = gsl_splinalg_precond_apply(&vm.vector, state->z,
+                                                  state->precond);
+              if (status)
+                return status;
+
+              status = splinalg_matvec(A, state->z, r);
+              if (status)
+                return status;
+            }
+          else
+            {
+              status = splinalg_matvec(A, &vm.vector, r);
+              if (status)
+                return status;
+            }
+
           gsl_vector_memcpy(&vm.vector, r);
 
           /* Step 2a: v_m <- P_m ... P_1 v_m */
@@ -395,12 +432,17 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
           gsl_linalg_householder_hv(tau, &uk.vector, &rk.vector);
         }
 
-      /* x <- x + V_m y_m */
-      gsl_vector_add(x, r);
+      /* x <- x + V_m y_m, or x <- x + M^{-1} V_m y_m */
+      status = splinalg_precond(state->precond, r, state->z);
+      if (status)
+        return status;
+
+      gsl_vector_add(x, state->z);
 
       /* compute new residual r = b - A*x */
-      gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      status = splinalg_residual(A, b, x, r);
+      if (status)
+        return status;
       normr = gsl_blas_dnrm2(r);
 
       if (normr <= reltol)
@@ -413,6 +455,18 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
       return status;
     }
+} /* gmres_iterate_op() */
+
+/* solve A*x = b for a sparse matrix A */
+static int
+gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+              const double tol, gsl_vector *x, void *vstate)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return gmres_iterate_op(&op, b, tol, x, vstate);
 } /* gmres_iterate() */
 
 static double
@@ -422,6 +476,21 @@ gmres_normr(const void *vstate)
   return state->normr;
 } /* gmres_normr() */
 
+static int
+gmres_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  gmres_state_t *state = (gmres_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->precond = P;
+
+  return GSL_SUCCESS;
+} /* gmres_set_precond() */
+
 static const gsl_splinalg_itersolve_type gmres_type =
 {
   "gmres",
@@ -433,3 +502,10 @@ static const gsl_splinalg_itersolve_type gmres_type =
 
 const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres =
   &gmres_type;
+
+const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_gmres_methods =
+{
+  &gmres_type,
+  &gmres_set_precond,
+  &gmres_iterate_op
+};
@@ -24,7 +24,9 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_permutation.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
 #include <gsl/gsl_types.h>
 
 #undef __BEGIN_DECLS
@@ -39,6 +41,40 @@
 
 __BEGIN_DECLS
 
+/* preconditioner type */
+typedef struct
+{
+  const char *name;
+  void * (*alloc) (const size_t n);
+  int (*init) (const gsl_spmatrix *A, void *);
+  int (*apply) (const gsl_vector *r, gsl_vector *z, void *); /* z = M^{-1} r */
+  void (*free) (void *);
+} gsl_splinalg_precond_type;
+
+typedef struct
+{
+  const gsl_splinalg_precond_type * type;
+  size_t n;
+  void * state;
+} gsl_splinalg_precond;
+
+/* available types */
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_jacobi;
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_ilu0;
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_ic0;
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_ssor;
+
+gsl_splinalg_precond *
+gsl_splinalg_precond_alloc(const gsl_splinalg_precond_type *T,
+                           const size_t n);
+void gsl_splinalg_precond_free(gsl_splinalg_precond *P);
+const char *gsl_splinalg_precond_name(const gsl_splinalg_precond *P);
+int gsl_splinalg_precond_init(const gsl_spmatrix *A, gsl_splinalg_precond *P);
+int gsl_splinalg_precond_apply(const gsl_vector *r, gsl_vector *z,
+                               const gsl_splinalg_precond *P);
+int gsl_splinalg_precond_ssor_set_omega(const double omega,
+                                        gsl_splinalg_precond *P);
+
 /* iteration solver type */
 typedef struct
 {
@@ -59,6 +95,10 @@ typedef struct
 
 /* available types */
 GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_fgmres;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_cg;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres;
 
 /*
  * Prototypes
@@ -72,7 +112,144 @@ int gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A,
                                    const gsl_vector *b,
                                    const double tol, gsl_vector *x,
                                    gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_iterate_op(const gsl_linalg_operator *A,
+                                      const gsl_vector *b,
+                                      const double tol, gsl_vector *x,
+                                      gsl_splinalg_itersolve *w);
 double gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_set_precond(const gsl_splinalg_precond *P,
+                                       gsl_splinalg_itersolve *w);
+
+/* linear operator for a sparse matrix */
+int gsl_splinalg_operator_init(const gsl_spmatrix *A, gsl_linalg_operator *op);
+
+/* Krylov eigensolvers: which eigenvalues to compute */
+enum
+{
+  GSL_SPLINALG_EIGEN_LARGEST_MAG = 0,   /* largest magnitude */
+  GSL_SPLINALG_EIGEN_LARGEST_REAL = 1,  /* largest real part */
+  GSL_SPLINALG_EIGEN_SMALLEST_REAL = 2  /* smallest real part */
+};
+
+typedef struct
+{
+  size_t n;                     /* size of operator */
+  size_t k;                     /* number of wanted eigenpairs */
+  size_t m;                     /* maximum dimension of Krylov subspace */
+  double tol;                   /* relative tolerance of Ritz residuals */
+  size_t max_restarts;          /* maximum number of restarts */
+  size_t nrestarts;             /* restarts used by the last call */
+  size_t nmult;                 /* operator applications in the last call */
+  size_t nconv;                 /* converged eigenpairs in the last call */
+  gsl_matrix *V;                /* Krylov basis, (m+1)-by-n, by rows */
+  gsl_matrix *H;                /* projection of A, (m+1)-by-m */
+  gsl_matrix *Hm;               /* m-by-m workspace */
+  gsl_matrix *Q;                /* m-by-m basis of the kept subspace */
+  gsl_matrix *S;                /* m-by-m Ritz vectors, symmetric case */
+  gsl_vector *theta;            /* m Ritz values, symmetric case */
+  gsl_matrix_complex *Sc;       /* m-by-m Ritz vectors, nonsymmetric case */
+  gsl_vector_complex *thetac;   /* m Ritz values, nonsymmetric case */
+  gsl_vector *h;                /* orthogonalization coefficients, size m+1 */
+  gsl_vector *resid;            /* m Ritz residual norms */
+  size_t *idx;                  /* m Ritz values in order of preference */
+  gsl_matrix *work;             /* m-by-nb workspace for basis updates */
+  gsl_eigen_symmv_workspace *symmv_p;
+  gsl_eigen_nonsymmv_workspace *nonsymmv_p;
+} gsl_splinalg_eigen_workspace;
+
+gsl_splinalg_eigen_workspace *gsl_splinalg_eigen_alloc(const size_t n,
+                                                       const size_t k,
+                                                       const size_t m);
+void gsl_splinalg_eigen_free(gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_params(const double tol, const size_t max_restarts,
+                              gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_symmv(const gsl_spmatrix *A, const int which,
+                             gsl_vector *eval, gsl_matrix *evec,
+                             gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_symmv_op(const gsl_linalg_operator *A, const int which,
+                                gsl_vector *eval, gsl_matrix *evec,
+                                gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_nonsymmv(const gsl_spmatrix *A, const int which,
+                                gsl_vector_complex *eval,
+                                gsl_matrix_complex *evec,
+                                gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_nonsymmv_op(const gsl_linalg_operator *A,
+                                   const int which,
+                                   gsl_vector_complex *eval,
+                                   gsl_matrix_complex *evec,
+                                   gsl_splinalg_eigen_workspace *w);
+
+/* fill-reducing orderings */
+enum
+{
+  GSL_SPLINALG_ORDER_NATURAL = 0, /* no reordering */
+  GSL_SPLINALG_ORDER_AMD = 1,     /* approximate minimum degree of A + A^T */
+  GSL_SPLINALG_ORDER_AMD_COL = 2  /* approximate minimum degree of A^T A */
+};
+
+int gsl_splinalg_amd(const gsl_spmatrix *A, gsl_permutation *p);
+int gsl_splinalg_amd_col(const gsl_spmatrix *A, gsl_permutation *q);
+
+/* sparse Cholesky factorization P A P^T = L L^T */
+typedef struct
+{
+  size_t n;               /* matrix size */
+  gsl_permutation *perm;  /* fill-reducing permutation P */
+  int *pinv;              /* inverse of perm */
+  int *parent;            /* elimination tree */
+  int *Cp;                /* column pointers of lower triangle of P A P^T */
+  int *Ci;                /* row indices of lower triangle of P A P^T */
+  int *Cmap;              /* positions in A->data of entries of C */
+  gsl_spmatrix *L;        /* Cholesky factor, diagonal first in each column */
+  double *x;              /* workspace, size n */
+  int *work;              /* workspace, size 3*n */
+  size_t nnzA;            /* nonzeros of A in symbolic analysis */
+} gsl_splinalg_cholesky_workspace;
+
+gsl_splinalg_cholesky_workspace *gsl_splinalg_cholesky_alloc(const size_t n);
+void gsl_splinalg_cholesky_free(gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_symbolic(const gsl_spmatrix *A, const int ordering,
+                                   gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_numeric(const gsl_spmatrix *A,
+                                  gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_decomp(const gsl_spmatrix *A,
+                                 gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_solve(const gsl_splinalg_cholesky_workspace *w,
+                                const gsl_vector *b, gsl_vector *x);
+int gsl_splinalg_cholesky_svx(const gsl_splinalg_cholesky_workspace *w,
+                              gsl_vector *x);
+int gsl_splinalg_cholesky_solve_mat(const gsl_splinalg_cholesky_workspace *w,
+                                    const gsl_matrix *B, gsl_matrix *X);
+
+/* sparse LU factorization P A Q = L U */
+typedef struct
+{
+  size_t n;               /* matrix size */
+  gsl_permutation *q;     /* fill-reducing column permutation Q */
+  gsl_permutation *p;     /* row permutation P from pivoting */
+  int *pinv;              /* inverse row permutation */
+  gsl_spmatrix *L;        /* unit lower triangular factor, diagonal first */
+  gsl_spmatrix *U;        /* upper triangular factor, diagonal last */
+  double pivot_tol;       /* threshold for keeping diagonal pivots, in (0,1] */
+  double *x;              /* workspace, size n */
+  int *xi;                /* workspace, size 2*n */
+  int *pstack;            /* workspace, size n */
+  int *mark;              /* workspace, size n */
+  size_t nnzA;            /* nonzeros of A in symbolic analysis */
+  int factorized;         /* numerical factorization available */
+} gsl_splinalg_LU_workspace;
+
+gsl_splinalg_LU_workspace *gsl_splinalg_LU_alloc(const size_t n);
+void gsl_splinalg_LU_free(gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_symbolic(const gsl_spmatrix *A, const int ordering,
+                             gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_numeric(const gsl_spmatrix *A, gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_decomp(const gsl_spmatrix *A, gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_solve(const gsl_splinalg_LU_workspace *w,
+                          const gsl_vector *b, gsl_vector *x);
+int gsl_splinalg_LU_svx(const gsl_splinalg_LU_workspace *w, gsl_vector *x);
+int gsl_splinalg_LU_solve_mat(const gsl_splinalg_LU_workspace *w,
+                              const gsl_matrix *B, gsl_matrix *X);
 
 __END_DECLS
 
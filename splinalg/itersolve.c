@@ -26,6 +26,33 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
 
+#include "methods.h"
+
+/* optional methods of the solvers in the library, see methods.h */
+
+static const gsl_splinalg_itersolve_methods *const itersolve_methods[] = {
+  &gsl_splinalg_itersolve_bicgstab_methods,
+  &gsl_splinalg_itersolve_cg_methods,
+  &gsl_splinalg_itersolve_fgmres_methods,
+  &gsl_splinalg_itersolve_gmres_methods,
+  &gsl_splinalg_itersolve_minres_methods,
+  0
+};
+
+static const gsl_splinalg_itersolve_methods *
+find_methods (const gsl_splinalg_itersolve_type * T)
+{
+  const gsl_splinalg_itersolve_methods *const *m;
+
+  for (m = itersolve_methods; *m != 0; m++)
+    {
+      if ((*m)->type == T)
+        return *m;
+    }
+
+  return 0;
+}
+
 gsl_splinalg_itersolve *
 gsl_splinalg_itersolve_alloc(const gsl_splinalg_itersolve_type *T,
                              const size_t n, const size_t m)
@@ -88,3 +115,62 @@ gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w)
 {
   return w->normr;
 }
+
+/*
+gsl_splinalg_itersolve_set_precond()
+  Attach a preconditioner to an iterative solver
+
+Inputs: P - preconditioner, previously initialized with
+            gsl_splinalg_precond_init(); NULL removes the
+            current preconditioner
+        w - workspace
+
+Notes:
+1) The solver keeps a pointer to P, which must stay valid while
+the solver is in use
+*/
+
+int
+gsl_splinalg_itersolve_set_precond(const gsl_splinalg_precond *P,
+                                   gsl_splinalg_itersolve *w)
+{
+  const gsl_splinalg_itersolve_methods *m = find_methods(w->type);
+
+  if (m == NULL || m->set_precond == NULL)
+    {
+      GSL_ERROR("solver does not support preconditioning", GSL_EINVAL);
+    }
+  else
+    {
+      return m->set_precond(P, w->state);
+    }
+}
+
+/*
+gsl_splinalg_itersolve_iterate_op()
+  Perform one call of the iterative method for the linear system
+A*x = b, where A is given as a linear operator which is never
+formed explicitly
+*/
+
+int
+gsl_splinalg_itersolve_iterate_op(const gsl_linalg_operator *A,
+                                  const gsl_vector *b, const double tol,
+                                  gsl_vector *x, gsl_splinalg_itersolve *w)
+{
+  const gsl_splinalg_itersolve_methods *m = find_methods(w->type);
+
+  if (m == NULL || m->iterate_op == NULL)
+    {
+      GSL_ERROR("solver does not support linear operators", GSL_EINVAL);
+    }
+  else
+    {
+      int status = m->iterate_op(A, b, tol, x, w->state);
+
+      /* store current residual */
+      w->normr = w->type->normr(w->state);
+
+      return status;
+    }
+}
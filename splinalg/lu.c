@@ -0,0 +1,663 @@
+/* lu.c
+ *
+ * Copyright (C) 2006 Timothy A. Davis
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * LU_reach() and the sparse triangular solve in
+ * gsl_splinalg_LU_numeric() are derived from cs_reach(), cs_dfs() and
+ * cs_spsolve() of CSparse, copyright (C) 2006 Timothy A. Davis, which
+ * is distributed under the GNU Lesser General Public License, version
+ * 2.1 or later.  The license on this implementation was changed from
+ * LGPL to GPL, following section 3 of the LGPL, version 2.1.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Sparse LU factorization with partial pivoting
+ *
+ *   P A Q = L U
+ *
+ * where Q is a fill-reducing column permutation chosen in the
+ * symbolic analysis and P is the row permutation chosen during the
+ * numerical factorization.  Column k of L and U is computed by the
+ * left-looking algorithm of Gilbert and Peierls: the pattern of the
+ * solution of the sparse triangular system L x = A(:,q[k]) is found by
+ * a depth-first search in the graph of L, and the system is then
+ * solved in topological order, so that the work is proportional to
+ * the number of floating point operations.
+ *
+ * Threshold pivoting is used: the diagonal entry A(q[k],q[k]) is kept
+ * as pivot when its magnitude is at least pivot_tol times the largest
+ * magnitude in the pivot column, which preserves the fill-reducing
+ * properties of symmetric orderings.
+ *
+ * See J. R. Gilbert and T. Peierls, Sparse partial pivoting in time
+ * proportional to arithmetic operations, SIAM J. Sci. Stat. Comput.,
+ * 9 (1988), and T. A. Davis, Direct methods for sparse linear systems,
+ * SIAM, 2006, chapter 6.
+ */
+
+static int LU_reach(const int k, const gsl_spmatrix *A, const int col,
+                    gsl_splinalg_LU_workspace *w);
+static void LU_free_factors(gsl_splinalg_LU_workspace *w);
+
+gsl_splinalg_LU_workspace *
+gsl_splinalg_LU_alloc(const size_t n)
+{
+  gsl_splinalg_LU_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_LU_workspace));
+  if (!w)
+    {
+      GSL_ERROR_NULL("failed to allocate LU workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+  w->pivot_tol = 1.0;
+
+  w->q = gsl_permutation_alloc(n);
+  w->p = gsl_permutation_alloc(n);
+  w->pinv = malloc(n * sizeof(int));
+  w->x = malloc(n * sizeof(double));
+  w->xi = malloc(2 * n * sizeof(int));
+  w->pstack = malloc(n * sizeof(int));
+  w->mark = malloc(n * sizeof(int));
+
+  if (!w->q || !w->p || !w->pinv || !w->x || !w->xi || !w->pstack || !w->mark)
+    {
+      gsl_splinalg_LU_free(w);
+      GSL_ERROR_NULL("failed to allocate LU workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_splinalg_LU_free(gsl_splinalg_LU_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  LU_free_factors(w);
+
+  if (w->q)
+    gsl_permutation_free(w->q);
+
+  if (w->p)
+    gsl_permutation_free(w->p);
+
+  if (w->pinv)
+    free(w->pinv);
+
+  if (w->x)
+    free(w->x);
+
+  if (w->xi)
+    free(w->xi);
+
+  if (w->pstack)
+    free(w->pstack);
+
+  if (w->mark)
+    free(w->mark);
+
+  free(w);
+}
+
+/*
+gsl_splinalg_LU_symbolic()
+  Symbolic analysis of the LU factorization of a square matrix
+
+Inputs: A        - square matrix in compressed column format
+        ordering - fill-reducing column ordering:
+                   GSL_SPLINALG_ORDER_NATURAL - Q = I
+                   GSL_SPLINALG_ORDER_AMD     - AMD ordering of A + A^T,
+                                                for matrices with a
+                                                nearly symmetric pattern
+                                                and a strong diagonal
+                   GSL_SPLINALG_ORDER_AMD_COL - AMD ordering of A^T A
+        w        - workspace
+
+Notes:
+1) The row pivots depend on the numerical values, so the pattern of
+L and U is only determined by the numerical factorization; the
+symbolic analysis fixes Q and estimates the storage needed
+*/
+
+int
+gsl_splinalg_LU_symbolic(const gsl_spmatrix *A, const int ordering,
+                         gsl_splinalg_LU_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix size must match workspace", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("compressed column format required", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t nzmax = 4 * A->nz + n;
+      int status;
+
+      LU_free_factors(w);
+
+      if (ordering == GSL_SPLINALG_ORDER_AMD_COL)
+        {
+          status = gsl_splinalg_amd_col(A, w->q);
+          if (status)
+            return status;
+        }
+      else if (ordering == GSL_SPLINALG_ORDER_AMD)
+        {
+          status = gsl_splinalg_amd(A, w->q);
+          if (status)
+            return status;
+        }
+      else if (ordering == GSL_SPLINALG_ORDER_NATURAL)
+        {
+          gsl_permutation_init(w->q);
+        }
+      else
+        {
+          GSL_ERROR("unsupported ordering for LU factorization", GSL_EINVAL);
+        }
+
+      w->L = gsl_spmatrix_alloc_nzmax(n, n, nzmax, GSL_SPMATRIX_CSC);
+      w->U = gsl_spmatrix_alloc_nzmax(n, n, nzmax, GSL_SPMATRIX_CSC);
+
+      if (!w->L || !w->U)
+        {
+          LU_free_factors(w);
+          GSL_ERROR("failed to allocate space for L and U", GSL_ENOMEM);
+        }
+
+      w->nnzA = A->nz;
+      w->factorized = 0;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_LU_numeric()
+  Numerical LU factorization with threshold partial pivoting, after the
+symbolic analysis of a matrix with the same pattern
+
+Inputs: A - square matrix in compressed column format
+        w - workspace
+
+Return: GSL_SUCCESS, or GSL_EDOM if A is singular
+*/
+
+int
+gsl_splinalg_LU_numeric(const gsl_spmatrix *A, gsl_splinalg_LU_workspace *w)
+{
+  if (w->L == NULL)
+    {
+      GSL_ERROR("symbolic analysis has not been performed", GSL_EINVAL);
+    }
+  else if (A->size1 != w->n || A->size2 != w->n || !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix does not match symbolic analysis", GSL_EBADLEN);
+    }
+  else if (A->nz != w->nnzA)
+    {
+      GSL_ERROR("matrix pattern does not match symbolic analysis", GSL_EINVAL);
+    }
+  else
+    {
+      const int N = (int) w->n;
+      const size_t *q = w->q->data;
+      const int *Ap = A->p;
+      const int *Ai = A->i;
+      const double *Ax = A->data;
+      gsl_spmatrix *L = w->L;
+      gsl_spmatrix *U = w->U;
+      int *pinv = w->pinv;
+      int *xi = w->xi;
+      double *x = w->x;
+      size_t lnz = 0, unz = 0;
+      int i, k, p, top;
+
+      w->factorized = 0;
+
+      for (i = 0; i < N; ++i)
+        {
+          x[i] = 0.0;
+          pinv[i] = -1;
+          w->mark[i] = -1;
+        }
+
+      L->nz = 0;
+      U->nz = 0;
+
+      for (k = 0; k < N; ++k)
+        {
+          const int col = (int) q[k];
+          int ipiv = -1;
+          double amax = -1.0, pivot;
+
+          /* make room for column k of L and U */
+          if (lnz + w->n > L->nzmax)
+            {
+              int status = gsl_spmatrix_realloc(2 * L->nzmax + w->n, L);
+              if (status)
+                return status;
+            }
+
+          if (unz + w->n > U->nzmax)
+            {
+              int status = gsl_spmatrix_realloc(2 * U->nzmax + w->n, U);
+              if (status)
+                return status;
+            }
+
+          L->p[k] = (int) lnz;
+          U->p[k] = (int) unz;
+
+          /* pattern of x = L \ A(:,col), in topological order in xi[top:n-1] */
+          top = LU_reach(k, A, col, w);
+
+          for (p = Ap[col]; p < Ap[col + 1]; ++p)
+            x[Ai[p]] = Ax[p];
+
+          /* sparse triangular solve; L has unit diagonal stored first */
+          for (p = top; p < N; ++p)
+            {
+              const int j = xi[p];
+              const int J = pinv[j];
+              int pp;
+
+              if (J < 0)
+                continue;
+
+              for (pp = L->p[J] + 1; pp < L->p[J + 1]; ++pp)
+                x[L->i[pp]] -= L->data[pp] * x[j];
+            }
+
+          /* rows already pivotal go to U, the others are pivot candidates */
+          for (p = top; p < N; ++p)
+            {
+              i = xi[p];
+
+              if (pinv[i] < 0)
+                {
+                  const double a = fabs(x[i]);
+
+                  if (a > amax)
+                    {
+                      amax = a;
+                      ipiv = i;
+                    }
+                }
+              else
+                {
+                  U->i[unz] = pinv[i];
+                  U->data[unz++] = x[i];
+                }
+            }
+
+          if (ipiv < 0 || amax <= 0.0)
+            {
+              GSL_ERROR("matrix is singular", GSL_EDOM);
+            }
+
+          if (pinv[col] < 0 && fabs(x[col]) >= w->pivot_tol * amax)
+            ipiv = col;
+
+          /* diagonal of U is stored last in each column */
+          pivot = x[ipiv];
+          U->i[unz] = k;
+          U->data[unz++] = pivot;
+
+          pinv[ipiv] = k;
+          L->i[lnz] = ipiv;
+          L->data[lnz++] = 1.0;
+
+          for (p = top; p < N; ++p)
+            {
+              i = xi[p];
+
+              if (pinv[i] < 0)
+                {
+                  L->i[lnz] = i;
+                  L->data[lnz++] = x[i] / pivot;
+                }
+
+              x[i] = 0.0;
+            }
+        }
+
+      L->p[N] = (int) lnz;
+      U->p[N] = (int) unz;
+      L->nz = lnz;
+      U->nz = unz;
+
+      /* row indices of L were original row numbers; relabel by pivot order */
+      for (p = 0; p < (int) lnz; ++p)
+        L->i[p] = pinv[L->i[p]];
+
+      for (i = 0; i < N; ++i)
+        w->p->data[pinv[i]] = (size_t) i;
+
+      w->factorized = 1;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_LU_decomp()
+  Symbolic analysis with the column approximate minimum degree ordering,
+followed by the numerical factorization
+*/
+
+int
+gsl_splinalg_LU_decomp(const gsl_spmatrix *A, gsl_splinalg_LU_workspace *w)
+{
+  int status = gsl_splinalg_LU_symbolic(A, GSL_SPLINALG_ORDER_AMD_COL, w);
+
+  if (status)
+    return status;
+
+  return gsl_splinalg_LU_numeric(A, w);
+}
+
+int
+gsl_splinalg_LU_solve(const gsl_splinalg_LU_workspace *w,
+                      const gsl_vector *b, gsl_vector *x)
+{
+  if (b->size != w->n)
+    {
+      GSL_ERROR("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_vector_memcpy(x, b);
+      return gsl_splinalg_LU_svx(w, x);
+    }
+}
+
+int
+gsl_splinalg_LU_svx(const gsl_splinalg_LU_workspace *w, gsl_vector *x)
+{
+  if (!w->factorized)
+    {
+      GSL_ERROR("matrix has not been factorized", GSL_EINVAL);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const int N = (int) w->n;
+      const size_t *perm = w->p->data;
+      const size_t *q = w->q->data;
+      const int *Lp = w->L->p, *Li = w->L->i;
+      const int *Up = w->U->p, *Ui = w->U->i;
+      const double *Lx = w->L->data, *Ux = w->U->data;
+      double *y = w->x;
+      int j, p;
+
+      /* y = P b */
+      for (j = 0; j < N; ++j)
+        y[j] = gsl_vector_get(x, perm[j]);
+
+      /* y = L^{-1} y */
+      for (j = 0; j < N; ++j)
+        {
+          for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+            y[Li[p]] -= Lx[p] * y[j];
+        }
+
+      /* y = U^{-1} y */
+      for (j = N - 1; j >= 0; --j)
+        {
+          y[j] /= Ux[Up[j + 1] - 1];
+
+          for (p = Up[j]; p < Up[j + 1] - 1; ++p)
+            y[Ui[p]] -= Ux[p] * y[j];
+        }
+
+      /* x = Q y */
+      for (j = 0; j < N; ++j)
+        {
+          gsl_vector_set(x, q[j], y[j]);
+          y[j] = 0.0;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_LU_solve_mat()
+  Solve A X = B for several right hand sides; each sweep over L and U
+is applied to all the columns of B
+
+Inputs: w - workspace containing the factorization
+        B - right hand sides, n-by-nrhs
+        X - (output) solutions, n-by-nrhs; may be the same as B
+*/
+
+int
+gsl_splinalg_LU_solve_mat(const gsl_splinalg_LU_workspace *w,
+                          const gsl_matrix *B, gsl_matrix *X)
+{
+  if (!w->factorized)
+    {
+      GSL_ERROR("matrix has not been factorized", GSL_EINVAL);
+    }
+  else if (B->size1 != w->n || X->size1 != w->n)
+    {
+      GSL_ERROR("matrix size must match right hand side size", GSL_EBADLEN);
+    }
+  else if (B->size2 != X->size2)
+    {
+      GSL_ERROR("B and X must have the same number of columns", GSL_EBADLEN);
+    }
+  else
+    {
+      const int N = (int) w->n;
+      const size_t nrhs = B->size2;
+      const size_t *perm = w->p->data;
+      const size_t *q = w->q->data;
+      const int *Lp = w->L->p, *Li = w->L->i;
+      const int *Up = w->U->p, *Ui = w->U->i;
+      const double *Lx = w->L->data, *Ux = w->U->data;
+      gsl_matrix *Y = gsl_matrix_alloc(w->n, nrhs);
+      size_t k;
+      int j, p;
+
+      if (Y == NULL)
+        {
+          GSL_ERROR("failed to allocate space for Y", GSL_ENOMEM);
+        }
+
+      /* Y = P B */
+      for (j = 0; j < N; ++j)
+        {
+          gsl_vector_const_view b = gsl_matrix_const_row(B, perm[j]);
+          gsl_vector_view y = gsl_matrix_row(Y, j);
+          gsl_vector_memcpy(&y.vector, &b.vector);
+        }
+
+      /* Y = L^{-1} Y */
+      for (j = 0; j < N; ++j)
+        {
+          const double *yj = gsl_matrix_const_ptr(Y, j, 0);
+
+          for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+            {
+              double *yi = gsl_matrix_ptr(Y, Li[p], 0);
+
+              for (k = 0; k < nrhs; ++k)
+                yi[k] -= Lx[p] * yj[k];
+            }
+        }
+
+      /* Y = U^{-1} Y */
+      for (j = N - 1; j >= 0; --j)
+        {
+          double *yj = gsl_matrix_ptr(Y, j, 0);
+          const double ujj = Ux[Up[j + 1] - 1];
+
+          for (k = 0; k < nrhs; ++k)
+            yj[k] /= ujj;
+
+          for (p = Up[j]; p < Up[j + 1] - 1; ++p)
+            {
+              double *yi = gsl_matrix_ptr(Y, Ui[p], 0);
+
+              for (k = 0; k < nrhs; ++k)
+                yi[k] -= Ux[p] * yj[k];
+            }
+        }
+
+      /* X = Q Y */
+      for (j = 0; j < N; ++j)
+        {
+          gsl_vector_view x = gsl_matrix_row(X, q[j]);
+          gsl_vector_const_view y = gsl_matrix_const_row(Y, j);
+          gsl_vector_memcpy(&x.vector, &y.vector);
+        }
+
+      gsl_matrix_free(Y);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+LU_reach()
+  Compute the pattern of the solution of L x = A(:,col) by depth-first
+search from the nonzeros of A(:,col) in the graph of the columns of L
+computed so far; row i of x depends on column pinv[i] of L when row i
+is pivotal
+
+Inputs: k   - current column, used to stamp the visited nodes
+        A   - matrix
+        col - column of A
+        w   - workspace
+
+Return: top, such that the pattern of x is xi[top:n-1] in topological
+order
+*/
+
+static int
+LU_reach(const int k, const gsl_spmatrix *A, const int col,
+         gsl_splinalg_LU_workspace *w)
+{
+  const int N = (int) w->n;
+  const int *Lp = w->L->p;
+  const int *Li = w->L->i;
+  const int *pinv = w->pinv;
+  int *xi = w->xi;
+  int *pstack = w->pstack;
+  int *mark = w->mark;
+  int top = N;
+  int p;
+
+  for (p = A->p[col]; p < A->p[col + 1]; ++p)
+    {
+      int head = 0;
+
+      if (mark[A->i[p]] == k)
+        continue;
+
+      /* the recursion stack is kept in xi[0:head], below the output */
+      xi[0] = A->i[p];
+
+      while (head >= 0)
+        {
+          const int j = xi[head];
+          const int J = pinv[j];
+          int done = 1, pp, pend;
+
+          if (mark[j] != k)
+            {
+              mark[j] = k;
+              pstack[head] = (J < 0) ? 0 : Lp[J] + 1;
+            }
+
+          pend = (J < 0) ? 0 : Lp[J + 1];
+
+          for (pp = pstack[head]; pp < pend; ++pp)
+            {
+              const int i = Li[pp];
+
+              if (mark[i] == k)
+                continue;
+
+              pstack[head] = pp + 1;
+              xi[++head] = i;
+              done = 0;
+              break;
+            }
+
+          if (done)
+            {
+              --head;
+              xi[--top] = j;
+            }
+        }
+    }
+
+  return top;
+}
+
+static void
+LU_free_factors(gsl_splinalg_LU_workspace *w)
+{
+  if (w->L)
+    gsl_spmatrix_free(w->L);
+
+  if (w->U)
+    gsl_spmatrix_free(w->U);
+
+  w->L = NULL;
+  w->U = NULL;
+  w->factorized = 0;
+}
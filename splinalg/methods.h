@@ -0,0 +1,44 @@
+/* splinalg/methods.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPLINALG_METHODS_H__
+#define __GSL_SPLINALG_METHODS_H__
+
+/* Optional methods of the iterative solvers in the library.  They are
+   kept out of gsl_splinalg_itersolve_type so that its layout, which
+   user-defined solvers depend on, does not change.  itersolve.c looks
+   the table up by the type pointer; types without a table do not
+   support the optional methods. */
+
+typedef struct
+  {
+    const gsl_splinalg_itersolve_type *type;
+    int (*set_precond) (const gsl_splinalg_precond *P, void *state); /* or NULL */
+    int (*iterate_op) (const gsl_linalg_operator *A, const gsl_vector *b,
+                       const double tol, gsl_vector *x, void *state); /* or NULL */
+  }
+gsl_splinalg_itersolve_methods;
+
+extern const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_bicgstab_methods;
+extern const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_cg_methods;
+extern const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_fgmres_methods;
+extern const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_gmres_methods;
+extern const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_minres_methods;
+
+#endif /* __GSL_SPLINALG_METHODS_H__ */
@@ -0,0 +1,411 @@
+/* minres.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "methods.h"
+#include "common.c"
+
+/*
+ * MINRES method of Paige and Saunders for symmetric, possibly
+ * indefinite, systems. A symmetric positive definite preconditioner
+ * M may be used, in which case the method minimizes the M^{-1} norm
+ * of the residual over the Krylov subspace.
+ *
+ * [1] C. C. Paige and M. A. Saunders, Solution of sparse indefinite
+ *     systems of linear equations, SIAM J. Numer. Anal. 12(4), 1975.
+ *
+ * [2] S.-C. T. Choi, C. C. Paige and M. A. Saunders, MINRES-QLP: A
+ *     Krylov subspace method for indefinite or singular symmetric
+ *     systems, SIAM J. Sci. Comput. 33(4), 2011.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *r1;  /* Lanczos vectors, unpreconditioned */
+  gsl_vector *r2;
+  gsl_vector *y;   /* y = M^{-1} r2 */
+  gsl_vector *v;   /* Lanczos vector, v = y / beta */
+  gsl_vector *w;   /* search directions */
+  gsl_vector *w1;
+  gsl_vector *w2;
+
+  const gsl_splinalg_precond *precond; /* preconditioner, or NULL */
+
+  double normr;    /* residual norm ||r|| */
+} minres_state_t;
+
+static void minres_free(void *vstate);
+
+/*
+minres_alloc()
+  Allocate a MINRES workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations for each call to
+            gsl_splinalg_itersolve_iterate(); if this parameter
+            is 0, the value n is used
+
+Return: pointer to workspace
+*/
+
+static void *
+minres_alloc(const size_t n, const size_t m)
+{
+  minres_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(minres_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate minres state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->maxit = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->r1 = gsl_vector_alloc(n);
+  state->r2 = gsl_vector_alloc(n);
+  state->y = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->w = gsl_vector_alloc(n);
+  state->w1 = gsl_vector_alloc(n);
+  state->w2 = gsl_vector_alloc(n);
+  if (!state->r || !state->r1 || !state->r2 || !state->y ||
+      !state->v || !state->w || !state->w1 || !state->w2)
+    {
+      minres_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->precond = NULL;
+  state->normr = 0.0;
+
+  return state;
+}
+
+static void
+minres_free(void *vstate)
+{
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->r1)
+    gsl_vector_free(state->r1);
+
+  if (state->r2)
+    gsl_vector_free(state->r2);
+
+  if (state->y)
+    gsl_vector_free(state->y);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->w)
+    gsl_vector_free(state->w);
+
+  if (state->w1)
+    gsl_vector_free(state->w1);
+
+  if (state->w2)
+    gsl_vector_free(state->w2);
+
+  free(state);
+}
+
+/* return sqrt(r^T M^{-1} r) = sqrt(r^T y) */
+static int
+minres_mnorm(const gsl_vector *r, const gsl_vector *y, double *norm)
+{
+  double d;
+
+  gsl_blas_ddot(r, y, &d);
+  if (d < 0.0)
+    {
+      GSL_ERROR("preconditioner is not positive definite", GSL_EDOM);
+    }
+
+  *norm = sqrt(d);
+
+  return GSL_SUCCESS;
+}
+
+/*
+minres_iterate_op()
+  Solve A*x = b using the MINRES algorithm
+
+Inputs: A    - symmetric linear operator
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||; GSL_CONTINUE if not
+yet converged after maxit iterations, in which case calling this
+function again restarts the iteration from the current x
+
+Notes:
+1) The residual estimate phibar of the method is ||r||_{M^{-1}};
+once it drops below tol * ||b||_{M^{-1}} the true residual is
+computed to check convergence. If that test fails, the estimate
+threshold is reduced by the observed ratio and the iteration
+continues.
+*/
+
+static int
+minres_iterate_op(const gsl_linalg_operator *A, const gsl_vector *b,
+                  const double tol, gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double reltol = tol * gsl_blas_dnrm2(b); /* tol*||b|| */
+      gsl_vector *r = state->r;
+      gsl_vector *r1 = state->r1;
+      gsl_vector *r2 = state->r2;
+      gsl_vector *y = state->y;
+      gsl_vector *v = state->v;
+      gsl_vector *w = state->w;
+      gsl_vector *w1 = state->w1;
+      gsl_vector *w2 = state->w2;
+      gsl_vector *tmp;
+      double normr, normb_M, esttol;
+      double beta, oldb, dbar = 0.0, epsln = 0.0, phibar;
+      double cs = -1.0, sn = 0.0;
+      size_t k;
+      int status;
+
+      /* r = b - A*x_0 */
+      status = splinalg_residual(A, b, x, r);
+      if (status)
+        return status;
+      normr = gsl_blas_dnrm2(r);
+
+      if (normr > reltol)
+        {
+          /* threshold for the estimate phibar, tol * ||b||_{M^{-1}} */
+          status = splinalg_precond(state->precond, b, y);
+          if (!status)
+            status = minres_mnorm(b, y, &normb_M);
+          if (status)
+            return status;
+
+          esttol = tol * normb_M;
+
+          /* r1 = r2 = r, y = M^{-1} r, beta_1 = ||r||_{M^{-1}} */
+          gsl_vector_memcpy(r1, r);
+          gsl_vector_memcpy(r2, r);
+          status = splinalg_precond(state->precond, r2, y);
+          if (!status)
+            status = minres_mnorm(r2, y, &beta);
+          if (status)
+            return status;
+
+          oldb = 0.0;
+          phibar = beta;
+          gsl_vector_set_zero(w);
+          gsl_vector_set_zero(w2);
+
+          for (k = 0; k < state->maxit && beta > 0.0; ++k)
+            {
+              double alfa, oldeps, delta, gbar, gamma, phi;
+
+              /* Lanczos step: v = y / beta, y = A*v - (beta/oldb) r1 */
+              gsl_vector_memcpy(v, y);
+              gsl_vector_scale(v, 1.0 / beta);
+
+              status = splinalg_matvec(A, v, y);
+              if (status)
+                return status;
+              if (k > 0)
+                gsl_blas_daxpy(-beta / oldb, r1, y);
+
+              gsl_blas_ddot(v, y, &alfa);
+              gsl_blas_daxpy(-alfa / beta, r2, y);
+
+              /* r1 <- r2, r2 <- y, y <- M^{-1} r2 */
+              tmp = r1;
+              r1 = r2;
+              r2 = y;
+              y = tmp;
+
+              status = splinalg_precond(state->precond, r2, y);
+              if (status)
+                return status;
+
+              oldb = beta;
+              status = minres_mnorm(r2, y, &beta);
+              if (status)
+                return status;
+
+              /* apply previous rotation Q_{k-1} */
+              oldeps = epsln;
+              delta = cs * dbar + sn * alfa;
+              gbar = sn * dbar - cs * alfa;
+              epsln = sn * beta;
+              dbar = -cs * beta;
+
+              /* compute next rotation Q_k */
+              gamma = GSL_MAX(gsl_hypot(gbar, beta), GSL_DBL_EPSILON);
+              cs = gbar / gamma;
+              sn = beta / gamma;
+              phi = cs * phibar;
+              phibar = sn * phibar;
+
+              /* w <- (v - oldeps*w1 - delta*w2) / gamma */
+              tmp = w1;
+              w1 = w2;
+              w2 = w;
+              w = tmp;
+
+              gsl_vector_memcpy(w, v);
+              gsl_blas_daxpy(-oldeps, w1, w);
+              gsl_blas_daxpy(-delta, w2, w);
+              gsl_vector_scale(w, 1.0 / gamma);
+
+              /* x = x + phi*w */
+              gsl_blas_daxpy(phi, w, x);
+
+              if (phibar <= esttol || beta == 0.0)
+                {
+                  /* check the true residual */
+                  status = splinalg_residual(A, b, x, r);
+                  if (status)
+                    return status;
+                  normr = gsl_blas_dnrm2(r);
+
+                  if (normr <= reltol)
+                    break;
+
+                  esttol = phibar * (reltol / normr);
+                }
+            }
+
+          if (normr > reltol)
+            {
+              /* compute true residual r = b - A*x */
+              status = splinalg_residual(A, b, x, r);
+              if (status)
+                return status;
+              normr = gsl_blas_dnrm2(r);
+            }
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+}
+
+/* solve A*x = b for a sparse matrix A */
+static int
+minres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+               const double tol, gsl_vector *x, void *vstate)
+{
+  gsl_linalg_operator op;
+
+  gsl_splinalg_operator_init(A, &op);
+
+  return minres_iterate_op(&op, b, tol, x, vstate);
+}
+
+static double
+minres_normr(const void *vstate)
+{
+  const minres_state_t *state = (const minres_state_t *) vstate;
+  return state->normr;
+}
+
+static int
+minres_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->precond = P;
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_splinalg_itersolve_type minres_type =
+{
+  "minres",
+  &minres_alloc,
+  &minres_iterate,
+  &minres_normr,
+  &minres_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres =
+  &minres_type;
+
+const gsl_splinalg_itersolve_methods gsl_splinalg_itersolve_minres_methods =
+{
+  &minres_type,
+  &minres_set_precond,
+  &minres_iterate_op
+};
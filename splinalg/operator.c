@@ -0,0 +1,73 @@
+/* operator.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/* Y = op(A) X for a sparse matrix A, one column at a time */
+static int
+spmatrix_mult(CBLAS_TRANSPOSE_t TransA, const gsl_matrix *X, gsl_matrix *Y,
+              void *params)
+{
+  const gsl_spmatrix *A = (const gsl_spmatrix *) params;
+  size_t j;
+
+  for (j = 0; j < X->size2; ++j)
+    {
+      gsl_vector_const_view x = gsl_matrix_const_column(X, j);
+      gsl_vector_view y = gsl_matrix_column(Y, j);
+      int status = gsl_spblas_dgemv(TransA, 1.0, A, &x.vector, 0.0, &y.vector);
+
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_splinalg_operator_init()
+  Initialize a linear operator which applies the sparse matrix A
+
+Inputs: A  - sparse matrix, in any format supported by
+             gsl_spblas_dgemv()
+        op - (output) linear operator
+
+Notes:
+1) op keeps a pointer to A, which must stay valid while op is
+in use
+*/
+
+int
+gsl_splinalg_operator_init(const gsl_spmatrix *A, gsl_linalg_operator *op)
+{
+  op->size1 = A->size1;
+  op->size2 = A->size2;
+  op->mult = &spmatrix_mult;
+  op->params = (void *) A;
+
+  return GSL_SUCCESS;
+}
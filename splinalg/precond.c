@@ -0,0 +1,919 @@
+/* precond.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Preconditioners for the iterative solvers. Each type computes an
+ * approximation M to the matrix A in its init() function and applies
+ * z = M^{-1} r in its apply() function:
+ *
+ * jacobi  M = D
+ * ilu0    M = L U, incomplete LU factorization with the pattern of A
+ * ic0     M = L L^T, incomplete Cholesky factorization with the
+ *         pattern of the lower triangle of A
+ * ssor    M = (D + w L) D^{-1} (D + w U) / (w (2 - w))
+ *
+ * where D, L and U are the diagonal, strictly lower and strictly
+ * upper parts of A. The factorization based types work on a copy
+ * of A in CSR format with sorted column indices.
+ *
+ * [1] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+gsl_splinalg_precond *
+gsl_splinalg_precond_alloc(const gsl_splinalg_precond_type *T,
+                           const size_t n)
+{
+  gsl_splinalg_precond *P;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  P = calloc(1, sizeof(gsl_splinalg_precond));
+  if (P == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for precond struct",
+                     GSL_ENOMEM);
+    }
+
+  P->type = T;
+  P->n = n;
+
+  P->state = P->type->alloc(n);
+  if (P->state == NULL)
+    {
+      gsl_splinalg_precond_free(P);
+      GSL_ERROR_NULL("failed to allocate space for precond state",
+                     GSL_ENOMEM);
+    }
+
+  return P;
+}
+
+void
+gsl_splinalg_precond_free(gsl_splinalg_precond *P)
+{
+  RETURN_IF_NULL(P);
+
+  if (P->state)
+    P->type->free(P->state);
+
+  free(P);
+}
+
+const char *
+gsl_splinalg_precond_name(const gsl_splinalg_precond *P)
+{
+  return P->type->name;
+}
+
+/*
+gsl_splinalg_precond_init()
+  Compute preconditioner for the matrix A
+
+Inputs: A - sparse square matrix in COO, CSC or CSR format
+        P - preconditioner
+
+Notes:
+1) P does not keep a reference to A, so A may be freed or
+modified afterwards; call this function again if the values of A
+change
+*/
+
+int
+gsl_splinalg_precond_init(const gsl_spmatrix *A, gsl_splinalg_precond *P)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != P->n)
+    {
+      GSL_ERROR("matrix does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSC(A) &&
+           !GSL_SPMATRIX_ISCSR(A))
+    {
+      GSL_ERROR("COO, CSC or CSR format required", GSL_EINVAL);
+    }
+  else
+    {
+      return P->type->init(A, P->state);
+    }
+}
+
+/*
+gsl_splinalg_precond_apply()
+  Compute z = M^{-1} r
+
+Inputs: r - input vector, length n
+        z - (output) M^{-1} r, length n; may be the same vector as r
+        P - preconditioner
+*/
+
+int
+gsl_splinalg_precond_apply(const gsl_vector *r, gsl_vector *z,
+                           const gsl_splinalg_precond *P)
+{
+  if (r->size != P->n)
+    {
+      GSL_ERROR("input vector does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (z->size != P->n)
+    {
+      GSL_ERROR("output vector does not match preconditioner", GSL_EBADLEN);
+    }
+  else
+    {
+      return P->type->apply(r, z, P->state);
+    }
+}
+
+/*
+precond_csr()
+  Return a copy of A in CSR format with the column indices of each
+row in increasing order
+*/
+
+static gsl_spmatrix *
+precond_csr(const gsl_spmatrix *A)
+{
+  const size_t N = A->size1;
+  gsl_spmatrix *C; /* A in CSC format */
+  gsl_spmatrix *T;
+  int status = GSL_SUCCESS;
+
+  if (GSL_SPMATRIX_ISCSC(A))
+    {
+      C = (gsl_spmatrix *) A;
+    }
+  else if (GSL_SPMATRIX_ISCOO(A))
+    {
+      C = gsl_spmatrix_compress(A, GSL_SPMATRIX_CSC);
+      if (C == NULL)
+        return NULL;
+    }
+  else
+    {
+      /* the transpose of A, in CSR format, is A in CSC format with
+       * sorted row indices */
+      C = gsl_spmatrix_alloc_nzmax(N, N, GSL_MAX(A->nz, 1), GSL_SPMATRIX_CSR);
+      if (C == NULL)
+        return NULL;
+
+      status = gsl_spmatrix_transpose_memcpy(C, A);
+      if (status == GSL_SUCCESS)
+        status = gsl_spmatrix_transpose(C);
+    }
+
+  T = gsl_spmatrix_alloc_nzmax(N, N, GSL_MAX(A->nz, 1), GSL_SPMATRIX_CSC);
+
+  if (T != NULL && status == GSL_SUCCESS)
+    {
+      /* counting sort of the transpose sorts the indices */
+      status = gsl_spmatrix_transpose_memcpy(T, C);
+      if (status == GSL_SUCCESS)
+        status = gsl_spmatrix_transpose(T);
+    }
+
+  if (C != A)
+    gsl_spmatrix_free(C);
+
+  if (T != NULL && status)
+    {
+      gsl_spmatrix_free(T);
+      T = NULL;
+    }
+
+  return T;
+}
+
+/*
+precond_diag()
+  Find the position of the diagonal element of each row of a CSR
+matrix
+
+Return: GSL_SUCCESS, or GSL_ESING if a diagonal element is not
+stored or is zero
+*/
+
+static int
+precond_diag(const gsl_spmatrix *A, int *diag)
+{
+  const size_t N = A->size1;
+  size_t i;
+
+  for (i = 0; i < N; ++i)
+    {
+      int p;
+
+      diag[i] = -1;
+
+      for (p = A->p[i]; p < A->p[i + 1]; ++p)
+        {
+          if (A->i[p] == (int) i)
+            {
+              diag[i] = p;
+              break;
+            }
+        }
+
+      if (diag[i] < 0 || A->data[diag[i]] == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_ESING);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Jacobi preconditioner */
+
+typedef struct
+{
+  size_t n;
+  double *dinv;    /* inverse diagonal D^{-1} */
+} jacobi_state_t;
+
+static void jacobi_free(void *vstate);
+
+static void *
+jacobi_alloc(const size_t n)
+{
+  jacobi_state_t *state;
+
+  state = calloc(1, sizeof(jacobi_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate jacobi state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->dinv = malloc(n * sizeof(double));
+  if (!state->dinv)
+    {
+      jacobi_free(state);
+      GSL_ERROR_NULL("failed to allocate diagonal", GSL_ENOMEM);
+    }
+
+  return state;
+}
+
+static void
+jacobi_free(void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+
+  if (state->dinv)
+    free(state->dinv);
+
+  free(state);
+}
+
+static int
+jacobi_init(const gsl_spmatrix *A, void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+  double *d = state->dinv;
+  size_t i;
+
+  for (i = 0; i < state->n; ++i)
+    d[i] = 0.0;
+
+  if (GSL_SPMATRIX_ISCOO(A))
+    {
+      /* duplicates of an assembled COO matrix are summed */
+      for (i = 0; i < A->nz; ++i)
+        {
+          if (A->i[i] == A->p[i])
+            d[A->i[i]] += A->data[i];
+        }
+    }
+  else
+    {
+      size_t j;
+      int p;
+
+      for (j = 0; j < state->n; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            {
+              if (A->i[p] == (int) j)
+                d[j] += A->data[p];
+            }
+        }
+    }
+
+  for (i = 0; i < state->n; ++i)
+    {
+      if (d[i] == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_ESING);
+        }
+
+      d[i] = 1.0 / d[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+jacobi_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < state->n; ++i)
+    {
+      double ri = gsl_vector_get(r, i);
+      gsl_vector_set(z, i, ri * state->dinv[i]);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* ILU(0) preconditioner */
+
+typedef struct
+{
+  size_t n;
+  gsl_spmatrix *LU; /* L (unit diagonal, not stored) and U, CSR format */
+  int *diag;        /* position of U(i,i) in row i */
+  int *pos;         /* workspace, size n */
+} ilu0_state_t;
+
+static void ilu0_free(void *vstate);
+
+static void *
+ilu0_alloc(const size_t n)
+{
+  ilu0_state_t *state;
+
+  state = calloc(1, sizeof(ilu0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ilu0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->diag = malloc(n * sizeof(int));
+  state->pos = malloc(n * sizeof(int));
+  if (!state->diag || !state->pos)
+    {
+      ilu0_free(state);
+      GSL_ERROR_NULL("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  return state;
+}
+
+static void
+ilu0_free(void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+
+  if (state->LU)
+    gsl_spmatrix_free(state->LU);
+
+  if (state->diag)
+    free(state->diag);
+
+  if (state->pos)
+    free(state->pos);
+
+  free(state);
+}
+
+/*
+ilu0_init()
+  Compute the ILU(0) factorization of A in place, using the IKJ
+variant of Gaussian elimination (Saad, algorithm 10.4) restricted
+to the pattern of A
+*/
+
+static int
+ilu0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+  const size_t N = state->n;
+  int *Ap, *Aj, *diag = state->diag, *pos = state->pos;
+  double *Ad;
+  size_t i;
+  int status;
+
+  if (state->LU)
+    gsl_spmatrix_free(state->LU);
+
+  state->LU = precond_csr(A);
+  if (state->LU == NULL)
+    {
+      GSL_ERROR("failed to copy matrix", GSL_ENOMEM);
+    }
+
+  Ap = state->LU->p;
+  Aj = state->LU->i;
+  Ad = state->LU->data;
+
+  status = precond_diag(state->LU, diag);
+  if (status)
+    return status;
+
+  for (i = 0; i < N; ++i)
+    pos[i] = -1;
+
+  for (i = 0; i < N; ++i)
+    {
+      int p, q;
+
+      for (p = Ap[i]; p < Ap[i + 1]; ++p)
+        pos[Aj[p]] = p;
+
+      /* eliminate the entries left of the diagonal, in column order */
+      for (p = Ap[i]; p < diag[i]; ++p)
+        {
+          const int k = Aj[p];
+          const double lik = Ad[p] / Ad[diag[k]];
+
+          Ad[p] = lik;
+
+          for (q = diag[k] + 1; q < Ap[k + 1]; ++q)
+            {
+              if (pos[Aj[q]] >= 0)
+                Ad[pos[Aj[q]]] -= lik * Ad[q];
+            }
+        }
+
+      for (p = Ap[i]; p < Ap[i + 1]; ++p)
+        pos[Aj[p]] = -1;
+
+      if (Ad[diag[i]] == 0.0)
+        {
+          GSL_ERROR("zero pivot in incomplete LU factorization", GSL_ESING);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+ilu0_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+  const int N = (int) state->n;
+  const int *Ap, *Aj, *diag = state->diag;
+  const double *Ad;
+  int i, p;
+
+  if (state->LU == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Ap = state->LU->p;
+  Aj = state->LU->i;
+  Ad = state->LU->data;
+
+  if (r != z)
+    gsl_vector_memcpy(z, r);
+
+  /* solve L y = r */
+  for (i = 0; i < N; ++i)
+    {
+      double sum = gsl_vector_get(z, i);
+
+      for (p = Ap[i]; p < diag[i]; ++p)
+        sum -= Ad[p] * gsl_vector_get(z, Aj[p]);
+
+      gsl_vector_set(z, i, sum);
+    }
+
+  /* solve U z = y */
+  for (i = N - 1; i >= 0; --i)
+    {
+      double sum = gsl_vector_get(z, i);
+
+      for (p = diag[i] + 1; p < Ap[i + 1]; ++p)
+        sum -= Ad[p] * gsl_vector_get(z, Aj[p]);
+
+      gsl_vector_set(z, i, sum / Ad[diag[i]]);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* IC(0) preconditioner */
+
+typedef struct
+{
+  size_t n;
+  gsl_spmatrix *L; /* lower triangular factor, CSR format, diagonal last */
+  double *work;    /* workspace, size n */
+} ic0_state_t;
+
+static void ic0_free(void *vstate);
+
+static void *
+ic0_alloc(const size_t n)
+{
+  ic0_state_t *state;
+
+  state = calloc(1, sizeof(ic0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ic0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->work = calloc(n, sizeof(double));
+  if (!state->work)
+    {
+      ic0_free(state);
+      GSL_ERROR_NULL("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  return state;
+}
+
+static void
+ic0_free(void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+
+  if (state->L)
+    gsl_spmatrix_free(state->L);
+
+  if (state->work)
+    free(state->work);
+
+  free(state);
+}
+
+/*
+ic0_init()
+  Compute the IC(0) factorization of a symmetric positive definite
+matrix A; only the lower triangle of A is referenced. Row i of L
+is computed from the rows above it,
+
+  L(i,k) = (A(i,k) - sum_{j<k} L(i,j) L(k,j)) / L(k,k)
+  L(i,i) = sqrt(A(i,i) - sum_{j<i} L(i,j)^2)
+
+with the sums restricted to the pattern of row i, which is
+scattered into a dense work vector
+*/
+
+static int
+ic0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+  const size_t N = state->n;
+  double *w = state->work;
+  gsl_spmatrix *L;
+  int *Lp, *Lj;
+  double *Ld;
+  size_t i;
+  int p, q, nz = 0;
+
+  if (state->L)
+    gsl_spmatrix_free(state->L);
+
+  state->L = L = precond_csr(A);
+  if (L == NULL)
+    {
+      GSL_ERROR("failed to copy matrix", GSL_ENOMEM);
+    }
+
+  Lp = L->p;
+  Lj = L->i;
+  Ld = L->data;
+
+  /* keep the lower triangle in place */
+  for (i = 0; i < N; ++i)
+    {
+      const int p0 = Lp[i];
+
+      Lp[i] = nz;
+
+      for (p = p0; p < Lp[i + 1] && Lj[p] <= (int) i; ++p)
+        {
+          Lj[nz] = Lj[p];
+          Ld[nz++] = Ld[p];
+        }
+
+      if (nz == Lp[i] || Lj[nz - 1] != (int) i)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_ESING);
+        }
+    }
+
+  Lp[N] = nz;
+  L->nz = nz;
+
+  for (i = 0; i < N; ++i)
+    {
+      const int d = Lp[i + 1] - 1;
+      double sum = 0.0;
+
+      for (p = Lp[i]; p < d; ++p)
+        {
+          const int k = Lj[p];
+          double lik = Ld[p];
+
+          for (q = Lp[k]; q < Lp[k + 1] - 1; ++q)
+            lik -= Ld[q] * w[Lj[q]];
+
+          lik /= Ld[Lp[k + 1] - 1];
+
+          Ld[p] = lik;
+          w[k] = lik;
+          sum += lik * lik;
+        }
+
+      for (p = Lp[i]; p < d; ++p)
+        w[Lj[p]] = 0.0;
+
+      sum = Ld[d] - sum;
+      if (sum <= 0.0)
+        {
+          GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+        }
+
+      Ld[d] = sqrt(sum);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+ic0_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+  const int N = (int) state->n;
+  const int *Lp, *Lj;
+  const double *Ld;
+  int i, p;
+
+  if (state->L == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Lp = state->L->p;
+  Lj = state->L->i;
+  Ld = state->L->data;
+
+  if (r != z)
+    gsl_vector_memcpy(z, r);
+
+  /* solve L y = r */
+  for (i = 0; i < N; ++i)
+    {
+      double sum = gsl_vector_get(z, i);
+
+      for (p = Lp[i]; p < Lp[i + 1] - 1; ++p)
+        sum -= Ld[p] * gsl_vector_get(z, Lj[p]);
+
+      gsl_vector_set(z, i, sum / Ld[Lp[i + 1] - 1]);
+    }
+
+  /* solve L^T z = y, by columns of L^T */
+  for (i = N - 1; i >= 0; --i)
+    {
+      double zi = gsl_vector_get(z, i) / Ld[Lp[i + 1] - 1];
+
+      gsl_vector_set(z, i, zi);
+
+      for (p = Lp[i]; p < Lp[i + 1] - 1; ++p)
+        {
+          double *zj = gsl_vector_ptr(z, Lj[p]);
+          *zj -= Ld[p] * zi;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* SSOR preconditioner */
+
+typedef struct
+{
+  size_t n;
+  gsl_spmatrix *A; /* copy of A, CSR format */
+  int *diag;       /* position of A(i,i) in row i */
+  double omega;    /* relaxation parameter in (0,2) */
+} ssor_state_t;
+
+static void ssor_free(void *vstate);
+
+static void *
+ssor_alloc(const size_t n)
+{
+  ssor_state_t *state;
+
+  state = calloc(1, sizeof(ssor_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ssor state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->omega = 1.0;
+
+  state->diag = malloc(n * sizeof(int));
+  if (!state->diag)
+    {
+      ssor_free(state);
+      GSL_ERROR_NULL("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  return state;
+}
+
+static void
+ssor_free(void *vstate)
+{
+  ssor_state_t *state = (ssor_state_t *) vstate;
+
+  if (state->A)
+    gsl_spmatrix_free(state->A);
+
+  if (state->diag)
+    free(state->diag);
+
+  free(state);
+}
+
+static int
+ssor_init(const gsl_spmatrix *A, void *vstate)
+{
+  ssor_state_t *state = (ssor_state_t *) vstate;
+
+  if (state->A)
+    gsl_spmatrix_free(state->A);
+
+  state->A = precond_csr(A);
+  if (state->A == NULL)
+    {
+      GSL_ERROR("failed to copy matrix", GSL_ENOMEM);
+    }
+
+  return precond_diag(state->A, state->diag);
+}
+
+/*
+ssor_apply()
+  Compute z = M^{-1} r with one forward and one backward SOR sweep:
+
+  (D + w L) y = r
+  (D + w U) z = D y
+  z <- w (2 - w) z
+*/
+
+static int
+ssor_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  ssor_state_t *state = (ssor_state_t *) vstate;
+  const int N = (int) state->n;
+  const double omega = state->omega;
+  const int *Ap, *Aj, *diag = state->diag;
+  const double *Ad;
+  int i, p;
+
+  if (state->A == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Ap = state->A->p;
+  Aj = state->A->i;
+  Ad = state->A->data;
+
+  if (r != z)
+    gsl_vector_memcpy(z, r);
+
+  for (i = 0; i < N; ++i)
+    {
+      double sum = 0.0;
+
+      for (p = Ap[i]; p < diag[i]; ++p)
+        sum += Ad[p] * gsl_vector_get(z, Aj[p]);
+
+      gsl_vector_set(z, i, (gsl_vector_get(z, i) - omega * sum) / Ad[diag[i]]);
+    }
+
+  /* z(i) still holds y(i) when row i is reached */
+  for (i = N - 1; i >= 0; --i)
+    {
+      double sum = 0.0;
+
+      for (p = diag[i] + 1; p < Ap[i + 1]; ++p)
+        sum += Ad[p] * gsl_vector_get(z, Aj[p]);
+
+      gsl_vector_set(z, i, gsl_vector_get(z, i) - omega * sum / Ad[diag[i]]);
+    }
+
+  gsl_vector_scale(z, omega * (2.0 - omega));
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_splinalg_precond_type jacobi_type =
+{
+  "jacobi",
+  &jacobi_alloc,
+  &jacobi_init,
+  &jacobi_apply,
+  &jacobi_free
+};
+
+static const gsl_splinalg_precond_type ilu0_type =
+{
+  "ilu0",
+  &ilu0_alloc,
+  &ilu0_init,
+  &ilu0_apply,
+  &ilu0_free
+};
+
+static const gsl_splinalg_precond_type ic0_type =
+{
+  "ic0",
+  &ic0_alloc,
+  &ic0_init,
+  &ic0_apply,
+  &ic0_free
+};
+
+static const gsl_splinalg_precond_type ssor_type =
+{
+  "ssor",
+  &ssor_alloc,
+  &ssor_init,
+  &ssor_apply,
+  &ssor_free
+};
+
+const gsl_splinalg_precond_type * gsl_splinalg_precond_jacobi = &jacobi_type;
+const gsl_splinalg_precond_type * gsl_splinalg_precond_ilu0 = &ilu0_type;
+const gsl_splinalg_precond_type * gsl_splinalg_precond_ic0 = &ic0_type;
+const gsl_splinalg_precond_type * gsl_splinalg_precond_ssor = &ssor_type;
+
+/*
+gsl_splinalg_precond_ssor_set_omega()
+  Set the relaxation parameter of an SSOR preconditioner
+
+Inputs: omega - relaxation parameter, 0 < omega < 2; the default
+                omega = 1 gives the symmetric Gauss-Seidel
+                preconditioner
+        P     - SSOR preconditioner
+*/
+
+int
+gsl_splinalg_precond_ssor_set_omega(const double omega,
+                                    gsl_splinalg_precond *P)
+{
+  if (P->type != gsl_splinalg_precond_ssor)
+    {
+      GSL_ERROR("preconditioner is not of type ssor", GSL_EINVAL);
+    }
+  else if (omega <= 0.0 || omega >= 2.0)
+    {
+      GSL_ERROR("omega must be in (0,2)", GSL_EDOM);
+    }
+  else
+    {
+      ssor_state_t *state = (ssor_state_t *) P->state;
+      state->omega = omega;
+      return GSL_SUCCESS;
+    }
+}
@@ -29,6 +29,9 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_blas.h>
+#include <gsl/gsl_complex_math.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_sort_vector.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
@@ -337,6 +340,964 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
     gsl_spmatrix_free(B);
 } /* test_random() */
 
+/* 5-point Laplacian on an nx-by-nx grid, plus shift*I, in triplet format */
+static gsl_spmatrix *
+create_laplace2d(const size_t nx, const double shift)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *A = gsl_spmatrix_alloc(n, n);
+  size_t i, j;
+
+  for (i = 0; i < nx; ++i)
+    {
+      for (j = 0; j < nx; ++j)
+        {
+          size_t k = i * nx + j;
+
+          gsl_spmatrix_set(A, k, k, 4.0 + shift);
+
+          if (i > 0)
+            gsl_spmatrix_set(A, k, k - nx, -1.0);
+          if (i < nx - 1)
+            gsl_spmatrix_set(A, k, k + nx, -1.0);
+          if (j > 0)
+            gsl_spmatrix_set(A, k, k - 1, -1.0);
+          if (j < nx - 1)
+            gsl_spmatrix_set(A, k, k + 1, -1.0);
+        }
+    }
+
+  return A;
+}
+
+/* check ||b - A x|| <= tol * ||A|| ||x|| */
+static void
+test_residual(const gsl_spmatrix *A, const gsl_vector *b, const gsl_vector *x,
+              const double tol, const char *desc)
+{
+  gsl_vector *r = gsl_vector_alloc(b->size);
+  double normr, normx, normA;
+  int status;
+
+  gsl_vector_memcpy(r, b);
+  gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+
+  normr = gsl_blas_dnrm2(r);
+  normx = gsl_blas_dnrm2(x);
+  normA = gsl_spmatrix_norm1(A);
+
+  status = (normr <= tol * normA * normx) != 1;
+  gsl_test(status, "%s residual normr=%.12e normx=%.12e", desc, normr, normx);
+
+  gsl_vector_free(r);
+}
+
+static void
+test_cholesky_laplace(const size_t nx, const gsl_rng *r)
+{
+  const size_t n = nx * nx;
+  const size_t nrhs = 3;
+  const double tol = 1.0e2 * GSL_DBL_EPSILON;
+  gsl_spmatrix *T = create_laplace2d(nx, 0.1);
+  gsl_spmatrix *A = gsl_spmatrix_ccs(T);
+  gsl_splinalg_cholesky_workspace *w = gsl_splinalg_cholesky_alloc(n);
+  gsl_vector *b = gsl_vector_alloc(n);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_matrix *B = gsl_matrix_alloc(n, nrhs);
+  gsl_matrix *X = gsl_matrix_alloc(n, nrhs);
+  size_t nnz_natural, nnz_amd, j;
+  int status;
+
+  create_random_vector(b, r);
+
+  /* natural ordering */
+  status = gsl_splinalg_cholesky_symbolic(A, GSL_SPLINALG_ORDER_NATURAL, w);
+  status += gsl_splinalg_cholesky_numeric(A, w);
+  gsl_test(status, "cholesky laplace natural nx=%zu status", nx);
+  nnz_natural = gsl_spmatrix_nnz(w->L);
+
+  gsl_splinalg_cholesky_solve(w, b, x);
+  test_residual(A, b, x, tol, "cholesky laplace natural");
+
+  /* AMD ordering */
+  status = gsl_splinalg_cholesky_decomp(A, w);
+  gsl_test(status, "cholesky laplace amd nx=%zu status", nx);
+  gsl_test(gsl_permutation_valid(w->perm), "cholesky laplace amd nx=%zu permutation", nx);
+  nnz_amd = gsl_spmatrix_nnz(w->L);
+
+  if (nx >= 10)
+    gsl_test(nnz_amd >= nnz_natural, "cholesky laplace nx=%zu fill amd=%zu natural=%zu",
+             nx, nnz_amd, nnz_natural);
+
+  gsl_splinalg_cholesky_solve(w, b, x);
+  test_residual(A, b, x, tol, "cholesky laplace amd");
+
+  /* refactor new values with the same pattern */
+  gsl_spmatrix_scale(A, 3.0);
+  status = gsl_splinalg_cholesky_numeric(A, w);
+  gsl_test(status, "cholesky laplace refactor nx=%zu status", nx);
+  gsl_splinalg_cholesky_solve(w, b, x);
+  test_residual(A, b, x, tol, "cholesky laplace refactor");
+
+  /* several right hand sides */
+  for (j = 0; j < nrhs; ++j)
+    {
+      gsl_vector_view v = gsl_matrix_column(B, j);
+      create_random_vector(&v.vector, r);
+    }
+
+  gsl_splinalg_cholesky_solve_mat(w, B, X);
+
+  for (j = 0; j < nrhs; ++j)
+    {
+      gsl_vector_view bj = gsl_matrix_column(B, j);
+      gsl_vector_view xj = gsl_matrix_column(X, j);
+      gsl_vector_memcpy(x, &xj.vector);
+      test_residual(A, &bj.vector, x, tol, "cholesky laplace solve_mat");
+    }
+
+  /* indefinite matrix */
+  if (nx >= 5)
+    {
+      gsl_spmatrix_free(T);
+      gsl_spmatrix_free(A);
+      T = create_laplace2d(nx, -2.0);
+      A = gsl_spmatrix_ccs(T);
+
+      gsl_set_error_handler_off();
+      status = gsl_splinalg_cholesky_decomp(A, w);
+      gsl_test(status != GSL_EDOM, "cholesky laplace indefinite nx=%zu status=%d", nx, status);
+      gsl_set_error_handler(NULL);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_matrix_free(B);
+  gsl_matrix_free(X);
+  gsl_splinalg_cholesky_free(w);
+}
+
+static void
+test_LU_matrix(const gsl_spmatrix *A, const int ordering, const gsl_rng *r,
+               const char *desc)
+{
+  const size_t n = A->size1;
+  const size_t nrhs = 2;
+  const double tol = 1.0e3 * GSL_DBL_EPSILON;
+  gsl_splinalg_LU_workspace *w = gsl_splinalg_LU_alloc(n);
+  gsl_vector *b = gsl_vector_alloc(n);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_matrix *B = gsl_matrix_alloc(n, nrhs);
+  gsl_matrix *X = gsl_matrix_alloc(n, nrhs);
+  size_t j;
+  int status;
+
+  create_random_vector(b, r);
+
+  status = gsl_splinalg_LU_symbolic(A, ordering, w);
+  status += gsl_splinalg_LU_numeric(A, w);
+  gsl_test(status, "%s n=%zu ordering=%d status", desc, n, ordering);
+  gsl_test(gsl_permutation_valid(w->p), "%s n=%zu row permutation", desc, n);
+  gsl_test(gsl_permutation_valid(w->q), "%s n=%zu column permutation", desc, n);
+
+  gsl_splinalg_LU_solve(w, b, x);
+  test_residual(A, b, x, tol, desc);
+
+  for (j = 0; j < nrhs; ++j)
+    {
+      gsl_vector_view v = gsl_matrix_column(B, j);
+      create_random_vector(&v.vector, r);
+    }
+
+  gsl_splinalg_LU_solve_mat(w, B, X);
+
+  for (j = 0; j < nrhs; ++j)
+    {
+      gsl_vector_view bj = gsl_matrix_column(B, j);
+      gsl_vector_view xj = gsl_matrix_column(X, j);
+      gsl_vector_memcpy(x, &xj.vector);
+      test_residual(A, &bj.vector, x, tol, desc);
+    }
+
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_matrix_free(B);
+  gsl_matrix_free(X);
+  gsl_splinalg_LU_free(w);
+}
+
+static void
+test_LU_random(const size_t n, const double density, const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_random_sparse(n, n, density, r);
+  gsl_spmatrix *A = gsl_spmatrix_ccs(T);
+
+  test_LU_matrix(A, GSL_SPLINALG_ORDER_NATURAL, r, "LU random");
+  test_LU_matrix(A, GSL_SPLINALG_ORDER_AMD, r, "LU random");
+  test_LU_matrix(A, GSL_SPLINALG_ORDER_AMD_COL, r, "LU random");
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+}
+
+/* upwind convection-diffusion on an nx-by-nx grid, in triplet format */
+static gsl_spmatrix *
+create_convdiff2d(const size_t nx, const double c)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *A = gsl_spmatrix_alloc(n, n);
+  size_t i, j;
+
+  for (i = 0; i < nx; ++i)
+    {
+      for (j = 0; j < nx; ++j)
+        {
+          size_t k = i * nx + j;
+
+          gsl_spmatrix_set(A, k, k, 4.0 + c);
+
+          if (i > 0)
+            gsl_spmatrix_set(A, k, k - nx, -1.0 - c);
+          if (i < nx - 1)
+            gsl_spmatrix_set(A, k, k + nx, -1.0);
+          if (j > 0)
+            gsl_spmatrix_set(A, k, k - 1, -1.0);
+          if (j < nx - 1)
+            gsl_spmatrix_set(A, k, k + 1, -1.0);
+        }
+    }
+
+  return A;
+}
+
+static void
+test_LU_convdiff(const size_t nx, const gsl_rng *r)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *T = create_convdiff2d(nx, 20.0);
+  gsl_spmatrix *A;
+  gsl_splinalg_LU_workspace *w = gsl_splinalg_LU_alloc(n);
+  size_t i;
+  int status;
+
+  A = gsl_spmatrix_ccs(T);
+
+  test_LU_matrix(A, GSL_SPLINALG_ORDER_AMD, r, "LU convdiff");
+  test_LU_matrix(A, GSL_SPLINALG_ORDER_AMD_COL, r, "LU convdiff");
+
+  /* singular matrix: zero out column 0 */
+  for (i = (size_t) A->p[0]; i < (size_t) A->p[1]; ++i)
+    A->data[i] = 0.0;
+
+  gsl_set_error_handler_off();
+  status = gsl_splinalg_LU_decomp(A, w);
+  gsl_test(status != GSL_EDOM, "LU convdiff singular status=%d", status);
+  gsl_set_error_handler(NULL);
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_splinalg_LU_free(w);
+}
+
+/* solve A x = b with solver T and preconditioner P (may be NULL) */
+static void
+test_krylov(const gsl_splinalg_itersolve_type *T, const size_t m,
+            const gsl_splinalg_precond_type *P, const gsl_spmatrix *A,
+            const gsl_rng *r, const char *desc)
+{
+  const size_t n = A->size1;
+  const double tol = 1.0e-10;
+  const size_t max_iter = 100;
+  size_t iter = 0;
+  gsl_vector *b = gsl_vector_alloc(n);
+  gsl_vector *x = gsl_vector_calloc(n);
+  gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(T, n, m);
+  gsl_splinalg_precond *M = NULL;
+  const char *pname = "none";
+  int status;
+
+  create_random_vector(b, r);
+
+  if (P != NULL)
+    {
+      M = gsl_splinalg_precond_alloc(P, n);
+      pname = gsl_splinalg_precond_name(M);
+
+      status = gsl_splinalg_precond_init(A, M);
+      gsl_test(status, "%s %s/%s precond init status=%d",
+               desc, gsl_splinalg_itersolve_name(w), pname, status);
+
+      gsl_splinalg_itersolve_set_precond(M, w);
+    }
+
+  do
+    {
+      status = gsl_splinalg_itersolve_iterate(A, b, tol, x, w);
+    }
+  while (status == GSL_CONTINUE && ++iter < max_iter);
+
+  gsl_test(status, "%s %s/%s status=%d", desc,
+           gsl_splinalg_itersolve_name(w), pname, status);
+
+  /* check that the residual satisfies ||r|| <= tol*||b|| */
+  {
+    gsl_vector *res = gsl_vector_alloc(n);
+    double normr, normb;
+
+    gsl_vector_memcpy(res, b);
+    gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, res);
+
+    normr = gsl_blas_dnrm2(res);
+    normb = gsl_blas_dnrm2(b);
+
+    status = (normr <= tol*normb) != 1;
+    gsl_test(status, "%s %s/%s residual normr=%.12e normb=%.12e",
+             desc, gsl_splinalg_itersolve_name(w), pname, normr, normb);
+
+    /* the two residuals differ by rounding of order eps*||b|| */
+    gsl_test_abs(gsl_splinalg_itersolve_normr(w), normr, 1.0e-12 * normb,
+                 "%s %s/%s normr", desc, gsl_splinalg_itersolve_name(w),
+                 pname);
+
+    gsl_vector_free(res);
+  }
+
+  gsl_splinalg_itersolve_free(w);
+  gsl_splinalg_precond_free(M);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+}
+
+/*
+test_precond_exact()
+  ILU(0) and IC(0) of a tridiagonal matrix have no dropped fill,
+so M = A and M^{-1} A x = x
+*/
+static void
+test_precond_exact(const size_t n, const gsl_rng *r)
+{
+  const double tol = 1.0e-12;
+  const gsl_splinalg_precond_type *P[] = { gsl_splinalg_precond_ilu0,
+                                           gsl_splinalg_precond_ic0 };
+  gsl_spmatrix *T = gsl_spmatrix_alloc(n, n);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *z = gsl_vector_alloc(n);
+  size_t i, k, fmt;
+
+  /* symmetric diagonally dominant tridiagonal matrix */
+  for (i = 0; i < n; ++i)
+    {
+      gsl_spmatrix_set(T, i, i, 3.0 + gsl_rng_uniform(r));
+
+      if (i > 0)
+        {
+          double a = gsl_rng_uniform(r) - 0.5;
+          gsl_spmatrix_set(T, i, i - 1, a);
+          gsl_spmatrix_set(T, i - 1, i, a);
+        }
+    }
+
+  create_random_vector(x, r);
+
+  for (fmt = 0; fmt < 3; ++fmt)
+    {
+      gsl_spmatrix *A;
+
+      if (fmt == 0)
+        A = T;
+      else if (fmt == 1)
+        A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSC);
+      else
+        A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, A, x, 0.0, y);
+
+      for (k = 0; k < 2; ++k)
+        {
+          gsl_splinalg_precond *M = gsl_splinalg_precond_alloc(P[k], n);
+          const char *desc = gsl_splinalg_precond_name(M);
+          int status;
+
+          status = gsl_splinalg_precond_init(A, M);
+          gsl_test(status, "%s exact n=%zu %s status=%d", desc, n,
+                   gsl_spmatrix_type(A), status);
+
+          /* z = M^{-1} y, then in place */
+          gsl_splinalg_precond_apply(y, z, M);
+          for (i = 0; i < n; ++i)
+            {
+              gsl_test_rel(gsl_vector_get(z, i), gsl_vector_get(x, i), tol,
+                           "%s exact n=%zu %s i=%zu", desc, n,
+                           gsl_spmatrix_type(A), i);
+            }
+
+          gsl_vector_memcpy(z, y);
+          gsl_splinalg_precond_apply(z, z, M);
+          for (i = 0; i < n; ++i)
+            {
+              gsl_test_rel(gsl_vector_get(z, i), gsl_vector_get(x, i), tol,
+                           "%s exact in place n=%zu %s i=%zu", desc, n,
+                           gsl_spmatrix_type(A), i);
+            }
+
+          gsl_splinalg_precond_free(M);
+        }
+
+      if (fmt > 0)
+        gsl_spmatrix_free(A);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(z);
+}
+
+static void
+test_precond(const size_t nx, const gsl_rng *r)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *T = create_laplace2d(nx, 0.0);
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+  gsl_spmatrix *B = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSC);
+  gsl_spmatrix *S = create_laplace2d(nx, -0.5);
+  gsl_spmatrix *C = create_convdiff2d(nx, 20.0);
+  gsl_spmatrix *D = gsl_spmatrix_compress(C, GSL_SPMATRIX_CSR);
+  gsl_splinalg_precond *M;
+  int status;
+
+  /* symmetric positive definite */
+  test_krylov(gsl_splinalg_itersolve_cg, 0, NULL, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_cg, 0, gsl_splinalg_precond_jacobi, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_cg, 0, gsl_splinalg_precond_ssor, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_cg, 0, gsl_splinalg_precond_ic0, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_cg, 0, gsl_splinalg_precond_ic0, B, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_cg, 10, gsl_splinalg_precond_ic0, T, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_minres, 0, NULL, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_minres, 0, gsl_splinalg_precond_ic0, B, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_gmres, 0, gsl_splinalg_precond_ic0, A, r, "laplace");
+  test_krylov(gsl_splinalg_itersolve_fgmres, 20, gsl_splinalg_precond_ssor, A, r, "laplace");
+
+  /* symmetric indefinite */
+  test_krylov(gsl_splinalg_itersolve_minres, 0, NULL, S, r, "indefinite");
+
+  /* nonsymmetric */
+  test_krylov(gsl_splinalg_itersolve_bicgstab, 0, NULL, D, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_bicgstab, 0, gsl_splinalg_precond_jacobi, C, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_bicgstab, 0, gsl_splinalg_precond_ilu0, D, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_bicgstab, 0, gsl_splinalg_precond_ssor, D, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_gmres, 0, gsl_splinalg_precond_ilu0, D, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_fgmres, 0, NULL, D, r, "convdiff");
+  test_krylov(gsl_splinalg_itersolve_fgmres, 5, gsl_splinalg_precond_ilu0, D, r, "convdiff");
+
+  /* preconditioning reduces the number of CG iterations */
+  if (nx == 30)
+    {
+      const gsl_splinalg_itersolve_type *TT = gsl_splinalg_itersolve_cg;
+      gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(TT, n, 40);
+      gsl_vector *b = gsl_vector_alloc(n);
+      gsl_vector *x = gsl_vector_alloc(n);
+
+      M = gsl_splinalg_precond_alloc(gsl_splinalg_precond_ic0, n);
+      gsl_splinalg_precond_init(A, M);
+      create_random_vector(b, r);
+
+      gsl_vector_set_zero(x);
+      status = gsl_splinalg_itersolve_iterate(A, b, 1.0e-8, x, w);
+      gsl_test(status != GSL_CONTINUE, "cg/none 40 iterations status=%d", status);
+
+      gsl_splinalg_itersolve_set_precond(M, w);
+      gsl_vector_set_zero(x);
+      status = gsl_splinalg_itersolve_iterate(A, b, 1.0e-8, x, w);
+      gsl_test(status, "cg/ic0 40 iterations status=%d", status);
+
+      gsl_splinalg_itersolve_free(w);
+      gsl_splinalg_precond_free(M);
+      gsl_vector_free(b);
+      gsl_vector_free(x);
+    }
+
+  /* IC(0) of a nonsymmetric matrix breaks down */
+  gsl_set_error_handler_off();
+
+  M = gsl_splinalg_precond_alloc(gsl_splinalg_precond_ic0, n);
+  status = gsl_splinalg_precond_init(D, M);
+  gsl_test(nx > 1 && status != GSL_EDOM, "ic0 convdiff status=%d", status);
+  gsl_splinalg_precond_free(M);
+
+  M = gsl_splinalg_precond_alloc(gsl_splinalg_precond_ssor, n);
+  status = gsl_splinalg_precond_ssor_set_omega(2.0, M);
+  gsl_test(status != GSL_EDOM, "ssor omega=2 status=%d", status);
+  status = gsl_splinalg_precond_ssor_set_omega(1.5, M);
+  gsl_test(status, "ssor omega=1.5 status=%d", status);
+  gsl_splinalg_precond_free(M);
+
+  gsl_set_error_handler(NULL);
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+  gsl_spmatrix_free(S);
+  gsl_spmatrix_free(C);
+  gsl_spmatrix_free(D);
+}
+
+/* matrix-free 5-point Laplacian on an nx-by-nx grid, plus shift*I */
+typedef struct
+{
+  size_t nx;
+  double shift;
+} laplace2d_params;
+
+static int
+laplace2d_mult(CBLAS_TRANSPOSE_t TransA, const gsl_matrix *X, gsl_matrix *Y,
+               void *params)
+{
+  const laplace2d_params *p = (const laplace2d_params *) params;
+  const size_t nx = p->nx;
+  size_t c, i, j;
+
+  (void) TransA; /* operator is symmetric */
+
+  for (c = 0; c < X->size2; ++c)
+    {
+      for (i = 0; i < nx; ++i)
+        {
+          for (j = 0; j < nx; ++j)
+            {
+              size_t k = i * nx + j;
+              double y = (4.0 + p->shift) * gsl_matrix_get(X, k, c);
+
+              if (i > 0)
+                y -= gsl_matrix_get(X, k - nx, c);
+              if (i < nx - 1)
+                y -= gsl_matrix_get(X, k + nx, c);
+              if (j > 0)
+                y -= gsl_matrix_get(X, k - 1, c);
+              if (j < nx - 1)
+                y -= gsl_matrix_get(X, k + 1, c);
+
+              gsl_matrix_set(Y, k, c, y);
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* solve A x = b with solver T applied to the operator op, and check
+ * the residual with the equivalent sparse matrix A */
+static void
+test_krylov_op(const gsl_splinalg_itersolve_type *T,
+               const gsl_linalg_operator *op,
+               const gsl_splinalg_precond_type *P, const gsl_spmatrix *A,
+               const gsl_rng *r, const char *desc)
+{
+  const size_t n = A->size1;
+  const double tol = 1.0e-10;
+  const size_t max_iter = 100;
+  size_t iter = 0;
+  gsl_vector *b = gsl_vector_alloc(n);
+  gsl_vector *x = gsl_vector_calloc(n);
+  gsl_vector *res = gsl_vector_alloc(n);
+  gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(T, n, 0);
+  gsl_splinalg_precond *M = NULL;
+  const char *pname = "none";
+  double normr, normb;
+  int status;
+
+  create_random_vector(b, r);
+
+  if (P != NULL)
+    {
+      M = gsl_splinalg_precond_alloc(P, n);
+      pname = gsl_splinalg_precond_name(M);
+      gsl_splinalg_precond_init(A, M);
+      gsl_splinalg_itersolve_set_precond(M, w);
+    }
+
+  do
+    {
+      status = gsl_splinalg_itersolve_iterate_op(op, b, tol, x, w);
+    }
+  while (status == GSL_CONTINUE && ++iter < max_iter);
+
+  gsl_test(status, "%s operator %s/%s status=%d", desc,
+           gsl_splinalg_itersolve_name(w), pname, status);
+
+  gsl_vector_memcpy(res, b);
+  gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, res);
+
+  normr = gsl_blas_dnrm2(res);
+  normb = gsl_blas_dnrm2(b);
+
+  status = (normr <= tol*normb) != 1;
+  gsl_test(status, "%s operator %s/%s residual normr=%.12e normb=%.12e",
+           desc, gsl_splinalg_itersolve_name(w), pname, normr, normb);
+
+  gsl_splinalg_itersolve_free(w);
+  gsl_splinalg_precond_free(M);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(res);
+}
+
+static void
+test_operator(const size_t nx, const gsl_rng *r)
+{
+  const size_t n = nx * nx;
+  laplace2d_params params;
+  gsl_linalg_operator op, opA;
+  gsl_spmatrix *T = create_laplace2d(nx, 0.0);
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+  gsl_spmatrix *C = create_convdiff2d(nx, 20.0);
+  gsl_spmatrix *D = gsl_spmatrix_compress(C, GSL_SPMATRIX_CSC);
+  gsl_matrix *X = gsl_matrix_alloc(n, 2);
+  gsl_matrix *Y = gsl_matrix_alloc(n, 2);
+  gsl_vector *y = gsl_vector_alloc(n);
+  size_t i, j;
+
+  params.nx = nx;
+  params.shift = 0.0;
+
+  op.size1 = n;
+  op.size2 = n;
+  op.mult = &laplace2d_mult;
+  op.params = &params;
+
+  /* matrix-free operator */
+  test_krylov_op(gsl_splinalg_itersolve_cg, &op, NULL, A, r, "laplace");
+  test_krylov_op(gsl_splinalg_itersolve_cg, &op, gsl_splinalg_precond_ic0, A, r, "laplace");
+  test_krylov_op(gsl_splinalg_itersolve_minres, &op, NULL, A, r, "laplace");
+  test_krylov_op(gsl_splinalg_itersolve_bicgstab, &op, NULL, A, r, "laplace");
+  test_krylov_op(gsl_splinalg_itersolve_gmres, &op, gsl_splinalg_precond_jacobi, A, r, "laplace");
+  test_krylov_op(gsl_splinalg_itersolve_fgmres, &op, NULL, A, r, "laplace");
+
+  /* operator of a sparse matrix */
+  gsl_splinalg_operator_init(D, &opA);
+  test_krylov_op(gsl_splinalg_itersolve_bicgstab, &opA, gsl_splinalg_precond_ilu0, D, r, "convdiff");
+  test_krylov_op(gsl_splinalg_itersolve_gmres, &opA, NULL, D, r, "convdiff");
+
+  /* apply and apply-transpose of the sparse matrix operator */
+  for (j = 0; j < 2; ++j)
+    {
+      CBLAS_TRANSPOSE_t TransA = (j == 0) ? CblasNoTrans : CblasTrans;
+      gsl_vector_view x = gsl_matrix_column(X, 1);
+      gsl_vector_view yc = gsl_matrix_column(Y, 1);
+
+      gsl_matrix_set_zero(X);
+      create_random_vector(&x.vector, r);
+      gsl_spblas_dgemv(TransA, 1.0, C, &x.vector, 0.0, y);
+      opA.mult(TransA, X, Y, opA.params);
+
+      for (i = 0; i < n; ++i)
+        {
+          gsl_test_rel(gsl_vector_get(&yc.vector, i), gsl_vector_get(y, i),
+                       1.0e-14, "operator convdiff nx=%zu trans=%zu i=%zu",
+                       nx, j, i);
+          gsl_test_abs(gsl_matrix_get(Y, i, 0), 0.0, 0.0,
+                       "operator convdiff nx=%zu trans=%zu column 0 i=%zu",
+                       nx, j, i);
+        }
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C);
+  gsl_spmatrix_free(D);
+  gsl_matrix_free(X);
+  gsl_matrix_free(Y);
+  gsl_vector_free(y);
+}
+
+/* random sparse symmetric matrix with a spread diagonal */
+static gsl_spmatrix *
+create_random_symm(const size_t n, const double density, const gsl_rng *r)
+{
+  gsl_spmatrix *B = create_random_sparse(n, n, density, r);
+  gsl_spmatrix *A = gsl_spmatrix_alloc(n, n);
+  size_t i;
+
+  for (i = 0; i < B->nz; ++i)
+    {
+      size_t ii = B->i[i];
+      size_t jj = B->p[i];
+      double aij = 2.0 * B->data[i] - 1.0;
+
+      gsl_spmatrix_set(A, ii, jj, gsl_spmatrix_get(A, ii, jj) + aij);
+      gsl_spmatrix_set(A, jj, ii, gsl_spmatrix_get(A, jj, ii) + aij);
+    }
+
+  for (i = 0; i < n; ++i)
+    gsl_spmatrix_set(A, i, i, gsl_spmatrix_get(A, i, i) + (double) i / n);
+
+  gsl_spmatrix_free(B);
+
+  return A;
+}
+
+/* return the sort key of an eigenvalue, smallest first */
+static double
+eigen_key(const int which, const gsl_complex z)
+{
+  if (which == GSL_SPLINALG_EIGEN_LARGEST_MAG)
+    return -gsl_complex_abs(z);
+  else if (which == GSL_SPLINALG_EIGEN_LARGEST_REAL)
+    return -GSL_REAL(z);
+  else
+    return GSL_REAL(z);
+}
+
+/* compare k extremal eigenpairs of a symmetric operator with the
+ * dense eigensolver; Ad is the dense matrix of op */
+static void
+test_eigen_symm_op(const gsl_linalg_operator *op, const gsl_matrix *Ad,
+                   const size_t k, const size_t m, const int which,
+                   const char *desc)
+{
+  const size_t n = Ad->size1;
+  const double tol = 1.0e-10;
+  gsl_splinalg_eigen_workspace *w = gsl_splinalg_eigen_alloc(n, k, m);
+  gsl_vector *eval = gsl_vector_alloc(k);
+  gsl_matrix *evec = gsl_matrix_alloc(n, k);
+  gsl_matrix *A = gsl_matrix_alloc(n, n);
+  gsl_vector *d = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_eigen_symm_workspace *wd = gsl_eigen_symm_alloc(n);
+  double normA = 0.0;
+  size_t i;
+  int status;
+
+  gsl_matrix_memcpy(A, Ad);
+  gsl_eigen_symm(A, d, wd);
+
+  for (i = 0; i < n; ++i)
+    {
+      double di = gsl_vector_get(d, i);
+      gsl_vector_set(d, i, eigen_key(which, gsl_complex_rect(di, 0.0)));
+      normA = GSL_MAX(normA, fabs(di));
+    }
+
+  gsl_sort_vector(d);
+
+  status = gsl_splinalg_eigen_symmv_op(op, which, eval, evec, w);
+  gsl_test(status, "%s symmv n=%zu k=%zu which=%d status=%d restarts=%zu",
+           desc, n, k, which, status, w->nrestarts);
+
+  for (i = 0; i < k; ++i)
+    {
+      gsl_vector_const_view x = gsl_matrix_const_column(evec, i);
+      double theta = gsl_vector_get(eval, i);
+      double normres;
+
+      gsl_test_abs(eigen_key(which, gsl_complex_rect(theta, 0.0)),
+                   gsl_vector_get(d, i), 1.0e-8 * normA,
+                   "%s symmv n=%zu k=%zu which=%d eval %zu",
+                   desc, n, k, which, i);
+
+      /* ||A x - theta x|| */
+      gsl_blas_dgemv(CblasNoTrans, 1.0, Ad, &x.vector, 0.0, y);
+      gsl_blas_daxpy(-theta, &x.vector, y);
+      normres = gsl_blas_dnrm2(y);
+
+      gsl_test(normres > 10.0 * tol * GSL_MAX(fabs(theta), 1.0e-10),
+               "%s symmv n=%zu k=%zu which=%d residual %zu: %e",
+               desc, n, k, which, i, normres);
+      gsl_test_rel(gsl_blas_dnrm2(&x.vector), 1.0, 1.0e-12,
+                   "%s symmv n=%zu k=%zu which=%d norm %zu",
+                   desc, n, k, which, i);
+    }
+
+  gsl_splinalg_eigen_free(w);
+  gsl_vector_free(eval);
+  gsl_matrix_free(evec);
+  gsl_matrix_free(A);
+  gsl_vector_free(d);
+  gsl_vector_free(y);
+  gsl_eigen_symm_free(wd);
+}
+
+static void
+test_eigen_symm(const size_t n, const size_t k, const size_t m,
+                const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_random_symm(n, 2.0 / n, r);
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+  gsl_matrix *Ad = gsl_matrix_alloc(n, n);
+  gsl_linalg_operator op;
+
+  gsl_spmatrix_sp2d(Ad, T);
+  gsl_splinalg_operator_init(A, &op);
+
+  test_eigen_symm_op(&op, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_MAG, "random");
+  test_eigen_symm_op(&op, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_REAL, "random");
+  test_eigen_symm_op(&op, Ad, k, m, GSL_SPLINALG_EIGEN_SMALLEST_REAL, "random");
+
+  /* restart limit */
+  if (m == 0 && n > 100)
+    {
+      gsl_splinalg_eigen_workspace *w = gsl_splinalg_eigen_alloc(n, k, m);
+      gsl_vector *eval = gsl_vector_alloc(k);
+      int status;
+
+      gsl_set_error_handler_off();
+
+      gsl_splinalg_eigen_params(1.0e-10, 0, w);
+      status = gsl_splinalg_eigen_symmv(A, GSL_SPLINALG_EIGEN_LARGEST_REAL,
+                                        eval, NULL, w);
+      gsl_test(status != GSL_EMAXITER || w->nconv >= k,
+               "symmv max_restarts=0 status=%d nconv=%zu", status, w->nconv);
+
+      status = (gsl_splinalg_eigen_alloc(n, k, k + 1) != NULL);
+      gsl_test(status, "symmv alloc m=k+1");
+
+      gsl_set_error_handler(NULL);
+
+      gsl_splinalg_eigen_free(w);
+      gsl_vector_free(eval);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_matrix_free(Ad);
+}
+
+/* k extremal eigenpairs of the matrix-free Laplacian */
+static void
+test_eigen_laplace(const size_t nx, const size_t k, const size_t m)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *T = create_laplace2d(nx, 0.0);
+  gsl_matrix *Ad = gsl_matrix_alloc(n, n);
+  laplace2d_params params;
+  gsl_linalg_operator op;
+
+  params.nx = nx;
+  params.shift = 0.0;
+
+  op.size1 = n;
+  op.size2 = n;
+  op.mult = &laplace2d_mult;
+  op.params = &params;
+
+  gsl_spmatrix_sp2d(Ad, T);
+
+  test_eigen_symm_op(&op, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_REAL, "laplace");
+  test_eigen_symm_op(&op, Ad, k, m, GSL_SPLINALG_EIGEN_SMALLEST_REAL, "laplace");
+
+  gsl_spmatrix_free(T);
+  gsl_matrix_free(Ad);
+}
+
+static void
+test_eigen_nonsymm_which(const gsl_spmatrix *A, const gsl_matrix *Ad,
+                         const size_t k, const size_t m, const int which,
+                         const char *desc)
+{
+  const size_t n = A->size1;
+  const double tol = 1.0e-10;
+  gsl_splinalg_eigen_workspace *w = gsl_splinalg_eigen_alloc(n, k, m);
+  gsl_vector_complex *eval = gsl_vector_complex_alloc(k);
+  gsl_matrix_complex *evec = gsl_matrix_complex_alloc(n, k);
+  gsl_matrix *B = gsl_matrix_alloc(n, n);
+  gsl_vector_complex *d = gsl_vector_complex_alloc(n);
+  gsl_vector *key = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_eigen_nonsymm_workspace *wd = gsl_eigen_nonsymm_alloc(n);
+  double normA = 0.0;
+  size_t i;
+  int status;
+
+  gsl_matrix_memcpy(B, Ad);
+  gsl_eigen_nonsymm(B, d, wd);
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_complex di = gsl_vector_complex_get(d, i);
+      gsl_vector_set(key, i, eigen_key(which, di));
+      normA = GSL_MAX(normA, gsl_complex_abs(di));
+    }
+
+  gsl_sort_vector(key);
+
+  status = gsl_splinalg_eigen_nonsymmv(A, which, eval, evec, w);
+  gsl_test(status, "%s nonsymmv n=%zu k=%zu which=%d status=%d restarts=%zu",
+           desc, n, k, which, status, w->nrestarts);
+
+  for (i = 0; i < k; ++i)
+    {
+      gsl_complex theta = gsl_vector_complex_get(eval, i);
+      gsl_vector_complex_const_view x = gsl_matrix_complex_const_column(evec, i);
+      gsl_vector_const_view xr = gsl_vector_complex_const_real(&x.vector);
+      gsl_vector_const_view xi = gsl_vector_complex_const_imag(&x.vector);
+      double normres, normx;
+
+      /* the k-th wanted eigenvalue is the k-th in the sorted spectrum */
+      gsl_test_abs(eigen_key(which, theta), gsl_vector_get(key, i),
+                   1.0e-8 * normA, "%s nonsymmv n=%zu k=%zu which=%d eval %zu",
+                   desc, n, k, which, i);
+
+      /* ||A x - theta x||, real part */
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &xr.vector, 0.0, y);
+      gsl_blas_daxpy(-GSL_REAL(theta), &xr.vector, y);
+      gsl_blas_daxpy(GSL_IMAG(theta), &xi.vector, y);
+      normres = gsl_blas_dnrm2(y);
+
+      /* imaginary part */
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &xi.vector, 0.0, y);
+      gsl_blas_daxpy(-GSL_IMAG(theta), &xr.vector, y);
+      gsl_blas_daxpy(-GSL_REAL(theta), &xi.vector, y);
+      normres = gsl_hypot(normres, gsl_blas_dnrm2(y));
+
+      normx = gsl_hypot(gsl_blas_dnrm2(&xr.vector), gsl_blas_dnrm2(&xi.vector));
+
+      gsl_test(normres > 10.0 * tol * GSL_MAX(gsl_complex_abs(theta), 1.0e-10),
+               "%s nonsymmv n=%zu k=%zu which=%d residual %zu: %e",
+               desc, n, k, which, i, normres);
+      gsl_test_rel(normx, 1.0, 1.0e-12,
+                   "%s nonsymmv n=%zu k=%zu which=%d norm %zu",
+                   desc, n, k, which, i);
+    }
+
+  gsl_splinalg_eigen_free(w);
+  gsl_vector_complex_free(eval);
+  gsl_matrix_complex_free(evec);
+  gsl_matrix_free(B);
+  gsl_vector_complex_free(d);
+  gsl_vector_free(key);
+  gsl_vector_free(y);
+  gsl_eigen_nonsymm_free(wd);
+}
+
+static void
+test_eigen_nonsymm(const size_t nx, const size_t k, const size_t m,
+                   const gsl_rng *r)
+{
+  const size_t n = nx * nx;
+  gsl_spmatrix *C = create_convdiff2d(nx, 20.0);
+  gsl_spmatrix *A = gsl_spmatrix_compress(C, GSL_SPMATRIX_CSC);
+  gsl_spmatrix *R = create_random_sparse(n, n, 2.0 / n, r);
+  gsl_spmatrix *B = gsl_spmatrix_compress(R, GSL_SPMATRIX_CSR);
+  gsl_matrix *Ad = gsl_matrix_alloc(n, n);
+
+  gsl_spmatrix_sp2d(Ad, C);
+  test_eigen_nonsymm_which(A, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_MAG, "convdiff");
+  test_eigen_nonsymm_which(A, Ad, k, m, GSL_SPLINALG_EIGEN_SMALLEST_REAL, "convdiff");
+
+  gsl_spmatrix_sp2d(Ad, R);
+  test_eigen_nonsymm_which(B, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_MAG, "random");
+  test_eigen_nonsymm_which(B, Ad, k, m, GSL_SPLINALG_EIGEN_LARGEST_REAL, "random");
+
+  gsl_spmatrix_free(C);
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(R);
+  gsl_spmatrix_free(B);
+  gsl_matrix_free(Ad);
+}
+
 int
 main()
 {
@@ -366,6 +1327,42 @@ main()
       test_random(n, r, 1);
     }
 
+  test_cholesky_laplace(1, r);
+  test_cholesky_laplace(5, r);
+  test_cholesky_laplace(30, r);
+
+  test_LU_convdiff(1, r);
+  test_LU_convdiff(20, r);
+
+  for (n = 1; n <= 50; ++n)
+    test_LU_random(n, 0.1, r);
+
+  test_LU_random(300, 0.02, r);
+
+  for (n = 1; n <= 20; ++n)
+    test_precond_exact(n, r);
+
+  test_precond(1, r);
+  test_precond(10, r);
+  test_precond(30, r);
+
+  test_operator(1, r);
+  test_operator(20, r);
+
+  for (n = 1; n <= 6; ++n)
+    test_eigen_symm(n, 1, n, r);
+
+  test_eigen_symm(10, 3, 0, r);
+  test_eigen_symm(200, 5, 0, r);
+  test_eigen_symm(300, 4, 30, r);
+
+  test_eigen_laplace(1, 1, 0);
+  test_eigen_laplace(10, 1, 0);
+
+  test_eigen_nonsymm(1, 1, 0, r);
+  test_eigen_nonsymm(4, 3, 0, r);
+  test_eigen_nonsymm(15, 4, 0, r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
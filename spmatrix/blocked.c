@@ -0,0 +1,457 @@
+/* spmatrix/blocked.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+/*
+ * Conversion to the SELL-C-sigma and BCSR formats, which store the
+ * matrix in fixed-size groups (slices of C rows, or dense r-by-c
+ * blocks) so that the inner loops of matrix-vector products have
+ * constant trip counts and unit stride.
+ *
+ * See M. Kreutzer, G. Hager, G. Wellein, H. Fehske and A. R. Bishop,
+ * A unified sparse matrix data format for efficient general sparse
+ * matrix-vector multiplication on modern processors with wide SIMD
+ * units, SIAM J. Sci. Comput. 36(5), 2014, and E.-J. Im, K. Yelick and
+ * R. Vuduc, Sparsity: optimization framework for sparse matrix
+ * kernels, Int. J. High Perform. Comput. Appl. 18(1), 2004.
+ */
+
+typedef struct
+{
+  int len;
+  int row;
+} blocked_row;
+
+static gsl_spmatrix *blocked_alloc(const size_t n1, const size_t n2,
+                                   const size_t nzmax, const int sptype,
+                                   const size_t np);
+static gsl_spmatrix *blocked_csr(const gsl_spmatrix *src);
+static int blocked_sort(const int *len, int *perm, const size_t n);
+static int blocked_compare(const void *a, const void *b);
+
+/*
+gsl_spmatrix_compress_sell()
+  Convert a sparse matrix to the SELL-C-sigma format
+
+Inputs: src   - sparse matrix in COO, CSC or CSR format
+        sigma - size of the windows in which rows are sorted by
+                decreasing length; it is rounded up to a multiple
+                of C = GSL_SPMATRIX_SELL_C. sigma = 1 keeps the
+                original row order
+
+Return: pointer to new matrix in SELL format, or NULL on error
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_compress_sell(const gsl_spmatrix * src, const size_t sigma)
+{
+  const size_t C = GSL_SPMATRIX_SELL_C;
+  const size_t M = src->size1;
+  const size_t nslice = (M + C - 1) / C;
+  const size_t window = (sigma <= 1) ? 1 : ((sigma + C - 1) / C) * C;
+  gsl_spmatrix *A = blocked_csr(src);
+  gsl_spmatrix *m;
+  int *len, *perm;
+  size_t s, j, nzpad = 0;
+
+  if (A == NULL)
+    return NULL;
+
+  len = malloc(M * sizeof(int));
+  perm = malloc(nslice * C * sizeof(int));
+  if (!len || !perm)
+    {
+      free(len);
+      free(perm);
+      if (A != src)
+        gsl_spmatrix_free(A);
+      GSL_ERROR_NULL("failed to allocate space for row lengths", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < M; ++j)
+    {
+      len[j] = A->p[j + 1] - A->p[j];
+      perm[j] = (int) j;
+    }
+
+  /* sort rows by decreasing length within each window */
+  if (window > 1)
+    {
+      for (j = 0; j < M; j += window)
+        {
+          if (blocked_sort(len, perm + j, GSL_MIN(window, M - j)))
+            {
+              free(len);
+              free(perm);
+              if (A != src)
+                gsl_spmatrix_free(A);
+              return NULL;
+            }
+        }
+    }
+
+  /* padded rows of the last slice */
+  for (j = M; j < nslice * C; ++j)
+    perm[j] = -1;
+
+  /* padded size of each slice is C times its longest row */
+  for (s = 0; s < nslice; ++s)
+    {
+      int width = 0;
+
+      for (j = s * C; j < (s + 1) * C; ++j)
+        {
+          if (perm[j] >= 0)
+            width = GSL_MAX(width, len[perm[j]]);
+        }
+
+      nzpad += C * (size_t) width;
+    }
+
+  if (nzpad > INT_MAX)
+    {
+      free(len);
+      free(perm);
+      if (A != src)
+        gsl_spmatrix_free(A);
+      GSL_ERROR_NULL("padded matrix is too large for int indices", GSL_EOVRFLW);
+    }
+
+  m = blocked_alloc(M, src->size2, nzpad, GSL_SPMATRIX_SELL, nslice + 1 + M);
+  if (!m)
+    {
+      free(len);
+      free(perm);
+      if (A != src)
+        gsl_spmatrix_free(A);
+      GSL_ERROR_NULL("failed to allocate space for SELL matrix", GSL_ENOMEM);
+    }
+
+  m->bsize1 = C;
+  m->bsize2 = window;
+  m->p[0] = 0;
+
+  for (s = 0; s < nslice; ++s)
+    {
+      int width = 0;
+      size_t r;
+      int k;
+
+      for (r = 0; r < C; ++r)
+        {
+          if (perm[s * C + r] >= 0)
+            width = GSL_MAX(width, len[perm[s * C + r]]);
+        }
+
+      for (r = 0; r < C; ++r)
+        {
+          const int row = perm[s * C + r];
+          const int nrow = (row >= 0) ? len[row] : 0;
+          int col = 0;
+
+          for (k = 0; k < width; ++k)
+            {
+              const size_t idx = m->p[s] + k * C + r;
+
+              if (k < nrow)
+                {
+                  col = A->i[A->p[row] + k];
+                  m->data[idx] = A->data[A->p[row] + k];
+                }
+              else
+                {
+                  /* padding repeats the last column index, with value 0 */
+                  m->data[idx] = 0.0;
+                }
+
+              m->i[idx] = col;
+            }
+        }
+
+      m->p[s + 1] = m->p[s] + (int) (C * width);
+    }
+
+  for (j = 0; j < M; ++j)
+    m->p[nslice + 1 + j] = perm[j];
+
+  m->nz = nzpad;
+
+  free(len);
+  free(perm);
+  if (A != src)
+    gsl_spmatrix_free(A);
+
+  return m;
+}
+
+/*
+gsl_spmatrix_compress_bcsr()
+  Convert a sparse matrix to the block compressed row format
+
+Inputs: src - sparse matrix in COO, CSC or CSR format
+        r   - number of rows of each block, 1 <= r <= GSL_SPMATRIX_BCSR_MAX
+        c   - number of columns of each block, 1 <= c <= GSL_SPMATRIX_BCSR_MAX
+
+Return: pointer to new matrix in BCSR format, or NULL on error
+
+Notes:
+1) Blocks which are partly outside the matrix, in the last block row
+or column, are padded with zeros
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_compress_bcsr(const gsl_spmatrix * src, const size_t r, const size_t c)
+{
+  if (r == 0 || r > GSL_SPMATRIX_BCSR_MAX || c == 0 || c > GSL_SPMATRIX_BCSR_MAX)
+    {
+      GSL_ERROR_NULL("block dimensions must be between 1 and GSL_SPMATRIX_BCSR_MAX",
+                     GSL_EINVAL);
+    }
+  else
+    {
+      const size_t M = src->size1;
+      const size_t N = src->size2;
+      const size_t nbrow = (M + r - 1) / r;
+      const size_t nbcol = (N + c - 1) / c;
+      const size_t bs = r * c;
+      gsl_spmatrix *A = blocked_csr(src);
+      gsl_spmatrix *m;
+      int *pos;
+      size_t I, i, nblock = 0;
+      int p;
+
+      if (A == NULL)
+        return NULL;
+
+      pos = malloc(nbcol * sizeof(int));
+      if (!pos)
+        {
+          if (A != src)
+            gsl_spmatrix_free(A);
+          GSL_ERROR_NULL("failed to allocate space for block positions", GSL_ENOMEM);
+        }
+
+      for (I = 0; I < nbcol; ++I)
+        pos[I] = -1;
+
+      /* count the blocks; pos[J] marks the last block row containing J */
+      for (I = 0; I < nbrow; ++I)
+        {
+          for (i = I * r; i < GSL_MIN((I + 1) * r, M); ++i)
+            {
+              for (p = A->p[i]; p < A->p[i + 1]; ++p)
+                {
+                  const size_t J = A->i[p] / c;
+
+                  if (pos[J] != (int) I)
+                    {
+                      pos[J] = (int) I;
+                      ++nblock;
+                    }
+                }
+            }
+        }
+
+      if (nblock * bs > INT_MAX)
+        {
+          free(pos);
+          if (A != src)
+            gsl_spmatrix_free(A);
+          GSL_ERROR_NULL("blocked matrix is too large for int indices", GSL_EOVRFLW);
+        }
+
+      m = blocked_alloc(M, N, nblock * bs, GSL_SPMATRIX_BCSR, nbrow + 1);
+      if (!m)
+        {
+          free(pos);
+          if (A != src)
+            gsl_spmatrix_free(A);
+          GSL_ERROR_NULL("failed to allocate space for BCSR matrix", GSL_ENOMEM);
+        }
+
+      m->bsize1 = r;
+      m->bsize2 = c;
+
+      for (I = 0; I < nbcol; ++I)
+        pos[I] = -1;
+
+      /* fill the blocks; pos[J] is the position of block J in the
+         current block row, or refers to a previous block row */
+      nblock = 0;
+      m->p[0] = 0;
+
+      for (I = 0; I < nbrow; ++I)
+        {
+          const int start = (int) nblock;
+
+          for (i = I * r; i < GSL_MIN((I + 1) * r, M); ++i)
+            {
+              for (p = A->p[i]; p < A->p[i + 1]; ++p)
+                {
+                  const size_t J = A->i[p] / c;
+                  size_t b;
+
+                  if (pos[J] < start)
+                    {
+                      size_t k;
+
+                      pos[J] = (int) nblock;
+                      m->i[nblock] = (int) J;
+
+                      for (k = 0; k < bs; ++k)
+                        m->data[nblock * bs + k] = 0.0;
+
+                      ++nblock;
+                    }
+
+                  b = (size_t) pos[J];
+                  m->data[b * bs + (i - I * r) * c + (A->i[p] - J * c)] = A->data[p];
+                }
+            }
+
+          m->p[I + 1] = (int) nblock;
+        }
+
+      m->nz = nblock * bs;
+
+      free(pos);
+      if (A != src)
+        gsl_spmatrix_free(A);
+
+      return m;
+    }
+}
+
+/*
+blocked_alloc()
+  Allocate a SELL or BCSR matrix. These types cannot be
+passed to gsl_spmatrix_alloc_nzmax(), so a CSR matrix is
+allocated and its pointer array resized to np entries
+*/
+
+static gsl_spmatrix *
+blocked_alloc(const size_t n1, const size_t n2, const size_t nzmax,
+              const int sptype, const size_t np)
+{
+  gsl_spmatrix *m = gsl_spmatrix_alloc_nzmax(n1, n2, nzmax, GSL_SPMATRIX_CSR);
+  int *p;
+
+  if (m == NULL)
+    return NULL;
+
+  p = realloc(m->p, np * sizeof(int));
+  if (p == NULL)
+    {
+      gsl_spmatrix_free(m);
+      return NULL;
+    }
+
+  m->p = p;
+  m->sptype = sptype;
+
+  return m;
+}
+
+/* return src in CSR format, either src itself or a new matrix */
+static gsl_spmatrix *
+blocked_csr(const gsl_spmatrix *src)
+{
+  if (GSL_SPMATRIX_ISCSR(src))
+    {
+      return (gsl_spmatrix *) src;
+    }
+  else if (GSL_SPMATRIX_ISCOO(src))
+    {
+      return gsl_spmatrix_compress(src, GSL_SPMATRIX_CSR);
+    }
+  else if (GSL_SPMATRIX_ISCSC(src))
+    {
+      /* the transpose of src, in CSC format, is src in CSR format */
+      gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax(src->size2, src->size1,
+                                                 src->nz, GSL_SPMATRIX_CSC);
+      int status;
+
+      if (T == NULL)
+        return NULL;
+
+      status = gsl_spmatrix_transpose_memcpy(T, src);
+      if (status == GSL_SUCCESS)
+        status = gsl_spmatrix_transpose(T);
+
+      if (status)
+        {
+          gsl_spmatrix_free(T);
+          return NULL;
+        }
+
+      return T;
+    }
+  else
+    {
+      GSL_ERROR_NULL("COO, CSC or CSR format required", GSL_EINVAL);
+    }
+}
+
+/* sort perm[0:n-1] by decreasing len[perm[k]], keeping the original
+   order of rows of equal length */
+static int
+blocked_sort(const int *len, int *perm, const size_t n)
+{
+  blocked_row *rows = malloc(n * sizeof(blocked_row));
+  size_t k;
+
+  if (rows == NULL)
+    {
+      GSL_ERROR("failed to allocate space for sorting", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < n; ++k)
+    {
+      rows[k].len = len[perm[k]];
+      rows[k].row = perm[k];
+    }
+
+  qsort(rows, n, sizeof(blocked_row), blocked_compare);
+
+  for (k = 0; k < n; ++k)
+    perm[k] = rows[k].row;
+
+  free(rows);
+
+  return GSL_SUCCESS;
+}
+
+static int
+blocked_compare(const void *a, const void *b)
+{
+  const blocked_row *ra = (const blocked_row *) a;
+  const blocked_row *rb = (const blocked_row *) b;
+
+  if (ra->len != rb->len)
+    return (ra->len > rb->len) ? -1 : 1;
+
+  return (ra->row > rb->row) - (ra->row < rb->row);
+}
@@ -1,8 +1,15 @@
 #include <config.h>
 #include <stddef.h>
+#include <stdlib.h>
+#include <limits.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_errno.h>
 
+#include "thread_internal.h"
+
+/* minimum number of triplets for a threaded compression */
+#define SPMATRIX_THREAD_MIN 65536
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "compress_source.c"
@@ -17,6 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+static int FUNCTION (spmatrix, sum_coo) (TYPE (gsl_spmatrix) * dest, const size_t n,
+                                        const TYPE (gsl_spmatrix) * const src[]);
+static TYPE (gsl_spmatrix) * FUNCTION (spmatrix, compress_sum) (const size_t n,
+                                                                const TYPE (gsl_spmatrix) * const src[],
+                                                                const int sptype);
+
 /*
 gsl_spmatrix_csc()
   Create a sparse matrix in compressed column format
@@ -41,6 +47,11 @@ FUNCTION (gsl_spmatrix, csc) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatr
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
+  else if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      /* appended triplets may contain duplicates */
+      return FUNCTION (spmatrix, sum_coo) (dest, 1, &src);
+    }
   else
     {
       int status;
@@ -134,6 +145,11 @@ FUNCTION (gsl_spmatrix, csr) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatr
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
+  else if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      /* appended triplets may contain duplicates */
+      return FUNCTION (spmatrix, sum_coo) (dest, 1, &src);
+    }
   else
     {
       int status;
@@ -199,8 +215,16 @@ TYPE (gsl_spmatrix) *
 FUNCTION (gsl_spmatrix, compress) (const TYPE (gsl_spmatrix) * src, const int sptype)
 {
   int status = GSL_SUCCESS;
-  TYPE (gsl_spmatrix) * dest = FUNCTION (gsl_spmatrix, alloc_nzmax) (src->size1, src->size2, src->nz, sptype);
+  TYPE (gsl_spmatrix) * dest;
+
+  if (GSL_SPMATRIX_ISBLOCKED(src))
+    {
+      GSL_ERROR_NULL("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (GSL_SPMATRIX_ISCOO(src) && (src->spflags & GSL_SPMATRIX_FLG_APPEND))
+    return FUNCTION (spmatrix, compress_sum) (1, &src, sptype);
 
+  dest = FUNCTION (gsl_spmatrix, alloc_nzmax) (src->size1, src->size2, src->nz, sptype);
   if (dest == NULL)
     return NULL;
 
@@ -231,3 +255,312 @@ FUNCTION (gsl_spmatrix, compress) (const TYPE (gsl_spmatrix) * src, const int sp
 
   return dest;
 }
+
+/*
+gsl_spmatrix_compress_sum()
+  Compress the sum of several COO matrices, for instance
+triplets assembled by different threads with gsl_spmatrix_append()
+
+Inputs: n      - number of input matrices
+        src    - COO matrices src[0], ..., src[n-1]
+        sptype - format of the result
+
+Return: pointer to new matrix, whose dimensions are the largest
+dimensions of the inputs (should be freed when finished with it)
+*/
+
+TYPE (gsl_spmatrix) *
+FUNCTION (gsl_spmatrix, compress_sum) (const size_t n, TYPE (gsl_spmatrix) * const src[],
+                                       const int sptype)
+{
+  return FUNCTION (spmatrix, compress_sum) (n, (const TYPE (gsl_spmatrix) * const *) src, sptype);
+}
+
+static TYPE (gsl_spmatrix) *
+FUNCTION (spmatrix, compress_sum) (const size_t n, const TYPE (gsl_spmatrix) * const src[],
+                                   const int sptype)
+{
+  size_t M = 1, N = 1, nz = 0;
+  size_t b;
+  int status;
+  TYPE (gsl_spmatrix) * dest;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("at least one input matrix is required", GSL_EINVAL);
+    }
+  else if (sptype != GSL_SPMATRIX_COO && sptype != GSL_SPMATRIX_CSC &&
+           sptype != GSL_SPMATRIX_CSR)
+    {
+      GSL_ERROR_NULL ("unknown sparse matrix format", GSL_EINVAL);
+    }
+
+  for (b = 0; b < n; ++b)
+    {
+      if (!GSL_SPMATRIX_ISCOO(src[b]))
+        {
+          GSL_ERROR_NULL ("input matrices must be in COO format", GSL_EINVAL);
+        }
+
+      M = GSL_MAX(M, src[b]->size1);
+      N = GSL_MAX(N, src[b]->size2);
+      nz += src[b]->nz;
+    }
+
+  /* a COO result is expanded from CSR */
+  dest = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, nz,
+                                              (sptype == GSL_SPMATRIX_COO) ? GSL_SPMATRIX_CSR : sptype);
+  if (dest == NULL)
+    return NULL;
+
+  status = FUNCTION (spmatrix, sum_coo) (dest, n, src);
+  if (status)
+    {
+      FUNCTION (gsl_spmatrix, free) (dest);
+      return NULL;
+    }
+
+  if (sptype == GSL_SPMATRIX_COO)
+    {
+      /* expand the row pointers into a COO matrix with a binary tree */
+      TYPE (gsl_spmatrix) * T = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, dest->nz, GSL_SPMATRIX_COO);
+      size_t i, r;
+      int p;
+
+      if (T == NULL)
+        {
+          FUNCTION (gsl_spmatrix, free) (dest);
+          return NULL;
+        }
+
+      for (i = 0; i < M; ++i)
+        {
+          for (p = dest->p[i]; p < dest->p[i + 1]; ++p)
+            {
+              T->i[p] = (int) i;
+              T->p[p] = dest->i[p];
+
+              for (r = 0; r < MULTIPLICITY; ++r)
+                T->data[MULTIPLICITY * p + r] = dest->data[MULTIPLICITY * p + r];
+            }
+        }
+
+      T->nz = dest->nz;
+      FUNCTION (gsl_spmatrix, free) (dest);
+
+      status = FUNCTION (gsl_spmatrix, tree_rebuild) (T);
+      if (status)
+        {
+          FUNCTION (gsl_spmatrix, free) (T);
+          return NULL;
+        }
+
+      return T;
+    }
+
+  return dest;
+}
+
+/*
+spmatrix_sum_coo()
+  Compress the sum of n COO matrices into CSC or CSR format. The
+triplets are distributed into their columns (CSC) or rows (CSR)
+with a counting sort, and a pass over each column or row then
+merges entries with equal indices, using a marker array of the
+position of each index in the current column or row.
+
+Within each column or row, entries are summed in the order
+src[0], src[1], ..., and in the order in which they were added
+to each input, so the result does not depend on the number of
+threads.
+
+Inputs: dest - (output) CSC or CSR matrix, at least as large as
+               each input; its dimensions are not changed
+        n    - number of input matrices
+        src  - COO matrices
+
+Return: success/error
+*/
+
+static int
+FUNCTION (spmatrix, sum_coo) (TYPE (gsl_spmatrix) * dest, const size_t n,
+                              const TYPE (gsl_spmatrix) * const src[])
+{
+  const int csr = GSL_SPMATRIX_ISCSR(dest);
+  const size_t nouter = csr ? dest->size1 : dest->size2;
+  const size_t ninner = csr ? dest->size2 : dest->size1;
+  int *Cp = dest->p;
+  int *off;   /* off[b*nouter + k] = next position of src[b] in column/row k */
+  int *mark;  /* marker arrays of size ninner for each thread */
+  size_t nz = 0;
+  size_t b, k;
+  int nthreads, t, q;
+
+  for (b = 0; b < n; ++b)
+    nz += src[b]->nz;
+
+  if (nz > INT_MAX)
+    {
+      GSL_ERROR ("number of triplets is too large for int indices", GSL_EOVRFLW);
+    }
+
+  if (dest->nzmax < nz)
+    {
+      int status = FUNCTION (gsl_spmatrix, realloc) (nz, dest);
+      if (status)
+        return status;
+    }
+
+  nthreads = sys_thread_count (nz, SPMATRIX_THREAD_MIN);
+
+  off = malloc(n * nouter * sizeof(int));
+  mark = malloc(nthreads * ninner * sizeof(int));
+  if (!off || !mark)
+    {
+      free(off);
+      free(mark);
+      GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  /* count the entries of each input in each column/row */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (t = 0; t < (int) n; ++t)
+    {
+      const TYPE (gsl_spmatrix) * T = src[t];
+      const int *Tk = csr ? T->i : T->p;
+      int *cnt = off + t * nouter;
+      size_t m;
+
+      for (m = 0; m < nouter; ++m)
+        cnt[m] = 0;
+
+      for (m = 0; m < T->nz; ++m)
+        cnt[Tk[m]]++;
+    }
+
+  /* column/row pointers, and the start of each input within each column/row */
+  for (k = 0; k < nouter; ++k)
+    {
+      int sum = 0;
+
+      for (b = 0; b < n; ++b)
+        {
+          int c = off[b * nouter + k];
+          off[b * nouter + k] = sum;
+          sum += c;
+        }
+
+      Cp[k] = sum;
+    }
+
+  gsl_spmatrix_cumsum(nouter, Cp);
+
+  /* scatter the triplets; each input writes to its own positions */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (t = 0; t < (int) n; ++t)
+    {
+      const TYPE (gsl_spmatrix) * T = src[t];
+      const int *Tk = csr ? T->i : T->p;
+      const int *Tl = csr ? T->p : T->i;
+      int *pos = off + t * nouter;
+      size_t m, r;
+
+      for (m = 0; m < T->nz; ++m)
+        {
+          const int kk = Tk[m];
+          const int idx = Cp[kk] + pos[kk]++;
+
+          dest->i[idx] = Tl[m];
+
+          for (r = 0; r < MULTIPLICITY; ++r)
+            dest->data[MULTIPLICITY * idx + r] = T->data[MULTIPLICITY * m + r];
+        }
+    }
+
+  /*
+   * sum duplicates within each column/row in place, storing the new
+   * length of column/row k in off[k]; the columns/rows are divided
+   * into nthreads ranges with equal numbers of triplets
+   */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (t = 0; t < nthreads; ++t)
+    {
+      const size_t k0 = sys_thread_bound (Cp, nouter, sys_thread_split (nz, t, nthreads));
+      const size_t k1 = (t == nthreads - 1) ? nouter :
+                        sys_thread_bound (Cp, nouter, sys_thread_split (nz, t + 1, nthreads));
+      int *w = mark + t * ninner;
+      size_t m, r;
+
+      for (m = 0; m < ninner; ++m)
+        w[m] = -1;
+
+      for (m = k0; m < k1; ++m)
+        {
+          const int start = Cp[m];
+          int p, qq = start;
+
+          for (p = start; p < Cp[m + 1]; ++p)
+            {
+              const int l = dest->i[p];
+
+              if (w[l] >= start)
+                {
+                  /* duplicate entry, add to the first one */
+                  for (r = 0; r < MULTIPLICITY; ++r)
+                    dest->data[MULTIPLICITY * w[l] + r] += dest->data[MULTIPLICITY * p + r];
+                }
+              else
+                {
+                  w[l] = qq;
+                  dest->i[qq] = l;
+
+                  for (r = 0; r < MULTIPLICITY; ++r)
+                    dest->data[MULTIPLICITY * qq + r] = dest->data[MULTIPLICITY * p + r];
+
+                  ++qq;
+                }
+            }
+
+          off[m] = qq - start;
+        }
+    }
+
+  /* remove the gaps left by the duplicates */
+  q = 0;
+  for (k = 0; k < nouter; ++k)
+    {
+      const int start = Cp[k];
+      const int len = off[k];
+      int p;
+      size_t r;
+
+      Cp[k] = q;
+
+      if (q != start)
+        {
+          for (p = 0; p < len; ++p)
+            {
+              dest->i[q + p] = dest->i[start + p];
+
+              for (r = 0; r < MULTIPLICITY; ++r)
+                dest->data[MULTIPLICITY * (q + p) + r] = dest->data[MULTIPLICITY * (start + p) + r];
+            }
+        }
+
+      q += len;
+    }
+
+  Cp[nouter] = q;
+  dest->nz = q;
+
+  free(off);
+  free(mark);
+
+  return GSL_SUCCESS;
+}
@@ -23,7 +23,11 @@ FUNCTION (gsl_spmatrix, memcpy) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spm
   const size_t M = src->size1;
   const size_t N = src->size2;
 
-  if (M != dest->size1 || N != dest->size2)
+  if (GSL_SPMATRIX_ISBLOCKED(src))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (M != dest->size1 || N != dest->size2)
     {
       GSL_ERROR("matrix sizes are different", GSL_EBADLEN);
     }
@@ -57,6 +61,9 @@ FUNCTION (gsl_spmatrix, memcpy) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spm
               for (r = 0; r < MULTIPLICITY; ++r)
                 dest->data[MULTIPLICITY * n + r] = src->data[MULTIPLICITY * n + r];
 
+              if (dest->tree == NULL)
+                continue;
+
               /* copy binary tree data */
               ptr = gsl_bst_insert(&dest->data[MULTIPLICITY * n], dest->tree);
               if (ptr != NULL)
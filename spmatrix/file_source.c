@@ -35,6 +35,11 @@ FUNCTION (gsl_spmatrix, fprintf) (FILE * stream, const TYPE (gsl_spmatrix) * m,
 {
   int status;
 
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+
   /* print header */
 
 #if defined(BASE_GSL_COMPLEX_LONG) || defined(BASE_GSL_COMPLEX) || defined(BASE_GSL_COMPLEX_FLOAT)
@@ -296,6 +301,11 @@ FUNCTION (gsl_spmatrix, fwrite) (FILE * stream, const TYPE (gsl_spmatrix) * m)
 {
   size_t items;
 
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+
   /* write header: size1, size2, nz */
 
   items = fwrite(&(m->size1), sizeof(size_t), 1, stream);
@@ -364,6 +374,11 @@ FUNCTION (gsl_spmatrix, fread) (FILE * stream, TYPE (gsl_spmatrix) * m)
   size_t size1, size2, nz;
   size_t items;
 
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+
   /* read header: size1, size2, nz */
 
   items = fread(&size1, sizeof(size_t), 1, stream);
@@ -24,7 +24,11 @@ FUNCTION (gsl_spmatrix, get) (const TYPE (gsl_spmatrix) * m, const size_t i, con
 {
   BASE zero = ZERO;
 
-  if (i >= m->size1)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR_VAL("not supported for SELL or BCSR matrices", GSL_EINVAL, zero);
+    }
+  else if (i >= m->size1)
     {
       GSL_ERROR_VAL("first index out of range", GSL_EINVAL, zero);
     }
@@ -39,7 +43,11 @@ FUNCTION (gsl_spmatrix, get) (const TYPE (gsl_spmatrix) * m, const size_t i, con
     }
   else
     {
-      if (GSL_SPMATRIX_ISCOO(m))
+      if (GSL_SPMATRIX_ISCOO(m) && m->tree == NULL)
+        {
+          GSL_ERROR_VAL("matrix has no binary tree, compress it first", GSL_EINVAL, zero);
+        }
+      else if (GSL_SPMATRIX_ISCOO(m))
         {
           /* traverse binary tree to search for (i,j) element */
           void *ptr = FUNCTION (tree, find) (m, i, j);
@@ -90,6 +98,10 @@ FUNCTION (gsl_spmatrix, set) (TYPE (gsl_spmatrix) * m, const size_t i,
     {
       GSL_ERROR("matrix not in COO representation", GSL_EINVAL);
     }
+  else if (m->tree == NULL)
+    {
+      GSL_ERROR("matrix has no binary tree, use gsl_spmatrix_append", GSL_EINVAL);
+    }
   else if (!(m->spflags & GSL_SPMATRIX_FLG_GROW) && (i >= m->size1 || j >= m->size2))
     {
       GSL_ERROR ("indices out of range", GSL_EINVAL);
@@ -156,10 +168,63 @@ FUNCTION (gsl_spmatrix, set) (TYPE (gsl_spmatrix) * m, const size_t i,
     }
 }
 
+/*
+gsl_spmatrix_append()
+  Append the triplet (i,j,x) to a matrix allocated with
+gsl_spmatrix_alloc_append(). No search for an existing (i,j)
+entry is made; duplicates are summed when the matrix is
+compressed.
+*/
+
+int
+FUNCTION (gsl_spmatrix, append) (TYPE (gsl_spmatrix) * m, const size_t i,
+                                 const size_t j, const BASE x)
+{
+  if (!GSL_SPMATRIX_ISCOO(m) || !(m->spflags & GSL_SPMATRIX_FLG_APPEND))
+    {
+      GSL_ERROR("matrix not allocated with gsl_spmatrix_alloc_append", GSL_EINVAL);
+    }
+  else if (!(m->spflags & GSL_SPMATRIX_FLG_GROW) && (i >= m->size1 || j >= m->size2))
+    {
+      GSL_ERROR ("indices out of range", GSL_EINVAL);
+    }
+  else
+    {
+      /* check if matrix needs to be reallocated */
+      if (m->nz >= m->nzmax)
+        {
+          int status = FUNCTION (gsl_spmatrix, realloc) (2 * m->nzmax, m);
+          if (status)
+            return status;
+        }
+
+      /* store the triplet (i, j, x) */
+      m->i[m->nz] = i;
+      m->p[m->nz] = j;
+      m->data[2 * m->nz] = GSL_REAL (x);
+      m->data[2 * m->nz + 1] = GSL_IMAG (x);
+
+      /* increase matrix dimensions if needed */
+      if (m->spflags & GSL_SPMATRIX_FLG_GROW)
+        {
+          m->size1 = GSL_MAX(m->size1, i + 1);
+          m->size2 = GSL_MAX(m->size2, j + 1);
+        }
+
+      ++(m->nz);
+
+      return GSL_SUCCESS;
+    }
+}
+
 BASE *
 FUNCTION (gsl_spmatrix, ptr) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j)
 {
-  if (i >= m->size1)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR_NULL("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (i >= m->size1)
     {
       GSL_ERROR_NULL("first index out of range", GSL_EINVAL);
     }
@@ -169,7 +234,11 @@ FUNCTION (gsl_spmatrix, ptr) (const TYPE (gsl_spmatrix) * m, const size_t i, con
     }
   else
     {
-      if (GSL_SPMATRIX_ISCOO(m))
+      if (GSL_SPMATRIX_ISCOO(m) && m->tree == NULL)
+        {
+          GSL_ERROR_NULL("matrix has no binary tree, compress it first", GSL_EINVAL);
+        }
+      else if (GSL_SPMATRIX_ISCOO(m))
         {
           /* traverse binary tree to search for (i,j) element */
           void *ptr = FUNCTION (tree, find) (m, i, j);
@@ -6,6 +6,8 @@ enum
   GSL_SPMATRIX_COO = 0, /* coordinate/triplet representation */
   GSL_SPMATRIX_CSC = 1, /* compressed sparse column */
   GSL_SPMATRIX_CSR = 2, /* compressed sparse row */
+  GSL_SPMATRIX_SELL = 3, /* sliced ELLPACK (SELL-C-sigma) */
+  GSL_SPMATRIX_BCSR = 4, /* block compressed sparse row */
   GSL_SPMATRIX_TRIPLET = GSL_SPMATRIX_COO,
   GSL_SPMATRIX_CCS = GSL_SPMATRIX_CSC,
   GSL_SPMATRIX_CRS = GSL_SPMATRIX_CSR
@@ -24,6 +26,9 @@ typedef struct gsl_spmatrix_pool_node gsl_spmatrix_pool;
 #define GSL_SPMATRIX_ISCOO(m)         ((m)->sptype == GSL_SPMATRIX_COO)
 #define GSL_SPMATRIX_ISCSC(m)         ((m)->sptype == GSL_SPMATRIX_CSC)
 #define GSL_SPMATRIX_ISCSR(m)         ((m)->sptype == GSL_SPMATRIX_CSR)
+#define GSL_SPMATRIX_ISSELL(m)        ((m)->sptype == GSL_SPMATRIX_SELL)
+#define GSL_SPMATRIX_ISBCSR(m)        ((m)->sptype == GSL_SPMATRIX_BCSR)
+#define GSL_SPMATRIX_ISBLOCKED(m)     (GSL_SPMATRIX_ISSELL(m) || GSL_SPMATRIX_ISBCSR(m))
 
 #define GSL_SPMATRIX_ISTRIPLET(m)     GSL_SPMATRIX_ISCOO(m)
 #define GSL_SPMATRIX_ISCCS(m)         GSL_SPMATRIX_ISCSC(m)
@@ -31,6 +36,10 @@ typedef struct gsl_spmatrix_pool_node gsl_spmatrix_pool;
 
 #define GSL_SPMATRIX_FLG_GROW         (1 << 0) /* allow size of matrix to grow as elements are added */
 #define GSL_SPMATRIX_FLG_FIXED        (1 << 1) /* sparsity pattern is fixed */
+#define GSL_SPMATRIX_FLG_APPEND       (1 << 2) /* COO triplets appended without binary tree, may contain duplicates */
+
+#define GSL_SPMATRIX_SELL_C           8        /* slice height of SELL format */
+#define GSL_SPMATRIX_BCSR_MAX         16       /* maximum block dimension of BCSR format */
 
 /* compare matrix entries (ia,ja) and (ib,jb) - sort by rows first, then by columns */
 #define GSL_SPMATRIX_COMPARE_ROWCOL(m,ia,ja,ib,jb)   ((ia) < (ib) ? -1 : ((ia) > (ib) ? 1 : ((ja) < (jb) ? -1 : ((ja) > (jb)))))
@@ -59,4 +68,6 @@ void gsl_spmatrix_cumsum(const size_t n, int * c);
 #include <gsl/gsl_spmatrix_uchar.h>
 #include <gsl/gsl_spmatrix_char.h>
 
+#include <gsl/gsl_spmatrix64.h>
+
 #endif /* __GSL_SPMATRIX_H__ */
@@ -0,0 +1,86 @@
+/* spmatrix/gsl_spmatrix64.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPMATRIX64_H__
+#define __GSL_SPMATRIX64_H__
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <gsl/gsl_types.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/*
+ * Sparse matrix with wide indices, for matrices with more than
+ * INT_MAX non-zero elements or dimensions. The indices have the width
+ * of a pointer, i.e. 64 bits on 64-bit platforms.
+ *
+ * Only the compressed formats are supported, with the same layout as
+ * gsl_spmatrix:
+ *
+ * CSC: row indices in i, column pointers in p (size size2 + 1)
+ * CSR: column indices in i, row pointers in p (size size1 + 1)
+ */
+
+typedef ptrdiff_t gsl_spmatrix64_index;
+
+typedef struct
+{
+  size_t size1;                 /* number of rows */
+  size_t size2;                 /* number of columns */
+  gsl_spmatrix64_index *i;      /* row (CSC) or column (CSR) indices, size nzmax */
+  double *data;                 /* matrix elements of size nzmax */
+  gsl_spmatrix64_index *p;      /* column (CSC) or row (CSR) pointers */
+  size_t nzmax;                 /* maximum number of matrix elements */
+  size_t nz;                    /* number of non-zero values in matrix */
+  int sptype;                   /* GSL_SPMATRIX_CSC or GSL_SPMATRIX_CSR */
+} gsl_spmatrix64;
+
+/*
+ * Prototypes
+ */
+
+gsl_spmatrix64 * gsl_spmatrix64_alloc_nzmax (const size_t n1, const size_t n2,
+                                             const size_t nzmax, const int sptype);
+void gsl_spmatrix64_free (gsl_spmatrix64 * m);
+int gsl_spmatrix64_realloc (const size_t nzmax, gsl_spmatrix64 * m);
+size_t gsl_spmatrix64_nnz (const gsl_spmatrix64 * m);
+double gsl_spmatrix64_get (const gsl_spmatrix64 * m, const size_t i, const size_t j);
+int gsl_spmatrix64_set_zero (gsl_spmatrix64 * m);
+int gsl_spmatrix64_memcpy_spmatrix (gsl_spmatrix64 * dest, const gsl_spmatrix * src);
+gsl_spmatrix64 * gsl_spmatrix64_compress_coo (const size_t n1, const size_t n2, const size_t nz,
+                                              const gsl_spmatrix64_index * ti,
+                                              const gsl_spmatrix64_index * tj,
+                                              const double * tx, const int sptype);
+
+__END_DECLS
+
+#endif /* __GSL_SPMATRIX64_H__ */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_char * gsl_spmatrix_char_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_char * gsl_spmatrix_char_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_char * gsl_spmatrix_char_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_char_free (gsl_spmatrix_char * m);
 int gsl_spmatrix_char_realloc (const size_t nzmax, gsl_spmatrix_char * m);
 size_t gsl_spmatrix_char_nnz (const gsl_spmatrix_char * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_char * gsl_spmatrix_char_compress (const gsl_spmatrix_char * src, c
 gsl_spmatrix_char * gsl_spmatrix_char_compcol (const gsl_spmatrix_char * src);
 gsl_spmatrix_char * gsl_spmatrix_char_ccs (const gsl_spmatrix_char * src);
 gsl_spmatrix_char * gsl_spmatrix_char_crs (const gsl_spmatrix_char * src);
+gsl_spmatrix_char * gsl_spmatrix_char_compress_sum (const size_t n, gsl_spmatrix_char * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_char_fread (FILE * stream, gsl_spmatrix_char * m);
 
 char gsl_spmatrix_char_get (const gsl_spmatrix_char * m, const size_t i, const size_t j);
 int gsl_spmatrix_char_set (gsl_spmatrix_char * m, const size_t i, const size_t j, const char x);
+int gsl_spmatrix_char_append (gsl_spmatrix_char * m, const size_t i, const size_t j, const char x);
 char * gsl_spmatrix_char_ptr (const gsl_spmatrix_char * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_complex * gsl_spmatrix_complex_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_complex * gsl_spmatrix_complex_alloc_nzmax (const size_t n1, const size_t n2,
                                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_complex * gsl_spmatrix_complex_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_complex_free (gsl_spmatrix_complex * m);
 int gsl_spmatrix_complex_realloc (const size_t nzmax, gsl_spmatrix_complex * m);
 size_t gsl_spmatrix_complex_nnz (const gsl_spmatrix_complex * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_complex * gsl_spmatrix_complex_compress (const gsl_spmatrix_complex
 gsl_spmatrix_complex * gsl_spmatrix_complex_compcol (const gsl_spmatrix_complex * src);
 gsl_spmatrix_complex * gsl_spmatrix_complex_ccs (const gsl_spmatrix_complex * src);
 gsl_spmatrix_complex * gsl_spmatrix_complex_crs (const gsl_spmatrix_complex * src);
+gsl_spmatrix_complex * gsl_spmatrix_complex_compress_sum (const size_t n, gsl_spmatrix_complex * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_complex_fread (FILE * stream, gsl_spmatrix_complex * m);
 
 gsl_complex gsl_spmatrix_complex_get (const gsl_spmatrix_complex * m, const size_t i, const size_t j);
 int gsl_spmatrix_complex_set (gsl_spmatrix_complex * m, const size_t i, const size_t j, const gsl_complex x);
+int gsl_spmatrix_complex_append (gsl_spmatrix_complex * m, const size_t i, const size_t j, const gsl_complex x);
 gsl_complex * gsl_spmatrix_complex_ptr (const gsl_spmatrix_complex * m, const size_t i, const size_t j);
 
 /* operations */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_alloc_nzmax (const size_t n1, const size_t n2,
                                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_complex_float_free (gsl_spmatrix_complex_float * m);
 int gsl_spmatrix_complex_float_realloc (const size_t nzmax, gsl_spmatrix_complex_float * m);
 size_t gsl_spmatrix_complex_float_nnz (const gsl_spmatrix_complex_float * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_compress (const gsl_spma
 gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_compcol (const gsl_spmatrix_complex_float * src);
 gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_ccs (const gsl_spmatrix_complex_float * src);
 gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_crs (const gsl_spmatrix_complex_float * src);
+gsl_spmatrix_complex_float * gsl_spmatrix_complex_float_compress_sum (const size_t n, gsl_spmatrix_complex_float * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_complex_float_fread (FILE * stream, gsl_spmatrix_complex_float
 
 gsl_complex_float gsl_spmatrix_complex_float_get (const gsl_spmatrix_complex_float * m, const size_t i, const size_t j);
 int gsl_spmatrix_complex_float_set (gsl_spmatrix_complex_float * m, const size_t i, const size_t j, const gsl_complex_float x);
+int gsl_spmatrix_complex_float_append (gsl_spmatrix_complex_float * m, const size_t i, const size_t j, const gsl_complex_float x);
 gsl_complex_float * gsl_spmatrix_complex_float_ptr (const gsl_spmatrix_complex_float * m, const size_t i, const size_t j);
 
 /* operations */
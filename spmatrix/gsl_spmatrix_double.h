@@ -60,6 +60,26 @@ __BEGIN_DECLS
  *   A->p[i] <= n < A->p[i+1]
  * so that row i is stored in
  * [ data[p[i]], data[p[i] + 1], ..., data[p[i+1] - 1] ]
+ *
+ * Sliced ELLPACK format (SELL), with C = GSL_SPMATRIX_SELL_C:
+ *
+ * The rows are permuted, and the permuted rows are grouped in slices of
+ * C rows padded with zeros to the length of the longest row of the
+ * slice. Slice s is stored column by column in
+ * [ data[p[s]], ..., data[p[s+1] - 1] ], so that element k of
+ * permuted row s*C+r is data[p[s] + k*C + r], with column index
+ * i[p[s] + k*C + r]. Permuted row j is row p[nslice + 1 + j] of
+ * the matrix.
+ *
+ * Block compressed row format (BCSR), with blocks of size
+ * bsize1-by-bsize2:
+ *
+ * p[I] <= n < p[I+1] are the blocks of block row I, i[n] is the block
+ * column of block n, whose elements are stored by rows in
+ * [ data[n*bsize1*bsize2], ..., data[(n+1)*bsize1*bsize2 - 1] ]
+ *
+ * For SELL and BCSR, nz is the number of stored elements, including
+ * padding.
  */
 
 typedef struct
@@ -103,6 +123,8 @@ typedef struct
 
   int sptype;                /* sparse storage type */
   size_t spflags;            /* GSL_SPMATRIX_FLG_xxx */
+  size_t bsize1;             /* SELL: slice height; BCSR: rows per block */
+  size_t bsize2;             /* SELL: sorting window; BCSR: columns per block */
 } gsl_spmatrix;
 
 /*
@@ -114,6 +136,7 @@ typedef struct
 gsl_spmatrix * gsl_spmatrix_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix * gsl_spmatrix_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix * gsl_spmatrix_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_free (gsl_spmatrix * m);
 int gsl_spmatrix_realloc (const size_t nzmax, gsl_spmatrix * m);
 size_t gsl_spmatrix_nnz (const gsl_spmatrix * m);
@@ -129,6 +152,9 @@ gsl_spmatrix * gsl_spmatrix_compress (const gsl_spmatrix * src, const int sptype
 gsl_spmatrix * gsl_spmatrix_compcol (const gsl_spmatrix * src);
 gsl_spmatrix * gsl_spmatrix_ccs (const gsl_spmatrix * src);
 gsl_spmatrix * gsl_spmatrix_crs (const gsl_spmatrix * src);
+gsl_spmatrix * gsl_spmatrix_compress_sum (const size_t n, gsl_spmatrix * const src[], const int sptype);
+gsl_spmatrix * gsl_spmatrix_compress_sell (const gsl_spmatrix * src, const size_t sigma);
+gsl_spmatrix * gsl_spmatrix_compress_bcsr (const gsl_spmatrix * src, const size_t r, const size_t c);
 
 /* copy */
 
@@ -145,6 +171,7 @@ int gsl_spmatrix_fread (FILE * stream, gsl_spmatrix * m);
 
 double gsl_spmatrix_get (const gsl_spmatrix * m, const size_t i, const size_t j);
 int gsl_spmatrix_set (gsl_spmatrix * m, const size_t i, const size_t j, const double x);
+int gsl_spmatrix_append (gsl_spmatrix * m, const size_t i, const size_t j, const double x);
 double * gsl_spmatrix_ptr (const gsl_spmatrix * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_int * gsl_spmatrix_int_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_int * gsl_spmatrix_int_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_int * gsl_spmatrix_int_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_int_free (gsl_spmatrix_int * m);
 int gsl_spmatrix_int_realloc (const size_t nzmax, gsl_spmatrix_int * m);
 size_t gsl_spmatrix_int_nnz (const gsl_spmatrix_int * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_int * gsl_spmatrix_int_compress (const gsl_spmatrix_int * src, cons
 gsl_spmatrix_int * gsl_spmatrix_int_compcol (const gsl_spmatrix_int * src);
 gsl_spmatrix_int * gsl_spmatrix_int_ccs (const gsl_spmatrix_int * src);
 gsl_spmatrix_int * gsl_spmatrix_int_crs (const gsl_spmatrix_int * src);
+gsl_spmatrix_int * gsl_spmatrix_int_compress_sum (const size_t n, gsl_spmatrix_int * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_int_fread (FILE * stream, gsl_spmatrix_int * m);
 
 int gsl_spmatrix_int_get (const gsl_spmatrix_int * m, const size_t i, const size_t j);
 int gsl_spmatrix_int_set (gsl_spmatrix_int * m, const size_t i, const size_t j, const int x);
+int gsl_spmatrix_int_append (gsl_spmatrix_int * m, const size_t i, const size_t j, const int x);
 int * gsl_spmatrix_int_ptr (const gsl_spmatrix_int * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_long * gsl_spmatrix_long_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_long * gsl_spmatrix_long_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_long * gsl_spmatrix_long_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_long_free (gsl_spmatrix_long * m);
 int gsl_spmatrix_long_realloc (const size_t nzmax, gsl_spmatrix_long * m);
 size_t gsl_spmatrix_long_nnz (const gsl_spmatrix_long * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_long * gsl_spmatrix_long_compress (const gsl_spmatrix_long * src, c
 gsl_spmatrix_long * gsl_spmatrix_long_compcol (const gsl_spmatrix_long * src);
 gsl_spmatrix_long * gsl_spmatrix_long_ccs (const gsl_spmatrix_long * src);
 gsl_spmatrix_long * gsl_spmatrix_long_crs (const gsl_spmatrix_long * src);
+gsl_spmatrix_long * gsl_spmatrix_long_compress_sum (const size_t n, gsl_spmatrix_long * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_long_fread (FILE * stream, gsl_spmatrix_long * m);
 
 long gsl_spmatrix_long_get (const gsl_spmatrix_long * m, const size_t i, const size_t j);
 int gsl_spmatrix_long_set (gsl_spmatrix_long * m, const size_t i, const size_t j, const long x);
+int gsl_spmatrix_long_append (gsl_spmatrix_long * m, const size_t i, const size_t j, const long x);
 long * gsl_spmatrix_long_ptr (const gsl_spmatrix_long * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_long_double * gsl_spmatrix_long_double_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_long_double * gsl_spmatrix_long_double_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_long_double * gsl_spmatrix_long_double_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_long_double_free (gsl_spmatrix_long_double * m);
 int gsl_spmatrix_long_double_realloc (const size_t nzmax, gsl_spmatrix_long_double * m);
 size_t gsl_spmatrix_long_double_nnz (const gsl_spmatrix_long_double * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_long_double * gsl_spmatrix_long_double_compress (const gsl_spmatrix
 gsl_spmatrix_long_double * gsl_spmatrix_long_double_compcol (const gsl_spmatrix_long_double * src);
 gsl_spmatrix_long_double * gsl_spmatrix_long_double_ccs (const gsl_spmatrix_long_double * src);
 gsl_spmatrix_long_double * gsl_spmatrix_long_double_crs (const gsl_spmatrix_long_double * src);
+gsl_spmatrix_long_double * gsl_spmatrix_long_double_compress_sum (const size_t n, gsl_spmatrix_long_double * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_long_double_fread (FILE * stream, gsl_spmatrix_long_double * m)
 
 long double gsl_spmatrix_long_double_get (const gsl_spmatrix_long_double * m, const size_t i, const size_t j);
 int gsl_spmatrix_long_double_set (gsl_spmatrix_long_double * m, const size_t i, const size_t j, const long double x);
+int gsl_spmatrix_long_double_append (gsl_spmatrix_long_double * m, const size_t i, const size_t j, const long double x);
 long double * gsl_spmatrix_long_double_ptr (const gsl_spmatrix_long_double * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_short * gsl_spmatrix_short_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_short * gsl_spmatrix_short_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_short * gsl_spmatrix_short_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_short_free (gsl_spmatrix_short * m);
 int gsl_spmatrix_short_realloc (const size_t nzmax, gsl_spmatrix_short * m);
 size_t gsl_spmatrix_short_nnz (const gsl_spmatrix_short * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_short * gsl_spmatrix_short_compress (const gsl_spmatrix_short * src
 gsl_spmatrix_short * gsl_spmatrix_short_compcol (const gsl_spmatrix_short * src);
 gsl_spmatrix_short * gsl_spmatrix_short_ccs (const gsl_spmatrix_short * src);
 gsl_spmatrix_short * gsl_spmatrix_short_crs (const gsl_spmatrix_short * src);
+gsl_spmatrix_short * gsl_spmatrix_short_compress_sum (const size_t n, gsl_spmatrix_short * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_short_fread (FILE * stream, gsl_spmatrix_short * m);
 
 short gsl_spmatrix_short_get (const gsl_spmatrix_short * m, const size_t i, const size_t j);
 int gsl_spmatrix_short_set (gsl_spmatrix_short * m, const size_t i, const size_t j, const short x);
+int gsl_spmatrix_short_append (gsl_spmatrix_short * m, const size_t i, const size_t j, const short x);
 short * gsl_spmatrix_short_ptr (const gsl_spmatrix_short * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_uchar * gsl_spmatrix_uchar_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_uchar * gsl_spmatrix_uchar_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_uchar * gsl_spmatrix_uchar_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_uchar_free (gsl_spmatrix_uchar * m);
 int gsl_spmatrix_uchar_realloc (const size_t nzmax, gsl_spmatrix_uchar * m);
 size_t gsl_spmatrix_uchar_nnz (const gsl_spmatrix_uchar * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_uchar * gsl_spmatrix_uchar_compress (const gsl_spmatrix_uchar * src
 gsl_spmatrix_uchar * gsl_spmatrix_uchar_compcol (const gsl_spmatrix_uchar * src);
 gsl_spmatrix_uchar * gsl_spmatrix_uchar_ccs (const gsl_spmatrix_uchar * src);
 gsl_spmatrix_uchar * gsl_spmatrix_uchar_crs (const gsl_spmatrix_uchar * src);
+gsl_spmatrix_uchar * gsl_spmatrix_uchar_compress_sum (const size_t n, gsl_spmatrix_uchar * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_uchar_fread (FILE * stream, gsl_spmatrix_uchar * m);
 
 unsigned char gsl_spmatrix_uchar_get (const gsl_spmatrix_uchar * m, const size_t i, const size_t j);
 int gsl_spmatrix_uchar_set (gsl_spmatrix_uchar * m, const size_t i, const size_t j, const unsigned char x);
+int gsl_spmatrix_uchar_append (gsl_spmatrix_uchar * m, const size_t i, const size_t j, const unsigned char x);
 unsigned char * gsl_spmatrix_uchar_ptr (const gsl_spmatrix_uchar * m, const size_t i, const size_t j);
 
 /* minmax */
@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_uint * gsl_spmatrix_uint_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_uint * gsl_spmatrix_uint_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_uint * gsl_spmatrix_uint_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_uint_free (gsl_spmatrix_uint * m);
 int gsl_spmatrix_uint_realloc (const size_t nzmax, gsl_spmatrix_uint * m);
 size_t gsl_spmatrix_uint_nnz (const gsl_spmatrix_uint * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_uint * gsl_spmatrix_uint_compress (const gsl_spmatrix_uint * src, c
 gsl_spmatrix_uint * gsl_spmatrix_uint_compcol (const gsl_spmatrix_uint * src);
 gsl_spmatrix_uint * gsl_spmatrix_uint_ccs (const gsl_spmatrix_uint * src);
 gsl_spmatrix_uint * gsl_spmatrix_uint_crs (const gsl_spmatrix_uint * src);
+gsl_spmatrix_uint * gsl_spmatrix_uint_compress_sum (const size_t n, gsl_spmatrix_uint * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_uint_fread (FILE * stream, gsl_spmatrix_uint * m);
 
 unsigned int gsl_spmatrix_uint_get (const gsl_spmatrix_uint * m, const size_t i, const size_t j);
 int gsl_spmatrix_uint_set (gsl_spmatrix_uint * m, const size_t i, const size_t j, const unsigned int x);
+int gsl_spmatrix_uint_append (gsl_spmatrix_uint * m, const size_t i, const size_t j, const unsigned int x);
 unsigned int * gsl_spmatrix_uint_ptr (const gsl_spmatrix_uint * m, const size_t i, const size_t j);
 
 /* minmax */
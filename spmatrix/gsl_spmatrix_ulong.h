@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_ulong * gsl_spmatrix_ulong_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_ulong * gsl_spmatrix_ulong_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_ulong * gsl_spmatrix_ulong_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_ulong_free (gsl_spmatrix_ulong * m);
 int gsl_spmatrix_ulong_realloc (const size_t nzmax, gsl_spmatrix_ulong * m);
 size_t gsl_spmatrix_ulong_nnz (const gsl_spmatrix_ulong * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_ulong * gsl_spmatrix_ulong_compress (const gsl_spmatrix_ulong * src
 gsl_spmatrix_ulong * gsl_spmatrix_ulong_compcol (const gsl_spmatrix_ulong * src);
 gsl_spmatrix_ulong * gsl_spmatrix_ulong_ccs (const gsl_spmatrix_ulong * src);
 gsl_spmatrix_ulong * gsl_spmatrix_ulong_crs (const gsl_spmatrix_ulong * src);
+gsl_spmatrix_ulong * gsl_spmatrix_ulong_compress_sum (const size_t n, gsl_spmatrix_ulong * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_ulong_fread (FILE * stream, gsl_spmatrix_ulong * m);
 
 unsigned long gsl_spmatrix_ulong_get (const gsl_spmatrix_ulong * m, const size_t i, const size_t j);
 int gsl_spmatrix_ulong_set (gsl_spmatrix_ulong * m, const size_t i, const size_t j, const unsigned long x);
+int gsl_spmatrix_ulong_append (gsl_spmatrix_ulong * m, const size_t i, const size_t j, const unsigned long x);
 unsigned long * gsl_spmatrix_ulong_ptr (const gsl_spmatrix_ulong * m, const size_t i, const size_t j);
 
 /* minmax */
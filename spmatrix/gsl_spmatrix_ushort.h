@@ -114,6 +114,7 @@ typedef struct
 gsl_spmatrix_ushort * gsl_spmatrix_ushort_alloc (const size_t n1, const size_t n2);
 gsl_spmatrix_ushort * gsl_spmatrix_ushort_alloc_nzmax (const size_t n1, const size_t n2,
                                                      const size_t nzmax, const int sptype);
+gsl_spmatrix_ushort * gsl_spmatrix_ushort_alloc_append (const size_t n1, const size_t n2, const size_t nzmax);
 void gsl_spmatrix_ushort_free (gsl_spmatrix_ushort * m);
 int gsl_spmatrix_ushort_realloc (const size_t nzmax, gsl_spmatrix_ushort * m);
 size_t gsl_spmatrix_ushort_nnz (const gsl_spmatrix_ushort * m);
@@ -129,6 +130,7 @@ gsl_spmatrix_ushort * gsl_spmatrix_ushort_compress (const gsl_spmatrix_ushort *
 gsl_spmatrix_ushort * gsl_spmatrix_ushort_compcol (const gsl_spmatrix_ushort * src);
 gsl_spmatrix_ushort * gsl_spmatrix_ushort_ccs (const gsl_spmatrix_ushort * src);
 gsl_spmatrix_ushort * gsl_spmatrix_ushort_crs (const gsl_spmatrix_ushort * src);
+gsl_spmatrix_ushort * gsl_spmatrix_ushort_compress_sum (const size_t n, gsl_spmatrix_ushort * const src[], const int sptype);
 
 /* copy */
 
@@ -145,6 +147,7 @@ int gsl_spmatrix_ushort_fread (FILE * stream, gsl_spmatrix_ushort * m);
 
 unsigned short gsl_spmatrix_ushort_get (const gsl_spmatrix_ushort * m, const size_t i, const size_t j);
 int gsl_spmatrix_ushort_set (gsl_spmatrix_ushort * m, const size_t i, const size_t j, const unsigned short x);
+int gsl_spmatrix_ushort_append (gsl_spmatrix_ushort * m, const size_t i, const size_t j, const unsigned short x);
 unsigned short * gsl_spmatrix_ushort_ptr (const gsl_spmatrix_ushort * m, const size_t i, const size_t j);
 
 /* minmax */
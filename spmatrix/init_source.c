@@ -18,6 +18,9 @@
  */
 
 static int FUNCTION(compare, func) (const void * pa, const void * pb, void * param);
+static TYPE (gsl_spmatrix) * FUNCTION (spmatrix, alloc) (const size_t n1, const size_t n2,
+                                                       const size_t nzmax, const int sptype,
+                                                       const size_t flags);
 static int FUNCTION (spmatrix, pool_init) (TYPE (gsl_spmatrix) * m);
 static int FUNCTION (spmatrix, pool_free) (TYPE (gsl_spmatrix) * m);
 static void * FUNCTION (spmatrix, malloc) (size_t size, void * params);
@@ -44,6 +47,33 @@ FUNCTION (gsl_spmatrix, alloc) (const size_t n1, const size_t n2)
 TYPE (gsl_spmatrix) *
 FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
                                       const size_t nzmax, const int sptype)
+{
+  return FUNCTION (spmatrix, alloc) (n1, n2, nzmax, sptype, 0);
+}
+
+/*
+gsl_spmatrix_alloc_append()
+  Allocate a COO matrix without a binary tree, for fast
+assembly with gsl_spmatrix_append(). Duplicate entries are
+summed when the matrix is compressed.
+
+Inputs: n1    - number of rows
+        n2    - number of columns
+        nzmax - initial number of triplets to allocate
+*/
+
+TYPE (gsl_spmatrix) *
+FUNCTION (gsl_spmatrix, alloc_append) (const size_t n1, const size_t n2,
+                                       const size_t nzmax)
+{
+  return FUNCTION (spmatrix, alloc) (n1, n2, nzmax, GSL_SPMATRIX_COO,
+                                     GSL_SPMATRIX_FLG_APPEND);
+}
+
+static TYPE (gsl_spmatrix) *
+FUNCTION (spmatrix, alloc) (const size_t n1, const size_t n2,
+                            const size_t nzmax, const int sptype,
+                            const size_t flags)
 {
   TYPE(gsl_spmatrix) * m;
 
@@ -57,6 +87,12 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
       GSL_ERROR_NULL ("matrix dimension n2 must be positive integer",
                       GSL_EINVAL);
     }
+  else if (sptype != GSL_SPMATRIX_COO && sptype != GSL_SPMATRIX_CSC &&
+           sptype != GSL_SPMATRIX_CSR)
+    {
+      GSL_ERROR_NULL ("sparse matrix type must be COO, CSC or CSR",
+                      GSL_EINVAL);
+    }
 
   m = calloc(1, sizeof(TYPE(gsl_spmatrix)));
   if (!m)
@@ -76,6 +112,8 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
   else
     m->spflags = 0;
 
+  m->spflags |= flags;
+
   m->i = malloc(m->nzmax * sizeof(int));
   if (!m->i)
     {
@@ -92,7 +130,18 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
       GSL_ERROR_NULL("failed to allocate space for work", GSL_ENOMEM);
     }
 
-  if (sptype == GSL_SPMATRIX_COO)
+  if (sptype == GSL_SPMATRIX_COO && (flags & GSL_SPMATRIX_FLG_APPEND))
+    {
+      /* triplets are appended without a binary tree */
+      m->p = malloc(m->nzmax * sizeof(int));
+      if (!m->p)
+        {
+          FUNCTION(gsl_spmatrix, free) (m);
+          GSL_ERROR_NULL("failed to allocate space for column indices",
+                         GSL_ENOMEM);
+        }
+    }
+  else if (sptype == GSL_SPMATRIX_COO)
     {
       m->tree = gsl_bst_alloc(gsl_bst_avl, &FUNCTION(spmatrix, allocator), FUNCTION (compare, func), (void *) m);
       if (!m->tree)
@@ -178,7 +227,11 @@ FUNCTION (gsl_spmatrix, realloc) (const size_t nzmax, TYPE (gsl_spmatrix) * m)
   void *ptr;
   ATOMIC * ptr_atomic;
 
-  if (nzmax < m->nz)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (nzmax < m->nz)
     {
       GSL_ERROR("new nzmax is less than current nz", GSL_EINVAL);
     }
@@ -208,7 +261,7 @@ FUNCTION (gsl_spmatrix, realloc) (const size_t nzmax, TYPE (gsl_spmatrix) * m)
       GSL_ERROR("failed to allocate space for data", GSL_ENOMEM);
     }
 
-  if (GSL_SPMATRIX_ISCOO(m))
+  if (GSL_SPMATRIX_ISCOO(m) && m->tree != NULL)
     {
       const size_t nnew = nzmax - m->nz; /* number of new nodes to allocate in memory pool */
       gsl_spmatrix_pool * node;
@@ -273,6 +326,10 @@ FUNCTION (gsl_spmatrix, type) (const TYPE (gsl_spmatrix) * m)
     return "CSR";
   else if (GSL_SPMATRIX_ISCSC(m))
     return "CSC";
+  else if (GSL_SPMATRIX_ISSELL(m))
+    return "SELL";
+  else if (GSL_SPMATRIX_ISBCSR(m))
+    return "BCSR";
   else
     return "unknown";
 }
@@ -280,6 +337,11 @@ FUNCTION (gsl_spmatrix, type) (const TYPE (gsl_spmatrix) * m)
 int
 FUNCTION (gsl_spmatrix, set_zero) (TYPE (gsl_spmatrix) * m)
 {
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+
   m->nz = 0;
 
   if (m->tree != NULL)
@@ -311,6 +373,11 @@ FUNCTION (gsl_spmatrix, tree_rebuild) (TYPE (gsl_spmatrix) * m)
     {
       GSL_ERROR("matrix must be in COO format", GSL_EINVAL);
     }
+  else if (m->tree == NULL)
+    {
+      /* matrix assembled with gsl_spmatrix_append(), nothing to rebuild */
+      return GSL_SUCCESS;
+    }
   else
     {
       size_t n;
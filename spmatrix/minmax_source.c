@@ -24,7 +24,11 @@ FUNCTION (gsl_spmatrix, minmax) (const TYPE (gsl_spmatrix) * m,
   ATOMIC min, max;
   size_t n;
 
-  if (m->nz == 0)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (m->nz == 0)
     {
       GSL_ERROR("matrix is empty", GSL_EINVAL);
     }
@@ -53,7 +57,11 @@ int
 FUNCTION (gsl_spmatrix, min_index) (const TYPE (gsl_spmatrix) * m,
                                     size_t * imin_out, size_t * jmin_out)
 {
-  if (m->nz == 0)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (m->nz == 0)
     {
       GSL_ERROR("matrix is empty", GSL_EINVAL);
     }
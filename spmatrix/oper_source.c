@@ -36,7 +36,11 @@ FUNCTION (gsl_spmatrix, scale) (TYPE (gsl_spmatrix) * m, const BASE x)
 int
 FUNCTION (gsl_spmatrix, scale_columns) (TYPE (gsl_spmatrix) * m, const TYPE (gsl_vector) * x)
 {
-  if (m->size2 != x->size)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (m->size2 != x->size)
     {
       GSL_ERROR("x vector length does not match matrix", GSL_EBADLEN);
     }
@@ -93,7 +97,11 @@ FUNCTION (gsl_spmatrix, scale_columns) (TYPE (gsl_spmatrix) * m, const TYPE (gsl
 int
 FUNCTION (gsl_spmatrix, scale_rows) (TYPE (gsl_spmatrix) * m, const TYPE (gsl_vector) * x)
 {
-  if (m->size1 != x->size)
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (m->size1 != x->size)
     {
       GSL_ERROR("x vector length does not match matrix", GSL_EBADLEN);
     }
@@ -164,7 +172,11 @@ FUNCTION (gsl_spmatrix, add) (TYPE (gsl_spmatrix) * c, const TYPE (gsl_spmatrix)
   const size_t M = a->size1;
   const size_t N = a->size2;
 
-  if (b->size1 != M || b->size2 != N || c->size1 != M || c->size2 != N)
+  if (GSL_SPMATRIX_ISBLOCKED(a))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (b->size1 != M || b->size2 != N || c->size1 != M || c->size2 != N)
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
@@ -257,7 +269,11 @@ FUNCTION (gsl_spmatrix, dense_add) (TYPE (gsl_matrix) * a, const TYPE (gsl_spmat
   const size_t M = a->size1;
   const size_t N = a->size2;
 
-  if (b->size1 != M || b->size2 != N)
+  if (GSL_SPMATRIX_ISBLOCKED(b))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (b->size1 != M || b->size2 != N)
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
@@ -342,7 +358,11 @@ FUNCTION (gsl_spmatrix, dense_sub) (TYPE (gsl_matrix) * a, const TYPE (gsl_spmat
   const size_t M = a->size1;
   const size_t N = a->size2;
 
-  if (b->size1 != M || b->size2 != N)
+  if (GSL_SPMATRIX_ISBLOCKED(b))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (b->size1 != M || b->size2 != N)
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
@@ -449,7 +469,11 @@ gsl_spmatrix_sp2d()
 int
 FUNCTION (gsl_spmatrix, sp2d) (TYPE (gsl_matrix) * A, const TYPE (gsl_spmatrix) * S)
 {
-  if (A->size1 != S->size1 || A->size2 != S->size2)
+  if (GSL_SPMATRIX_ISBLOCKED(S))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (A->size1 != S->size1 || A->size2 != S->size2)
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
@@ -467,7 +491,8 @@ FUNCTION (gsl_spmatrix, sp2d) (TYPE (gsl_matrix) * A, const TYPE (gsl_spmatrix)
               int j = S->p[n];
               BASE x = S->data[n];
 
-              FUNCTION (gsl_matrix, set) (A, i, j, x);
+              /* sum duplicate triplets of appended matrices */
+              *FUNCTION (gsl_matrix, ptr) (A, i, j) += x;
             }
         }
       else if (GSL_SPMATRIX_ISCSR(S))
@@ -23,7 +23,11 @@ FUNCTION (gsl_spmatrix, equal) (const TYPE (gsl_spmatrix) * a, const TYPE (gsl_s
   const size_t M = a->size1;
   const size_t N = a->size2;
 
-  if (b->size1 != M || b->size2 != N)
+  if (GSL_SPMATRIX_ISBLOCKED(a))
+    {
+      GSL_ERROR_VAL("not supported for SELL or BCSR matrices", GSL_EINVAL, 0);
+    }
+  else if (b->size1 != M || b->size2 != N)
     {
       GSL_ERROR_VAL("matrices must have same dimensions", GSL_EBADLEN, 0);
     }
@@ -131,7 +135,11 @@ FUNCTION (gsl_spmatrix, norm1) (const TYPE (gsl_spmatrix) * A)
   const size_t N = A->size2;
   ATOMIC value = (ATOMIC) 0;
 
-  if (A->nz == 0)
+  if (GSL_SPMATRIX_ISBLOCKED(A))
+    {
+      GSL_ERROR_VAL("not supported for SELL or BCSR matrices", GSL_EINVAL, value);
+    }
+  else if (A->nz == 0)
     {
       return (ATOMIC) 0;
     }
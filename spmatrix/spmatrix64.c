@@ -0,0 +1,335 @@
+/* spmatrix/spmatrix64.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_errno.h>
+
+/* length of the pointer array p */
+static size_t
+spmatrix64_plen (const gsl_spmatrix64 * m)
+{
+  return (GSL_SPMATRIX_ISCSC(m) ? m->size2 : m->size1) + 1;
+}
+
+gsl_spmatrix64 *
+gsl_spmatrix64_alloc_nzmax (const size_t n1, const size_t n2,
+                            const size_t nzmax, const int sptype)
+{
+  gsl_spmatrix64 *m;
+
+  if (n1 == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension n1 must be positive integer",
+                      GSL_EINVAL);
+    }
+  else if (n2 == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension n2 must be positive integer",
+                      GSL_EINVAL);
+    }
+  else if (sptype != GSL_SPMATRIX_CSC && sptype != GSL_SPMATRIX_CSR)
+    {
+      GSL_ERROR_NULL ("compressed format required", GSL_EINVAL);
+    }
+
+  m = calloc (1, sizeof (gsl_spmatrix64));
+  if (!m)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for spmatrix64 struct",
+                      GSL_ENOMEM);
+    }
+
+  m->size1 = n1;
+  m->size2 = n2;
+  m->nzmax = GSL_MAX (nzmax, 1);
+  m->nz = 0;
+  m->sptype = sptype;
+
+  m->i = malloc (m->nzmax * sizeof (gsl_spmatrix64_index));
+  m->data = malloc (m->nzmax * sizeof (double));
+  m->p = calloc (spmatrix64_plen (m), sizeof (gsl_spmatrix64_index));
+
+  if (!m->i || !m->data || !m->p)
+    {
+      gsl_spmatrix64_free (m);
+      GSL_ERROR_NULL ("failed to allocate space for matrix", GSL_ENOMEM);
+    }
+
+  return m;
+}
+
+void
+gsl_spmatrix64_free (gsl_spmatrix64 * m)
+{
+  RETURN_IF_NULL (m);
+
+  if (m->i)
+    free (m->i);
+
+  if (m->data)
+    free (m->data);
+
+  if (m->p)
+    free (m->p);
+
+  free (m);
+}
+
+int
+gsl_spmatrix64_realloc (const size_t nzmax, gsl_spmatrix64 * m)
+{
+  void *ptr;
+
+  if (nzmax < m->nz)
+    {
+      GSL_ERROR ("new nzmax is less than current nz", GSL_EINVAL);
+    }
+
+  ptr = realloc (m->i, GSL_MAX (nzmax, 1) * sizeof (gsl_spmatrix64_index));
+  if (!ptr)
+    {
+      GSL_ERROR ("failed to allocate space for indices", GSL_ENOMEM);
+    }
+
+  m->i = (gsl_spmatrix64_index *) ptr;
+
+  ptr = realloc (m->data, GSL_MAX (nzmax, 1) * sizeof (double));
+  if (!ptr)
+    {
+      GSL_ERROR ("failed to allocate space for data", GSL_ENOMEM);
+    }
+
+  m->data = (double *) ptr;
+  m->nzmax = GSL_MAX (nzmax, 1);
+
+  return GSL_SUCCESS;
+}
+
+size_t
+gsl_spmatrix64_nnz (const gsl_spmatrix64 * m)
+{
+  return m->nz;
+}
+
+double
+gsl_spmatrix64_get (const gsl_spmatrix64 * m, const size_t i, const size_t j)
+{
+  if (i >= m->size1)
+    {
+      GSL_ERROR_VAL ("first index out of range", GSL_EINVAL, 0);
+    }
+  else if (j >= m->size2)
+    {
+      GSL_ERROR_VAL ("second index out of range", GSL_EINVAL, 0);
+    }
+  else
+    {
+      /* search column j for row i (CSC) or row i for column j (CSR) */
+      const size_t outer = GSL_SPMATRIX_ISCSC(m) ? j : i;
+      const gsl_spmatrix64_index inner = (gsl_spmatrix64_index) (GSL_SPMATRIX_ISCSC(m) ? i : j);
+      gsl_spmatrix64_index p;
+
+      for (p = m->p[outer]; p < m->p[outer + 1]; ++p)
+        {
+          if (m->i[p] == inner)
+            return m->data[p];
+        }
+
+      return 0.0;
+    }
+}
+
+int
+gsl_spmatrix64_set_zero (gsl_spmatrix64 * m)
+{
+  memset (m->p, 0, spmatrix64_plen (m) * sizeof (gsl_spmatrix64_index));
+  m->nz = 0;
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_spmatrix64_memcpy_spmatrix()
+  Copy a compressed gsl_spmatrix into a gsl_spmatrix64 of the same
+size and format, enlarging dest if needed
+*/
+
+int
+gsl_spmatrix64_memcpy_spmatrix (gsl_spmatrix64 * dest, const gsl_spmatrix * src)
+{
+  if (dest->size1 != src->size1 || dest->size2 != src->size2)
+    {
+      GSL_ERROR ("matrices must have same dimensions", GSL_EBADLEN);
+    }
+  else if (dest->sptype != src->sptype)
+    {
+      GSL_ERROR ("matrices must have same sparse storage format", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t plen = spmatrix64_plen (dest);
+      size_t n;
+
+      if (dest->nzmax < src->nz)
+        {
+          int status = gsl_spmatrix64_realloc (src->nz, dest);
+          if (status)
+            return status;
+        }
+
+      for (n = 0; n < plen; ++n)
+        dest->p[n] = src->p[n];
+
+      for (n = 0; n < src->nz; ++n)
+        {
+          dest->i[n] = src->i[n];
+          dest->data[n] = src->data[n];
+        }
+
+      dest->nz = src->nz;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* triplet (outer, inner) with its position in the input arrays */
+typedef struct
+{
+  gsl_spmatrix64_index outer;
+  gsl_spmatrix64_index inner;
+  size_t n;
+} spmatrix64_triplet;
+
+static int
+spmatrix64_triplet_cmp (const void * a, const void * b)
+{
+  const spmatrix64_triplet *ta = (const spmatrix64_triplet *) a;
+  const spmatrix64_triplet *tb = (const spmatrix64_triplet *) b;
+
+  if (ta->outer != tb->outer)
+    return ta->outer < tb->outer ? -1 : 1;
+  else if (ta->inner != tb->inner)
+    return ta->inner < tb->inner ? -1 : 1;
+  else if (ta->n != tb->n)
+    return ta->n < tb->n ? -1 : 1;
+  else
+    return 0;
+}
+
+/*
+gsl_spmatrix64_compress_coo()
+  Assemble a compressed matrix from nz triplets (ti[n], tj[n], tx[n]).
+Duplicate entries are summed in the order they appear in the input,
+and the indices within each column (CSC) or row (CSR) are sorted.
+
+Inputs: n1     - number of rows
+        n2     - number of columns
+        nz     - number of triplets
+        ti     - row indices, length nz
+        tj     - column indices, length nz
+        tx     - values, length nz
+        sptype - GSL_SPMATRIX_CSC or GSL_SPMATRIX_CSR
+
+Return: pointer to new matrix, or NULL on error
+
+Notes:
+1) Only the pointer array depends on the dimensions, so size1 or
+size2 may exceed INT_MAX as long as the outer dimension fits in memory
+*/
+
+gsl_spmatrix64 *
+gsl_spmatrix64_compress_coo (const size_t n1, const size_t n2, const size_t nz,
+                             const gsl_spmatrix64_index * ti,
+                             const gsl_spmatrix64_index * tj,
+                             const double * tx, const int sptype)
+{
+  gsl_spmatrix64 *m;
+  spmatrix64_triplet *t;
+  const int csc = (sptype == GSL_SPMATRIX_CSC);
+  const size_t plen = (csc ? n2 : n1) + 1;
+  size_t n, k;
+
+  if (nz > ((size_t) -1 >> 1) / sizeof (spmatrix64_triplet))
+    {
+      GSL_ERROR_NULL ("too many triplets", GSL_EINVAL);
+    }
+
+  m = gsl_spmatrix64_alloc_nzmax (n1, n2, nz, sptype);
+  if (!m)
+    return NULL;
+
+  t = malloc (GSL_MAX (nz, 1) * sizeof (spmatrix64_triplet));
+  if (!t)
+    {
+      gsl_spmatrix64_free (m);
+      GSL_ERROR_NULL ("failed to allocate space for triplets", GSL_ENOMEM);
+    }
+
+  for (n = 0; n < nz; ++n)
+    {
+      if (ti[n] < 0 || (size_t) ti[n] >= n1)
+        {
+          free (t);
+          gsl_spmatrix64_free (m);
+          GSL_ERROR_NULL ("row index out of range", GSL_EINVAL);
+        }
+      else if (tj[n] < 0 || (size_t) tj[n] >= n2)
+        {
+          free (t);
+          gsl_spmatrix64_free (m);
+          GSL_ERROR_NULL ("column index out of range", GSL_EINVAL);
+        }
+
+      t[n].outer = csc ? tj[n] : ti[n];
+      t[n].inner = csc ? ti[n] : tj[n];
+      t[n].n = n;
+    }
+
+  qsort (t, nz, sizeof (spmatrix64_triplet), spmatrix64_triplet_cmp);
+
+  /* copy sorted triplets, summing duplicates, and count entries per outer index */
+  k = 0;
+  for (n = 0; n < nz; ++n)
+    {
+      if (k > 0 && t[n].outer == t[n - 1].outer && t[n].inner == t[n - 1].inner)
+        {
+          m->data[k - 1] += tx[t[n].n];
+        }
+      else
+        {
+          m->i[k] = t[n].inner;
+          m->data[k] = tx[t[n].n];
+          ++(m->p[t[n].outer + 1]);
+          ++k;
+        }
+    }
+
+  /* cumulative sum gives the pointer array */
+  for (n = 1; n < plen; ++n)
+    m->p[n] += m->p[n - 1];
+
+  m->nz = k;
+
+  free (t);
+
+  return m;
+}
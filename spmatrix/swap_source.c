@@ -20,6 +20,11 @@
 int
 FUNCTION (gsl_spmatrix, transpose) (TYPE (gsl_spmatrix) * m)
 {
+  if (GSL_SPMATRIX_ISBLOCKED(m))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+
   /* swap dimensions - this must be done before the tree_rebuild step */
   if (m->size1 != m->size2)
     {
@@ -73,7 +78,11 @@ FUNCTION (gsl_spmatrix, transpose_memcpy) (TYPE (gsl_spmatrix) * dest, const TYP
   const size_t M = src->size1;
   const size_t N = src->size2;
 
-  if (M != dest->size2 || N != dest->size1)
+  if (GSL_SPMATRIX_ISBLOCKED(src))
+    {
+      GSL_ERROR("not supported for SELL or BCSR matrices", GSL_EINVAL);
+    }
+  else if (M != dest->size2 || N != dest->size1)
     {
       GSL_ERROR("dimensions of dest must be transpose of src matrix",
                 GSL_EBADLEN);
@@ -108,6 +117,9 @@ FUNCTION (gsl_spmatrix, transpose_memcpy) (TYPE (gsl_spmatrix) * dest, const TYP
               for (r = 0; r < MULTIPLICITY; ++r)
                 dest->data[MULTIPLICITY * n + r] = src->data[MULTIPLICITY * n + r];
 
+              if (dest->tree == NULL)
+                continue;
+
               /* copy binary tree data */
               ptr = gsl_bst_insert(&dest->data[MULTIPLICITY * n], dest->tree);
               if (ptr != NULL)
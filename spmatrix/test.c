@@ -19,14 +19,18 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_spmatrix.h>
 
+#include "thread_internal.h"
+
 int status = 0;
 
 #define BASE_GSL_COMPLEX_LONG
@@ -113,6 +117,416 @@ int status = 0;
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+static void
+test_spmatrix64 (const size_t M, const size_t N, const double density,
+                 const gsl_rng * r)
+{
+  const int sptypes[] = { GSL_SPMATRIX_CSC, GSL_SPMATRIX_CSR };
+  gsl_spmatrix * A = test_random (M, N, density, -10.0, 10.0, r);
+  size_t k;
+
+  for (k = 0; k < 2; ++k)
+    {
+      gsl_spmatrix * B = gsl_spmatrix_compress (A, sptypes[k]);
+      gsl_spmatrix64 * C = gsl_spmatrix64_alloc_nzmax (M, N, 1, sptypes[k]);
+      size_t i, j;
+
+      status = gsl_spmatrix64_memcpy_spmatrix (C, B);
+      gsl_test (status, "test_spmatrix64: memcpy M=%zu N=%zu type=%s",
+                M, N, gsl_spmatrix_type (B));
+
+      gsl_test (gsl_spmatrix64_nnz (C) != gsl_spmatrix_nnz (A),
+                "test_spmatrix64: nnz M=%zu N=%zu type=%s",
+                M, N, gsl_spmatrix_type (B));
+
+      status = 0;
+      for (i = 0; i < M; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              if (gsl_spmatrix64_get (C, i, j) != gsl_spmatrix_get (A, i, j))
+                status = 1;
+            }
+        }
+
+      gsl_test (status, "test_spmatrix64: get M=%zu N=%zu type=%s",
+                M, N, gsl_spmatrix_type (B));
+
+      gsl_spmatrix64_set_zero (C);
+      gsl_test (gsl_spmatrix64_nnz (C) != 0 || gsl_spmatrix64_get (C, M - 1, N - 1) != 0.0,
+                "test_spmatrix64: set_zero M=%zu N=%zu type=%s",
+                M, N, gsl_spmatrix_type (B));
+
+      gsl_spmatrix_free (B);
+      gsl_spmatrix64_free (C);
+    }
+
+  /* assemble from the triplets of A, each split into two duplicates */
+  {
+    const size_t nz = gsl_spmatrix_nnz (A);
+    gsl_spmatrix64_index * ti = malloc (2 * nz * sizeof (gsl_spmatrix64_index));
+    gsl_spmatrix64_index * tj = malloc (2 * nz * sizeof (gsl_spmatrix64_index));
+    double * tx = malloc (2 * nz * sizeof (double));
+    size_t n;
+
+    for (n = 0; n < nz; ++n)
+      {
+        ti[n] = ti[2 * nz - 1 - n] = A->i[n];
+        tj[n] = tj[2 * nz - 1 - n] = A->p[n];
+        tx[n] = tx[2 * nz - 1 - n] = 0.5 * A->data[n];
+      }
+
+    for (k = 0; k < 2; ++k)
+      {
+        gsl_spmatrix64 * C = gsl_spmatrix64_compress_coo (M, N, 2 * nz, ti, tj, tx, sptypes[k]);
+        const size_t plen = (sptypes[k] == GSL_SPMATRIX_CSC ? N : M) + 1;
+        size_t i, j;
+
+        gsl_test (gsl_spmatrix64_nnz (C) != nz,
+                  "test_spmatrix64: compress_coo nnz M=%zu N=%zu type=%d",
+                  M, N, sptypes[k]);
+
+        status = C->p[0] != 0 || C->p[plen - 1] != (gsl_spmatrix64_index) nz;
+        for (i = 0; i < plen - 1; ++i)
+          {
+            gsl_spmatrix64_index p;
+
+            for (p = C->p[i] + 1; p < C->p[i + 1]; ++p)
+              {
+                if (C->i[p] <= C->i[p - 1])
+                  status = 1;
+              }
+          }
+
+        gsl_test (status, "test_spmatrix64: compress_coo sorted M=%zu N=%zu type=%d",
+                  M, N, sptypes[k]);
+
+        status = 0;
+        for (i = 0; i < M; ++i)
+          {
+            for (j = 0; j < N; ++j)
+              {
+                if (gsl_spmatrix64_get (C, i, j) != gsl_spmatrix_get (A, i, j))
+                  status = 1;
+              }
+          }
+
+        gsl_test (status, "test_spmatrix64: compress_coo get M=%zu N=%zu type=%d",
+                  M, N, sptypes[k]);
+
+        gsl_spmatrix64_free (C);
+      }
+
+    free (ti);
+    free (tj);
+    free (tx);
+  }
+
+  gsl_spmatrix_free (A);
+}
+
+/* assemble matrices whose row or column dimension exceeds INT_MAX */
+static void
+test_spmatrix64_large (void)
+{
+  const size_t big = (size_t) 2 * INT_MAX + 7;
+  const gsl_spmatrix64_index last = (gsl_spmatrix64_index) big - 1;
+  const gsl_spmatrix64_index mid = (gsl_spmatrix64_index) INT_MAX + 3;
+  gsl_spmatrix64_index outer[] = { 2, 0, 2, 1, 2, 0 };
+  gsl_spmatrix64_index inner[] = { 0, 0, 0, 0, 0, 0 };
+  const double tx[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+  gsl_error_handler_t * old_handler;
+  gsl_spmatrix64 * C;
+
+  if (sizeof (gsl_spmatrix64_index) <= sizeof (int))
+    return;
+
+  inner[0] = last;
+  inner[1] = mid;
+  inner[2] = 1;
+  inner[3] = mid;
+  inner[4] = last;
+  inner[5] = mid;
+
+  /* CSC: big row dimension, outer index is the column */
+  C = gsl_spmatrix64_compress_coo (big, 3, 6, inner, outer, tx, GSL_SPMATRIX_CSC);
+  gsl_test (C == NULL || gsl_spmatrix64_nnz (C) != 4 ||
+            C->p[0] != 0 || C->p[1] != 1 || C->p[2] != 2 || C->p[3] != 4,
+            "test_spmatrix64_large: CSC pointers");
+  gsl_test (C == NULL || C->i[0] != mid || C->i[1] != mid ||
+            C->i[2] != 1 || C->i[3] != last,
+            "test_spmatrix64_large: CSC indices");
+  gsl_test (C == NULL || gsl_spmatrix64_get (C, (size_t) last, 2) != 6.0 ||
+            gsl_spmatrix64_get (C, (size_t) mid, 0) != 8.0 ||
+            gsl_spmatrix64_get (C, (size_t) mid, 1) != 4.0 ||
+            gsl_spmatrix64_get (C, (size_t) last, 1) != 0.0,
+            "test_spmatrix64_large: CSC get");
+  gsl_spmatrix64_free (C);
+
+  /* CSR: big column dimension, outer index is the row */
+  C = gsl_spmatrix64_compress_coo (3, big, 6, outer, inner, tx, GSL_SPMATRIX_CSR);
+  gsl_test (C == NULL || gsl_spmatrix64_nnz (C) != 4 ||
+            C->p[3] != 4 || C->i[3] != last ||
+            gsl_spmatrix64_get (C, 2, (size_t) last) != 6.0 ||
+            gsl_spmatrix64_get (C, 0, (size_t) mid) != 8.0,
+            "test_spmatrix64_large: CSR");
+  gsl_spmatrix64_free (C);
+
+  /* invalid input */
+  old_handler = gsl_set_error_handler_off ();
+
+  C = gsl_spmatrix64_compress_coo (big - 1, 3, 6, inner, outer, tx, GSL_SPMATRIX_CSC);
+  gsl_test (C != NULL, "test_spmatrix64_large: row index out of range");
+  gsl_spmatrix64_free (C);
+
+  outer[3] = -1;
+  C = gsl_spmatrix64_compress_coo (big, 3, 6, inner, outer, tx, GSL_SPMATRIX_CSC);
+  gsl_test (C != NULL, "test_spmatrix64_large: negative column index");
+  gsl_spmatrix64_free (C);
+
+  C = gsl_spmatrix64_compress_coo (big, 3, 0, inner, outer, tx, GSL_SPMATRIX_COO);
+  gsl_test (C != NULL, "test_spmatrix64_large: COO format");
+  gsl_spmatrix64_free (C);
+
+  gsl_set_error_handler (old_handler);
+}
+
+/* expand a SELL or BCSR matrix into a dense matrix; returns 1 if a
+   stored element lies outside the matrix and is not zero */
+static int
+test_blocked_expand (gsl_matrix * E, const gsl_spmatrix * S)
+{
+  const size_t M = S->size1;
+  const size_t N = S->size2;
+  int err = 0;
+
+  gsl_matrix_set_zero (E);
+
+  if (GSL_SPMATRIX_ISSELL (S))
+    {
+      const size_t C = S->bsize1;
+      const size_t nslice = (M + C - 1) / C;
+      size_t s, r;
+      int q;
+
+      for (s = 0; s < nslice; ++s)
+        {
+          for (q = S->p[s]; q < S->p[s + 1]; q += (int) C)
+            {
+              for (r = 0; r < C; ++r)
+                {
+                  const size_t idx = (size_t) q + r;
+
+                  if (s * C + r < M)
+                    {
+                      const size_t row = (size_t) S->p[nslice + 1 + s * C + r];
+                      double * e = gsl_matrix_ptr (E, row, (size_t) S->i[idx]);
+                      *e += S->data[idx];
+                    }
+                  else if (S->data[idx] != 0.0)
+                    err = 1;
+                }
+            }
+        }
+    }
+  else
+    {
+      const size_t rb = S->bsize1, cb = S->bsize2;
+      const size_t nbrow = (M + rb - 1) / rb;
+      size_t I, a, b;
+      int n;
+
+      for (I = 0; I < nbrow; ++I)
+        {
+          for (n = S->p[I]; n < S->p[I + 1]; ++n)
+            {
+              const size_t J = (size_t) S->i[n];
+
+              for (a = 0; a < rb; ++a)
+                {
+                  for (b = 0; b < cb; ++b)
+                    {
+                      const size_t i = I * rb + a, j = J * cb + b;
+                      const double x = S->data[(size_t) n * rb * cb + a * cb + b];
+
+                      if (i < M && j < N)
+                        *gsl_matrix_ptr (E, i, j) += x;
+                      else if (x != 0.0)
+                        err = 1;
+                    }
+                }
+            }
+        }
+    }
+
+  return err;
+}
+
+/* SELL and BCSR conversions store the same elements as CSR, and the
+   routines which do not support them reject them */
+static void
+test_blocked (const size_t M, const size_t N, const double density,
+              const gsl_rng * r)
+{
+  const size_t sigma[] = { 1, 16, 1000000 };
+  const size_t bsize[][2] = { { 1, 1 }, { 2, 2 }, { 3, 3 }, { 2, 5 } };
+  const size_t nsigma = sizeof (sigma) / sizeof (sigma[0]);
+  const size_t nbsize = sizeof (bsize) / sizeof (bsize[0]);
+  gsl_spmatrix * A = test_random (M, N, density, -10.0, 10.0, r);
+  gsl_spmatrix * B = gsl_spmatrix_compress (A, GSL_SPMATRIX_CSR);
+  gsl_spmatrix * C = gsl_spmatrix_compress (A, GSL_SPMATRIX_CSR);
+  gsl_matrix * D = gsl_matrix_alloc (M, N);
+  gsl_matrix * E = gsl_matrix_alloc (M, N);
+  size_t k;
+
+  gsl_spmatrix_sp2d (D, B);
+
+  for (k = 0; k < nsigma + nbsize; ++k)
+    {
+      gsl_error_handler_t * old_handler;
+      gsl_spmatrix * S;
+      double min, max;
+      int err;
+
+      if (k < nsigma)
+        S = gsl_spmatrix_compress_sell (A, sigma[k]);
+      else
+        S = gsl_spmatrix_compress_bcsr (B, bsize[k - nsigma][0], bsize[k - nsigma][1]);
+
+      err = test_blocked_expand (E, S);
+      gsl_test (err || !gsl_matrix_equal (D, E),
+                "test_blocked: elements M=%zu N=%zu type=%s k=%zu",
+                M, N, gsl_spmatrix_type (S), k);
+
+      old_handler = gsl_set_error_handler_off ();
+
+      status = (gsl_spmatrix_memcpy (C, S) != GSL_EINVAL) ||
+               (gsl_spmatrix_transpose (S) != GSL_EINVAL) ||
+               (gsl_spmatrix_set_zero (S) != GSL_EINVAL) ||
+               (gsl_spmatrix_minmax (S, &min, &max) != GSL_EINVAL) ||
+               (gsl_spmatrix_sp2d (E, S) != GSL_EINVAL) ||
+               (gsl_spmatrix_ptr (S, 0, 0) != NULL) ||
+               (gsl_spmatrix_compress (S, GSL_SPMATRIX_CSC) != NULL);
+      gsl_test (status, "test_blocked: rejected M=%zu N=%zu type=%s k=%zu",
+                M, N, gsl_spmatrix_type (S), k);
+
+      gsl_set_error_handler (old_handler);
+
+      gsl_test (gsl_spmatrix_nnz (S) < gsl_spmatrix_nnz (B),
+                "test_blocked: nnz M=%zu N=%zu type=%s k=%zu",
+                M, N, gsl_spmatrix_type (S), k);
+
+      gsl_spmatrix_free (S);
+    }
+
+  gsl_spmatrix_free (A);
+  gsl_spmatrix_free (B);
+  gsl_spmatrix_free (C);
+  gsl_matrix_free (D);
+  gsl_matrix_free (E);
+}
+
+/* compress per-thread triplet buffers with 1 and nthreads threads */
+static void
+test_compress_sum_threads (const size_t M, const size_t N, const size_t ntriplet,
+                           const int nthreads, const gsl_rng * r)
+{
+  const int sptypes[] = { GSL_SPMATRIX_CSC, GSL_SPMATRIX_CSR };
+  const size_t nbuf = 4;
+  const int prev = sys_thread_get_num ();
+  gsl_spmatrix * buf[4];
+  gsl_matrix * D = gsl_matrix_calloc (M, N);
+  gsl_matrix * E = gsl_matrix_alloc (M, N);
+  size_t b, k;
+
+  for (b = 0; b < nbuf; ++b)
+    {
+      gsl_matrix * T = gsl_matrix_alloc (M, N);
+
+      buf[b] = gsl_spmatrix_alloc_append (M, N, ntriplet);
+
+      /* triplets on a few rows and columns, so there are many duplicates */
+      for (k = 0; k < ntriplet; ++k)
+        {
+          size_t i = gsl_rng_uniform (r) * M;
+          size_t j = (gsl_rng_uniform (r) < 0.5) ? i % N : gsl_rng_uniform (r) * N;
+          double x = gsl_rng_uniform (r) * 2.0 - 1.0;
+
+          gsl_spmatrix_append (buf[b], i, j, x);
+        }
+
+      gsl_spmatrix_sp2d (T, buf[b]);
+      gsl_matrix_add (D, T);
+      gsl_matrix_free (T);
+    }
+
+  for (k = 0; k < 2; ++k)
+    {
+      gsl_spmatrix * A, * B;
+      size_t i, j;
+
+      sys_thread_set_num (1);
+      A = gsl_spmatrix_compress_sum (nbuf, buf, sptypes[k]);
+
+      sys_thread_set_num (nthreads);
+      B = gsl_spmatrix_compress_sum (nbuf, buf, sptypes[k]);
+
+      gsl_test (!gsl_spmatrix_equal (A, B),
+                "test_compress_sum_threads: deterministic M=%zu N=%zu nthreads=%d type=%s",
+                M, N, nthreads, gsl_spmatrix_type (B));
+
+      gsl_spmatrix_sp2d (E, B);
+
+      status = 0;
+      for (i = 0; i < M; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              double dij = gsl_matrix_get (D, i, j);
+              double eij = gsl_matrix_get (E, i, j);
+
+              if (fabs (dij - eij) > 1.0e-12 * GSL_MAX (1.0, fabs (dij)))
+                status = 1;
+            }
+        }
+
+      gsl_test (status, "test_compress_sum_threads: sum M=%zu N=%zu nthreads=%d type=%s",
+                M, N, nthreads, gsl_spmatrix_type (B));
+
+      gsl_spmatrix_free (A);
+      gsl_spmatrix_free (B);
+    }
+
+  sys_thread_set_num (prev);
+
+  for (b = 0; b < nbuf; ++b)
+    gsl_spmatrix_free (buf[b]);
+
+  gsl_matrix_free (D);
+  gsl_matrix_free (E);
+}
+
+/* SELL and BCSR matrices can only be built by compression */
+static void
+test_alloc_sptype (void)
+{
+  const int sptypes[] = { GSL_SPMATRIX_SELL, GSL_SPMATRIX_BCSR };
+  gsl_error_handler_t * old_handler = gsl_set_error_handler_off ();
+  size_t k;
+
+  for (k = 0; k < 2; ++k)
+    {
+      gsl_spmatrix * m = gsl_spmatrix_alloc_nzmax (10, 10, 20, sptypes[k]);
+
+      gsl_test (m != NULL, "test_alloc_sptype: rejected sptype=%d", sptypes[k]);
+
+      if (m != NULL)
+        gsl_spmatrix_free (m);
+    }
+
+  gsl_set_error_handler (old_handler);
+}
+
 int
 main (void)
 {
@@ -140,8 +554,15 @@ main (void)
       test_complex_all (M[i], N[i], density[i], r);
       test_complex_float_all (M[i], N[i], density[i], r);
       test_complex_long_double_all (M[i], N[i], density[i], r);
+
+      test_spmatrix64 (M[i], N[i], density[i], r);
+      test_blocked (M[i], N[i], density[i], r);
     }
 
+  test_compress_sum_threads (500, 400, 30000, 3, r);
+  test_alloc_sptype ();
+  test_spmatrix64_large ();
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary ());
@@ -663,6 +663,62 @@ FUNCTION (test, convert) (const size_t M, const size_t N, const int sptype,
   FUNCTION (gsl_matrix, free) (D);
 }
 
+/* assemble a matrix from triplets appended to several buffers, with duplicates */
+static void
+FUNCTION (test, append) (const size_t M, const size_t N, const int sptype,
+                         const double density, gsl_rng * r)
+{
+  const size_t nbuf = 3;
+  TYPE (gsl_spmatrix) * A = FUNCTION (test, random_int) (M, N, density, 1.0, 20.0, r);
+  TYPE (gsl_spmatrix) * buf[3];
+  TYPE (gsl_spmatrix) * B, * C;
+  TYPE (gsl_matrix) * DA = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * DB = FUNCTION (gsl_matrix, alloc) (M, N);
+  size_t k;
+
+  /* start with nzmax = 1 to test reallocation */
+  for (k = 0; k < nbuf; ++k)
+    buf[k] = FUNCTION (gsl_spmatrix, alloc_append) (M, N, 1);
+
+  /* split each entry x of A into x - 1 and 1, in the same or different buffers */
+  for (k = 0; k < A->nz; ++k)
+    {
+      const size_t b = k % nbuf;
+      const BASE x = A->data[k];
+
+      FUNCTION (gsl_spmatrix, append) (buf[b], A->i[k], A->p[k], x - 1);
+      FUNCTION (gsl_spmatrix, append) (buf[(k & 1) ? (b + 1) % nbuf : b], A->i[k], A->p[k], (BASE) 1);
+    }
+
+  B = FUNCTION (gsl_spmatrix, compress_sum) (nbuf, buf, sptype);
+
+  FUNCTION (gsl_spmatrix, sp2d) (DA, A);
+  FUNCTION (gsl_spmatrix, sp2d) (DB, B);
+
+  status = (B->nz != A->nz) || !FUNCTION (gsl_matrix, equal) (DA, DB);
+  gsl_test (status, NAME (gsl_spmatrix) "_compress_sum[%zu,%zu](%s)",
+            M, N, FUNCTION (gsl_spmatrix, type) (B));
+
+  /* compress a single buffer and compare with the sum of its triplets */
+  C = FUNCTION (gsl_spmatrix, compress) (buf[0], sptype);
+
+  FUNCTION (gsl_spmatrix, sp2d) (DA, buf[0]);
+  FUNCTION (gsl_spmatrix, sp2d) (DB, C);
+
+  status = !FUNCTION (gsl_matrix, equal) (DA, DB);
+  gsl_test (status, NAME (gsl_spmatrix) "_append[%zu,%zu](%s)",
+            M, N, FUNCTION (gsl_spmatrix, type) (C));
+
+  for (k = 0; k < nbuf; ++k)
+    FUNCTION (gsl_spmatrix, free) (buf[k]);
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  FUNCTION (gsl_spmatrix, free) (B);
+  FUNCTION (gsl_spmatrix, free) (C);
+  FUNCTION (gsl_matrix, free) (DA);
+  FUNCTION (gsl_matrix, free) (DB);
+}
+
 static void
 FUNCTION (test, minmax) (const size_t M, const size_t N, const int sptype,
                          const double density, gsl_rng * r)
@@ -836,6 +892,10 @@ FUNCTION (test, all) (const size_t M, const size_t N, const double density, gsl_
   FUNCTION (test, convert) (M, N, GSL_SPMATRIX_CSC, density, r);
   FUNCTION (test, convert) (M, N, GSL_SPMATRIX_CSR, density, r);
 
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_COO, density, r);
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_CSC, density, r);
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_CSR, density, r);
+
   FUNCTION (test, minmax) (M, N, GSL_SPMATRIX_COO, density, r);
   FUNCTION (test, minmax) (M, N, GSL_SPMATRIX_CSC, density, r);
   FUNCTION (test, minmax) (M, N, GSL_SPMATRIX_CSR, density, r);
@@ -0,0 +1,124 @@
+/* sys/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include "thread_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* number of threads requested, or -1 if not yet initialised from the
+   environment variable GSL_NUM_THREADS */
+static int sys_num_threads = -1;
+
+static int
+max_threads (void)
+{
+#ifdef _OPENMP
+  return omp_get_max_threads ();
+#else
+  return 1;
+#endif
+}
+
+int
+sys_thread_get_num (void)
+{
+  if (sys_num_threads < 0)
+    {
+      const char *env = getenv ("GSL_NUM_THREADS");
+      int n = (env != NULL) ? atoi (env) : 1;
+
+      /* GSL_NUM_THREADS=0 selects the OpenMP default */
+      sys_num_threads = (n > 0) ? n : max_threads ();
+    }
+
+  return sys_num_threads;
+}
+
+int
+sys_thread_set_num (const int n)
+{
+  const int prev = sys_thread_get_num ();
+
+  sys_num_threads = (n > 0) ? n : max_threads ();
+
+  return prev;
+}
+
+int
+sys_thread_count (const size_t size, const size_t min_size)
+{
+#ifdef _OPENMP
+  const int n = sys_thread_get_num ();
+
+  if (n <= 1 || size < min_size || omp_in_parallel ())
+    return 1;
+
+  return n;
+#else
+  (void) size;
+  (void) min_size;
+  return 1;
+#endif
+}
+
+size_t
+sys_thread_split (const size_t total, const size_t k, const size_t n)
+{
+  return total / n * k + total % n * k / n;
+}
+
+size_t
+sys_thread_bound (const int * p, const size_t n, const size_t target)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+
+      if ((size_t) p[mid] < target)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+size_t
+sys_thread_bound64 (const ptrdiff_t * p, const size_t n, const size_t target)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+
+      if ((size_t) p[mid] < target)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
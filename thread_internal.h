@@ -0,0 +1,50 @@
+/* thread_internal.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Thread count and work partitioning shared by the modules which are
+   threaded with OpenMP (linalg, spmatrix, spblas and cblas); not part
+   of the public interface.  The number of threads is set by
+   gsl_linalg_set_num_threads() or gsl_cblas_set_num_threads(), or
+   initialised from the environment variable GSL_NUM_THREADS.  The
+   functions are compiled into both libgsl and libgslcblas (see
+   cblas/sys_thread.c). */
+
+#ifndef __THREAD_INTERNAL_H__
+#define __THREAD_INTERNAL_H__
+
+#include <stddef.h>
+
+/* number of threads requested, and set it to n (or to the OpenMP
+   default if n <= 0), returning the previous value */
+int sys_thread_get_num (void);
+int sys_thread_set_num (const int n);
+
+/* number of threads to use for a problem of the given size, which is
+   1 below min_size, without OpenMP, or inside a parallel region */
+int sys_thread_count (const size_t size, const size_t min_size);
+
+/* k-th of n split points of [0,total], without overflow */
+size_t sys_thread_split (const size_t total, const size_t k, const size_t n);
+
+/* smallest j in [0,n] with p[j] >= target, for the non-decreasing
+   array p[0..n] */
+size_t sys_thread_bound (const int * p, const size_t n, const size_t target);
+size_t sys_thread_bound64 (const ptrdiff_t * p, const size_t n, const size_t target);
+
+#endif /* __THREAD_INTERNAL_H__ */